@@ -0,0 +1,170 @@
+#pragma once
+
+#include <chrono>
+#include <exception>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+#include "frame_encoder.hpp"
+
+namespace demo {
+
+enum class PipelineLoadMode {
+  // Create every pipeline on the calling thread before returning, as
+  // Module::get_kernel()/get_graph() do on their own.
+  kEager,
+  // Create pipelines on a background worker; handles block only when they
+  // are used before their pipeline is ready.
+  kAsync,
+  // Create each pipeline on the thread that first uses it.
+  kOnFirstUse,
+};
+
+// Recognizes `--pipelines eager|async|lazy`; defaults to async.
+inline PipelineLoadMode ParsePipelineLoadMode(int argc, char **argv) {
+  for (int i = 1; i + 1 < argc; i++) {
+    if (std::string(argv[i]) == "--pipelines") {
+      const std::string mode = argv[i + 1];
+      if (mode == "eager") {
+        return PipelineLoadMode::kEager;
+      } else if (mode == "lazy") {
+        return PipelineLoadMode::kOnFirstUse;
+      }
+    }
+  }
+  return PipelineLoadMode::kAsync;
+}
+
+inline const char *PipelineLoadModeName(PipelineLoadMode mode) {
+  switch (mode) {
+    case PipelineLoadMode::kEager:
+      return "eager";
+    case PipelineLoadMode::kAsync:
+      return "async";
+    default:
+      return "lazy";
+  }
+}
+
+// Milliseconds since the first call; the demos call it at the top of main()
+// so that later calls measure time-to-first-frame.
+inline double MillisecondsSinceStartup() {
+  static const auto begin = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(
+             std::chrono::steady_clock::now() - begin)
+      .count();
+}
+
+// Handle to something an AsyncModuleLoader is creating, e.g. the
+// `aot::Kernel *` or `std::unique_ptr<aot::CompiledGraph>` returned by the
+// module. Dereferencing waits for (or, in kOnFirstUse mode, performs) the
+// creation.
+template <typename T>
+class Lazy {
+public:
+  Lazy() = default;
+  explicit Lazy(std::shared_future<T> future) : future_(std::move(future)) {}
+
+  const T &get() const { return future_.get(); }
+  auto operator->() const { return &*get(); }
+
+  bool ready() const {
+    return future_.wait_for(std::chrono::seconds(0)) ==
+           std::future_status::ready;
+  }
+
+private:
+  std::shared_future<T> future_;
+};
+
+// Moves pipeline creation for an AOT module off the critical path.
+//
+// This is not a parallel compile: Taichi registers kernels in per-module and
+// per-runtime tables that are not thread safe, so every call into the module
+// is serialized under one mutex, and more workers would only queue on it.
+// The pool runs a single worker. What runs in parallel is the caller:
+// allocations, uploads, window and render pipeline setup proceed on the main
+// thread while the compute pipelines are built, and each handle only blocks
+// if it is used before its pipeline is ready. Request handles in the order
+// they are first needed.
+//
+// Launching on the runtime also touches those tables, and Taichi's device is
+// no more thread safe than they are, so launches, allocations and raster or
+// GGUI pipeline creation issued while handles are still pending must hold
+// Lock() (or come after Wait()). Resolve the handles they use before taking
+// it, since creating them needs the same lock. In
+// kOnFirstUse mode the loader must outlive the first use of each handle, and
+// load times measured after Wait() leave out the pipelines still deferred.
+class AsyncModuleLoader {
+public:
+  explicit AsyncModuleLoader(PipelineLoadMode mode = DefaultMode())
+      : mode_(mode) {
+    if (mode_ == PipelineLoadMode::kAsync) {
+      pool_ = std::make_unique<ThreadPool>(1);
+    }
+  }
+
+  // Blocks until all background work is done, so the module and runtime can
+  // be torn down afterwards.
+  ~AsyncModuleLoader() { Wait(); }
+
+  // Mode used by loaders constructed without one; set once from main().
+  static PipelineLoadMode &DefaultMode() {
+    static PipelineLoadMode mode = PipelineLoadMode::kAsync;
+    return mode;
+  }
+
+  PipelineLoadMode mode() const { return mode_; }
+
+  // `create` is invoked with the module lock held, e.g.
+  //   loader.Load([&] { return module->get_kernel("init"); })
+  template <typename F>
+  auto Load(F create) -> Lazy<decltype(create())> {
+    using T = decltype(create());
+    auto locked = [this, create]() mutable {
+      std::lock_guard<std::mutex> lock(module_mutex_);
+      return create();
+    };
+    if (mode_ == PipelineLoadMode::kOnFirstUse) {
+      return Lazy<T>(std::async(std::launch::deferred, locked).share());
+    }
+    auto promise = std::make_shared<std::promise<T>>();
+    Lazy<T> handle(promise->get_future().share());
+    auto task = [promise, locked]() mutable {
+      try {
+        promise->set_value(locked());
+      } catch (...) {
+        promise->set_exception(std::current_exception());
+      }
+    };
+    if (pool_) {
+      pool_->Enqueue(std::move(task));
+    } else {
+      task();
+    }
+    return handle;
+  }
+
+  // Held around launches that may overlap background creation.
+  std::unique_lock<std::mutex> Lock() {
+    return std::unique_lock<std::mutex>(module_mutex_);
+  }
+
+  // Waits for every Load() issued so far. Deferred (kOnFirstUse) handles are
+  // not forced.
+  void Wait() {
+    if (pool_) {
+      pool_->Wait();
+    }
+  }
+
+private:
+  PipelineLoadMode mode_;
+  std::mutex module_mutex_;
+  std::unique_ptr<ThreadPool> pool_{nullptr};
+};
+
+} // namespace demo
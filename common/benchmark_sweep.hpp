@@ -0,0 +1,48 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+namespace demo {
+
+// The sizes a benchmark sweep visits: `first`, `first * factor`, ... while
+// they do not exceed `last`, then `last` itself if the progression skipped
+// it, so `--batch 3` runs 1, 2 and 3.
+inline std::vector<int> SweepSizes(int first, int last, int factor = 2) {
+  std::vector<int> sizes;
+  for (int n = first; n <= last; n *= factor) {
+    sizes.push_back(n);
+  }
+  if (last >= first && sizes.back() != last) {
+    sizes.push_back(last);
+  }
+  return sizes;
+}
+
+// Mean milliseconds per call of `run`, over `num_runs` calls (at least one)
+// after one untimed warm-up call. `sync` is called after the warm-up and
+// after the last timed call, so work `run` only queues on the GPU is counted
+// in full.
+template <typename Run, typename Sync>
+double MillisecondsPerRun(int num_runs, Run run, Sync sync) {
+  num_runs = std::max(num_runs, 1);
+  run();
+  sync();
+  const auto begin = std::chrono::steady_clock::now();
+  for (int i = 0; i < num_runs; i++) {
+    run();
+  }
+  sync();
+  const std::chrono::duration<double, std::milli> elapsed =
+      std::chrono::steady_clock::now() - begin;
+  return elapsed.count() / num_runs;
+}
+
+// For a `run` that waits for its own GPU work.
+template <typename Run>
+double MillisecondsPerRun(int num_runs, Run run) {
+  return MillisecondsPerRun(num_runs, run, [] {});
+}
+
+} // namespace demo
@@ -0,0 +1,141 @@
+#pragma once
+
+// Expects GLFW, the Taichi GGUI headers (taichi::ui::vulkan::Renderer, Gui,
+// CirclesInfo) and the Taichi Vulkan headers to be included before this file.
+
+#include <cstdio>
+#include <iostream>
+#include <memory>
+
+#include "async_loader.hpp"
+#include "offscreen.hpp"
+#include "startup_profiler.hpp"
+
+namespace demo {
+
+// A 512x512 GGUI window that draws a particle simulation as circles, or with
+// `--offscreen` renders the same frames into image files without touching
+// GLFW. The window owns the Vulkan device, so a simulation created on
+// device() must be destroyed before the window.
+class CirclesWindow {
+public:
+  CirclesWindow(const char *name, const OffscreenOptions &offscreen)
+      : offscreen_options_(offscreen) {
+    // Init gl window. Offscreen runs render into the surface's own image and
+    // never touch GLFW, so they work on headless nodes.
+    if (!offscreen_options_.enabled) {
+      glfwInit();
+      glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
+      window_ = glfwCreateWindow(512, 512, "Taichi show", NULL, NULL);
+      if (window_ == NULL) {
+        std::cout << "Failed to create GLFW window" << std::endl;
+        glfwTerminate();
+      }
+    }
+
+    // Create a GGUI configuration
+    taichi::ui::AppConfig app_config;
+    app_config.name = name;
+    app_config.width = 512;
+    app_config.height = 512;
+    app_config.vsync = true;
+    app_config.show_window = false;
+    app_config.package_path = "../"; // make it flexible later
+    app_config.ti_arch = taichi::Arch::vulkan;
+
+    // Create GUI & renderer
+    ProfileScope renderer_phase("renderer init");
+    renderer_ = std::make_unique<taichi::ui::vulkan::Renderer>();
+    renderer_->init(nullptr, window_, app_config);
+    renderer_phase.End();
+
+    renderer_->set_background_color({0.6, 0.6, 0.6});
+
+    gui_ = std::make_shared<taichi::ui::vulkan::Gui>(
+        &renderer_->app_context(), &renderer_->swap_chain(), window_);
+
+    if (offscreen_options_.enabled) {
+      offscreen_ = std::make_unique<OffscreenCapture>(
+          device(), app_config.width, app_config.height, offscreen_options_);
+    }
+  }
+
+  ~CirclesWindow() {
+    offscreen_.reset();
+    gui_.reset();
+    // renderer owns the device so it must be destructed last.
+    renderer_.reset();
+  }
+
+  // The renderer's device, for the simulation to compute on.
+  taichi::lang::vulkan::VulkanDevice *device() {
+    return &renderer_->app_context().device();
+  }
+
+  // Draws the `num_particles` 2D positions (vec2 or the xy of vec3, as f32)
+  // in `pos` as circles of `radius`.
+  void SetParticles(const taichi::lang::DeviceAllocation &pos,
+                    int num_particles, float radius) {
+    f_info_.valid = true;
+    f_info_.field_type = taichi::ui::FieldType::Scalar;
+    f_info_.matrix_rows = 1;
+    f_info_.matrix_cols = 1;
+    f_info_.shape = {num_particles};
+    f_info_.field_source = taichi::ui::FieldSource::TaichiVulkan;
+    f_info_.dtype = taichi::lang::PrimitiveType::f32;
+    f_info_.snode = nullptr;
+    f_info_.dev_alloc = pos;
+
+    circles_.renderable_info.has_per_vertex_color = false;
+    circles_.renderable_info.vbo_attrs = taichi::ui::VertexAttributes::kPos;
+    circles_.renderable_info.vbo = f_info_;
+    circles_.color = {0.8, 0.4, 0.1};
+    circles_.radius = radius;
+  }
+
+  // Calls `step()` and draws a frame until the window is closed or, offscreen,
+  // until every requested frame has been written.
+  template <typename F>
+  void Run(F step) {
+    for (int frame = 0;
+         offscreen_ ? frame < offscreen_options_.num_frames
+                    : !glfwWindowShouldClose(window_);
+         frame++) {
+      step();
+
+      // Render elements
+      renderer_->circles(circles_);
+      renderer_->draw_frame(gui_.get());
+      if (offscreen_) {
+        offscreen_->Capture(renderer_->swap_chain().surface());
+      }
+      renderer_->swap_chain().surface().present_image();
+      renderer_->prepare_for_next_frame();
+      if (frame == 0) {
+        std::printf("[startup] first frame after %.1f ms (pipelines: %s)\n",
+                    MillisecondsSinceStartup(),
+                    PipelineLoadModeName(AsyncModuleLoader::DefaultMode()));
+        StartupProfiler::Get().Finish();
+      }
+
+      if (!offscreen_) {
+        glfwSwapBuffers(window_);
+        glfwPollEvents();
+      }
+    }
+    if (offscreen_) {
+      offscreen_->Finish();
+    }
+  }
+
+private:
+  std::shared_ptr<taichi::ui::vulkan::Gui> gui_{nullptr};
+  std::unique_ptr<taichi::ui::vulkan::Renderer> renderer_{nullptr};
+  GLFWwindow *window_{nullptr};
+  OffscreenOptions offscreen_options_;
+  std::unique_ptr<OffscreenCapture> offscreen_{nullptr};
+  taichi::ui::FieldInfo f_info_;
+  taichi::ui::CirclesInfo circles_;
+};
+
+} // namespace demo
@@ -0,0 +1,210 @@
+#pragma once
+
+// Expects the Taichi RHI headers (taichi::lang::Device and friends) to be
+// included before this file.
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+namespace demo {
+
+// A staging pool, plus ownership of the demo's device buffers.
+//
+// Buffers that kernels bind (ndarrays, vertex/index buffers) come from
+// Allocate(). Taichi binds them whole, from offset 0, so they cannot share a
+// VkBuffer and are not sub-allocated: each is its own device allocation,
+// tracked only so Release() frees everything in one call.
+//
+// What is pooled is the staging: uploads and other short-lived host-visible
+// data are sub-allocated from a few large staging blocks. Upload() copies into a block and queues a
+// buffer copy; Flush() submits every queued copy in one command list. Space
+// handed out since the last ResetScratch() stays valid until then, and the
+// reset itself only rewinds the block cursors, so per-frame scratch costs no
+// allocation at all in steady state.
+class DeviceArena {
+public:
+  static constexpr uint64_t kDefaultBlockSize = 4 << 20;
+  // Covers minStorageBufferOffsetAlignment and optimalBufferCopyOffset
+  // alignment on every GPU we run on.
+  static constexpr uint64_t kDefaultAlignment = 256;
+
+  struct Stats {
+    // Buffers requested from the device: Allocate() calls plus staging
+    // blocks.
+    int device_allocations{0};
+    int buffers{0};
+    int staging_blocks{0};
+    int sub_allocations{0};
+    int submits{0};
+    uint64_t buffer_bytes{0};
+    uint64_t staging_bytes{0};
+  };
+
+  explicit DeviceArena(taichi::lang::Device *device,
+                       uint64_t block_size = kDefaultBlockSize,
+                       uint64_t alignment = kDefaultAlignment)
+      : device_(device), block_size_(block_size), alignment_(alignment) {}
+
+  ~DeviceArena() { Release(); }
+
+  DeviceArena(const DeviceArena &) = delete;
+  DeviceArena &operator=(const DeviceArena &) = delete;
+
+  taichi::lang::Device *device() const { return device_; }
+
+  taichi::lang::DeviceAllocation Allocate(
+      const taichi::lang::Device::AllocParams &params) {
+    auto alloc = device_->allocate_memory(params);
+    buffers_.push_back(alloc);
+    stats_.device_allocations++;
+    stats_.buffers++;
+    stats_.buffer_bytes += params.size;
+    return alloc;
+  }
+
+  // Host-visible scratch of `size` bytes, valid until ResetScratch(). The
+  // returned pointer is mapped for the lifetime of the arena.
+  taichi::lang::DevicePtr Scratch(uint64_t size, void **mapped) {
+    const uint64_t aligned = (size + alignment_ - 1) / alignment_ * alignment_;
+    if (current_block_ >= blocks_.size() ||
+        blocks_[current_block_].cursor + aligned >
+            blocks_[current_block_].size) {
+      // Move on to the next block that can hold `size`, adding one if none
+      // is left.
+      current_block_ = current_block_ < blocks_.size() ? current_block_ + 1
+                                                       : blocks_.size();
+      while (current_block_ < blocks_.size() &&
+             blocks_[current_block_].size < aligned) {
+        current_block_++;
+      }
+      if (current_block_ == blocks_.size()) {
+        AddBlock(std::max(block_size_, aligned));
+      }
+    }
+    auto &block = blocks_[current_block_];
+    const uint64_t offset = block.cursor;
+    block.cursor += aligned;
+    stats_.sub_allocations++;
+    *mapped = block.mapped + offset;
+    return block.alloc.get_ptr(offset);
+  }
+
+  // Queues a copy of `size` bytes from `data` to `dst`; nothing reaches the
+  // device before Flush().
+  void Upload(taichi::lang::DevicePtr dst, const void *data, uint64_t size) {
+    void *mapped = nullptr;
+    auto src = Scratch(size, &mapped);
+    std::memcpy(mapped, data, size);
+    pending_copies_.push_back({dst, src, size});
+  }
+
+  void Upload(taichi::lang::DeviceAllocation dst, const void *data,
+              uint64_t size) {
+    Upload(dst.get_ptr(0), data, size);
+  }
+
+  // Records every queued copy into one command list on the compute stream,
+  // so kernels submitted afterwards see the data. With `wait` the submit is
+  // synchronous and the scratch space is recycled right away; otherwise the
+  // caller resets it once the device is idle (e.g. after the frame's
+  // synchronize()).
+  void Flush(bool wait = true) {
+    if (!pending_copies_.empty()) {
+      auto *stream = device_->get_compute_stream();
+      auto cmd_list = stream->new_command_list();
+      for (const auto &copy : pending_copies_) {
+        cmd_list->buffer_copy(copy.dst, copy.src, copy.size);
+      }
+      cmd_list->memory_barrier();
+      if (wait) {
+        stream->submit_synced(cmd_list.get());
+      } else {
+        stream->submit(cmd_list.get());
+      }
+      pending_copies_.clear();
+      stats_.submits++;
+    }
+    if (wait) {
+      ResetScratch();
+    }
+  }
+
+  // O(1) in the number of sub-allocations: only the block cursors rewind.
+  void ResetScratch() {
+    for (auto &block : blocks_) {
+      block.cursor = 0;
+    }
+    current_block_ = 0;
+  }
+
+  // Frees every buffer and staging block.
+  void Release() {
+    for (auto &block : blocks_) {
+      device_->unmap(block.alloc);
+      device_->dealloc_memory(block.alloc);
+    }
+    for (auto &alloc : buffers_) {
+      device_->dealloc_memory(alloc);
+    }
+    blocks_.clear();
+    buffers_.clear();
+    pending_copies_.clear();
+    current_block_ = 0;
+  }
+
+  const Stats &stats() const { return stats_; }
+
+  // Prints the counts this run actually made.
+  void Report(const char *name, double setup_ms) const {
+    std::printf(
+        "[arena] %s: %d device allocations (%d buffers + %d staging blocks), "
+        "%d staging sub-allocations, %d submits, %.1f KiB, setup %.1f ms\n",
+        name, stats_.device_allocations, stats_.buffers, stats_.staging_blocks,
+        stats_.sub_allocations, stats_.submits,
+        (stats_.buffer_bytes + stats_.staging_bytes) / 1024.0, setup_ms);
+  }
+
+private:
+  struct Block {
+    taichi::lang::DeviceAllocation alloc;
+    char *mapped{nullptr};
+    uint64_t size{0};
+    uint64_t cursor{0};
+  };
+
+  struct Copy {
+    taichi::lang::DevicePtr dst;
+    taichi::lang::DevicePtr src;
+    uint64_t size{0};
+  };
+
+  void AddBlock(uint64_t size) {
+    taichi::lang::Device::AllocParams params;
+    params.size = size;
+    params.host_write = true;
+    params.host_read = true;
+    params.usage = taichi::lang::AllocUsage::Storage;
+    Block block;
+    block.alloc = device_->allocate_memory(params);
+    block.mapped = reinterpret_cast<char *>(device_->map(block.alloc));
+    block.size = size;
+    blocks_.push_back(block);
+    stats_.device_allocations++;
+    stats_.staging_blocks++;
+    stats_.staging_bytes += size;
+  }
+
+  taichi::lang::Device *device_{nullptr};
+  uint64_t block_size_{kDefaultBlockSize};
+  uint64_t alignment_{kDefaultAlignment};
+  std::vector<Block> blocks_;
+  size_t current_block_{0};
+  std::vector<taichi::lang::DeviceAllocation> buffers_;
+  std::vector<Copy> pending_copies_;
+  Stats stats_;
+};
+
+} // namespace demo
@@ -0,0 +1,21 @@
+#pragma once
+
+// Expects the Taichi Vulkan headers (VulkanDevice, volk) to be included
+// before this file.
+
+namespace demo {
+
+// Whether optimally tiled images of `format` can be sampled with a linear
+// filter, which is what Taichi's texture samplers use. Vulkan requires it
+// for the 16-bit float formats but not for r32f, rg32f or rgba32f, which
+// many mobile GPUs cannot filter; sampling those there is undefined.
+inline bool HasLinearFilter(taichi::lang::vulkan::VulkanDevice *device,
+                            VkFormat format) {
+  VkFormatProperties props{};
+  vkGetPhysicalDeviceFormatProperties(device->vk_physical_device(), format,
+                                      &props);
+  return (props.optimalTilingFeatures &
+          VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT) != 0;
+}
+
+} // namespace demo
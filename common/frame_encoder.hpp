@@ -0,0 +1,286 @@
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace demo {
+
+// Fixed-size pool of worker threads draining a FIFO of tasks.
+class ThreadPool {
+public:
+  explicit ThreadPool(int num_threads) {
+    if (num_threads < 1) {
+      num_threads = 1;
+    }
+    for (int i = 0; i < num_threads; i++) {
+      workers_.emplace_back([this] { WorkerLoop(); });
+    }
+  }
+
+  ~ThreadPool() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stopping_ = true;
+    }
+    task_cv_.notify_all();
+    for (auto &w : workers_) {
+      w.join();
+    }
+  }
+
+  int num_threads() const { return int(workers_.size()); }
+
+  void Enqueue(std::function<void()> task) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      tasks_.push(std::move(task));
+      num_unfinished_++;
+    }
+    task_cv_.notify_one();
+  }
+
+  // Blocks until every task enqueued so far has finished.
+  void Wait() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    idle_cv_.wait(lock, [this] { return num_unfinished_ == 0; });
+  }
+
+private:
+  void WorkerLoop() {
+    while (true) {
+      std::function<void()> task;
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        task_cv_.wait(lock, [this] { return stopping_ || !tasks_.empty(); });
+        if (tasks_.empty()) {
+          return;
+        }
+        task = std::move(tasks_.front());
+        tasks_.pop();
+      }
+      task();
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        num_unfinished_--;
+      }
+      idle_cv_.notify_all();
+    }
+  }
+
+  std::vector<std::thread> workers_;
+  std::queue<std::function<void()>> tasks_;
+  std::mutex mutex_;
+  std::condition_variable task_cv_;
+  std::condition_variable idle_cv_;
+  int num_unfinished_{0};
+  bool stopping_{false};
+};
+
+enum class FrameFormat { kPng, kY4m };
+
+namespace detail {
+
+inline uint32_t Crc32(const uint8_t *data, size_t size, uint32_t crc = 0) {
+  static const std::vector<uint32_t> table = [] {
+    std::vector<uint32_t> t(256);
+    for (uint32_t n = 0; n < 256; n++) {
+      uint32_t c = n;
+      for (int k = 0; k < 8; k++) {
+        c = (c & 1) ? 0xedb88320u ^ (c >> 1) : c >> 1;
+      }
+      t[n] = c;
+    }
+    return t;
+  }();
+  crc = ~crc;
+  for (size_t i = 0; i < size; i++) {
+    crc = table[(crc ^ data[i]) & 0xff] ^ (crc >> 8);
+  }
+  return ~crc;
+}
+
+inline void PutBe32(std::vector<uint8_t> &out, uint32_t v) {
+  out.push_back(uint8_t(v >> 24));
+  out.push_back(uint8_t(v >> 16));
+  out.push_back(uint8_t(v >> 8));
+  out.push_back(uint8_t(v));
+}
+
+inline void PutPngChunk(std::vector<uint8_t> &out, const char type[4],
+                        const std::vector<uint8_t> &data) {
+  PutBe32(out, uint32_t(data.size()));
+  size_t type_begin = out.size();
+  out.insert(out.end(), type, type + 4);
+  out.insert(out.end(), data.begin(), data.end());
+  PutBe32(out, Crc32(out.data() + type_begin, out.size() - type_begin));
+}
+
+} // namespace detail
+
+// Encodes tightly packed RGBA8 pixels as a PNG. The zlib stream uses stored
+// (uncompressed) deflate blocks so that the demos stay free of an image
+// library dependency; the files are larger but encoding is memcpy-bound.
+inline std::vector<uint8_t> EncodePng(const uint8_t *rgba, int width,
+                                      int height) {
+  const size_t row_size = size_t(width) * 4;
+  std::vector<uint8_t> raw;
+  raw.reserve((row_size + 1) * height);
+  for (int y = 0; y < height; y++) {
+    raw.push_back(0); // filter: none
+    raw.insert(raw.end(), rgba + y * row_size, rgba + (y + 1) * row_size);
+  }
+
+  std::vector<uint8_t> zlib = {0x78, 0x01};
+  uint32_t a = 1, b = 0;
+  for (uint8_t c : raw) {
+    a = (a + c) % 65521;
+    b = (b + a) % 65521;
+  }
+  size_t offset = 0;
+  do {
+    const size_t len = std::min<size_t>(raw.size() - offset, 65535);
+    const bool last = offset + len == raw.size();
+    zlib.push_back(last ? 1 : 0);
+    zlib.push_back(uint8_t(len));
+    zlib.push_back(uint8_t(len >> 8));
+    zlib.push_back(uint8_t(~len));
+    zlib.push_back(uint8_t(~len >> 8));
+    zlib.insert(zlib.end(), raw.begin() + offset, raw.begin() + offset + len);
+    offset += len;
+  } while (offset < raw.size());
+  detail::PutBe32(zlib, (b << 16) | a);
+
+  std::vector<uint8_t> ihdr;
+  detail::PutBe32(ihdr, uint32_t(width));
+  detail::PutBe32(ihdr, uint32_t(height));
+  ihdr.insert(ihdr.end(), {8, 6, 0, 0, 0}); // 8-bit RGBA, no interlace
+
+  std::vector<uint8_t> png = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n'};
+  detail::PutPngChunk(png, "IHDR", ihdr);
+  detail::PutPngChunk(png, "IDAT", zlib);
+  detail::PutPngChunk(png, "IEND", {});
+  return png;
+}
+
+// Converts RGBA8 to planar 4:4:4 BT.601 limited-range YCbCr, the payload of
+// a single Y4M frame.
+inline std::vector<uint8_t> RgbaToYuv444(const uint8_t *rgba, int width,
+                                         int height) {
+  const size_t n = size_t(width) * height;
+  std::vector<uint8_t> yuv(n * 3);
+  for (size_t i = 0; i < n; i++) {
+    const float r = rgba[i * 4 + 0];
+    const float g = rgba[i * 4 + 1];
+    const float b = rgba[i * 4 + 2];
+    yuv[i] = uint8_t(16.5f + 0.257f * r + 0.504f * g + 0.098f * b);
+    yuv[n + i] = uint8_t(128.5f - 0.148f * r - 0.291f * g + 0.439f * b);
+    yuv[2 * n + i] = uint8_t(128.5f + 0.439f * r - 0.368f * g - 0.071f * b);
+  }
+  return yuv;
+}
+
+// Encodes RGBA8 frames on a worker pool and writes them to `output_dir`,
+// either as numbered PNGs or appended in order to a single `frames.y4m`
+// played back at `frame_rate`.
+// Submit() only blocks when `max_pending` frames are still queued, so the
+// caller keeps simulating while the backlog drains.
+class FrameEncoder {
+public:
+  FrameEncoder(std::string output_dir, FrameFormat format, int width,
+               int height, int frame_rate, int num_threads, int max_pending)
+      : output_dir_(std::move(output_dir)), format_(format), width_(width),
+        height_(height), max_pending_(max_pending), pool_(num_threads) {
+    if (format_ == FrameFormat::kY4m) {
+      y4m_ = std::fopen((output_dir_ + "/frames.y4m").c_str(), "wb");
+      if (y4m_ != nullptr) {
+        std::fprintf(y4m_, "YUV4MPEG2 W%d H%d F%d:1 Ip A1:1 C444\n", width_,
+                     height_, frame_rate);
+      }
+    }
+  }
+
+  ~FrameEncoder() {
+    Flush();
+    if (y4m_ != nullptr) {
+      std::fclose(y4m_);
+    }
+  }
+
+  void Submit(int frame_index, std::vector<uint8_t> rgba) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      drained_cv_.wait(lock, [this] { return num_pending_ < max_pending_; });
+      num_pending_++;
+    }
+    auto pixels = std::make_shared<std::vector<uint8_t>>(std::move(rgba));
+    pool_.Enqueue([this, frame_index, pixels] {
+      if (format_ == FrameFormat::kPng) {
+        auto png = EncodePng(pixels->data(), width_, height_);
+        char name[32];
+        std::snprintf(name, sizeof(name), "/frame_%05d.png", frame_index);
+        if (FILE *f = std::fopen((output_dir_ + name).c_str(), "wb")) {
+          std::fwrite(png.data(), 1, png.size(), f);
+          std::fclose(f);
+        }
+      } else {
+        WriteY4mInOrder(frame_index,
+                        RgbaToYuv444(pixels->data(), width_, height_));
+      }
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        num_pending_--;
+      }
+      drained_cv_.notify_all();
+    });
+  }
+
+  void Flush() { pool_.Wait(); }
+
+private:
+  // Y4M is a stream format, so frames finishing out of order are parked until
+  // every earlier frame has been written.
+  void WriteY4mInOrder(int frame_index, std::vector<uint8_t> yuv) {
+    std::lock_guard<std::mutex> lock(y4m_mutex_);
+    ready_y4m_frames_.emplace(frame_index, std::move(yuv));
+    while (!ready_y4m_frames_.empty() &&
+           ready_y4m_frames_.begin()->first == next_y4m_frame_) {
+      if (y4m_ != nullptr) {
+        const auto &frame = ready_y4m_frames_.begin()->second;
+        std::fputs("FRAME\n", y4m_);
+        std::fwrite(frame.data(), 1, frame.size(), y4m_);
+      }
+      ready_y4m_frames_.erase(ready_y4m_frames_.begin());
+      next_y4m_frame_++;
+    }
+  }
+
+  std::string output_dir_;
+  FrameFormat format_;
+  int width_{0};
+  int height_{0};
+  int max_pending_{1};
+
+  std::mutex mutex_;
+  std::condition_variable drained_cv_;
+  int num_pending_{0};
+
+  std::mutex y4m_mutex_;
+  FILE *y4m_{nullptr};
+  std::map<int, std::vector<uint8_t>> ready_y4m_frames_;
+  int next_y4m_frame_{0};
+
+  // Declared last so workers are joined before the state above goes away.
+  ThreadPool pool_;
+};
+
+} // namespace demo
@@ -0,0 +1,155 @@
+#pragma once
+
+// Expects the Taichi Vulkan headers (VulkanDevice, volk) to be included
+// before this file.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace demo {
+
+// Bounds how many frames the host may queue ahead of the GPU.
+//
+// EndFrame() puts a fence behind everything submitted so far on the compute
+// and graphics queues (an empty vkQueueSubmit signals its fence once all
+// earlier work on the queue has completed), and BeginFrame() waits for the
+// fence of the frame `max_frames_in_flight` back before the next frame is
+// recorded. Compute work therefore has to be flushed to its queue, e.g. with
+// the runtime's flush(), before EndFrame().
+//
+// It also measures input-to-present latency: the time from BeginFrame(),
+// where the demo samples its input, until the frame's fence is seen
+// signaled. Fences are polled once per frame, so the figure is an upper
+// bound that resolves to one frame interval.
+class FramePacer {
+public:
+  static constexpr int kDefaultFramesInFlight = 2;
+
+  FramePacer(taichi::lang::vulkan::VulkanDevice *device,
+             int max_frames_in_flight = kDefaultFramesInFlight)
+      : device_(device->vk_device()) {
+    queues_.push_back(device->compute_queue());
+    if (device->graphics_queue() != device->compute_queue()) {
+      queues_.push_back(device->graphics_queue());
+    }
+    slots_.resize(std::max(max_frames_in_flight, 1));
+    VkFenceCreateInfo create_info{};
+    create_info.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+    for (auto &slot : slots_) {
+      slot.fences.resize(queues_.size());
+      for (auto &fence : slot.fences) {
+        vkCreateFence(device_, &create_info, nullptr, &fence);
+      }
+    }
+  }
+
+  ~FramePacer() {
+    for (auto &slot : slots_) {
+      Retire(slot, /*wait=*/true);
+      for (auto fence : slot.fences) {
+        vkDestroyFence(device_, fence, nullptr);
+      }
+    }
+  }
+
+  FramePacer(const FramePacer &) = delete;
+  FramePacer &operator=(const FramePacer &) = delete;
+
+  // Recognizes `--frames-in-flight <n>`.
+  static int ParseArgs(int argc, char **argv) {
+    for (int i = 1; i + 1 < argc; i++) {
+      if (std::string(argv[i]) == "--frames-in-flight") {
+        return std::max(std::stoi(argv[i + 1]), 1);
+      }
+    }
+    return kDefaultFramesInFlight;
+  }
+
+  int max_frames_in_flight() const { return int(slots_.size()); }
+
+  // Call before sampling input and recording the frame.
+  void BeginFrame() {
+    for (auto &slot : slots_) {
+      Retire(slot, /*wait=*/false);
+    }
+    auto &slot = slots_[frame_ % slots_.size()];
+    const auto wait_begin = std::chrono::steady_clock::now();
+    Retire(slot, /*wait=*/true);
+    wait_ms_ += MillisecondsBetween(wait_begin,
+                                    std::chrono::steady_clock::now());
+    slot.input_time = std::chrono::steady_clock::now();
+  }
+
+  // Call after the frame has been presented.
+  void EndFrame() {
+    auto &slot = slots_[frame_ % slots_.size()];
+    for (size_t i = 0; i < queues_.size(); i++) {
+      vkResetFences(device_, 1, &slot.fences[i]);
+      vkQueueSubmit(queues_[i], 0, nullptr, slot.fences[i]);
+    }
+    slot.pending = true;
+    frame_++;
+  }
+
+  void Report(const char *name) const {
+    if (latencies_ms_.empty()) {
+      return;
+    }
+    auto sorted = latencies_ms_;
+    std::sort(sorted.begin(), sorted.end());
+    double sum = 0;
+    for (double ms : sorted) {
+      sum += ms;
+    }
+    std::printf("[frame pacing] %s: %d frames in flight, input-to-present "
+                "%.2f ms avg, %.2f ms p95, %.2f ms max; host waited %.2f ms "
+                "per frame\n",
+                name, max_frames_in_flight(), sum / sorted.size(),
+                sorted[sorted.size() * 95 / 100], sorted.back(),
+                wait_ms_ / frame_);
+  }
+
+private:
+  struct Slot {
+    std::vector<VkFence> fences;
+    std::chrono::steady_clock::time_point input_time;
+    bool pending{false};
+  };
+
+  static double MillisecondsBetween(std::chrono::steady_clock::time_point a,
+                                    std::chrono::steady_clock::time_point b) {
+    return std::chrono::duration<double, std::milli>(b - a).count();
+  }
+
+  void Retire(Slot &slot, bool wait) {
+    if (!slot.pending) {
+      return;
+    }
+    if (wait) {
+      vkWaitForFences(device_, uint32_t(slot.fences.size()),
+                      slot.fences.data(), VK_TRUE, UINT64_MAX);
+    } else {
+      for (auto fence : slot.fences) {
+        if (vkGetFenceStatus(device_, fence) != VK_SUCCESS) {
+          return;
+        }
+      }
+    }
+    slot.pending = false;
+    latencies_ms_.push_back(
+        MillisecondsBetween(slot.input_time, std::chrono::steady_clock::now()));
+  }
+
+  VkDevice device_{VK_NULL_HANDLE};
+  std::vector<VkQueue> queues_;
+  std::vector<Slot> slots_;
+  uint64_t frame_{0};
+  double wait_ms_{0};
+  std::vector<double> latencies_ms_;
+};
+
+} // namespace demo
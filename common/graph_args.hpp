@@ -0,0 +1,88 @@
+#pragma once
+
+// Expects the Taichi AOT headers (taichi::lang::aot::CompiledGraph, IValue) to
+// be included before this file.
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace demo {
+
+// Arguments of one or more compiled graphs, bound by name once at load time.
+//
+// Bind() returns a slot that points straight at the map entry, so per-frame
+// updates (a scalar such as a time step, or a ping-pong ndarray) are a store
+// through the slot rather than a hash lookup, and the map itself is built
+// once and never copied. CompiledGraph::run() still resolves each dispatch's
+// arguments by name internally; Run() times it so the remaining per-run CPU
+// cost can be reported.
+class GraphArgs {
+public:
+  using Slot = size_t;
+  using Map = std::unordered_map<std::string, taichi::lang::aot::IValue>;
+
+  GraphArgs() = default;
+  // Slots point into the map, so the object must stay put.
+  GraphArgs(const GraphArgs &) = delete;
+  GraphArgs &operator=(const GraphArgs &) = delete;
+
+  // Binds `name` to `value`, replacing any earlier binding, and returns its
+  // slot. Slots stay valid for the lifetime of the object.
+  Slot Bind(const std::string &name, const taichi::lang::aot::IValue &value) {
+    auto it = map_.find(name);
+    if (it != map_.end()) {
+      it->second = value;
+      for (Slot slot = 0; slot < slots_.size(); slot++) {
+        if (slots_[slot] == &it->second) {
+          return slot;
+        }
+      }
+    } else {
+      it = map_.insert({name, value}).first;
+    }
+    // References to unordered_map elements survive rehashing.
+    slots_.push_back(&it->second);
+    return slots_.size() - 1;
+  }
+
+  void Set(Slot slot, const taichi::lang::aot::IValue &value) {
+    *slots_[slot] = value;
+  }
+
+  template <typename T>
+  void SetScalar(Slot slot, T value) {
+    *slots_[slot] = taichi::lang::aot::IValue::create<T>(value);
+  }
+
+  const Map &map() const { return map_; }
+
+  void Run(taichi::lang::aot::CompiledGraph &graph) {
+    const auto begin = std::chrono::steady_clock::now();
+    graph.run(map_);
+    run_ms_ += std::chrono::duration<double, std::milli>(
+                   std::chrono::steady_clock::now() - begin)
+                   .count();
+    runs_++;
+  }
+
+  // Average host time spent inside run(), i.e. recording and submitting the
+  // graph's dispatches; GPU execution is not included.
+  double cpu_us_per_run() const { return runs_ ? run_ms_ * 1000.0 / runs_ : 0; }
+
+  void Report(const char *name) const {
+    std::printf("[graph args] %s: %zu args, %.1f us CPU per run() over %d "
+                "runs\n",
+                name, map_.size(), cpu_us_per_run(), runs_);
+  }
+
+private:
+  Map map_;
+  std::vector<taichi::lang::aot::IValue *> slots_;
+  double run_ms_{0};
+  int runs_{0};
+};
+
+} // namespace demo
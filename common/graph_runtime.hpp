@@ -0,0 +1,130 @@
+#pragma once
+
+// Expects the Taichi Vulkan and GFX runtime headers (VulkanDevice,
+// VulkanDeviceCreator, GfxRuntime, aot::Module, CompiledGraph, TI_ERROR) and
+// volk to be included before this file.
+
+#include <chrono>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "async_loader.hpp"
+#include "pipeline_cache.hpp"
+#include "startup_profiler.hpp"
+
+namespace demo {
+
+// The GFX runtime and AOT module a graph-driven simulation runs on. It either
+// borrows the renderer's device or, for headless benchmarks, owns one that
+// never touches a window or swap chain. Graphs come from LoadGraph() and are
+// created on an AsyncModuleLoader, with every pipeline going through the
+// on-disk pipeline cache.
+class GraphRuntime {
+public:
+  explicit GraphRuntime(taichi::lang::vulkan::VulkanDevice *device)
+      : device_(device) {
+    InitRuntime();
+  }
+
+  GraphRuntime() {
+    taichi::lang::vulkan::VulkanDeviceCreator::Params evd_params;
+    evd_params.api_version = VK_API_VERSION_1_2;
+    evd_params.is_for_ui = false;
+    evd_params.surface_creator = nullptr;
+    embedded_device_ =
+        std::make_unique<taichi::lang::vulkan::VulkanDeviceCreator>(evd_params);
+    device_ = static_cast<taichi::lang::vulkan::VulkanDevice *>(
+        embedded_device_->device());
+    InitRuntime();
+  }
+
+  GraphRuntime(const GraphRuntime &) = delete;
+  GraphRuntime &operator=(const GraphRuntime &) = delete;
+
+  // Loads the AOT module in `module_path`. The module is not checked in for
+  // every demo, so a missing one is reported with `generate_command`, the
+  // command that writes it.
+  void LoadModule(const std::string &module_path,
+                  const std::string &generate_command) {
+    std::error_code error;
+    if (!std::filesystem::exists(
+            std::filesystem::path(module_path) / "metadata.tcb", error)) {
+      TI_ERROR("No AOT module in {}; generate it with `{}`", module_path,
+               generate_command);
+    }
+    ProfileScope module_phase("module load");
+    load_begin_ = std::chrono::steady_clock::now();
+    module_path_ = module_path;
+    taichi::lang::gfx::AotModuleParams mod_params;
+    mod_params.module_path = module_path;
+    mod_params.runtime = runtime_.get();
+    pipeline_cache_ =
+        std::make_unique<PipelineCacheStore>(device_, mod_params.module_path);
+    pipeline_cache_->Install();
+    module_ = taichi::lang::aot::Module::load(taichi::Arch::vulkan, mod_params);
+
+    auto root_size = module_->get_root_size();
+    runtime_->add_root_buffer(root_size);
+    module_phase.End();
+
+    loader_ = std::make_unique<AsyncModuleLoader>();
+  }
+
+  Lazy<std::unique_ptr<taichi::lang::aot::CompiledGraph>> LoadGraph(
+      const std::string &name) {
+    return loader_->Load([this, name] {
+      ProfileScope phase("get_graph " + name);
+      auto graph = module_->get_graph(name);
+      if (!graph) {
+        TI_ERROR("Graph {} is not in the AOT module; regenerate it", name);
+      }
+      return graph;
+    });
+  }
+
+  // Waits for the background pipeline creation and prints the module load
+  // time under `name`.
+  void FinishLoad(const std::string &name) {
+    {
+      ProfileScope wait_phase("wait for pipelines");
+      loader_->Wait();
+    }
+    pipeline_cache_->Report(name, MillisecondsSince(load_begin_),
+                            loader_->mode() == PipelineLoadMode::kOnFirstUse);
+  }
+
+  taichi::lang::vulkan::VulkanDevice *device() const { return device_; }
+  taichi::lang::gfx::GfxRuntime *runtime() const { return runtime_.get(); }
+  taichi::lang::aot::Module *module() const { return module_.get(); }
+  // Files written next to the module, e.g. boundary.sdf, live here too.
+  const std::string &module_path() const { return module_path_; }
+  AsyncModuleLoader *loader() const { return loader_.get(); }
+
+private:
+  void InitRuntime() {
+    ProfileScope runtime_phase("runtime");
+    taichi::lang::gfx::GfxRuntime::Params params;
+    result_buffer_.resize(taichi_result_buffer_entries);
+    params.host_result_buffer = result_buffer_.data();
+    params.device = device_;
+    runtime_ =
+        std::make_unique<taichi::lang::gfx::GfxRuntime>(std::move(params));
+  }
+
+  // Declared so that the loader finishes first, then the module, runtime and
+  // device go in reverse order of creation.
+  std::unique_ptr<taichi::lang::vulkan::VulkanDeviceCreator> embedded_device_{
+      nullptr};
+  taichi::lang::vulkan::VulkanDevice *device_{nullptr};
+  std::vector<uint64_t> result_buffer_;
+  std::unique_ptr<taichi::lang::gfx::GfxRuntime> runtime_{nullptr};
+  std::unique_ptr<taichi::lang::aot::Module> module_{nullptr};
+  std::unique_ptr<PipelineCacheStore> pipeline_cache_{nullptr};
+  std::unique_ptr<AsyncModuleLoader> loader_{nullptr};
+  std::string module_path_;
+  std::chrono::steady_clock::time_point load_begin_;
+};
+
+} // namespace demo
@@ -0,0 +1,116 @@
+#pragma once
+
+// Expects the Taichi headers (taichi::lang::Ndarray, TI_ERROR) to be included
+// before this file.
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "device_arena.hpp"
+
+namespace demo {
+
+// Size in bytes of one scalar of `dtype`.
+// TODO: Cannot use data_type_size() until
+// https://github.com/taichi-dev/taichi/pull/5220.
+inline uint64_t DataTypeSize(taichi::lang::DataType dtype) {
+  auto *prim = dtype->as<taichi::lang::PrimitiveType>();
+  if (prim == nullptr) {
+    TI_ERROR("Non primitive type!");
+  }
+  using PT = taichi::lang::PrimitiveType;
+  if (prim == PT::i8 || prim == PT::u8) {
+    return 1;
+  } else if (prim == PT::f16 || prim == PT::i16 || prim == PT::u16) {
+    return 2;
+  } else if (prim == PT::f32 || prim == PT::i32 || prim == PT::u32) {
+    return 4;
+  } else if (prim == PT::f64 || prim == PT::i64 || prim == PT::u64) {
+    return 8;
+  }
+  TI_ERROR("Unsupported bit width!");
+  return 0;
+}
+
+// An Ndarray together with the device memory backing it. Memory comes either
+// straight from the device, in which case it is freed with the object, or
+// from a DeviceArena, which keeps ownership.
+class NdarrayAndMem {
+public:
+  NdarrayAndMem() = default;
+  ~NdarrayAndMem() {
+    if (owns_memory_) {
+      device_->dealloc_memory(devalloc_);
+    }
+  }
+
+  const taichi::lang::Ndarray &ndarray() const { return *ndarray_; }
+
+  taichi::lang::DeviceAllocation &devalloc() { return devalloc_; }
+
+  uint64_t size() const { return size_; }
+
+  static std::unique_ptr<NdarrayAndMem>
+  Make(taichi::lang::Device *device, taichi::lang::DataType dtype,
+       const std::vector<int> &arr_shape,
+       const std::vector<int> &element_shape = {}, bool host_read = false,
+       bool host_write = false) {
+    auto params = AllocParamsFor(dtype, arr_shape, element_shape, host_read,
+                                 host_write);
+    auto res = std::make_unique<NdarrayAndMem>();
+    res->device_ = device;
+    res->owns_memory_ = true;
+    res->size_ = params.size;
+    res->devalloc_ = device->allocate_memory(params);
+    res->ndarray_ = std::make_unique<taichi::lang::Ndarray>(
+        res->devalloc_, dtype, arr_shape, element_shape);
+    return res;
+  }
+
+  static std::unique_ptr<NdarrayAndMem>
+  Make(DeviceArena *arena, taichi::lang::DataType dtype,
+       const std::vector<int> &arr_shape,
+       const std::vector<int> &element_shape = {}, bool host_read = false,
+       bool host_write = false) {
+    auto params = AllocParamsFor(dtype, arr_shape, element_shape, host_read,
+                                 host_write);
+    auto res = std::make_unique<NdarrayAndMem>();
+    res->device_ = arena->device();
+    res->owns_memory_ = false;
+    res->size_ = params.size;
+    res->devalloc_ = arena->Allocate(params);
+    res->ndarray_ = std::make_unique<taichi::lang::Ndarray>(
+        res->devalloc_, dtype, arr_shape, element_shape);
+    return res;
+  }
+
+private:
+  static taichi::lang::Device::AllocParams
+  AllocParamsFor(taichi::lang::DataType dtype,
+                 const std::vector<int> &arr_shape,
+                 const std::vector<int> &element_shape, bool host_read,
+                 bool host_write) {
+    uint64_t alloc_size = DataTypeSize(dtype);
+    for (int s : arr_shape) {
+      alloc_size *= s;
+    }
+    for (int s : element_shape) {
+      alloc_size *= s;
+    }
+    taichi::lang::Device::AllocParams alloc_params;
+    alloc_params.host_read = host_read;
+    alloc_params.host_write = host_write;
+    alloc_params.size = alloc_size;
+    alloc_params.usage = taichi::lang::AllocUsage::Storage;
+    return alloc_params;
+  }
+
+  taichi::lang::Device *device_{nullptr};
+  std::unique_ptr<taichi::lang::Ndarray> ndarray_{nullptr};
+  taichi::lang::DeviceAllocation devalloc_;
+  uint64_t size_{0};
+  bool owns_memory_{false};
+};
+
+} // namespace demo
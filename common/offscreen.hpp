@@ -0,0 +1,171 @@
+#pragma once
+
+// Expects the Taichi Vulkan headers (VulkanDevice, volk) to be included
+// before this file.
+
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "frame_encoder.hpp"
+#include "queue_fence.hpp"
+
+namespace demo {
+
+struct OffscreenOptions {
+  bool enabled{false};
+  std::string output_dir{"frames"};
+  FrameFormat format{FrameFormat::kPng};
+  int num_frames{300};
+  // Frame rate written into the y4m header.
+  int frame_rate{60};
+  // 0 picks std::thread::hardware_concurrency().
+  int encoder_threads{0};
+  // Number of staging buffers the readback cycles through.
+  int readback_depth{3};
+
+  // Recognizes `--offscreen <dir>`, `--frames <n>`, `--format png|y4m`,
+  // `--fps <n>` and `--encoder-threads <n>`; anything else is left to the
+  // demo.
+  static OffscreenOptions Parse(int argc, char **argv) {
+    OffscreenOptions options;
+    for (int i = 1; i < argc; i++) {
+      const std::string arg = argv[i];
+      const bool has_value = i + 1 < argc;
+      if (arg == "--offscreen" && has_value) {
+        options.enabled = true;
+        options.output_dir = argv[++i];
+      } else if (arg == "--frames" && has_value) {
+        options.num_frames = std::stoi(argv[++i]);
+      } else if (arg == "--format" && has_value) {
+        options.format = std::string(argv[++i]) == "y4m" ? FrameFormat::kY4m
+                                                         : FrameFormat::kPng;
+      } else if (arg == "--fps" && has_value) {
+        options.frame_rate = std::max(1, std::stoi(argv[++i]));
+      } else if (arg == "--encoder-threads" && has_value) {
+        options.encoder_threads = std::stoi(argv[++i]);
+      }
+    }
+    return options;
+  }
+};
+
+// Copies rendered frames out of a surface and hands them to a FrameEncoder.
+// Copies are recorded into a ring of host-readable staging buffers, each
+// followed by its own fence. A slot is only waited on when the ring comes
+// back around to it, and then only for that one copy, so the GPU works
+// `readback_depth` frames ahead of the readback instead of stalling on every
+// frame.
+class OffscreenCapture {
+public:
+  OffscreenCapture(taichi::lang::vulkan::VulkanDevice *device, int width,
+                   int height, const OffscreenOptions &options)
+      : device_(device), stream_(device->get_graphics_stream()),
+        width_(width), height_(height) {
+    std::filesystem::create_directories(options.output_dir);
+    int num_threads = options.encoder_threads;
+    if (num_threads <= 0) {
+      num_threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    const int depth = std::max(1, options.readback_depth);
+    encoder_ = std::make_unique<FrameEncoder>(
+        options.output_dir, options.format, width_, height_,
+        options.frame_rate, num_threads,
+        /*max_pending=*/num_threads + depth);
+
+    taichi::lang::Device::AllocParams alloc_params;
+    alloc_params.host_write = false;
+    alloc_params.host_read = true;
+    alloc_params.size = frame_size();
+    alloc_params.usage = taichi::lang::AllocUsage::Storage;
+    staging_.resize(depth);
+    for (auto &slot : staging_) {
+      slot.buffer = device_->allocate_memory(alloc_params);
+      slot.fence = std::make_unique<QueueFence>(device_->vk_device());
+    }
+  }
+
+  ~OffscreenCapture() {
+    Finish();
+    for (auto &slot : staging_) {
+      device_->dealloc_memory(slot.buffer);
+    }
+  }
+
+  // Copies the target image of `surface` after the frame has been drawn
+  // into it, i.e. while the image is in the present layout. The encoder
+  // takes the bytes as RGBA8, so any other surface format is an error.
+  void Capture(taichi::lang::Surface &surface) {
+    using namespace taichi::lang;
+    const BufferFormat format = surface.image_format();
+    if (format != BufferFormat::rgba8 && format != BufferFormat::rgba8srgb) {
+      TI_ERROR("Offscreen capture needs an rgba8 surface, got format {}",
+               int(format));
+    }
+    DeviceAllocation image = surface.get_target_image();
+    auto &slot = staging_[next_frame_ % staging_.size()];
+    Retire(slot);
+    slot.frame = next_frame_++;
+
+    BufferImageCopyParams params;
+    params.image_extent.x = width_;
+    params.image_extent.y = height_;
+    auto cmd_list = stream_->new_command_list();
+    cmd_list->image_transition(image, ImageLayout::present_src,
+                               ImageLayout::transfer_src);
+    cmd_list->image_to_buffer(slot.buffer.get_ptr(0), image,
+                              ImageLayout::transfer_src, params);
+    cmd_list->image_transition(image, ImageLayout::transfer_src,
+                               ImageLayout::present_src);
+    stream_->submit(cmd_list.get());
+    slot.fence->Signal(device_->graphics_queue());
+  }
+
+  // Reads back every outstanding frame and waits for the encoder to finish.
+  void Finish() {
+    // Oldest first, so the encoder sees frames in order.
+    for (size_t i = 0; i < staging_.size(); i++) {
+      Retire(staging_[(next_frame_ + i) % staging_.size()]);
+    }
+    encoder_->Flush();
+  }
+
+  int num_captured() const { return next_frame_; }
+
+private:
+  struct StagingSlot {
+    taichi::lang::DeviceAllocation buffer;
+    std::unique_ptr<QueueFence> fence;
+    // Frame whose copy the slot holds, or -1 once it has been read.
+    int frame{-1};
+  };
+
+  size_t frame_size() const { return size_t(width_) * height_ * 4; }
+
+  // Waits for the copy into `slot`, if any, and hands it to the encoder.
+  void Retire(StagingSlot &slot) {
+    if (slot.frame < 0) {
+      return;
+    }
+    slot.fence->Wait();
+    std::vector<uint8_t> pixels(frame_size());
+    const auto *mapped =
+        reinterpret_cast<const uint8_t *>(device_->map(slot.buffer));
+    std::memcpy(pixels.data(), mapped, frame_size());
+    device_->unmap(slot.buffer);
+    encoder_->Submit(slot.frame, std::move(pixels));
+    slot.frame = -1;
+  }
+
+  taichi::lang::vulkan::VulkanDevice *device_{nullptr};
+  taichi::lang::Stream *stream_{nullptr};
+  int width_{0};
+  int height_{0};
+  std::vector<StagingSlot> staging_;
+  int next_frame_{0};
+  std::unique_ptr<FrameEncoder> encoder_{nullptr};
+};
+
+} // namespace demo
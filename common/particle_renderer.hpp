@@ -0,0 +1,268 @@
+#pragma once
+
+// Expects the Taichi Vulkan headers (VulkanDevice, VulkanCommandList, volk),
+// taichi::ui::read_file, the Taichi AOT headers and glm to be included before
+// this file.
+
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "graph_args.hpp"
+#include "ndarray_and_mem.hpp"
+#include "queue_fence.hpp"
+
+namespace demo {
+
+// Draws particles as depth-correct sphere impostors: one camera-facing quad
+// per particle, carved into a sphere and given per-pixel depth by the
+// fragment shader.
+//
+// The instance list comes from the GPU. A culling graph (`cull` in sph.py)
+// writes the ids of particles inside the view frustum to `visible` and
+// their count into `draw_args`; Draw() copies `draw_args` into an indirect
+// buffer and issues one vkCmdDrawIndirect. The host never reads the count,
+// and vertex work scales with the visible particles rather than all of
+// them. Taichi allocations cannot carry the indirect usage flag, hence the
+// copy into a buffer created here.
+//
+// Nothing waits on the host in between: the culling graph only has to be
+// flushed to the compute queue, and where that is also the graphics queue
+// (as on every desktop GPU we run on) submission order plus a barrier
+// orders the draw after it. Only on devices with a separate graphics queue
+// does Draw() wait, for the compute queue through a fence before it submits
+// and for its own submit after.
+class ParticleImpostorRenderer {
+public:
+  ParticleImpostorRenderer(taichi::lang::vulkan::VulkanDevice *device,
+                           const std::string &shader_dir, int width,
+                           int height, int max_particles, float radius)
+      : device_(device), width_(width), height_(height), radius_(radius) {
+    using namespace taichi::lang;
+    for (const char *stage : {"vert", "frag"}) {
+      const std::string spv = shader_dir + "/impostor." + stage + ".spv";
+      if (!std::filesystem::exists(spv)) {
+        TI_ERROR("{} is missing; it is built from impostor.{} by the sph "
+                 "CMake project when glslc is found, or with `make -C "
+                 "sph/shaders/render`",
+                 spv, stage);
+      }
+    }
+    auto vert_code = taichi::ui::read_file(shader_dir + "/impostor.vert.spv");
+    auto frag_code = taichi::ui::read_file(shader_dir + "/impostor.frag.spv");
+    std::vector<PipelineSourceDesc> source(2);
+    source[0] = {PipelineSourceType::spirv_binary, frag_code.data(),
+                 frag_code.size(), PipelineStageType::fragment};
+    source[1] = {PipelineSourceType::spirv_binary, vert_code.data(),
+                 vert_code.size(), PipelineStageType::vertex};
+    RasterParams raster_params;
+    raster_params.prim_topology = TopologyType::Triangles;
+    raster_params.depth_test = true;
+    raster_params.depth_write = true;
+    // Vertices are generated from gl_VertexIndex; there is no vertex buffer.
+    pipeline_ = device_->create_raster_pipeline(source, raster_params, {}, {});
+
+    ImageParams image_params;
+    image_params.dimension = ImageDimension::d2D;
+    image_params.format = BufferFormat::depth32f;
+    image_params.initial_layout = ImageLayout::undefined;
+    image_params.x = width_;
+    image_params.y = height_;
+    image_params.export_sharing = false;
+    depth_ = device_->create_image(image_params);
+
+    constants_ = device_->allocate_memory(
+        {sizeof(Constants), true, false, false, AllocUsage::Uniform});
+
+    frustum_ = NdarrayAndMem::Make(device_, PrimitiveType::f32, {6}, {4},
+                                   /*host_read=*/false, /*host_write=*/true);
+    // [vertex count, instance count, first vertex, first instance]
+    draw_args_ = NdarrayAndMem::Make(device_, PrimitiveType::i32, {4}, {},
+                                     /*host_read=*/true);
+    visible_ = NdarrayAndMem::Make(device_, PrimitiveType::i32,
+                                   {max_particles});
+    CreateIndirectBuffer();
+    if (device_->compute_queue() != device_->graphics_queue()) {
+      cull_fence_ = std::make_unique<QueueFence>(device_->vk_device());
+    }
+  }
+
+  ~ParticleImpostorRenderer() {
+    vkDestroyBuffer(device_->vk_device(), indirect_buffer_, nullptr);
+    vkFreeMemory(device_->vk_device(), indirect_memory_, nullptr);
+    device_->dealloc_memory(constants_);
+    device_->destroy_image(depth_);
+  }
+
+  ParticleImpostorRenderer(const ParticleImpostorRenderer &) = delete;
+  ParticleImpostorRenderer &operator=(const ParticleImpostorRenderer &) =
+      delete;
+
+  // Binds the culling graph's `frustum`, `draw_args` and `visible`.
+  void Bind(GraphArgs &args) const {
+    using taichi::lang::aot::IValue;
+    args.Bind("frustum", IValue::create(frustum_->ndarray()));
+    args.Bind("draw_args", IValue::create(draw_args_->ndarray()));
+    args.Bind("visible", IValue::create(visible_->ndarray()));
+  }
+
+  // Updates the shader constants and the frustum planes the culling graph
+  // tests against. Call before running the culling graph.
+  void SetCamera(const glm::mat4 &view, const glm::mat4 &proj) {
+    auto *constants = static_cast<Constants *>(device_->map(constants_));
+    constants->proj = proj;
+    constants->view = view;
+    constants->radius = radius_;
+    device_->unmap(constants_);
+
+    // Gribb-Hartmann: each plane is the last row of the view-projection
+    // matrix plus or minus one of the others, with inward normals.
+    const glm::mat4 m = proj * view;
+    auto row = [&](int i) {
+      return glm::vec4(m[0][i], m[1][i], m[2][i], m[3][i]);
+    };
+    glm::vec4 planes[6] = {row(3) + row(0), row(3) - row(0),
+                           row(3) + row(1), row(3) - row(1),
+                           row(3) + row(2), row(3) - row(2)};
+    for (auto &plane : planes) {
+      plane /= glm::length(glm::vec3(plane));
+    }
+    void *mapped = device_->map(frustum_->devalloc());
+    std::memcpy(mapped, planes, sizeof(planes));
+    device_->unmap(frustum_->devalloc());
+  }
+
+  // Clears `target` to `background` and draws the particles of `pos` that
+  // the last culling run kept. The culling graph must have been flushed to
+  // the compute queue (the runtime's flush()), not necessarily synchronized.
+  // Returns without waiting for the draw; pass the returned semaphore to
+  // present_image().
+  taichi::lang::StreamSemaphore Draw(taichi::lang::DeviceAllocation target,
+                                     const taichi::lang::DeviceAllocation &pos,
+                                     const glm::vec3 &background) {
+    using namespace taichi::lang;
+    if (cull_fence_) {
+      cull_fence_->Signal(device_->compute_queue());
+      cull_fence_->Wait();
+    }
+    auto stream = device_->get_graphics_stream();
+    auto cmd_list = stream->new_command_list();
+    VkCommandBuffer cmd =
+        static_cast<vulkan::VulkanCommandList *>(cmd_list.get())
+            ->vk_command_buffer()
+            ->buffer;
+
+    // Makes the culling pass's writes to draw_args and visible, and the
+    // simulation's to pos, visible to the copy and the vertex shader.
+    cmd_list->memory_barrier();
+
+    VkBufferCopy copy{0, 0, 4 * sizeof(int32_t)};
+    vkCmdCopyBuffer(cmd, device_->get_vkbuffer(draw_args_->devalloc())->buffer,
+                    indirect_buffer_, 1, &copy);
+    VkBufferMemoryBarrier barrier{};
+    barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+    barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_INDIRECT_COMMAND_READ_BIT;
+    barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.buffer = indirect_buffer_;
+    barrier.size = VK_WHOLE_SIZE;
+    vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                         VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT, 0, 0, nullptr, 1,
+                         &barrier, 0, nullptr);
+
+    bool color_clear = true;
+    std::vector<float> clear_colors = {background.x, background.y,
+                                       background.z, 1};
+    cmd_list->begin_renderpass(
+        /*xmin=*/0, /*ymin=*/0, /*xmax=*/width_, /*ymax=*/height_,
+        /*num_color_attachments=*/1, &target, &color_clear, &clear_colors,
+        &depth_, /*depth_clear=*/true);
+    auto resource_binder = pipeline_->resource_binder();
+    resource_binder->buffer(0, 0, constants_.get_ptr(0));
+    resource_binder->rw_buffer(0, 1, pos);
+    resource_binder->rw_buffer(0, 2, visible_->devalloc());
+    cmd_list->bind_pipeline(pipeline_.get());
+    cmd_list->bind_resources(resource_binder);
+    vkCmdDrawIndirect(cmd, indirect_buffer_, 0, 1, 4 * sizeof(int32_t));
+    cmd_list->end_renderpass();
+    // The next frame's kernels overwrite what this draw reads.
+    cmd_list->memory_barrier();
+    if (cull_fence_) {
+      // On another queue they are not ordered after the barrier.
+      return stream->submit_synced(cmd_list.get());
+    }
+    return stream->submit(cmd_list.get());
+  }
+
+  // Instances kept by the last culling run; only meaningful once the
+  // runtime has been synchronized.
+  int visible_count() {
+    int32_t args[4];
+    void *mapped = device_->map(draw_args_->devalloc());
+    std::memcpy(args, mapped, sizeof(args));
+    device_->unmap(draw_args_->devalloc());
+    return args[1];
+  }
+
+private:
+  // Matches the uniform block in impostor.vert and impostor.frag.
+  struct Constants {
+    glm::mat4 proj;
+    glm::mat4 view;
+    float radius;
+  };
+
+  void CreateIndirectBuffer() {
+    VkBufferCreateInfo buffer_info{};
+    buffer_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    buffer_info.size = 4 * sizeof(int32_t);
+    buffer_info.usage =
+        VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    buffer_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    vkCreateBuffer(device_->vk_device(), &buffer_info, nullptr,
+                   &indirect_buffer_);
+
+    VkMemoryRequirements requirements;
+    vkGetBufferMemoryRequirements(device_->vk_device(), indirect_buffer_,
+                                  &requirements);
+    VkPhysicalDeviceMemoryProperties properties;
+    vkGetPhysicalDeviceMemoryProperties(device_->vk_physical_device(),
+                                        &properties);
+    uint32_t type = 0;
+    while (type < properties.memoryTypeCount &&
+           !((requirements.memoryTypeBits & (1u << type)) &&
+             (properties.memoryTypes[type].propertyFlags &
+              VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT))) {
+      type++;
+    }
+    TI_ASSERT(type < properties.memoryTypeCount);
+    VkMemoryAllocateInfo alloc_info{};
+    alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    alloc_info.allocationSize = requirements.size;
+    alloc_info.memoryTypeIndex = type;
+    vkAllocateMemory(device_->vk_device(), &alloc_info, nullptr,
+                     &indirect_memory_);
+    vkBindBufferMemory(device_->vk_device(), indirect_buffer_,
+                       indirect_memory_, 0);
+  }
+
+  taichi::lang::vulkan::VulkanDevice *device_{nullptr};
+  int width_{0};
+  int height_{0};
+  float radius_{0};
+  std::unique_ptr<taichi::lang::Pipeline> pipeline_{nullptr};
+  taichi::lang::DeviceAllocation depth_;
+  taichi::lang::DeviceAllocation constants_;
+  std::unique_ptr<NdarrayAndMem> frustum_{nullptr};
+  std::unique_ptr<NdarrayAndMem> draw_args_{nullptr};
+  std::unique_ptr<NdarrayAndMem> visible_{nullptr};
+  // Only with separate compute and graphics queues.
+  std::unique_ptr<QueueFence> cull_fence_{nullptr};
+  VkBuffer indirect_buffer_{VK_NULL_HANDLE};
+  VkDeviceMemory indirect_memory_{VK_NULL_HANDLE};
+};
+
+} // namespace demo
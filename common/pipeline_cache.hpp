@@ -0,0 +1,334 @@
+#pragma once
+
+// Expects the Taichi Vulkan headers (VulkanDevice, volk) to be included
+// before this file.
+
+#include <dlfcn.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace demo {
+
+namespace detail {
+
+inline VkPipelineCache &ActivePipelineCache() {
+  static VkPipelineCache cache = VK_NULL_HANDLE;
+  return cache;
+}
+
+// Pipelines created through the trampolines below while a store was
+// installed.
+inline uint64_t &InterceptedPipelines() {
+  static uint64_t count = 0;
+  return count;
+}
+
+inline PFN_vkCreateComputePipelines &RealCreateComputePipelines() {
+  static PFN_vkCreateComputePipelines fn = nullptr;
+  return fn;
+}
+
+inline PFN_vkCreateGraphicsPipelines &RealCreateGraphicsPipelines() {
+  static PFN_vkCreateGraphicsPipelines fn = nullptr;
+  return fn;
+}
+
+// The volk entry point `name` as Taichi itself calls it. volk keeps its
+// entry points in global variables; when libtaichi_export_core binds its own
+// references locally (-Bsymbolic), the binary's copy-relocated variable and
+// the library's are two different slots, and only the library's reaches
+// Taichi's pipelines. Null when the library is not loaded or does not export
+// the symbol, or when it is the slot `own` already is.
+template <typename Fn>
+Fn *TaichiVolkSlot(const char *name, Fn *own) {
+  void *lib = dlopen("libtaichi_export_core.so", RTLD_LAZY | RTLD_NOLOAD);
+  if (lib == nullptr) {
+    return nullptr;
+  }
+  auto *slot = reinterpret_cast<Fn *>(dlsym(lib, name));
+  dlclose(lib);
+  return slot == own ? nullptr : slot;
+}
+
+inline VKAPI_ATTR VkResult VKAPI_CALL CreateComputePipelinesWithCache(
+    VkDevice device, VkPipelineCache cache, uint32_t count,
+    const VkComputePipelineCreateInfo *infos,
+    const VkAllocationCallbacks *allocator, VkPipeline *pipelines) {
+  if (cache == VK_NULL_HANDLE) {
+    cache = ActivePipelineCache();
+  }
+  InterceptedPipelines() += count;
+  return RealCreateComputePipelines()(device, cache, count, infos, allocator,
+                                      pipelines);
+}
+
+inline VKAPI_ATTR VkResult VKAPI_CALL CreateGraphicsPipelinesWithCache(
+    VkDevice device, VkPipelineCache cache, uint32_t count,
+    const VkGraphicsPipelineCreateInfo *infos,
+    const VkAllocationCallbacks *allocator, VkPipeline *pipelines) {
+  if (cache == VK_NULL_HANDLE) {
+    cache = ActivePipelineCache();
+  }
+  InterceptedPipelines() += count;
+  return RealCreateGraphicsPipelines()(device, cache, count, infos, allocator,
+                                       pipelines);
+}
+
+inline uint64_t Fnv1a(const char *data, size_t size,
+                      uint64_t hash = 0xcbf29ce484222325ull) {
+  for (size_t i = 0; i < size; i++) {
+    hash ^= uint8_t(data[i]);
+    hash *= 0x100000001b3ull;
+  }
+  return hash;
+}
+
+inline std::vector<char> ReadFile(const std::filesystem::path &path) {
+  std::ifstream in(path, std::ios::binary);
+  return std::vector<char>(std::istreambuf_iterator<char>(in),
+                           std::istreambuf_iterator<char>());
+}
+
+} // namespace detail
+
+// On-disk VkPipelineCache for an AOT module.
+//
+// The cache file is keyed by the device (vendor/device ID, driver version and
+// pipelineCacheUUID) and by a hash of every shader and metadata file in the
+// module directory, so a driver update or a regenerated module starts cold
+// instead of feeding the driver a stale blob. The key is deliberately coarse:
+// inside the blob the driver already keys each pipeline by its own SPIR-V, but
+// a per-module file is what keeps a kernel that was regenerated away from
+// lingering in it. The price is that changing one kernel recompiles them all
+// on the next launch.
+//
+// Taichi creates its pipelines without a VkPipelineCache, and neither the
+// device creator's nor the runtime's params take one, so Install() points
+// volk's vkCreate*Pipelines entries at trampolines that substitute ours while
+// the store is alive: this binary's entries, and libtaichi_export_core's own
+// when it keeps separate ones (see TaichiVolkSlot). The store counts the
+// pipelines that actually went through it: if none did, e.g. because the
+// library does not export its volk entries, Report() says the cache is not in
+// effect and nothing is saved. Construct it before Module::load() and keep it
+// around until every pipeline has been created; the cache is written back on
+// destruction.
+class PipelineCacheStore {
+public:
+  PipelineCacheStore(taichi::lang::vulkan::VulkanDevice *device,
+                     const std::string &module_path,
+                     const std::string &cache_dir = "")
+      : device_(device->vk_device()) {
+    VkPhysicalDeviceProperties props;
+    vkGetPhysicalDeviceProperties(device->vk_physical_device(), &props);
+
+    uint64_t shader_hash = detail::Fnv1a(nullptr, 0);
+    std::vector<std::filesystem::path> files;
+    std::error_code error;
+    // A missing module directory is left for Module::load() to report; the
+    // key then covers the device alone.
+    for (std::filesystem::directory_iterator it(module_path, error), end;
+         !error && it != end; it.increment(error)) {
+      const auto ext = it->path().extension();
+      if (it->is_regular_file(error) &&
+          (ext == ".spv" || ext == ".json" || ext == ".tcb")) {
+        files.push_back(it->path());
+      }
+    }
+    std::sort(files.begin(), files.end());
+    for (const auto &file : files) {
+      const auto name = file.filename().string();
+      const auto data = detail::ReadFile(file);
+      shader_hash = detail::Fnv1a(name.data(), name.size(), shader_hash);
+      shader_hash = detail::Fnv1a(data.data(), data.size(), shader_hash);
+    }
+
+    char key[128];
+    int n = std::snprintf(key, sizeof(key), "%04x-%04x-%08x-",
+                          props.vendorID, props.deviceID,
+                          props.driverVersion);
+    for (int i = 0; i < VK_UUID_SIZE; i++) {
+      n += std::snprintf(key + n, sizeof(key) - n, "%02x",
+                         props.pipelineCacheUUID[i]);
+    }
+    std::snprintf(key + n, sizeof(key) - n, "-%016llx",
+                  (unsigned long long)shader_hash);
+
+    const std::filesystem::path dir =
+        cache_dir.empty() ? DefaultDir() : std::filesystem::path(cache_dir);
+    std::filesystem::create_directories(dir, error);
+    blob_path_ = dir / (std::string(key) + ".bin");
+    stats_path_ = dir / (std::string(key) + ".txt");
+  }
+
+  ~PipelineCacheStore() {
+    Save();
+    Uninstall();
+    if (cache_ != VK_NULL_HANDLE) {
+      vkDestroyPipelineCache(device_, cache_, nullptr);
+    }
+  }
+
+  // Creates the VkPipelineCache, seeded from disk when a matching blob
+  // exists, and routes pipeline creation through it.
+  void Install() {
+    std::error_code error;
+    const auto blob = std::filesystem::exists(blob_path_, error)
+                          ? detail::ReadFile(blob_path_)
+                          : std::vector<char>();
+    VkPipelineCacheCreateInfo info{};
+    info.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    info.initialDataSize = blob.size();
+    info.pInitialData = blob.empty() ? nullptr : blob.data();
+    if (vkCreatePipelineCache(device_, &info, nullptr, &cache_) !=
+        VK_SUCCESS) {
+      // A blob the driver rejects is as good as none.
+      info.initialDataSize = 0;
+      info.pInitialData = nullptr;
+      vkCreatePipelineCache(device_, &info, nullptr, &cache_);
+    }
+    warm_ = !blob.empty();
+
+    intercepted_before_ = detail::InterceptedPipelines();
+    detail::ActivePipelineCache() = cache_;
+    detail::RealCreateComputePipelines() = vkCreateComputePipelines;
+    detail::RealCreateGraphicsPipelines() = vkCreateGraphicsPipelines;
+    taichi_compute_slot_ = detail::TaichiVolkSlot(
+        "vkCreateComputePipelines", &vkCreateComputePipelines);
+    taichi_graphics_slot_ = detail::TaichiVolkSlot(
+        "vkCreateGraphicsPipelines", &vkCreateGraphicsPipelines);
+    vkCreateComputePipelines = detail::CreateComputePipelinesWithCache;
+    vkCreateGraphicsPipelines = detail::CreateGraphicsPipelinesWithCache;
+    if (taichi_compute_slot_ != nullptr) {
+      *taichi_compute_slot_ = detail::CreateComputePipelinesWithCache;
+    }
+    if (taichi_graphics_slot_ != nullptr) {
+      *taichi_graphics_slot_ = detail::CreateGraphicsPipelinesWithCache;
+    }
+    installed_ = true;
+  }
+
+  void Save() {
+    if (cache_ == VK_NULL_HANDLE || !effective()) {
+      return;
+    }
+    size_t size = 0;
+    vkGetPipelineCacheData(device_, cache_, &size, nullptr);
+    std::vector<char> data(size);
+    if (size == 0 ||
+        vkGetPipelineCacheData(device_, cache_, &size, data.data()) !=
+            VK_SUCCESS) {
+      return;
+    }
+    std::ofstream(blob_path_, std::ios::binary).write(data.data(), size);
+  }
+
+  bool warm() const { return warm_; }
+
+  // Whether any pipeline has been created through the cache so far.
+  bool effective() const {
+    return detail::InterceptedPipelines() > intercepted_before_;
+  }
+
+  // Prints how long the module took to load and, once both have been seen,
+  // the cold (first run) and warm load times for this device/module pair.
+  // With `deferred` set, pipelines are still created on first use (lazy
+  // loading), so `load_ms` leaves them out; it is labelled as such and not
+  // recorded as a cold or warm time.
+  void Report(const std::string &name, double load_ms,
+              bool deferred = false) {
+    if (!effective()) {
+      std::printf("[pipeline cache] %s: not in effect, no pipeline was "
+                  "created through it (libtaichi_export_core does not export "
+                  "its Vulkan entry points, or creates pipelines later), "
+                  "load %.1f ms\n",
+                  name.c_str(), load_ms);
+      return;
+    }
+    if (deferred) {
+      std::printf("[pipeline cache] %s: %s load %.1f ms, excluding pipelines "
+                  "deferred to first use\n",
+                  name.c_str(), warm_ ? "warm" : "cold", load_ms);
+      return;
+    }
+    double cold_ms = -1;
+    double warm_ms = -1;
+    if (std::ifstream in{stats_path_}) {
+      in >> cold_ms >> warm_ms;
+    }
+    (warm_ ? warm_ms : cold_ms) = load_ms;
+    std::ofstream(stats_path_) << cold_ms << " " << warm_ms << "\n";
+
+    std::printf("[pipeline cache] %s: %s load %.1f ms", name.c_str(),
+                warm_ ? "warm" : "cold", load_ms);
+    if (cold_ms > 0 && warm_ms > 0) {
+      std::printf(" (cold %.1f ms, warm %.1f ms, %.1fx)", cold_ms, warm_ms,
+                  cold_ms / warm_ms);
+    }
+    std::printf(", cache %s\n", blob_path_.string().c_str());
+  }
+
+private:
+  static std::filesystem::path DefaultDir() {
+    if (const char *dir = std::getenv("TI_AOT_DEMO_CACHE_DIR")) {
+      return dir;
+    }
+    if (const char *xdg = std::getenv("XDG_CACHE_HOME")) {
+      return std::filesystem::path(xdg) / "taichi-aot-demo";
+    }
+    if (const char *home = std::getenv("HOME")) {
+      return std::filesystem::path(home) / ".cache" / "taichi-aot-demo";
+    }
+    return "pipeline_cache";
+  }
+
+  void Uninstall() {
+    if (!installed_) {
+      return;
+    }
+    if (vkCreateComputePipelines == detail::CreateComputePipelinesWithCache) {
+      vkCreateComputePipelines = detail::RealCreateComputePipelines();
+    }
+    if (vkCreateGraphicsPipelines == detail::CreateGraphicsPipelinesWithCache) {
+      vkCreateGraphicsPipelines = detail::RealCreateGraphicsPipelines();
+    }
+    if (taichi_compute_slot_ != nullptr &&
+        *taichi_compute_slot_ == detail::CreateComputePipelinesWithCache) {
+      *taichi_compute_slot_ = detail::RealCreateComputePipelines();
+    }
+    if (taichi_graphics_slot_ != nullptr &&
+        *taichi_graphics_slot_ == detail::CreateGraphicsPipelinesWithCache) {
+      *taichi_graphics_slot_ = detail::RealCreateGraphicsPipelines();
+    }
+    detail::ActivePipelineCache() = VK_NULL_HANDLE;
+    installed_ = false;
+  }
+
+  VkDevice device_{VK_NULL_HANDLE};
+  VkPipelineCache cache_{VK_NULL_HANDLE};
+  std::filesystem::path blob_path_;
+  std::filesystem::path stats_path_;
+  bool warm_{false};
+  bool installed_{false};
+  uint64_t intercepted_before_{0};
+  PFN_vkCreateComputePipelines *taichi_compute_slot_{nullptr};
+  PFN_vkCreateGraphicsPipelines *taichi_graphics_slot_{nullptr};
+};
+
+// Wall-clock milliseconds since `begin`.
+inline double MillisecondsSince(std::chrono::steady_clock::time_point begin) {
+  return std::chrono::duration<double, std::milli>(
+             std::chrono::steady_clock::now() - begin)
+      .count();
+}
+
+} // namespace demo
@@ -0,0 +1,61 @@
+#pragma once
+
+// Expects the Taichi Vulkan headers (VulkanDevice, volk) to be included
+// before this file.
+
+#include <cstdint>
+
+namespace demo {
+
+// A fence behind everything submitted to one queue so far. Signal() makes an
+// empty vkQueueSubmit, which signals the fence once all earlier work on the
+// queue has completed, so the host can wait for one batch of its own work
+// (e.g. a readback copy) instead of draining the whole device with
+// command_sync() or synchronize(). Work recorded by the Taichi runtime has to
+// be flushed to the queue first.
+class QueueFence {
+public:
+  explicit QueueFence(VkDevice device) : device_(device) {
+    VkFenceCreateInfo create_info{};
+    create_info.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+    vkCreateFence(device_, &create_info, nullptr, &fence_);
+  }
+
+  ~QueueFence() {
+    Wait();
+    vkDestroyFence(device_, fence_, nullptr);
+  }
+
+  QueueFence(const QueueFence &) = delete;
+  QueueFence &operator=(const QueueFence &) = delete;
+
+  void Signal(VkQueue queue) {
+    vkResetFences(device_, 1, &fence_);
+    vkQueueSubmit(queue, 0, nullptr, fence_);
+    pending_ = true;
+  }
+
+  bool pending() const { return pending_; }
+
+  // Whether the work before the last Signal() has completed; never blocks.
+  bool Ready() {
+    if (pending_ && vkGetFenceStatus(device_, fence_) == VK_SUCCESS) {
+      pending_ = false;
+    }
+    return !pending_;
+  }
+
+  void Wait() {
+    if (pending_) {
+      vkWaitForFences(device_, 1, &fence_, VK_TRUE, UINT64_MAX);
+      pending_ = false;
+    }
+  }
+
+private:
+  VkDevice device_{VK_NULL_HANDLE};
+  VkFence fence_{VK_NULL_HANDLE};
+  bool pending_{false};
+};
+
+} // namespace demo
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <utility>
+#include <vector>
+
+namespace demo {
+
+// Picks the simulation resolution that keeps the measured frame time near a
+// target.
+//
+// Levels are ordered from cheapest to most expensive, each with a cost
+// relative to the others (its cell count, say). The controller smooths the
+// frame times it is fed, drops a level when the average overshoots the
+// target by more than kHighWater, and climbs one only when the average
+// scaled by the next level's relative cost would still leave kLowWater
+// headroom. The gap between the two keeps it from oscillating between
+// neighbouring levels. After a change the first kSettleFrames frames are
+// ignored, since they pay for reallocation and cold caches, and the next
+// kMinSamples frames only build up the average: one slow frame right after
+// settling does not start an average that drops a level on its own.
+class ResolutionController {
+public:
+  static constexpr double kHighWater = 1.1;
+  static constexpr double kLowWater = 0.85;
+  static constexpr double kSmoothing = 0.2;
+  static constexpr int kSettleFrames = 10;
+  static constexpr int kMinSamples = 5;
+
+  ResolutionController(std::vector<double> level_costs, int level,
+                       double target_ms)
+      : level_costs_(std::move(level_costs)), level_(level),
+        target_ms_(target_ms) {}
+
+  // Feeds the time of the frame just finished. Returns true if the level
+  // changed, in which case the caller resizes to level() before the next
+  // frame.
+  bool Update(double frame_ms) {
+    if (settle_ > 0) {
+      settle_--;
+      return false;
+    }
+    average_ms_ = num_samples_ > 0
+                      ? average_ms_ + kSmoothing * (frame_ms - average_ms_)
+                      : frame_ms;
+    if (++num_samples_ < kMinSamples) {
+      return false;
+    }
+
+    int next = level_;
+    if (average_ms_ > kHighWater * target_ms_ && level_ > 0) {
+      next = level_ - 1;
+    } else if (level_ + 1 < int(level_costs_.size()) &&
+               average_ms_ * level_costs_[level_ + 1] / level_costs_[level_] <
+                   kLowWater * target_ms_) {
+      next = level_ + 1;
+    }
+    if (next == level_) {
+      return false;
+    }
+    level_ = next;
+    settle_ = kSettleFrames;
+    num_samples_ = 0;
+    return true;
+  }
+
+  int level() const { return level_; }
+  double target_ms() const { return target_ms_; }
+  // Smoothed frame time at the current level, or 0 until it has
+  // kMinSamples frames behind it.
+  double average_ms() const {
+    return num_samples_ >= kMinSamples ? average_ms_ : 0.0;
+  }
+
+private:
+  std::vector<double> level_costs_;
+  int level_{0};
+  double target_ms_{0};
+  double average_ms_{0};
+  // Frames averaged since the last change, after settling.
+  int num_samples_{0};
+  int settle_{0};
+};
+
+} // namespace demo
@@ -0,0 +1,178 @@
+#pragma once
+
+// Expects the Taichi headers (Device, Texture, GfxRuntime, TI_ERROR) and the
+// Taichi Vulkan headers to be included before this file.
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "format_features.hpp"
+
+namespace demo {
+
+// A signed distance field over the unit simulation domain, held in an r32f
+// texture so boundary kernels get hardware trilinear filtering: one texture
+// fetch per sample, however complex the geometry it was baked from. On
+// devices that cannot filter r32f it is stored as r16f instead, which every
+// Vulkan device filters; half precision still resolves distances within a
+// few texels of the boundary, where they matter, to about 1e-3 of a texel.
+//
+// The file is what the demos' Python scripts write: the magic "SDF1", three
+// int32 resolutions (the last one 1 for a 2D field), then one float per texel
+// with x varying fastest. Texel (i, j, k) holds the distance at the domain
+// point ((i, j, k) + 0.5) / res; it is positive in the fluid.
+class SdfVolume {
+public:
+  static std::unique_ptr<SdfVolume> Load(taichi::lang::gfx::GfxRuntime *runtime,
+                                         const std::string &path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+      TI_ERROR("Cannot open SDF {}", path);
+    }
+    char magic[4];
+    int32_t res[3];
+    file.read(magic, sizeof(magic));
+    file.read(reinterpret_cast<char *>(res), sizeof(res));
+    if (!file || std::memcmp(magic, "SDF1", 4) != 0 || res[0] <= 0 ||
+        res[1] <= 0 || res[2] <= 0) {
+      TI_ERROR("{} is not an SDF file", path);
+    }
+    std::vector<float> data(size_t(res[0]) * res[1] * res[2]);
+    file.read(reinterpret_cast<char *>(data.data()),
+              data.size() * sizeof(float));
+    if (!file) {
+      TI_ERROR("{} is truncated", path);
+    }
+
+    auto sdf = std::unique_ptr<SdfVolume>(new SdfVolume());
+    sdf->device_ = static_cast<taichi::lang::vulkan::VulkanDevice *>(
+        runtime->get_ti_device());
+    std::memcpy(sdf->res_, res, sizeof(res));
+    sdf->Upload(runtime, data);
+    return sdf;
+  }
+
+  ~SdfVolume() { device_->destroy_image(image_); }
+
+  SdfVolume(const SdfVolume &) = delete;
+  SdfVolume &operator=(const SdfVolume &) = delete;
+
+  const taichi::lang::Texture &texture() const { return *texture_; }
+
+  int res(int axis) const { return res_[axis]; }
+  int num_dimensions() const { return res_[2] == 1 ? 2 : 3; }
+
+  // Whether the texture fell back to r16f.
+  bool half_precision() const { return half_precision_; }
+
+private:
+  SdfVolume() = default;
+
+  // Rounds to the nearest half, ties away from zero; the SDF never holds
+  // NaNs, and distances past the f16 range saturate to infinity.
+  static uint16_t ToHalf(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    const uint16_t sign = uint16_t((bits >> 16) & 0x8000);
+    const int exponent = int((bits >> 23) & 0xff) - 127 + 15;
+    uint32_t mantissa = bits & 0x7fffff;
+    if (exponent >= 31) {
+      return sign | 0x7c00;
+    }
+    if (exponent <= 0) {
+      // Subnormal, or zero below half the smallest one.
+      if (exponent < -10) {
+        return sign;
+      }
+      mantissa |= 0x800000;
+      const int shift = 14 - exponent;
+      return sign | uint16_t((mantissa + (1u << (shift - 1))) >> shift);
+    }
+    // A carry out of the mantissa correctly bumps the exponent.
+    return sign | uint16_t(((uint32_t(exponent) << 10) | (mantissa >> 13)) +
+                           ((mantissa >> 12) & 1));
+  }
+
+  void Upload(taichi::lang::gfx::GfxRuntime *runtime,
+              const std::vector<float> &data) {
+    using namespace taichi::lang;
+    half_precision_ = !HasLinearFilter(device_, VK_FORMAT_R32_SFLOAT);
+    if (half_precision_ && !HasLinearFilter(device_, VK_FORMAT_R16_SFLOAT)) {
+      TI_ERROR("The device can filter neither r32f nor r16f textures, which "
+               "the SDF boundary samples linearly");
+    }
+    if (half_precision_) {
+      std::printf("[sdf] r32f textures are not linearly filterable on this "
+                  "device, storing the SDF as r16f\n");
+    }
+    ImageParams img_params;
+    img_params.dimension =
+        num_dimensions() == 2 ? ImageDimension::d2D : ImageDimension::d3D;
+    img_params.format = half_precision_ ? BufferFormat::r16f : BufferFormat::r32f;
+    img_params.x = res_[0];
+    img_params.y = res_[1];
+    img_params.z = res_[2];
+    img_params.initial_layout = ImageLayout::undefined;
+    image_ = device_->create_image(img_params);
+    const DataType dtype = half_precision_ ? PrimitiveType::f16
+                                           : PrimitiveType::f32;
+    if (num_dimensions() == 2) {
+      texture_ = std::make_unique<Texture>(image_, dtype,
+                                           /*num_channels=*/1, res_[0],
+                                           res_[1]);
+    } else {
+      texture_ = std::make_unique<Texture>(image_, dtype,
+                                           /*num_channels=*/1, res_[0],
+                                           res_[1], res_[2]);
+    }
+
+    const uint64_t size =
+        data.size() * (half_precision_ ? sizeof(uint16_t) : sizeof(float));
+    Device::AllocParams staging_params;
+    staging_params.size = size;
+    staging_params.host_write = true;
+    staging_params.usage = AllocUsage::Storage;
+    auto staging = device_->allocate_memory(staging_params);
+    void *mapped = device_->map(staging);
+    if (half_precision_) {
+      auto *texels = static_cast<uint16_t *>(mapped);
+      for (size_t i = 0; i < data.size(); i++) {
+        texels[i] = ToHalf(data[i]);
+      }
+    } else {
+      std::memcpy(mapped, data.data(), size);
+    }
+    device_->unmap(staging);
+
+    BufferImageCopyParams params;
+    params.image_extent.x = res_[0];
+    params.image_extent.y = res_[1];
+    params.image_extent.z = res_[2];
+    auto stream = device_->get_compute_stream();
+    auto cmd_list = stream->new_command_list();
+    cmd_list->image_transition(image_, ImageLayout::undefined,
+                               ImageLayout::transfer_dst);
+    cmd_list->buffer_to_image(image_, staging.get_ptr(0),
+                              ImageLayout::transfer_dst, params);
+    cmd_list->image_transition(image_, ImageLayout::transfer_dst,
+                               ImageLayout::shader_read);
+    stream->submit_synced(cmd_list.get());
+    device_->dealloc_memory(staging);
+    // Kernels transition images from the layout the runtime last saw them
+    // in, which would otherwise be `undefined` and discard the upload.
+    runtime->track_image(image_, ImageLayout::shader_read);
+  }
+
+  taichi::lang::vulkan::VulkanDevice *device_{nullptr};
+  int res_[3] = {0, 0, 0};
+  bool half_precision_{false};
+  taichi::lang::DeviceAllocation image_;
+  std::unique_ptr<taichi::lang::Texture> texture_{nullptr};
+};
+
+} // namespace demo
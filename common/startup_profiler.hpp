@@ -0,0 +1,249 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace demo {
+
+// Collects named startup phases and writes them out as a JSON report and a
+// Chrome trace (load the latter in chrome://tracing or ui.perfetto.dev).
+//
+// Instrumentation is a no-op until Enable() is called, so the scopes can stay
+// in the demos permanently.
+class StartupProfiler {
+public:
+  struct Phase {
+    std::string name;
+    double start_ms{0};
+    double wall_ms{0};
+    // Time spent waiting for the device to go idle at the end of the phase,
+    // i.e. GPU work the phase submitted that the host had not overlapped.
+    double gpu_ms{0};
+    int depth{0};
+    size_t thread{0};
+  };
+
+  static StartupProfiler &Get() {
+    static StartupProfiler profiler;
+    return profiler;
+  }
+
+  // Recognizes `--profile-startup <prefix>`, which writes `<prefix>.json`
+  // and `<prefix>.trace.json` once the first frame has been presented.
+  void ParseArgs(int argc, char **argv) {
+    for (int i = 1; i + 1 < argc; i++) {
+      if (std::string(argv[i]) == "--profile-startup") {
+        Enable(argv[i + 1]);
+      }
+    }
+  }
+
+  void Enable(const std::string &output_prefix) {
+    output_prefix_ = output_prefix;
+    enabled_ = true;
+  }
+
+  bool enabled() const { return enabled_; }
+
+  double Now() const {
+    return std::chrono::duration<double, std::milli>(
+               std::chrono::steady_clock::now() - begin_)
+        .count();
+  }
+
+  void Record(Phase phase) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    phases_.push_back(std::move(phase));
+  }
+
+  // Prints the phases in start order and writes both files. Later calls
+  // are ignored, so it can sit in the frame loop.
+  void Finish() {
+    if (!enabled_ || finished_) {
+      return;
+    }
+    finished_ = true;
+    const double total_ms = Now();
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::stable_sort(phases_.begin(), phases_.end(),
+              [](const Phase &a, const Phase &b) {
+                return a.start_ms < b.start_ms;
+              });
+
+    std::printf("[startup] %.1f ms to first frame\n", total_ms);
+    std::printf("[startup] %-36s %10s %10s\n", "phase", "wall ms", "gpu ms");
+    const Phase *slowest = nullptr;
+    for (const auto &phase : phases_) {
+      std::printf("[startup] %-36s %10.2f %10.2f\n",
+                  (std::string(phase.depth * 2, ' ') + phase.name).c_str(),
+                  phase.wall_ms, phase.gpu_ms);
+      if (IsLeaf(phase) &&
+          (slowest == nullptr || phase.wall_ms > slowest->wall_ms)) {
+        slowest = &phase;
+      }
+    }
+    if (slowest != nullptr) {
+      std::printf("[startup] slowest leaf phase: %s (%.1f%% of startup)\n",
+                  slowest->name.c_str(), 100.0 * slowest->wall_ms / total_ms);
+    }
+
+    WriteReport(output_prefix_ + ".json", total_ms);
+    WriteTrace(output_prefix_ + ".trace.json");
+  }
+
+private:
+  StartupProfiler() : begin_(std::chrono::steady_clock::now()) {}
+
+  // A phase without nested phases, i.e. something that can be optimized
+  // directly rather than a grouping scope.
+  bool IsLeaf(const Phase &phase) const {
+    for (const auto &other : phases_) {
+      if (other.thread == phase.thread && other.depth > phase.depth &&
+          other.start_ms >= phase.start_ms &&
+          other.start_ms < phase.start_ms + phase.wall_ms) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  static std::string Escape(const std::string &s) {
+    std::string out;
+    for (char c : s) {
+      if (c == '"' || c == '\\') {
+        out.push_back('\\');
+      }
+      out.push_back(c);
+    }
+    return out;
+  }
+
+  void WriteReport(const std::string &path, double total_ms) const {
+    FILE *f = std::fopen(path.c_str(), "w");
+    if (f == nullptr) {
+      return;
+    }
+    std::fprintf(f, "{\n  \"total_ms\": %.3f,\n  \"phases\": [", total_ms);
+    for (size_t i = 0; i < phases_.size(); i++) {
+      const auto &p = phases_[i];
+      std::fprintf(f,
+                   "%s\n    {\"name\": \"%s\", \"start_ms\": %.3f, "
+                   "\"wall_ms\": %.3f, \"gpu_ms\": %.3f, \"depth\": %d, "
+                   "\"thread\": %zu}",
+                   i == 0 ? "" : ",", Escape(p.name).c_str(), p.start_ms,
+                   p.wall_ms, p.gpu_ms, p.depth, p.thread);
+    }
+    std::fprintf(f, "\n  ]\n}\n");
+    std::fclose(f);
+  }
+
+  // Complete ("X") events in microseconds. GPU waits get their own track
+  // (tid 1000 + thread) so they line up under the phase that caused them.
+  void WriteTrace(const std::string &path) const {
+    FILE *f = std::fopen(path.c_str(), "w");
+    if (f == nullptr) {
+      return;
+    }
+    std::fprintf(f, "{\"traceEvents\": [");
+    bool first = true;
+    auto event = [&](const std::string &name, double ts_ms, double dur_ms,
+                     size_t tid) {
+      std::fprintf(f,
+                   "%s\n  {\"name\": \"%s\", \"ph\": \"X\", \"ts\": %.1f, "
+                   "\"dur\": %.1f, \"pid\": 1, \"tid\": %zu}",
+                   first ? "" : ",", Escape(name).c_str(), ts_ms * 1000.0,
+                   dur_ms * 1000.0, tid);
+      first = false;
+    };
+    for (const auto &p : phases_) {
+      event(p.name, p.start_ms, p.wall_ms, p.thread);
+      if (p.gpu_ms > 0) {
+        event(p.name + " (gpu)", p.start_ms + p.wall_ms - p.gpu_ms, p.gpu_ms,
+              1000 + p.thread);
+      }
+    }
+    std::fprintf(f, "\n], \"displayTimeUnit\": \"ms\"}\n");
+    std::fclose(f);
+  }
+
+  std::chrono::steady_clock::time_point begin_;
+  std::string output_prefix_;
+  bool enabled_{false};
+  bool finished_{false};
+  std::mutex mutex_;
+  std::vector<StartupProfiler::Phase> phases_;
+};
+
+// Times the enclosing block as one startup phase. When `gpu_sync` is given
+// (e.g. a lambda calling the runtime's synchronize()), it is invoked at the
+// end of the phase while profiling and the wait is reported as GPU time.
+class ProfileScope {
+public:
+  explicit ProfileScope(std::string name, std::function<void()> gpu_sync = {})
+      : profiler_(StartupProfiler::Get()) {
+    if (!profiler_.enabled()) {
+      return;
+    }
+    phase_.name = std::move(name);
+    phase_.start_ms = profiler_.Now();
+    phase_.depth = Depth()++;
+    phase_.thread = ThreadIndex();
+    gpu_sync_ = std::move(gpu_sync);
+  }
+
+  ~ProfileScope() { End(); }
+
+  // Ends the phase before the end of the block, for phases that would
+  // otherwise need a scope of their own.
+  void End() {
+    if (!profiler_.enabled() || phase_.name.empty() || ended_) {
+      return;
+    }
+    ended_ = true;
+    if (gpu_sync_) {
+      const double sync_begin = profiler_.Now();
+      gpu_sync_();
+      phase_.gpu_ms = profiler_.Now() - sync_begin;
+    }
+    phase_.wall_ms = profiler_.Now() - phase_.start_ms;
+    Depth()--;
+    profiler_.Record(phase_);
+  }
+
+  ProfileScope(const ProfileScope &) = delete;
+  ProfileScope &operator=(const ProfileScope &) = delete;
+
+private:
+  static int &Depth() {
+    thread_local int depth = 0;
+    return depth;
+  }
+
+  // Small stable per-thread index, used as the trace's tid.
+  static size_t ThreadIndex() {
+    static std::mutex mutex;
+    static std::vector<std::thread::id> ids;
+    const auto id = std::this_thread::get_id();
+    std::lock_guard<std::mutex> lock(mutex);
+    for (size_t i = 0; i < ids.size(); i++) {
+      if (ids[i] == id) {
+        return i;
+      }
+    }
+    ids.push_back(id);
+    return ids.size() - 1;
+  }
+
+  StartupProfiler &profiler_;
+  StartupProfiler::Phase phase_;
+  std::function<void()> gpu_sync_;
+  bool ended_{false};
+};
+
+} // namespace demo
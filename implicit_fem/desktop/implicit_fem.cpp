@@ -3,31 +3,168 @@
 #include <unistd.h>
 
 #include <iostream>
+#include <string>
 
+#include "benchmark_sweep.hpp"
 #include "fem_app.h"
+#include "offscreen.hpp"
 
-int main() {
-  // Init gl window
-  glfwInit();
-  glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
-  GLFWwindow* window =
-      glfwCreateWindow(512, 512 * ASPECT_RATIO, "Taichi show", NULL, NULL);
-  if (window == NULL) {
-    std::cout << "Failed to create GLFW window" << std::endl;
-    glfwTerminate();
-    return -1;
+// Simulates 1, 2, 4, ... and `max_bodies` bodies headless for `num_steps`
+// frames each, and prints the frame time and body throughput of each.
+void RunBodySweep(int max_bodies, int num_steps, FemOptions options,
+                  int width, int height) {
+  std::cout << "bodies, ms/step, body-steps/sec" << std::endl;
+  for (int k : demo::SweepSizes(1, max_bodies)) {
+    options.num_bodies = k;
+    FemApp app(options);
+    app.run_init(width, height, "../../android/app/src/main/assets", nullptr);
+    // The warm-up also waits for the pipelines.
+    const double ms =
+        demo::MillisecondsPerRun(num_steps, [&] { app.simulate(); });
+    // NUM_SUBSTEPS implicit steps per frame.
+    std::cout << k << ", " << ms << ", " << k * NUM_SUBSTEPS * 1000.0 / ms
+              << std::endl;
+    app.cleanup();
   }
+}
 
-  FemApp app;
-  app.run_init(/*width=*/512, /*height=*/512 * ASPECT_RATIO,
-               "../../android/app/src/main/assets", window);
+// Times one system matrix product through the per-edge scatter and the
+// block-sparse gather for 1, 2, 4, ... and `max_bodies` bodies, each the
+// mean of `num_runs` launches.
+void RunMatvecComparison(int max_bodies, int num_runs, int width, int height) {
+  std::cout << "vertices, blocks, edge ms, bsr ms" << std::endl;
+  for (int k : demo::SweepSizes(1, max_bodies)) {
+    FemOptions options;
+    options.num_bodies = k;
+    options.bsr_matvec = true;
+    FemApp app(options);
+    app.run_init(width, height, "../../android/app/src/main/assets", nullptr);
+    const double edge_ms = app.time_matvec(/*bsr=*/false, num_runs);
+    const double bsr_ms = app.time_matvec(/*bsr=*/true, num_runs);
+    std::cout << k * N_VERTS << ", " << app.num_blocks() << ", " << edge_ms
+              << ", " << bsr_ms << std::endl;
+    app.cleanup();
+  }
+}
+
+// Times one force evaluation through the atomic get_force and the
+// per-color dispatches for 1, 2, 4, ... and `max_bodies` bodies, each the
+// mean of `num_runs` evaluations.
+void RunForceComparison(int max_bodies, int num_runs, int width, int height) {
+  std::cout << "# " << N_COLORS << " colors, "
+            << N_CELLS - color_offsets_data[N_COLORS]
+            << " cells per body left to atomics" << std::endl;
+  std::cout << "cells, atomic ms, colored ms" << std::endl;
+  for (int k : demo::SweepSizes(1, max_bodies)) {
+    FemOptions options;
+    options.num_bodies = k;
+    options.colored_forces = true;
+    FemApp app(options);
+    app.run_init(width, height, "../../android/app/src/main/assets", nullptr);
+    const double atomic_ms = app.time_forces(/*colored=*/false, num_runs);
+    const double colored_ms = app.time_forces(/*colored=*/true, num_runs);
+    std::cout << k * N_CELLS << ", " << atomic_ms << ", " << colored_ms
+              << std::endl;
+    app.cleanup();
+  }
+}
+
+int main(int argc, char** argv) {
+  demo::MillisecondsSinceStartup();
+  demo::StartupProfiler::Get().ParseArgs(argc, argv);
+  demo::AsyncModuleLoader::DefaultMode() =
+      demo::ParsePipelineLoadMode(argc, argv);
+  auto offscreen_options = demo::OffscreenOptions::Parse(argc, argv);
+  const int width = 512;
+  const int height = 512 * ASPECT_RATIO;
+
+  // `--bodies <k>` simulates k copies of the mesh; `--body-sweep <max k>
+  // [--steps <n>]` benchmarks body count against frame time headless.
+  // `--bsr-matvec` solves with the block-sparse matrix instead of the
+  // per-edge scatter, and `--compare-matvec <max k> [--steps <n>]` times
+  // one product through each. `--colored-forces` and `--compare-forces <max
+  // k> [--steps <n>]` do the same for the per-color force dispatches. All
+  // four, and more than one body, need the module regenerated with
+  // `python implicit_fem.py --aot`.
+  FemOptions options;
+  int body_sweep = 0;
+  int compare_matvec = 0;
+  int compare_forces = 0;
+  int steps = 100;
+  for (int i = 1; i < argc; i++) {
+    const std::string arg = argv[i];
+    const bool has_value = i + 1 < argc;
+    if (arg == "--bsr-matvec") {
+      options.bsr_matvec = true;
+    } else if (arg == "--colored-forces") {
+      options.colored_forces = true;
+    } else if (arg == "--bodies" && has_value) {
+      options.num_bodies = std::stoi(argv[++i]);
+    } else if (arg == "--body-sweep" && has_value) {
+      body_sweep = std::min(std::stoi(argv[++i]), MAX_BODIES);
+    } else if (arg == "--compare-matvec" && has_value) {
+      compare_matvec = std::min(std::stoi(argv[++i]), MAX_BODIES);
+    } else if (arg == "--compare-forces" && has_value) {
+      compare_forces = std::min(std::stoi(argv[++i]), MAX_BODIES);
+    } else if (arg == "--steps" && has_value) {
+      steps = std::stoi(argv[++i]);
+    }
+  }
+  if (body_sweep > 0) {
+    RunBodySweep(body_sweep, steps, options, width, height);
+    return 0;
+  }
+  if (compare_matvec > 0) {
+    RunMatvecComparison(compare_matvec, steps, width, height);
+    return 0;
+  }
+  if (compare_forces > 0) {
+    RunForceComparison(compare_forces, steps, width, height);
+    return 0;
+  }
+
+  // Init gl window, unless rendering offscreen.
+  GLFWwindow* window = nullptr;
+  if (!offscreen_options.enabled) {
+    glfwInit();
+    glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
+    window = glfwCreateWindow(width, height, "Taichi show", NULL, NULL);
+    if (window == NULL) {
+      std::cout << "Failed to create GLFW window" << std::endl;
+      glfwTerminate();
+      return -1;
+    }
+  }
+
+  FemApp app(options);
+  app.run_init(width, height, "../../android/app/src/main/assets", window);
+
+  std::unique_ptr<demo::OffscreenCapture> offscreen;
+  if (offscreen_options.enabled) {
+    offscreen = std::make_unique<demo::OffscreenCapture>(
+        app.device(), width, height, offscreen_options);
+  }
 
-  while (!glfwWindowShouldClose(window)) {
+  for (int frame = 0; offscreen ? frame < offscreen_options.num_frames
+                                : !glfwWindowShouldClose(window);
+       frame++) {
     app.run_render_loop();
+    if (frame == 0) {
+      printf("[startup] first frame after %.1f ms (pipelines: %s)\n",
+             demo::MillisecondsSinceStartup(),
+             demo::PipelineLoadModeName(
+                 demo::AsyncModuleLoader::DefaultMode()));
+      demo::StartupProfiler::Get().Finish();
+    }
 
-    glfwSwapBuffers(window);
-    glfwPollEvents();
+    if (offscreen) {
+      offscreen->Capture(app.surface());
+    } else {
+      glfwSwapBuffers(window);
+      glfwPollEvents();
+    }
   }
+  offscreen.reset();
 
   app.cleanup();
 
@@ -8,25 +8,28 @@
 #include <taichi/inc/constants.h>
 #include <taichi/ui/backends/vulkan/renderer.h>
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <memory>
 #include <vector>
 
+#include "async_loader.hpp"
+#include "benchmark_sweep.hpp"
 #include "box_color_data.h"
+#include "device_arena.hpp"
 #include "mesh_data.h"
+#include "pipeline_cache.hpp"
+#include "startup_profiler.hpp"
 
 constexpr float DT = 7.5e-3;
 constexpr int NUM_SUBSTEPS = 2;
 constexpr int CG_ITERS = 8;
 constexpr float ASPECT_RATIO = 2.0f;
-
-void load_data(taichi::lang::vulkan::VkRuntime* vulkan_runtime,
-               taichi::lang::DeviceAllocation& alloc, const void* data,
-               size_t size) {
-  char* const device_arr_ptr =
-      reinterpret_cast<char*>(vulkan_runtime->get_ti_device()->map(alloc));
-  std::memcpy(device_arr_ptr, data, size);
-  vulkan_runtime->get_ti_device()->unmap(alloc);
-}
+// Most copies of the mesh one FemApp accepts. The Taichi fields in
+// implicit_fem.py hold `--max-bodies` copies, one by default, and run_init()
+// checks the module's root buffer against the number asked for.
+constexpr int MAX_BODIES = 64;
 
 struct ColorVertex {
   glm::vec3 pos;
@@ -65,11 +68,101 @@ void build_wall(int face, std::vector<ColorVertex>& vertices,
   }
 }
 
+// Where each of `num_bodies` copies of the mesh starts out. A single body
+// keeps the mesh's own rest pose. More are shrunk to fit a lattice in the
+// box, side x side bodies per layer with the layers stacked from the floor,
+// and each is turned about y so that they do not all land alike.
+std::vector<glm::mat4> body_transforms(int num_bodies) {
+  if (num_bodies == 1) {
+    return {glm::mat4(1.0f)};
+  }
+  glm::vec3 lo(ox_data[0][0], ox_data[0][1], ox_data[0][2]);
+  glm::vec3 hi = lo;
+  for (int i = 1; i < N_VERTS; i++) {
+    glm::vec3 p(ox_data[i][0], ox_data[i][1], ox_data[i][2]);
+    lo = glm::min(lo, p);
+    hi = glm::max(hi, p);
+  }
+  const int side = int(std::ceil(std::cbrt(num_bodies / ASPECT_RATIO)));
+  const int layers = (num_bodies + side * side - 1) / (side * side);
+  const float cell = std::min(2.0f / side, 2.0f * ASPECT_RATIO / layers);
+  // The bounding box diagonal bounds the body whichever way it is turned.
+  const float scale = 0.9f * cell / glm::length(hi - lo);
+
+  std::vector<glm::mat4> transforms;
+  for (int k = 0; k < num_bodies; k++) {
+    const int ix = k % side;
+    const int iz = (k / side) % side;
+    const int iy = k / (side * side);
+    glm::vec3 pos((ix + 0.5f) * 2.0f / side - 1.0f,
+                  (iy + 0.5f) * cell - ASPECT_RATIO,
+                  (iz + 0.5f) * 2.0f / side - 1.0f);
+    glm::mat4 t = glm::translate(glm::mat4(1.0f), pos);
+    t = glm::rotate(t, 2.4f * k, glm::vec3(0.0f, 1.0f, 0.0f));
+    t = glm::scale(t, glm::vec3(scale));
+    transforms.push_back(glm::translate(t, -0.5f * (lo + hi)));
+  }
+  return transforms;
+}
+
+// Block-sparse row pattern of the system matrix over `n_verts` vertices
+// joined by `edges` (pairs of vertex ids): row u holds its diagonal block
+// followed by one block per edge at u, ordered by column. Same as
+// bsr_pattern() in implicit_fem.py.
+void build_bsr_pattern(const std::vector<int>& edges, int n_verts,
+                       std::vector<int>& row_ptr, std::vector<int>& cols) {
+  std::vector<std::vector<int>> neighbours(n_verts);
+  for (size_t e = 0; e < edges.size(); e += 2) {
+    neighbours[edges[e]].push_back(edges[e + 1]);
+    neighbours[edges[e + 1]].push_back(edges[e]);
+  }
+  row_ptr.assign(1, 0);
+  cols.clear();
+  for (int u = 0; u < n_verts; u++) {
+    std::sort(neighbours[u].begin(), neighbours[u].end());
+    cols.push_back(u);
+    cols.insert(cols.end(), neighbours[u].begin(), neighbours[u].end());
+    row_ptr.push_back(cols.size());
+  }
+}
+
+struct FemOptions {
+  // Independent copies of the mesh. They are packed into one set of
+  // ndarrays, so every kernel launch covers all of them at once, and one
+  // draw renders them all.
+  int num_bodies = 1;
+  // Whether the CG solver multiplies by the 3x3 block-sparse matrix, or
+  // scatters the scalar per-edge Hessian with atomics as it used to. The
+  // block-sparse kernels are not in the checked-in module, so this needs it
+  // regenerated.
+  bool bsr_matvec = false;
+  // Whether forces are scattered one tet color at a time without atomics
+  // (see color_offsets_data), or by a single get_force with them. Colored
+  // forces also put the cells in color_order_data rather than vertex order.
+  // Off until --compare-forces shows the per-color dispatches winning; like
+  // bsr_matvec, it needs the module regenerated.
+  bool colored_forces = false;
+};
+
 class FemApp {
  public:
+  explicit FemApp(const FemOptions& options = FemOptions())
+      : num_bodies_(options.num_bodies),
+        bsr_matvec_(options.bsr_matvec),
+        colored_forces_(options.colored_forces),
+        n_verts_(options.num_bodies * N_VERTS),
+        n_cells_(options.num_bodies * N_CELLS),
+        n_edges_(options.num_bodies * N_EDGES),
+        n_blocks_(n_verts_ + 2 * n_edges_) {
+    if (num_bodies_ < 1 || num_bodies_ > MAX_BODIES) {
+      TI_ERROR("FemApp supports 1 to {} bodies", MAX_BODIES);
+    }
+  }
+
   void run_init(int width, int height, std::string path_prefix,
                 taichi::ui::TaichiWindow* window) {
     using namespace taichi::lang;
+    demo::ProfileScope init_phase("FemApp::run_init");
     width_ = width;
     height_ = height;
 
@@ -85,19 +178,28 @@ class FemApp {
         VK_EXT_DEBUG_UTILS_EXTENSION_NAME,
     };
 
-    uint32_t glfw_ext_count = 0;
-    const char** glfw_extensions;
-    glfw_extensions = glfwGetRequiredInstanceExtensions(&glfw_ext_count);
+    // Without a window the surface is a plain offscreen image, so neither the
+    // GLFW surface extensions nor a swapchain are needed. This keeps headless
+    // runs working on software ICDs that expose no WSI at all.
+    if (window != nullptr) {
+      uint32_t glfw_ext_count = 0;
+      const char** glfw_extensions;
+      glfw_extensions = glfwGetRequiredInstanceExtensions(&glfw_ext_count);
 
-    for (int i = 0; i < glfw_ext_count; ++i) {
-      extensions.push_back(glfw_extensions[i]);
+      for (int i = 0; i < glfw_ext_count; ++i) {
+        extensions.push_back(glfw_extensions[i]);
+      }
     }
 #endif  // ANDROID
     // Create a Vulkan Device
+    demo::ProfileScope device_phase("vulkan device");
     taichi::lang::vulkan::VulkanDeviceCreator::Params evd_params;
     evd_params.api_version = VK_API_VERSION_1_2;
     evd_params.additional_instance_extensions = extensions;
-    evd_params.additional_device_extensions = {VK_KHR_SWAPCHAIN_EXTENSION_NAME};
+    if (window != nullptr) {
+      evd_params.additional_device_extensions = {
+          VK_KHR_SWAPCHAIN_EXTENSION_NAME};
+    }
     evd_params.is_for_ui = false;
     evd_params.surface_creator = nullptr;
 
@@ -106,7 +208,9 @@ class FemApp {
 
     device_ = static_cast<taichi::lang::vulkan::VulkanDevice*>(
         embedded_device_->device());
+    device_phase.End();
 
+    demo::ProfileScope surface_phase("surface + depth image");
     {
       taichi::lang::SurfaceConfig config;
       config.vsync = true;
@@ -127,112 +231,273 @@ class FemApp {
 
       depth_allocation_ = device_->create_image(params);
     }
+    surface_phase.End();
 
     // Initialize our Vulkan Program pipeline
+    demo::ProfileScope runtime_phase("runtime");
     host_result_buffer_.resize(taichi_result_buffer_entries);
     taichi::lang::vulkan::VkRuntime::Params params;
     params.host_result_buffer = host_result_buffer_.data();
     params.device = embedded_device_->device();
     vulkan_runtime_ =
         std::make_unique<taichi::lang::vulkan::VkRuntime>(std::move(params));
+    runtime_phase.End();
 
+    demo::ProfileScope module_phase("module load");
+    load_begin_ = std::chrono::steady_clock::now();
     std::string shader_source = path_prefix + "/shaders/aot/implicit_fem";
     taichi::lang::vulkan::AotModuleParams aot_params{shader_source,
                                                      vulkan_runtime_.get()};
+    // Kept alive with the app: in async and lazy mode pipelines are still
+    // being created after run_init() returns.
+#ifdef ANDROID
+    pipeline_cache_ = std::make_unique<demo::PipelineCacheStore>(
+        device_, shader_source, path_prefix + "/pipeline_cache");
+#else
+    pipeline_cache_ =
+        std::make_unique<demo::PipelineCacheStore>(device_, shader_source);
+#endif  // ANDROID
+    pipeline_cache_->Install();
     module_ = taichi::lang::aot::Module::load(taichi::Arch::vulkan, aot_params);
     auto root_size = module_->get_root_size();
     // printf("root buffer size=%ld\n", root_size);
+    // The per-vertex, per-cell and per-edge fields (m, B, W, hes_vert,
+    // hes_edge) are sized for `--max-bodies` bodies when the module is
+    // generated; the checked-in one only holds a single body.
+    const size_t field_bytes_per_body =
+        N_VERTS * 2 * sizeof(float) + N_CELLS * 10 * sizeof(float) +
+        N_EDGES * sizeof(float);
+    if (root_size < num_bodies_ * field_bytes_per_body) {
+      TI_ERROR(
+          "The AOT module in {} is too small for {} bodies; regenerate it "
+          "with `python implicit_fem.py --aot --max-bodies {}`",
+          shader_source, num_bodies_, num_bodies_);
+    }
     vulkan_runtime_->add_root_buffer(root_size);
-
-    loaded_kernels_.get_force_kernel = module_->get_kernel("get_force");
-    loaded_kernels_.init_kernel = module_->get_kernel("init");
-    loaded_kernels_.floor_bound_kernel = module_->get_kernel("floor_bound");
-    loaded_kernels_.get_matrix_kernel = module_->get_kernel("get_matrix");
-    loaded_kernels_.matmul_edge_kernel = module_->get_kernel("matmul_edge");
-    loaded_kernels_.add_kernel = module_->get_kernel("add");
-    loaded_kernels_.add_scalar_ndarray_kernel =
-        module_->get_kernel("add_scalar_ndarray");
-    loaded_kernels_.dot2scalar_kernel = module_->get_kernel("dot2scalar");
-    loaded_kernels_.get_b_kernel = module_->get_kernel("get_b");
-    loaded_kernels_.ndarray_to_ndarray_kernel =
-        module_->get_kernel("ndarray_to_ndarray");
-    loaded_kernels_.fill_ndarray_kernel = module_->get_kernel("fill_ndarray");
-    loaded_kernels_.clear_field_kernel = module_->get_kernel("clear_field");
-    loaded_kernels_.init_r_2_kernel = module_->get_kernel("init_r_2");
-    loaded_kernels_.update_alpha_kernel = module_->get_kernel("update_alpha");
-    loaded_kernels_.update_beta_r_2_kernel =
-        module_->get_kernel("update_beta_r_2");
+    module_phase.End();
+
+    // Kernels are requested in the order they are first launched, so the
+    // three init kernels are ready while the solver kernels still compile
+    // behind the uploads and render setup below.
+    demo::ProfileScope kernels_phase("request kernels");
+    kernel_loader_ = std::make_unique<demo::AsyncModuleLoader>();
+    auto load = [this, shader_source](const char* name) {
+      return kernel_loader_->Load([this, shader_source, name] {
+        demo::ProfileScope phase(std::string("get_kernel ") + name);
+        auto* kernel = module_->get_kernel(name);
+        if (kernel == nullptr) {
+          TI_ERROR(
+              "Kernel {} is not in the AOT module in {}; regenerate it with "
+              "`python implicit_fem.py --aot`",
+              name, shader_source);
+        }
+        return kernel;
+      });
+    };
+    loaded_kernels_.clear_field_kernel = load("clear_field");
+    loaded_kernels_.init_kernel = load("init");
+    loaded_kernels_.get_matrix_kernel = load("get_matrix");
+    if (bsr_matvec_) {
+      loaded_kernels_.get_matrix_bsr_kernel = load("get_matrix_bsr");
+    }
+    loaded_kernels_.get_force_kernel = load("get_force");
+    if (colored_forces_) {
+      loaded_kernels_.get_force_rest_kernel = load("get_force_rest");
+      loaded_kernels_.get_force_color_kernel = load("get_force_color");
+    }
+    loaded_kernels_.get_b_kernel = load("get_b");
+    loaded_kernels_.matmul_edge_kernel = load("matmul_edge");
+    if (bsr_matvec_) {
+      loaded_kernels_.matmul_bsr_kernel = load("matmul_bsr");
+    }
+    loaded_kernels_.add_kernel = load("add");
+    loaded_kernels_.ndarray_to_ndarray_kernel = load("ndarray_to_ndarray");
+    loaded_kernels_.dot2scalar_kernel = load("dot2scalar");
+    loaded_kernels_.init_r_2_kernel = load("init_r_2");
+    loaded_kernels_.update_alpha_kernel = load("update_alpha");
+    loaded_kernels_.add_scalar_ndarray_kernel = load("add_scalar_ndarray");
+    loaded_kernels_.update_beta_r_2_kernel = load("update_beta_r_2");
+    loaded_kernels_.fill_ndarray_kernel = load("fill_ndarray");
+    loaded_kernels_.floor_bound_kernel = load("floor_bound");
+    kernels_phase.End();
 
     // Prepare Ndarray for model
+    demo::ProfileScope alloc_phase("allocate buffers");
+    alloc_begin_ = std::chrono::steady_clock::now();
+    // The device is no more thread safe than the module, so allocations wait
+    // for the pipeline the loader's worker is creating.
+    auto loader_lock = kernel_loader_->Lock();
+    // Nothing below is touched by the host after the initial uploads, which
+    // go through the arena's staging blocks, so it all lives in device-local
+    // memory.
+    arena_ = std::make_unique<demo::DeviceArena>(device_);
     taichi::lang::Device::AllocParams alloc_params;
-    alloc_params.host_write = true;
-    // x
-    alloc_params.size = N_VERTS * 3 * sizeof(float);
+    // x, which is also the surface's vertex buffer
+    alloc_params.size = n_verts_ * 3 * sizeof(float);
     alloc_params.usage =
         taichi::lang::AllocUsage::Vertex | taichi::lang::AllocUsage::Storage;
-    devalloc_x_ = device_->allocate_memory(alloc_params);
+    devalloc_x_ = arena_->Allocate(alloc_params);
     alloc_params.usage = taichi::lang::AllocUsage::Storage;
     // v
-    devalloc_v_ = device_->allocate_memory(alloc_params);
+    devalloc_v_ = arena_->Allocate(alloc_params);
     // f
-    devalloc_f_ = device_->allocate_memory(alloc_params);
+    devalloc_f_ = arena_->Allocate(alloc_params);
     // mul_ans
-    devalloc_mul_ans_ = device_->allocate_memory(alloc_params);
+    devalloc_mul_ans_ = arena_->Allocate(alloc_params);
     // c2e
-    alloc_params.size = N_CELLS * 6 * sizeof(int);
-    devalloc_c2e_ = device_->allocate_memory(alloc_params);
+    alloc_params.size = n_cells_ * 6 * sizeof(int);
+    devalloc_c2e_ = arena_->Allocate(alloc_params);
     // b
-    alloc_params.size = N_VERTS * 3 * sizeof(float);
-    devalloc_b_ = device_->allocate_memory(alloc_params);
+    alloc_params.size = n_verts_ * 3 * sizeof(float);
+    devalloc_b_ = arena_->Allocate(alloc_params);
     // r0
-    devalloc_r0_ = device_->allocate_memory(alloc_params);
+    devalloc_r0_ = arena_->Allocate(alloc_params);
     // p0
-    devalloc_p0_ = device_->allocate_memory(alloc_params);
-    // indices
-    alloc_params.size = N_FACES * 3 * sizeof(int);
+    devalloc_p0_ = arena_->Allocate(alloc_params);
+    // indices, of every body, each offset by its copy of the vertices
+    alloc_params.size = num_bodies_ * N_FACES * 3 * sizeof(int);
     alloc_params.usage = taichi::lang::AllocUsage::Index;
-    devalloc_indices_ = device_->allocate_memory(alloc_params);
+    devalloc_indices_ = arena_->Allocate(alloc_params);
     alloc_params.usage = taichi::lang::AllocUsage::Storage;
     // vertices
-    alloc_params.size = N_CELLS * 4 * sizeof(int);
-    devalloc_vertices_ = device_->allocate_memory(alloc_params);
+    alloc_params.size = n_cells_ * 4 * sizeof(int);
+    devalloc_vertices_ = arena_->Allocate(alloc_params);
     // edges
-    alloc_params.size = N_EDGES * 2 * sizeof(int);
-    devalloc_edges_ = device_->allocate_memory(alloc_params);
+    alloc_params.size = n_edges_ * 2 * sizeof(int);
+    devalloc_edges_ = arena_->Allocate(alloc_params);
     // ox
-    alloc_params.size = N_VERTS * 3 * sizeof(float);
-    devalloc_ox_ = device_->allocate_memory(alloc_params);
+    alloc_params.size = n_verts_ * 3 * sizeof(float);
+    devalloc_ox_ = arena_->Allocate(alloc_params);
+    // bsr_row_ptr, bsr_cols, bsr_values
+    if (bsr_matvec_) {
+      alloc_params.size = (n_verts_ + 1) * sizeof(int);
+      devalloc_bsr_row_ptr_ = arena_->Allocate(alloc_params);
+      alloc_params.size = n_blocks_ * sizeof(int);
+      devalloc_bsr_cols_ = arena_->Allocate(alloc_params);
+      alloc_params.size = n_blocks_ * 9 * sizeof(float);
+      devalloc_bsr_values_ = arena_->Allocate(alloc_params);
+    }
 
     alloc_params.size = sizeof(float);
-    devalloc_alpha_scalar_ = device_->allocate_memory(alloc_params);
-    devalloc_beta_scalar_ = device_->allocate_memory(alloc_params);
-
-    load_data(vulkan_runtime_.get(), devalloc_indices_, indices_data,
-              sizeof(indices_data));
-    load_data(vulkan_runtime_.get(), devalloc_c2e_, c2e_data, sizeof(c2e_data));
-    load_data(vulkan_runtime_.get(), devalloc_vertices_, vertices_data,
-              sizeof(vertices_data));
-    load_data(vulkan_runtime_.get(), devalloc_ox_, ox_data, sizeof(ox_data));
-    load_data(vulkan_runtime_.get(), devalloc_edges_, edges_data,
-              sizeof(edges_data));
+    devalloc_alpha_scalar_ = arena_->Allocate(alloc_params);
+    devalloc_beta_scalar_ = arena_->Allocate(alloc_params);
+    alloc_phase.End();
+
+    demo::ProfileScope upload_phase("load_data");
+    {
+      // Body k is the mesh with its vertex and edge ids offset by k copies
+      // and its rest positions moved by its transform. Cells keep the mesh's
+      // vertex order, body after body, which keeps get_force's atomics local.
+      // Colored forces need them in color_order_data instead: cell r of that
+      // order is packed a tet color at a time, every body's cells of a color
+      // together, so that each color stays one contiguous range; the rest
+      // come last.
+      auto packed_cell = [this](int k, int r) {
+        if (!colored_forces_) {
+          return k * N_CELLS + r;
+        }
+        const int group =
+            int(std::upper_bound(color_offsets_data,
+                                 color_offsets_data + N_COLORS + 1, r) -
+                color_offsets_data) -
+            1;
+        const int begin = color_offsets_data[group];
+        const int end =
+            group < N_COLORS ? color_offsets_data[group + 1] : N_CELLS;
+        return num_bodies_ * begin + k * (end - begin) + r - begin;
+      };
+      const auto transforms = body_transforms(num_bodies_);
+      std::vector<float> ox(n_verts_ * 3);
+      std::vector<int> vertices(n_cells_ * 4);
+      std::vector<int> c2e(n_cells_ * 6);
+      std::vector<int> edges(n_edges_ * 2);
+      std::vector<int> indices(num_bodies_ * N_FACES * 3);
+      for (int k = 0; k < num_bodies_; k++) {
+        for (int i = 0; i < N_VERTS; i++) {
+          glm::vec4 p = transforms[k] * glm::vec4(ox_data[i][0], ox_data[i][1],
+                                                  ox_data[i][2], 1.0f);
+          for (int d = 0; d < 3; d++) {
+            ox[(k * N_VERTS + i) * 3 + d] = p[d];
+          }
+        }
+        for (int r = 0; r < N_CELLS; r++) {
+          const int c = colored_forces_ ? color_order_data[r] : r;
+          for (int j = 0; j < 4; j++) {
+            vertices[packed_cell(k, r) * 4 + j] =
+                vertices_data[c][j] + k * N_VERTS;
+          }
+          for (int j = 0; j < 6; j++) {
+            c2e[packed_cell(k, r) * 6 + j] = c2e_data[c][j] + k * N_EDGES;
+          }
+        }
+        for (int e = 0; e < N_EDGES; e++) {
+          for (int j = 0; j < 2; j++) {
+            edges[(k * N_EDGES + e) * 2 + j] = edges_data[e][j] + k * N_VERTS;
+          }
+        }
+        for (int i = 0; i < N_FACES * 3; i++) {
+          indices[k * N_FACES * 3 + i] = indices_data[i] + k * N_VERTS;
+        }
+      }
+      arena_->Upload(devalloc_indices_, indices.data(),
+                     indices.size() * sizeof(int));
+      arena_->Upload(devalloc_c2e_, c2e.data(), c2e.size() * sizeof(int));
+      arena_->Upload(devalloc_vertices_, vertices.data(),
+                     vertices.size() * sizeof(int));
+      arena_->Upload(devalloc_ox_, ox.data(), ox.size() * sizeof(float));
+      arena_->Upload(devalloc_edges_, edges.data(), edges.size() * sizeof(int));
+      if (bsr_matvec_) {
+        std::vector<int> row_ptr;
+        std::vector<int> cols;
+        build_bsr_pattern(edges, n_verts_, row_ptr, cols);
+        TI_ASSERT(int(cols.size()) == n_blocks_);
+        arena_->Upload(devalloc_bsr_row_ptr_, row_ptr.data(),
+                       row_ptr.size() * sizeof(int));
+        arena_->Upload(devalloc_bsr_cols_, cols.data(),
+                       cols.size() * sizeof(int));
+      }
+      arena_->Flush();
+    }
+    upload_phase.End();
 
     memset(&host_ctx_, 0, sizeof(taichi::lang::RuntimeContext));
     host_ctx_.result_buffer = host_result_buffer_.data();
+    // The solver kernels may still be compiling on the loader's worker, so
+    // launch under its lock once the init kernels themselves are ready.
+    loader_lock.unlock();
+    loaded_kernels_.clear_field_kernel.get();
+    loaded_kernels_.init_kernel.get();
+    loaded_kernels_.get_matrix_kernel.get();
+    if (bsr_matvec_) {
+      loaded_kernels_.get_matrix_bsr_kernel.get();
+    }
+    demo::ProfileScope init_kernels_phase(
+        "init kernels", [this] { vulkan_runtime_->synchronize(); });
+    loader_lock.lock();
     loaded_kernels_.clear_field_kernel->launch(&host_ctx_);
 
-    host_ctx_.set_arg_devalloc(0, devalloc_x_, {N_VERTS}, {3, 1});
-    host_ctx_.set_arg_devalloc(1, devalloc_v_, {N_VERTS}, {3, 1});
-    host_ctx_.set_arg_devalloc(2, devalloc_f_, {N_VERTS}, {3, 1});
-    host_ctx_.set_arg_devalloc(3, devalloc_ox_, {N_VERTS}, {3, 1});
-    host_ctx_.set_arg_devalloc(4, devalloc_vertices_, {N_CELLS}, {4, 1});
+    host_ctx_.set_arg_devalloc(0, devalloc_x_, {n_verts_}, {3, 1});
+    host_ctx_.set_arg_devalloc(1, devalloc_v_, {n_verts_}, {3, 1});
+    host_ctx_.set_arg_devalloc(2, devalloc_f_, {n_verts_}, {3, 1});
+    host_ctx_.set_arg_devalloc(3, devalloc_ox_, {n_verts_}, {3, 1});
+    host_ctx_.set_arg_devalloc(4, devalloc_vertices_, {n_cells_}, {4, 1});
     // init(x, v, f, ox, vertices)
     loaded_kernels_.init_kernel->launch(&host_ctx_);
     // get_matrix(c2e, vertices)
-    host_ctx_.set_arg_devalloc(0, devalloc_c2e_, {N_CELLS}, {6, 1});
-    host_ctx_.set_arg_devalloc(1, devalloc_vertices_, {N_CELLS}, {4, 1});
+    host_ctx_.set_arg_devalloc(0, devalloc_c2e_, {n_cells_}, {6, 1});
+    host_ctx_.set_arg_devalloc(1, devalloc_vertices_, {n_cells_}, {4, 1});
     loaded_kernels_.get_matrix_kernel->launch(&host_ctx_);
+    if (bsr_matvec_) {
+      // get_matrix_bsr(vertices, bsr_row_ptr, bsr_cols, bsr_values)
+      host_ctx_.set_arg_devalloc(0, devalloc_vertices_, {n_cells_}, {4, 1});
+      set_bsr_args(1);
+      loaded_kernels_.get_matrix_bsr_kernel->launch(&host_ctx_);
+    }
+    // Still held for the render pipelines and buffers below.
+    init_kernels_phase.End();
     vulkan_runtime_->synchronize();
 
+    demo::ProfileScope wall_phase("build_wall");
     {
       build_wall(0, cornell_box_vertices_, cornell_box_indicies_,
                  glm::vec3(0.0, 1.0, 0.0), glm::vec3(0.0, 0.0, 1.0),
@@ -250,8 +515,10 @@ class FemApp {
                  glm::vec3(0.0, 1.0, 0.0), glm::vec3(1.0, 0.0, 0.0),
                  glm::vec3(0.0, 0.0, -1.0));
     }
+    wall_phase.End();
 
     {
+      demo::ProfileScope phase("box pipeline + buffers");
       auto vert_code =
           taichi::ui::read_file(path_prefix + "/shaders/render/box.vert.spv");
       auto frag_code =
@@ -283,22 +550,21 @@ class FemApp {
           source, raster_params, vertex_inputs, vertex_attribs);
 
       alloc_params = Device::AllocParams{};
-      alloc_params.host_write = true;
       // x
       alloc_params.size = sizeof(ColorVertex) * cornell_box_vertices_.size();
       alloc_params.usage = taichi::lang::AllocUsage::Vertex;
-      devalloc_box_verts_ = device_->allocate_memory(alloc_params);
+      devalloc_box_verts_ = arena_->Allocate(alloc_params);
       alloc_params.size = sizeof(int) * cornell_box_indicies_.size();
       alloc_params.usage = taichi::lang::AllocUsage::Index;
-      devalloc_box_indices_ = device_->allocate_memory(alloc_params);
-      load_data(vulkan_runtime_.get(), devalloc_box_verts_,
-                cornell_box_vertices_.data(),
-                sizeof(ColorVertex) * cornell_box_vertices_.size());
-      load_data(vulkan_runtime_.get(), devalloc_box_indices_,
-                cornell_box_indicies_.data(),
-                sizeof(int) * cornell_box_indicies_.size());
+      devalloc_box_indices_ = arena_->Allocate(alloc_params);
+      arena_->Upload(devalloc_box_verts_, cornell_box_vertices_.data(),
+                     sizeof(ColorVertex) * cornell_box_vertices_.size());
+      arena_->Upload(devalloc_box_indices_, cornell_box_indicies_.data(),
+                     sizeof(int) * cornell_box_indicies_.size());
+      arena_->Flush();
     }
     {
+      demo::ProfileScope phase("mesh pipeline");
       auto vert_code = taichi::ui::read_file(
           path_prefix + "/shaders/render/surface.vert.spv");
       auto frag_code = taichi::ui::read_file(
@@ -326,216 +592,295 @@ class FemApp {
           source, raster_params, vertex_inputs, vertex_attribs);
     }
 
-    render_constants_ = device_->allocate_memory(
+    // Mapped every frame, so this one stays host-visible.
+    render_constants_ = arena_->Allocate(
         {sizeof(RenderConstants), true, false, false, AllocUsage::Uniform});
+    arena_->Report("implicit_fem", demo::MillisecondsSince(alloc_begin_));
   }
 
   void run_render_loop(float g_x = 0, float g_y = -9.8, float g_z = 0) {
     using namespace taichi::lang;
+    simulate(g_x, g_y, g_z);
+
+    // Render elements
+    auto stream = device_->get_graphics_stream();
+    auto cmd_list = stream->new_command_list();
+    bool color_clear = true;
+    std::vector<float> clear_colors = {0.03, 0.05, 0.08, 1};
+    auto image = surface_->get_target_image();
+    cmd_list->begin_renderpass(
+        /*xmin=*/0, /*ymin=*/0, /*xmax=*/width_,
+        /*ymax=*/height_, /*num_color_attachments=*/1, &image, &color_clear,
+        &clear_colors, &depth_allocation_,
+        /*depth_clear=*/true);
+
+    RenderConstants* constants =
+        (RenderConstants*)device_->map(render_constants_);
+    constants->proj = glm::perspective(
+        glm::radians(55.0f), float(width_) / float(height_), 0.1f, 10.0f);
+    constants->proj[1][1] *= -1.0f;
+#ifdef ANDROID
+    constexpr float kCameraZ = 4.85f;
+#else
+    constexpr float kCameraZ = 4.8f;
+#endif
+    constants->view = glm::lookAt(glm::vec3(0.0, 0.0, kCameraZ),
+                                  glm::vec3(0, 0, 0), glm::vec3(0, 1.0, 0));
+    device_->unmap(render_constants_);
+
+    // Draw box
+    {
+      auto resource_binder = render_box_pipeline_->resource_binder();
+      resource_binder->buffer(0, 0, render_constants_.get_ptr(0));
+      resource_binder->vertex_buffer(devalloc_box_verts_.get_ptr(0));
+      resource_binder->index_buffer(devalloc_box_indices_.get_ptr(0), 32);
+
+      cmd_list->bind_pipeline(render_box_pipeline_.get());
+      cmd_list->bind_resources(resource_binder);
+      cmd_list->draw_indexed(cornell_box_indicies_.size());
+    }
+    // Draw the bodies, all in one draw: the index buffer already points each
+    // body's faces at its own copy of x.
+    {
+      auto resource_binder = render_mesh_pipeline_->resource_binder();
+      resource_binder->buffer(0, 0, render_constants_.get_ptr(0));
+      resource_binder->vertex_buffer(devalloc_x_.get_ptr(0));
+      resource_binder->index_buffer(devalloc_indices_.get_ptr(0), 32);
+
+      cmd_list->bind_pipeline(render_mesh_pipeline_.get());
+      cmd_list->bind_resources(resource_binder);
+      cmd_list->draw_indexed(num_bodies_ * N_FACES * 3);
+    }
+
+    cmd_list->end_renderpass();
+    stream->submit_synced(cmd_list.get());
+
+    surface_->present_image();
+  }
+
+  // Advances every body by one frame, NUM_SUBSTEPS implicit steps, under
+  // gravity (g_x, g_y, g_z), and waits for the GPU.
+  void simulate(float g_x = 0, float g_y = -9.8, float g_z = 0) {
+    if (!pipelines_reported_) {
+      // Every kernel is needed from here on, so nothing is lost by waiting.
+      demo::ProfileScope phase("wait for pipelines");
+      kernel_loader_->Wait();
+      pipeline_cache_->Report(
+          "implicit_fem", demo::MillisecondsSince(load_begin_),
+          kernel_loader_->mode() == demo::PipelineLoadMode::kOnFirstUse);
+      pipelines_reported_ = true;
+    }
     for (int i = 0; i < NUM_SUBSTEPS; i++) {
-      // get_force(x, f, vertices)
-      host_ctx_.set_arg_devalloc(0, devalloc_x_, {N_VERTS}, {3, 1});
-      host_ctx_.set_arg_devalloc(1, devalloc_f_, {N_VERTS}, {3, 1});
-      host_ctx_.set_arg_devalloc(2, devalloc_vertices_, {N_CELLS}, {4, 1});
-      host_ctx_.set_arg<float>(3, g_x);
-      host_ctx_.set_arg<float>(4, g_y);
-      host_ctx_.set_arg<float>(5, g_z);
-      loaded_kernels_.get_force_kernel->launch(&host_ctx_);
+      // f += elastic forces and gravity
+      compute_forces(colored_forces_, g_x, g_y, g_z);
       // get_b(v, b, f)
-      host_ctx_.set_arg_devalloc(0, devalloc_v_, {N_VERTS}, {3, 1});
-      host_ctx_.set_arg_devalloc(1, devalloc_b_, {N_VERTS}, {3, 1});
-      host_ctx_.set_arg_devalloc(2, devalloc_f_, {N_VERTS}, {3, 1});
+      host_ctx_.set_arg_devalloc(0, devalloc_v_, {n_verts_}, {3, 1});
+      host_ctx_.set_arg_devalloc(1, devalloc_b_, {n_verts_}, {3, 1});
+      host_ctx_.set_arg_devalloc(2, devalloc_f_, {n_verts_}, {3, 1});
       loaded_kernels_.get_b_kernel->launch(&host_ctx_);
 
-      // matmul_edge(mul_ans, v, edges)
-      host_ctx_.set_arg_devalloc(0, devalloc_mul_ans_, {N_VERTS}, {3, 1});
-      host_ctx_.set_arg_devalloc(1, devalloc_v_, {N_VERTS}, {3, 1});
-      host_ctx_.set_arg_devalloc(2, devalloc_edges_, {N_EDGES}, {2, 1});
-      loaded_kernels_.matmul_edge_kernel->launch(&host_ctx_);
+      // mul_ans = A @ v
+      matmul(devalloc_mul_ans_, devalloc_v_, bsr_matvec_);
       // add(r0, b, -1, mul_ans)
-      host_ctx_.set_arg_devalloc(0, devalloc_r0_, {N_VERTS}, {3, 1});
-      host_ctx_.set_arg_devalloc(1, devalloc_b_, {N_VERTS}, {3, 1});
+      host_ctx_.set_arg_devalloc(0, devalloc_r0_, {n_verts_}, {3, 1});
+      host_ctx_.set_arg_devalloc(1, devalloc_b_, {n_verts_}, {3, 1});
       host_ctx_.set_arg<float>(2, -1.0f);
-      host_ctx_.set_arg_devalloc(3, devalloc_mul_ans_, {N_VERTS}, {3, 1});
+      host_ctx_.set_arg_devalloc(3, devalloc_mul_ans_, {n_verts_}, {3, 1});
       loaded_kernels_.add_kernel->launch(&host_ctx_);
       // ndarray_to_ndarray(p0, r0)
-      host_ctx_.set_arg_devalloc(0, devalloc_p0_, {N_VERTS}, {3, 1});
-      host_ctx_.set_arg_devalloc(1, devalloc_r0_, {N_VERTS}, {3, 1});
+      host_ctx_.set_arg_devalloc(0, devalloc_p0_, {n_verts_}, {3, 1});
+      host_ctx_.set_arg_devalloc(1, devalloc_r0_, {n_verts_}, {3, 1});
       loaded_kernels_.ndarray_to_ndarray_kernel->launch(&host_ctx_);
       // dot2scalar(r0, r0)
-      host_ctx_.set_arg_devalloc(0, devalloc_r0_, {N_VERTS}, {3, 1});
-      host_ctx_.set_arg_devalloc(1, devalloc_r0_, {N_VERTS}, {3, 1});
+      host_ctx_.set_arg_devalloc(0, devalloc_r0_, {n_verts_}, {3, 1});
+      host_ctx_.set_arg_devalloc(1, devalloc_r0_, {n_verts_}, {3, 1});
       loaded_kernels_.dot2scalar_kernel->launch(&host_ctx_);
       // init_r_2()
       loaded_kernels_.init_r_2_kernel->launch(&host_ctx_);
 
       for (int i = 0; i < CG_ITERS; i++) {
-        // matmul_edge(mul_ans, p0, edges);
-        host_ctx_.set_arg_devalloc(0, devalloc_mul_ans_, {N_VERTS}, {3, 1});
-        host_ctx_.set_arg_devalloc(1, devalloc_p0_, {N_VERTS}, {3, 1});
-        host_ctx_.set_arg_devalloc(2, devalloc_edges_, {N_EDGES}, {2, 1});
-        loaded_kernels_.matmul_edge_kernel->launch(&host_ctx_);
+        // mul_ans = A @ p0
+        matmul(devalloc_mul_ans_, devalloc_p0_, bsr_matvec_);
         // dot2scalar(p0, mul_ans)
-        host_ctx_.set_arg_devalloc(0, devalloc_p0_, {N_VERTS}, {3, 1});
-        host_ctx_.set_arg_devalloc(1, devalloc_mul_ans_, {N_VERTS}, {3, 1});
+        host_ctx_.set_arg_devalloc(0, devalloc_p0_, {n_verts_}, {3, 1});
+        host_ctx_.set_arg_devalloc(1, devalloc_mul_ans_, {n_verts_}, {3, 1});
         loaded_kernels_.dot2scalar_kernel->launch(&host_ctx_);
         host_ctx_.set_arg_devalloc(0, devalloc_alpha_scalar_, {1});
         loaded_kernels_.update_alpha_kernel->launch(&host_ctx_);
         // add(v, v, alpha, p0)
-        host_ctx_.set_arg_devalloc(0, devalloc_v_, {N_VERTS}, {3, 1});
-        host_ctx_.set_arg_devalloc(1, devalloc_v_, {N_VERTS}, {3, 1});
+        host_ctx_.set_arg_devalloc(0, devalloc_v_, {n_verts_}, {3, 1});
+        host_ctx_.set_arg_devalloc(1, devalloc_v_, {n_verts_}, {3, 1});
         host_ctx_.set_arg<float>(2, 1.0f);
         host_ctx_.set_arg_devalloc(3, devalloc_alpha_scalar_, {1});
-        host_ctx_.set_arg_devalloc(4, devalloc_p0_, {N_VERTS}, {3, 1});
+        host_ctx_.set_arg_devalloc(4, devalloc_p0_, {n_verts_}, {3, 1});
         loaded_kernels_.add_scalar_ndarray_kernel->launch(&host_ctx_);
         // add(r0, r0, -alpha, mul_ans)
-        host_ctx_.set_arg_devalloc(0, devalloc_r0_, {N_VERTS}, {3, 1});
-        host_ctx_.set_arg_devalloc(1, devalloc_r0_, {N_VERTS}, {3, 1});
+        host_ctx_.set_arg_devalloc(0, devalloc_r0_, {n_verts_}, {3, 1});
+        host_ctx_.set_arg_devalloc(1, devalloc_r0_, {n_verts_}, {3, 1});
         host_ctx_.set_arg<float>(2, -1.0f);
         host_ctx_.set_arg_devalloc(3, devalloc_alpha_scalar_, {1});
-        host_ctx_.set_arg_devalloc(4, devalloc_mul_ans_, {N_VERTS}, {3, 1});
+        host_ctx_.set_arg_devalloc(4, devalloc_mul_ans_, {n_verts_}, {3, 1});
         loaded_kernels_.add_scalar_ndarray_kernel->launch(&host_ctx_);
 
         // r_2_new = dot(r0, r0)
-        host_ctx_.set_arg_devalloc(0, devalloc_r0_, {N_VERTS}, {3, 1});
-        host_ctx_.set_arg_devalloc(1, devalloc_r0_, {N_VERTS}, {3, 1});
+        host_ctx_.set_arg_devalloc(0, devalloc_r0_, {n_verts_}, {3, 1});
+        host_ctx_.set_arg_devalloc(1, devalloc_r0_, {n_verts_}, {3, 1});
         loaded_kernels_.dot2scalar_kernel->launch(&host_ctx_);
 
         host_ctx_.set_arg_devalloc(0, devalloc_beta_scalar_, {1});
         loaded_kernels_.update_beta_r_2_kernel->launch(&host_ctx_);
 
         // add(p0, r0, beta, p0)
-        host_ctx_.set_arg_devalloc(0, devalloc_p0_, {N_VERTS}, {3, 1});
-        host_ctx_.set_arg_devalloc(1, devalloc_r0_, {N_VERTS}, {3, 1});
+        host_ctx_.set_arg_devalloc(0, devalloc_p0_, {n_verts_}, {3, 1});
+        host_ctx_.set_arg_devalloc(1, devalloc_r0_, {n_verts_}, {3, 1});
         host_ctx_.set_arg<float>(2, 1.0f);
         host_ctx_.set_arg_devalloc(3, devalloc_beta_scalar_, {1});
-        host_ctx_.set_arg_devalloc(4, devalloc_p0_, {N_VERTS}, {3, 1});
+        host_ctx_.set_arg_devalloc(4, devalloc_p0_, {n_verts_}, {3, 1});
         loaded_kernels_.add_scalar_ndarray_kernel->launch(&host_ctx_);
       }
 
       // fill_ndarray(f, 0)
-      host_ctx_.set_arg_devalloc(0, devalloc_f_, {N_VERTS}, {3, 1});
+      host_ctx_.set_arg_devalloc(0, devalloc_f_, {n_verts_}, {3, 1});
       host_ctx_.set_arg<float>(1, 0);
       loaded_kernels_.fill_ndarray_kernel->launch(&host_ctx_);
 
       // add(x, x, dt, v)
-      host_ctx_.set_arg_devalloc(0, devalloc_x_, {N_VERTS}, {3, 1});
-      host_ctx_.set_arg_devalloc(1, devalloc_x_, {N_VERTS}, {3, 1});
+      host_ctx_.set_arg_devalloc(0, devalloc_x_, {n_verts_}, {3, 1});
+      host_ctx_.set_arg_devalloc(1, devalloc_x_, {n_verts_}, {3, 1});
       host_ctx_.set_arg<float>(2, DT);
-      host_ctx_.set_arg_devalloc(3, devalloc_v_, {N_VERTS}, {3, 1});
+      host_ctx_.set_arg_devalloc(3, devalloc_v_, {n_verts_}, {3, 1});
       loaded_kernels_.add_kernel->launch(&host_ctx_);
     }
     // floor_bound(x, v)
-    host_ctx_.set_arg_devalloc(0, devalloc_x_, {N_VERTS}, {3, 1});
-    host_ctx_.set_arg_devalloc(1, devalloc_v_, {N_VERTS}, {3, 1});
+    host_ctx_.set_arg_devalloc(0, devalloc_x_, {n_verts_}, {3, 1});
+    host_ctx_.set_arg_devalloc(1, devalloc_v_, {n_verts_}, {3, 1});
     loaded_kernels_.floor_bound_kernel->launch(&host_ctx_);
     vulkan_runtime_->synchronize();
+  }
 
-    // Render elements
-    auto stream = device_->get_graphics_stream();
-    auto cmd_list = stream->new_command_list();
-    bool color_clear = true;
-    std::vector<float> clear_colors = {0.03, 0.05, 0.08, 1};
-    auto image = surface_->get_target_image();
-    cmd_list->begin_renderpass(
-        /*xmin=*/0, /*ymin=*/0, /*xmax=*/width_,
-        /*ymax=*/height_, /*num_color_attachments=*/1, &image, &color_clear,
-        &clear_colors, &depth_allocation_,
-        /*depth_clear=*/true);
+  int num_bodies() const { return num_bodies_; }
+  int num_blocks() const { return n_blocks_; }
+
+  // Milliseconds per force evaluation of the current positions, averaged
+  // over `num_runs` back-to-back evaluations, one tet color at a time or all
+  // at once with atomics. Both see the same cell order, so with colored
+  // forces get_force runs on the color order rather than its own.
+  double time_forces(bool colored, int num_runs) {
+    kernel_loader_->Wait();
+    return demo::MillisecondsPerRun(
+        num_runs, [&] { compute_forces(colored, 0, -9.8, 0); },
+        [&] { vulkan_runtime_->synchronize(); });
+  }
 
-    RenderConstants* constants =
-        (RenderConstants*)device_->map(render_constants_);
-    constants->proj = glm::perspective(
-        glm::radians(55.0f), float(width_) / float(height_), 0.1f, 10.0f);
-    constants->proj[1][1] *= -1.0f;
-#ifdef ANDROID
-    constexpr float kCameraZ = 4.85f;
-#else
-    constexpr float kCameraZ = 4.8f;
-#endif
-    constants->view = glm::lookAt(glm::vec3(0.0, 0.0, kCameraZ),
-                                  glm::vec3(0, 0, 0), glm::vec3(0, 1.0, 0));
-    device_->unmap(render_constants_);
+  // Milliseconds per product of the system matrix with the current
+  // velocities, averaged over `num_runs` back-to-back launches, through the
+  // block-sparse gather (which needs FemOptions::bsr_matvec) or the per-edge
+  // scatter.
+  double time_matvec(bool bsr, int num_runs) {
+    kernel_loader_->Wait();
+    return demo::MillisecondsPerRun(
+        num_runs, [&] { matmul(devalloc_mul_ans_, devalloc_v_, bsr); },
+        [&] { vulkan_runtime_->synchronize(); });
+  }
 
-    // Draw box
-    {
-      auto resource_binder = render_box_pipeline_->resource_binder();
-      resource_binder->buffer(0, 0, render_constants_.get_ptr(0));
-      resource_binder->vertex_buffer(devalloc_box_verts_.get_ptr(0));
-      resource_binder->index_buffer(devalloc_box_indices_.get_ptr(0), 32);
+  taichi::lang::vulkan::VulkanDevice* device() { return device_; }
 
-      cmd_list->bind_pipeline(render_box_pipeline_.get());
-      cmd_list->bind_resources(resource_binder);
-      cmd_list->draw_indexed(cornell_box_indicies_.size());
-    }
-    // Draw mesh
-    {
-      auto resource_binder = render_mesh_pipeline_->resource_binder();
-      resource_binder->buffer(0, 0, render_constants_.get_ptr(0));
-      resource_binder->vertex_buffer(devalloc_x_.get_ptr(0));
-      resource_binder->index_buffer(devalloc_indices_.get_ptr(0), 32);
+  // The surface frames are rendered into; with a null window this is an
+  // offscreen surface.
+  taichi::lang::Surface &surface() { return *surface_; }
 
-      cmd_list->bind_pipeline(render_mesh_pipeline_.get());
-      cmd_list->bind_resources(resource_binder);
-      cmd_list->draw_indexed(N_FACES * 3);
-    }
+  void cleanup() {
+    arena_->Release();
+    device_->destroy_image(depth_allocation_);
+  }
 
-    cmd_list->end_renderpass();
-    stream->submit_synced(cmd_list.get());
+ private:
+  // f += elastic forces and gravity, through get_force(x, f, vertices, g) or
+  // get_force_rest(x, f, vertices, begin, g) followed by
+  // get_force_color(x, f, vertices, begin, end) per tet color. Every color
+  // is one range of the packed cells, N_COLORS dispatches whatever the
+  // number of bodies.
+  void compute_forces(bool colored, float g_x, float g_y, float g_z) {
+    host_ctx_.set_arg_devalloc(0, devalloc_x_, {n_verts_}, {3, 1});
+    host_ctx_.set_arg_devalloc(1, devalloc_f_, {n_verts_}, {3, 1});
+    host_ctx_.set_arg_devalloc(2, devalloc_vertices_, {n_cells_}, {4, 1});
+    if (!colored) {
+      host_ctx_.set_arg<float>(3, g_x);
+      host_ctx_.set_arg<float>(4, g_y);
+      host_ctx_.set_arg<float>(5, g_z);
+      loaded_kernels_.get_force_kernel->launch(&host_ctx_);
+      return;
+    }
+    TI_ASSERT(colored_forces_);
+    host_ctx_.set_arg<int32_t>(3, num_bodies_ * color_offsets_data[N_COLORS]);
+    host_ctx_.set_arg<float>(4, g_x);
+    host_ctx_.set_arg<float>(5, g_y);
+    host_ctx_.set_arg<float>(6, g_z);
+    loaded_kernels_.get_force_rest_kernel->launch(&host_ctx_);
+    for (int color = 0; color < N_COLORS; color++) {
+      host_ctx_.set_arg<int32_t>(3, num_bodies_ * color_offsets_data[color]);
+      host_ctx_.set_arg<int32_t>(4,
+                                 num_bodies_ * color_offsets_data[color + 1]);
+      loaded_kernels_.get_force_color_kernel->launch(&host_ctx_);
+    }
+  }
 
-    surface_->present_image();
+  // Binds bsr_row_ptr, bsr_cols and bsr_values to args first..first+2.
+  void set_bsr_args(int first) {
+    host_ctx_.set_arg_devalloc(first, devalloc_bsr_row_ptr_, {n_verts_ + 1});
+    host_ctx_.set_arg_devalloc(first + 1, devalloc_bsr_cols_, {n_blocks_});
+    host_ctx_.set_arg_devalloc(first + 2, devalloc_bsr_values_, {n_blocks_},
+                               {3, 3});
   }
 
-  void cleanup() {
-    device_->dealloc_memory(devalloc_x_);
-    device_->dealloc_memory(devalloc_v_);
-    device_->dealloc_memory(devalloc_f_);
-    device_->dealloc_memory(devalloc_mul_ans_);
-    device_->dealloc_memory(devalloc_c2e_);
-    device_->dealloc_memory(devalloc_b_);
-    device_->dealloc_memory(devalloc_r0_);
-    device_->dealloc_memory(devalloc_p0_);
-    device_->dealloc_memory(devalloc_indices_);
-    device_->dealloc_memory(devalloc_vertices_);
-    device_->dealloc_memory(devalloc_edges_);
-    device_->dealloc_memory(devalloc_ox_);
-    device_->dealloc_memory(devalloc_alpha_scalar_);
-    device_->dealloc_memory(devalloc_beta_scalar_);
-
-    device_->dealloc_memory(devalloc_box_indices_);
-    device_->dealloc_memory(devalloc_box_verts_);
-    device_->dealloc_memory(render_constants_);
-    device_->destroy_image(depth_allocation_);
+  // ret = A @ vel, through matmul_bsr(ret, vel, bsr_row_ptr, bsr_cols,
+  // bsr_values) or matmul_edge(ret, vel, edges).
+  void matmul(taichi::lang::DeviceAllocation& ret,
+              taichi::lang::DeviceAllocation& vel,
+              bool bsr) {
+    host_ctx_.set_arg_devalloc(0, ret, {n_verts_}, {3, 1});
+    host_ctx_.set_arg_devalloc(1, vel, {n_verts_}, {3, 1});
+    if (bsr) {
+      TI_ASSERT(bsr_matvec_);
+      set_bsr_args(2);
+      loaded_kernels_.matmul_bsr_kernel->launch(&host_ctx_);
+    } else {
+      host_ctx_.set_arg_devalloc(2, devalloc_edges_, {n_edges_}, {2, 1});
+      loaded_kernels_.matmul_edge_kernel->launch(&host_ctx_);
+    }
   }
 
- private:
   struct RenderConstants {
     glm::mat4 proj;
     glm::mat4 view;
   };
 
   struct ImplicitFemKernels {
-    taichi::lang::aot::Kernel* init_kernel{nullptr};
-    taichi::lang::aot::Kernel* get_vertices_kernel{nullptr};
-    taichi::lang::aot::Kernel* get_indices_kernel{nullptr};
-    taichi::lang::aot::Kernel* get_force_kernel{nullptr};
-    taichi::lang::aot::Kernel* advect_kernel{nullptr};
-    taichi::lang::aot::Kernel* floor_bound_kernel{nullptr};
-    taichi::lang::aot::Kernel* get_b_kernel{nullptr};
-    taichi::lang::aot::Kernel* matmul_cell_kernel{nullptr};
-    taichi::lang::aot::Kernel* ndarray_to_ndarray_kernel{nullptr};
-    taichi::lang::aot::Kernel* fill_ndarray_kernel{nullptr};
-    taichi::lang::aot::Kernel* add_ndarray_kernel{nullptr};
-    taichi::lang::aot::Kernel* dot_kernel{nullptr};
-    taichi::lang::aot::Kernel* add_kernel{nullptr};
-    taichi::lang::aot::Kernel* update_alpha_kernel{nullptr};
-    taichi::lang::aot::Kernel* update_beta_r_2_kernel{nullptr};
-    taichi::lang::aot::Kernel* add_scalar_ndarray_kernel{nullptr};
-    taichi::lang::aot::Kernel* dot2scalar_kernel{nullptr};
-    taichi::lang::aot::Kernel* init_r_2_kernel{nullptr};
-    taichi::lang::aot::Kernel* get_matrix_kernel{nullptr};
-    taichi::lang::aot::Kernel* clear_field_kernel{nullptr};
-    taichi::lang::aot::Kernel* matmul_edge_kernel{nullptr};
+    demo::Lazy<taichi::lang::aot::Kernel*> init_kernel;
+    demo::Lazy<taichi::lang::aot::Kernel*> get_vertices_kernel;
+    demo::Lazy<taichi::lang::aot::Kernel*> get_indices_kernel;
+    demo::Lazy<taichi::lang::aot::Kernel*> get_force_kernel;
+    demo::Lazy<taichi::lang::aot::Kernel*> advect_kernel;
+    demo::Lazy<taichi::lang::aot::Kernel*> floor_bound_kernel;
+    demo::Lazy<taichi::lang::aot::Kernel*> get_b_kernel;
+    demo::Lazy<taichi::lang::aot::Kernel*> matmul_cell_kernel;
+    demo::Lazy<taichi::lang::aot::Kernel*> ndarray_to_ndarray_kernel;
+    demo::Lazy<taichi::lang::aot::Kernel*> fill_ndarray_kernel;
+    demo::Lazy<taichi::lang::aot::Kernel*> add_ndarray_kernel;
+    demo::Lazy<taichi::lang::aot::Kernel*> dot_kernel;
+    demo::Lazy<taichi::lang::aot::Kernel*> add_kernel;
+    demo::Lazy<taichi::lang::aot::Kernel*> update_alpha_kernel;
+    demo::Lazy<taichi::lang::aot::Kernel*> update_beta_r_2_kernel;
+    demo::Lazy<taichi::lang::aot::Kernel*> add_scalar_ndarray_kernel;
+    demo::Lazy<taichi::lang::aot::Kernel*> dot2scalar_kernel;
+    demo::Lazy<taichi::lang::aot::Kernel*> init_r_2_kernel;
+    demo::Lazy<taichi::lang::aot::Kernel*> get_matrix_kernel;
+    demo::Lazy<taichi::lang::aot::Kernel*> clear_field_kernel;
+    demo::Lazy<taichi::lang::aot::Kernel*> matmul_edge_kernel;
+    demo::Lazy<taichi::lang::aot::Kernel*> get_matrix_bsr_kernel;
+    demo::Lazy<taichi::lang::aot::Kernel*> matmul_bsr_kernel;
+    demo::Lazy<taichi::lang::aot::Kernel*> get_force_rest_kernel;
+    demo::Lazy<taichi::lang::aot::Kernel*> get_force_color_kernel;
   };
 
   std::vector<uint64_t> host_result_buffer_;
@@ -544,7 +889,14 @@ class FemApp {
   taichi::lang::vulkan::VulkanDevice* device_{nullptr};
   std::unique_ptr<taichi::lang::vulkan::VkRuntime> vulkan_runtime_{nullptr};
   std::unique_ptr<taichi::lang::aot::Module> module_{nullptr};
+  std::unique_ptr<demo::PipelineCacheStore> pipeline_cache_{nullptr};
+  std::unique_ptr<demo::AsyncModuleLoader> kernel_loader_{nullptr};
   ImplicitFemKernels loaded_kernels_;
+  // Owns every buffer below.
+  std::unique_ptr<demo::DeviceArena> arena_{nullptr};
+  std::chrono::steady_clock::time_point alloc_begin_;
+  std::chrono::steady_clock::time_point load_begin_;
+  bool pipelines_reported_{false};
   taichi::lang::RuntimeContext host_ctx_;
 
   std::vector<ColorVertex> cornell_box_vertices_;
@@ -553,6 +905,16 @@ class FemApp {
   int width_{0};
   int height_{0};
 
+  int num_bodies_{1};
+  bool bsr_matvec_{false};
+  bool colored_forces_{false};
+  // Sizes of the packed arrays, num_bodies_ copies of the mesh.
+  int n_verts_{N_VERTS};
+  int n_cells_{N_CELLS};
+  int n_edges_{N_EDGES};
+  // One diagonal block per vertex and two per edge.
+  int n_blocks_{N_VERTS + 2 * N_EDGES};
+
   taichi::lang::DeviceAllocation devalloc_x_;
   taichi::lang::DeviceAllocation devalloc_v_;
   taichi::lang::DeviceAllocation devalloc_f_;
@@ -567,6 +929,9 @@ class FemApp {
   taichi::lang::DeviceAllocation devalloc_ox_;
   taichi::lang::DeviceAllocation devalloc_alpha_scalar_;
   taichi::lang::DeviceAllocation devalloc_beta_scalar_;
+  taichi::lang::DeviceAllocation devalloc_bsr_row_ptr_;
+  taichi::lang::DeviceAllocation devalloc_bsr_cols_;
+  taichi::lang::DeviceAllocation devalloc_bsr_values_;
 
   std::unique_ptr<taichi::lang::Surface> surface_{nullptr};
   std::unique_ptr<taichi::lang::Pipeline> render_box_pipeline_{nullptr};
@@ -2,8 +2,11 @@ constexpr int N_VERTS = 616;
 constexpr int N_CELLS = 1770;
 constexpr int N_FACES = 1138;
 constexpr int N_EDGES = 2954;
-float ox_data[616][3] = {{0.08539670151711275,0.8035823870907268,-0.0,},{0.3673027003709913,0.4480827668269865,-0.5752464217440005,},{0.23344442848750271,0.7851012937625285,-0.43495129446703007,},{0.04489520489782714,0.787301389270448,-0.043050998437461845,},{0.49615325614333633,0.36107220108974813,-0.5238527357581374,},{0.08485096087727581,0.848765081542582,-0.02151276527046806,},{0.6381763372018298,0.21065304251068215,-0.4253230007320863,},{0.02708831624856434,0.8190998110678982,-0.07841247818443138,},{0.640576669911784,0.23680063419692876,-0.46505113325193753,},{0.43448988894740265,0.3608781264571689,-0.6553618753262455,},{0.03551792539705614,0.8560890532299545,-0.08840045799877504,},{0.0725758316541611,0.8571320462806585,-0.0677894547164593,},{0.037501841461219605,0.7426303018620473,-0.05163275346130213,},{0.4024158515892398,0.37197834157159154,-0.6517120942277773,},{0.5404080592067075,0.5176733641060494,-0.5202335822858807,},{0.41923391244243025,0.7550452068393408,-0.06478457367832696,},{0.46647918105299635,0.7252598734238928,-0.11367784142840898,},{0.5665235018079892,0.6346485374051627,-0.5401647581069111,},{0.44578151415707457,0.7520390027935968,-0.07160196575116967,},{0.545833581121634,0.6671326740477703,-0.5855293661053785,},{0.02223069535097115,0.783083177951602,-0.06836397077185123,},{0.06997446793760519,0.868287448011589,-0.09264294650729629,},{0.2256340530516792,0.7680516946702176,-0.4975764154312698,},{0.06064203839487164,0.820646473116386,-0.06746776541566814,},{0.2300770433637575,0.7238300329475201,-0.516477563676191,},{0.5639577931465692,0.8573412137840725,-0.5198749810727223,},{0.1012199387037344,0.9191871891056146,-0.0812957086726655,},{0.16349218707777458,0.7118202990513176,-0.44192641550734274,},{0.05714638768316964,0.782612121091447,-0.07856177959341461,},{0.2301753428293087,0.8167179343141274,-0.4533499247307895,},{0.2988045104769304,0.568461641808787,-0.43614139934911994,},{0.5107587971241255,0.005722603274139562,-0.5293048501260595,},{0.3998023360477702,0.7277726617808438,-0.09997393013501094,},{0.5749253277966347,0.724268676121188,-0.5680850476921092,},{0.7661297615126635,0.8935028485346137,-0.09349641871762061,},{0.7989257971997354,0.8954195558121015,-0.11115737962731008,},{0.13969061863902082,0.052937635868747335,-0.48678669300422023,},{0.4388088340658056,0.7140375936581895,-0.12794158339270884,},{0.08593007203578001,0.7881895242801996,-0.1464855195824641,},{0.8091384237065502,0.8611057657928577,-0.09131219930104183,},{0.7545415378415569,0.9260573691821651,-0.13532178290357966,},{0.38033096490715707,0.7335302586063134,-0.1259307441236467,},{0.011755319532467673,0.74616213683193,-0.10116642304584003,},{0.03625814815581673,0.7446564218690248,-0.1653999640538832,},{0.46435183111860767,0.7676241647604884,-0.12503367881251598,},{0.6057971150628321,0.2524888584567738,-0.5126803333793961,},{0.5285089948972259,0.16758147130485795,-0.5593805837122814,},{0.407278552836062,0.421671499723723,-0.599007903052119,},{0.09754773262624758,0.8332682964841536,-0.16960752516145486,},{0.04521272672464135,0.8804477401740061,-0.1373668880697855,},{0.17928082761534964,0.10543358564632001,-0.5266364099235891,},{0.7945540508475486,0.8550801937756329,-0.14227312949710957,},{0.39580390275338395,0.7238634388897163,-0.13447783634805976,},{0.5448063318615095,0.5284638141872854,-0.46534510554326297,},{0.8043527082726543,0.8123332224873457,-0.15011816773236034,},{0.41680054290940366,0.7105390323297417,-0.15432070141100748,},{0.4829729515724311,0.7468962076052961,-0.15759501294926775,},{0.6317662991726375,0.4184049476251055,-0.4296990667041254,},{0.01731320835894735,0.8307474377807712,-0.13275508198645097,},{0.20795278397514974,0.45778014801941463,-0.4722117134992619,},{0.3868577914332744,0.7621574311584566,-0.10988193413922577,},{0.2867163222293526,0.14665903203074193,-0.4816401933946067,},{0.07107117509734528,0.7505528683433452,-0.14540336550645297,},{0.41286360962384855,0.7997808570191938,-0.1522252558051755,},{0.8327705810206224,0.8620439104903325,-0.1710396147507675,},{0.3956163135041174,0.7289167326130837,-0.16677556121817513,},{0.37380023550858504,0.7476139392346574,-0.17215411636288538,},{0.47295672554557705,0.8216460715174256,-0.1760260304393622,},{0.02078021595585551,0.7850788687835097,-0.1765487507467551,},{0.23691229603935848,0.823184861670624,-0.4205542396407347,},{0.7805156832299063,0.8915338824564627,-0.15736600033167802,},{0.3275746340015206,0.6106320463798841,-0.575746981673897,},{0.44465378246883946,0.7242717190386948,-0.1548136540471365,},{0.4532212556255111,0.781423927955356,-0.1506133033310487,},{0.22371377365363973,0.7529576331287987,-0.4712866004267626,},{0.24950957761592843,0.8389215741594388,-0.4625775720706743,},{0.3775607854193449,0.828467829515387,-0.16077353873643907,},{0.5908211981011402,0.8036393425684116,-0.5071330286138102,},{0.8326155245285283,0.8122248020135648,-0.15805197977835786,},{0.04926152691880595,0.84666738682381,-0.19073006933684444,},{0.23286184208567923,0.001072893022729089,-0.45780363140452285,},{0.4396546196019057,0.6934280456842467,-0.18625631909779347,},{0.37335353521856196,0.7813287375576924,-0.1832121447335929,},{0.2953134241414888,0.9878264777614659,-0.17789993842061072,},{0.05517027736391534,0.7069609582438292,-0.1989065209788325,},{0.13083665479906795,0.0032373996258931136,-0.4125471329730475,},{0.3923852113944561,0.8386174808598835,-0.1767582490020719,},{0.4098763312019902,0.31111923731786406,-0.6561033549422371,},{0.7923308027064238,0.9091515810172488,-0.14873397101859218,},{0.40301048397536804,0.6949247641953921,-0.18147834325842618,},{0.17860563068070537,0.2129976766001827,-0.5355156432089259,},{0.45894783453752397,0.7323178544309279,-0.18181445334218516,},{0.773033678283313,0.9342669621648269,-0.16516513020280182,},{0.8472041971622679,0.8301800659664825,-0.1951496424141952,},{0.4384605589270568,0.38103915103659963,-0.4975098681484,},{0.22671475181931744,0.06846299789158894,-0.44395429511444384,},{0.32612441920792734,0.952728408829991,-0.21544993735889711,},{0.3870604166640483,0.7131800201242687,-0.1904999321627847,},{0.4945512923766781,0.8467838776440224,-0.23055623672072456,},{0.780471759377197,0.7880922170703571,-0.2013946352438247,},{0.7830290007899018,0.9242216961208954,-0.21371434982345458,},{0.2735744907197963,0.9919173495976834,-0.18037819627889556,},{0.31159958169145335,1.0,-0.2190943602765377,},{0.48190021731061533,0.7765668362608075,-0.19869636121970982,},{0.3839747726262582,0.4022956695777906,-0.522927159632974,},{0.13290782321522474,0.8325756358490346,-0.23480540641768502,},{0.3487345531419414,0.925746197791887,-0.18392412127984317,},{0.6181762326842284,0.0031432676343188344,-0.527784317477903,},{0.6322272350245627,0.7837180893044692,-0.44776318110829805,},{0.1389831403186504,0.8152830664088301,-0.19524496511262004,},{0.5917979746208775,0.45437002974981067,-0.4998344586725828,},{0.5512435576971229,0.14112978631905615,-0.4439778380348945,},{0.4890334245304531,0.867077359099524,-0.21106615163744355,},{0.5437917834744576,0.8857981152565866,-0.47856148853174013,},{0.3588538348467108,0.7668584079548215,-0.1975538118462234,},{0.4994136099512929,0.9169509093395143,-0.19037881081593122,},{0.3550268434936901,0.8441784787542508,-0.21164185839968602,},{0.506056166568246,0.0037613106401365483,-0.5754328335164928,},{0.42119937122740253,0.867851583153906,-0.20372465009921564,},{0.5369095640286403,0.9810141131175478,-0.1999469341646937,},{0.4387660810748326,0.7126475095605491,-0.21754988119060895,},{0.7613104416854297,0.7441026108827564,-0.20778244674514,},{0.3645793487375961,0.9375499394029438,-0.19117274768372788,},{0.48014489711664393,0.7719518549592047,-0.2348980169505058,},{0.36212001650319703,0.8775862070106043,-0.21444537767931368,},{0.31565975975107885,0.9617763255858229,-0.2476616005838697,},{0.11287629726684492,0.7019422611695084,-0.2026772249730123,},{0.6547406571021596,0.3114031415212643,-0.4612241352838788,},{0.15823925150579773,0.32733769656833656,-0.4622878334037063,},{0.30239918830837015,0.9236204553117466,-0.23551453849757006,},{0.3495550163123532,0.980016829979829,-0.22221262306699494,},{0.0,0.7730197867033899,-0.23585997578499168,},{0.7522525362221294,0.8889104245127909,-0.2075820772423441,},{0.25955629896823273,0.8147354074079562,-0.5400986738767054,},{0.5167360793635223,0.9877184541899685,-0.22622265913813597,},{0.6148941815514395,0.21862998460482194,-0.5546618124635387,},{0.019889368780499916,0.7359082324876295,-0.22006121423918693,},{0.3722340458677479,0.8092696660616334,-0.6332098327777915,},{0.5716743011923409,0.23207068353386714,-0.5481779506096122,},{0.5064164876912995,0.7790416542993018,-0.23342703093740844,},{0.4089126590726471,0.9177203044161134,-0.5687791636356011,},{0.617505864727367,0.2985422440630199,-0.5008366369384651,},{0.41309734537861215,0.33607147839684026,-0.5984525706070972,},{0.25347330842065907,0.6346599152706236,-0.43200428839687266,},{0.8134206685938038,0.7837801383614591,-0.21418620048817663,},{0.19684864878917357,0.6955010001606794,-0.4575873858103862,},{0.6015177807923242,0.09059420307015822,-0.5678302364260908,},{0.5226207510700983,0.0725655121947896,-0.5348538748015407,},{0.13635095052474128,0.6939774907453965,-0.23067629966148867,},{0.38851536782489154,0.336977566619883,-0.745137996639693,},{0.1453603677590719,0.7856092625350507,-0.23405327659041888,},{0.8268738037943991,0.8187621133750052,-0.24786421919960552,},{0.8148182276844503,0.883769746136669,-0.23357428168459354,},{0.1257823688199917,0.7191144369170457,-0.22836434385999776,},{0.6168321231010955,0.1377591598266622,-0.5595643494695501,},{0.5250244574494624,0.13264031107613375,-0.4645938356709445,},{0.36128233438871865,0.8907997455327159,-0.23498440934755152,},{0.2968466576627179,0.8924355121438539,-0.49225686642604244,},{0.39247156410127343,0.8931391537421502,-0.22332242800209118,},{0.3454006401107728,0.8726933279601585,-0.2479344709037882,},{0.5680888844141831,0.9670535383474749,-0.23802547464386453,},{0.6994690307401481,0.004174618218039707,-0.41447312776396966,},{0.1719434935510987,0.7775706682862044,-0.24521972543490736,},{0.6749295548059543,0.025055316602005776,-0.46489925197811144,},{0.7563131773344189,0.777088167410208,-0.2202204382052582,},{0.6161056596214969,0.05481240380494341,-0.43129146512575084,},{0.27699023177175003,0.2338607128325322,-0.4902982859576436,},{0.6160109322764974,0.6799515593993043,-0.4769487422530463,},{0.7988594483680074,0.7328153052929367,-0.2337322487934336,},{0.17253937617942003,0.7298713487553244,-0.2761706947066664,},{0.5343372403291616,0.2451498044826277,-0.5076134126776278,},{0.08449957005560142,0.8406923536973533,-0.25147609612999766,},{0.7669145696279392,0.9205330185986427,-0.23906701238619568,},{0.6013636504055582,0.16840180217450856,-0.41923024638833806,},{0.4508849895591548,0.451778059387298,-0.5768020802442484,},{0.5067333480143078,0.8681890162452768,-0.256499026828676,},{0.3495255132426117,0.7911357299307519,-0.2750829178483054,},{0.5975222316545317,0.057159353157764485,-0.5586044412968623,},{0.026724026102675626,0.8300105886914205,-0.24460928972285703,},{0.3937392435346769,0.7232694746224319,-0.24452984311577292,},{0.32365978832804326,0.831142090951349,-0.25328504443751043,},{0.46845271150740786,0.8893176462556802,-0.23183935565295685,},{0.05947547643323238,0.7046208223802085,-0.2852971981146348,},{0.6586863288529903,0.35321072382341795,-0.4354107088602018,},{0.4398932967900992,0.7191285269481107,-0.2839713460365437,},{0.44986361445282624,0.48833381810537246,-0.5920842734680548,},{0.7388401496559751,0.8531782380330158,-0.2513245456080745,},{0.42151772853352354,0.3152523924773523,-0.7216894066317476,},{0.7530988641913505,0.8640972183037311,-0.2632067415705066,},{0.1460201516550396,0.6947478119273238,-0.2775318049376099,},{0.3503005311015607,0.9152716157779507,-0.5383497239643844,},{0.2082570757258467,0.005431078546895739,-0.5485993285339468,},{0.7802163527577533,0.8612729278045993,-0.2765484795301947,},{0.3414640309620826,0.34026995044211944,-0.4993345602464922,},{0.10181006624894473,0.6805103978144974,-0.2694590770923812,},{0.7450281208575392,0.688439380882712,-0.26328552667378485,},{0.7212675656547489,0.7146156156837526,-0.24515463346041041,},{0.4035535785999815,0.7119848811982163,-0.2863962205376954,},{0.8429455679608836,0.7867290561776153,-0.2713327204721073,},{0.30841490391888754,0.3571984129729893,-0.5426502263566799,},{0.2777956788057688,0.6491489654312003,-0.5651460524330407,},{0.37121734759332686,0.7054158838044751,-0.3054434288229512,},{0.4976518930155187,0.8775072234561841,-0.28541263052875787,},{0.29293690556854574,0.7355303815137206,-0.6152850641503239,},{0.3356169326716797,0.5273263583931042,-0.5847821975566564,},{0.5639003746162203,0.28618447316943874,-0.5184695500867861,},{0.5194780126388242,0.5538981724700507,-0.5685144959628754,},{0.3541418837022067,0.886523784931618,-0.28732232586590356,},{0.4090650298592896,0.9263829613554108,-0.28394971486209203,},{0.3347323697824797,0.8780672525782276,-0.5775296682803169,},{0.041705235094814365,0.7945327504249998,-0.30739850332117913,},{0.46910140859958926,0.9105396144530908,-0.28416185913263226,},{0.24946400000370447,0.3740161701959328,-0.5546372706723413,},{0.5755220042295232,0.06496681797684223,-0.4465203411428047,},{0.34064892597249835,0.5832555790734859,-0.5917625841672636,},{0.597974038753936,0.11621027644839403,-0.4619915458490604,},{0.38016136194637185,0.925378930878872,-0.2793472359824201,},{0.3593069451086127,0.637258963723859,-0.2794839026687115,},{0.3837086827203498,0.39833482292965355,-0.5816822584216215,},{0.6761568428169717,0.7542324171130771,-0.2883661788715552,},{0.3180912492902892,0.8012283596471831,-0.27632303903315664,},{0.4935395223056107,0.8039171080164934,-0.29722576549385793,},{0.6869730915466363,0.8082123845287227,-0.2914708146836117,},{0.8048301155693455,0.8389791911409294,-0.31549378844618775,},{0.48363764382663826,0.6791289794167138,-0.29036709558352936,},{0.6971196338232454,0.7744582928796194,-0.2967065511566361,},{0.520631212223585,0.8094591207516325,-0.2845552554459789,},{0.43964591421182064,0.6082621428449996,-0.30348749436977573,},{0.02734636888323145,0.7307873330753027,-0.2902467018908623,},{0.3623613397066139,0.4167112729708024,-0.5532558522745576,},{0.6423067008152572,0.02656427293355969,-0.44290843775226035,},{0.3968021516866595,0.5333425370562856,-0.5999744262628653,},{0.7154045912730054,0.6817400010888354,-0.3001264596825668,},{0.1966134180358087,0.052732503538549226,-0.540180898799774,},{0.4740871760144542,0.7497236733226961,-0.28664084464510353,},{0.4152492635643506,0.6129628550398422,-0.3167276253448833,},{0.4203835597517536,0.6672258137836359,-0.30599446149323506,},{0.44029275247830757,0.5423485144708258,-0.6013776742862423,},{0.7663782884925262,0.686224666140683,-0.3047914506718927,},{0.5123763062302216,0.7352131242884287,-0.3106815467096768,},{0.3184259040656752,0.7247040117758263,-0.30646505530072593,},{0.22590493886018007,0.20182778793590372,-0.5354212466158292,},{0.3178726222824515,0.777737036493379,-0.3058218089999048,},{0.49205590156982143,0.9306345124660723,-0.4756493503271897,},{0.3785927379715291,0.29458243597585804,-0.7492396509879461,},{0.27538727574938304,0.7418653388609475,-0.3056558376950138,},{0.7322301390262705,0.8484881098990671,-0.3043534690020309,},{0.2388945583440073,0.7757957874246937,-0.33779791733464776,},{0.16569532550320104,0.7842031700453085,-0.29505603301062755,},{0.5219651346481076,0.8376473193782049,-0.3179223673686523,},{0.2805903339343978,0.5163115923713,-0.4423240652901611,},{0.49552013085074487,0.47451996487944,-0.5654341373404941,},{0.5479437121119562,0.7313615183787918,-0.5996710606174966,},{0.35605482040800107,0.5670861107948756,-0.3494413434983536,},{0.3001156771705313,0.6179215537189712,-0.3194470013404052,},{0.3837109715235181,0.8634171262409234,-0.6161112824038467,},{0.5482775730827751,0.010007824928519544,-0.6012622418721193,},{0.5150342946725593,0.02918078508726987,-0.5940303515145229,},{0.30680956648281943,0.8234541598699907,-0.3076599296252561,},{0.7638241561477089,0.8495467805899702,-0.31767470034373724,},{0.375006362012853,0.9131584418701216,-0.32593470653144385,},{0.6749173831359264,0.6680911269120852,-0.3289662594030286,},{0.08811978193394743,0.735478188863438,-0.3305417167121859,},{0.5172996806061175,0.7813434890925631,-0.32501812685804016,},{0.6428008441582368,0.1764857094340564,-0.45682857479468086,},{0.13359492721837454,0.6702094605496,-0.3209535696432199,},{0.5461043346293737,0.6824947107809444,-0.3092828630625602,},{0.21377606812854164,0.10364785612239304,-0.5404097791166027,},{0.3789764829443482,0.5479810209266068,-0.3308172330473278,},{0.26135148799658353,0.05931473100840766,-0.4879361881676682,},{0.24490028524705623,0.7217453037033431,-0.3242032335496738,},{0.536577026065433,0.06753398194663501,-0.5790707075464553,},{0.5947699127694778,0.7536934899624406,-0.5151096399560471,},{0.6826309144145716,0.7031699460828094,-0.31114459937378086,},{0.5895270320553501,0.7800423772568112,-0.36383525618157114,},{0.44910914951712544,0.9181921550808356,-0.3284012491573269,},{0.13438152139392615,0.0051534453995750774,-0.31441619874643706,},{0.19403388394484625,0.3665274576007482,-0.5226431098987364,},{0.4516187097355037,0.39314395625978077,-0.5397697741844304,},{0.565580792734254,0.4217070886284784,-0.5468243153716749,},{0.5564180389177243,0.45435772577902167,-0.5289794564039556,},{0.31592733804055034,0.8374490666875879,-0.5906165949739868,},{0.2855156928217114,0.5133248365374484,-0.5226259769501646,},{0.11869964757061742,0.7941177890875819,-0.3277229299247189,},{0.2661000930669705,0.793739938113673,-0.31837450521995964,},{0.43283841162087555,0.9520263548408286,-0.34090887050805013,},{0.2691962616303119,0.7027309060068581,-0.31417891733127407,},{0.7496656594389218,0.6912614884192845,-0.33904672406446995,},{0.33441961078306776,0.8763872313624776,-0.3380306277585122,},{0.4451272538178858,0.3460579367524304,-0.6131692442272714,},{0.056568894860651316,0.011078534988689251,-0.4118063214758997,},{0.4572147871766959,0.9271191489409556,-0.543974292374495,},{0.10433714308810224,0.05060351968975999,-0.4388499068371115,},{0.439690856780391,0.5317017430162232,-0.33800781910728606,},{0.3806463434616402,0.539500409834683,-0.3412635159284494,},{0.13472464341802726,0.6826605497850742,-0.3738248434501631,},{0.3761038365170079,0.9446716232264836,-0.3415249686926787,},{0.509853859917705,0.6044627295856453,-0.30969147396344177,},{0.1822293485292224,0.6752945726060294,-0.30682107664904135,},{0.2185179920104894,0.6646949002224043,-0.33998932068255816,},{0.6096962830961105,0.7237542907617488,-0.3422425217160123,},{0.5731925847275575,0.7305927186556179,-0.33477033348589813,},{0.16118902927690168,0.08182100884490126,-0.46806732600515016,},{0.4678892028753454,0.6034413015590124,-0.5945861470122089,},{0.38362770803947416,0.4845439305008226,-0.3564138780587854,},{0.42147314119249696,0.6773905474149061,-0.6209521672551515,},{0.36682321595234957,0.6144581182426146,-0.6044465227424016,},{0.6757130399136183,0.7557260927067155,-0.32790801868959935,},{0.5070947275434508,0.8617543702745063,-0.3456304134577393,},{0.07887050341961091,0.021182807172103624,-0.3454561601251989,},{0.49741236248741577,0.5612398724594203,-0.3671086482295413,},{0.1288273369887593,0.7929624065402617,-0.35112447378199124,},{0.8118796293276656,0.8118164557142056,-0.35707109531998626,},{0.41943446650478794,0.6854212697684625,-0.6446361203172228,},{0.1886813258997064,0.006166009275209448,-0.37496504448513873,},{0.45622009051885787,0.5521654294009732,-0.3296666199424479,},{0.4516110958266983,0.3843200379226902,-0.5955605421182449,},{0.10878039800170289,0.6989532562227168,-0.36937532409552093,},{0.41799033225417814,0.35677024603509505,-0.5758817961495319,},{0.7529705324530129,0.7326519138528886,-0.37158737297721234,},{0.5212159815879678,0.8241479450615798,-0.6030010046258301,},{0.5793171838645199,0.6709364532322433,-0.3586105271318763,},{0.2701396983582336,0.824897825775906,-0.36491732426208756,},{0.4397764024525651,0.47060062098008276,-0.3554962862845587,},{0.4893532946957781,0.5371245527655456,-0.3817840856869694,},{0.2835485128038362,0.6046976295871073,-0.37583582163502444,},{0.10217111502618467,0.703412717979561,-0.34593300514365516,},{0.7053889605995766,0.7826903108412999,-0.35885799570564964,},{0.5825557741972636,0.04390804276833788,-0.39878783396598455,},{0.39298688218107863,0.3935020414999705,-0.45135480279215473,},{0.42587641944659793,0.39212580929202495,-0.43469727700557864,},{0.5317938243459993,0.9015578480778453,-0.4958408940462078,},{0.1774809419099772,0.4043253021699773,-0.41373572962646005,},{0.24398079495690675,0.6769937112817689,-0.3420651328554321,},{0.8185250965613644,0.7279252707088563,-0.33374290561974607,},{0.6536121316093575,0.04538134404475575,-0.48353745246020213,},{0.1646578890844662,0.043133421811672394,-0.3915234168047501,},{0.5409067007755669,0.5734748484015191,-0.43181372238047966,},{0.6309247340308186,0.6501568326298132,-0.3792867083841837,},{0.14621304616482922,0.16817728778279867,-0.4894281438514115,},{0.15248350689098444,0.21629176710223824,-0.5066208923673112,},{0.19527995866395023,0.31021036416379866,-0.368903030223249,},{0.2641270918156038,0.36184784076227466,-0.37185335042747375,},{0.19775907647718274,0.36041126948467733,-0.37005017704818616,},{0.47748180186492484,0.6344371869391896,-0.6178456130820581,},{0.3449729117499019,0.5351651784925797,-0.3764475803546865,},{0.7072349531202177,0.6623786446461752,-0.3967329980787945,},{0.11191685214682133,0.7414882816916055,-0.3829445036012598,},{0.26033025842109236,0.8400869454142276,-0.3690546601256288,},{0.3398890565507036,0.9148733904868214,-0.3440796236255026,},{0.47183246013728464,0.3627419954566596,-0.4816401933946067,},{0.21442936928721185,0.24598052096203032,-0.38748135601135963,},{0.16289689980287853,0.2393895616419345,-0.38946064154888205,},{0.6349703590067151,0.30485278530477233,-0.3837163720405891,},{0.6486079214683851,0.20200057272999514,-0.5155596609951757,},{0.4735817871067749,0.585232350896546,-0.6108315559277323,},{0.2677471713931886,0.30196471260867935,-0.5161472748259236,},{0.5700458772734481,0.8549379043069918,-0.49140663558436687,},{0.7875339740085895,0.7448594373870442,-0.3720478193163213,},{0.4233981304976342,0.9469192808580446,-0.36361836231370487,},{0.4806729557597501,0.9270640456739272,-0.34686331102103046,},{0.6534875704427136,0.7392500835644683,-0.4765134065984079,},{0.6148926600926861,0.7873893692766278,-0.39987453257314204,},{0.28790610297457764,0.5603764776920079,-0.5146604788718662,},{0.5863955391887755,0.3159684108118564,-0.3659102480897259,},{0.2500102036962055,0.6362354188850473,-0.5149793898566727,},{0.3385825203837437,0.9331975089618882,-0.482340329022732,},{0.3912226316857281,0.4328419175910466,-0.36990783465924054,},{0.1689147983759553,0.6646599728214547,-0.40213461986121524,},{0.18906513040786813,0.7928906333773256,-0.4006612392043406,},{0.5471475261312195,0.07578769723314788,-0.4852919590044924,},{0.6765413088289393,0.000605937486170434,-0.35786460221030914,},{0.14122841653651036,0.013854469559612424,-0.3850766659758362,},{0.14645165058760398,0.3102275368025989,-0.37889188322261635,},{0.3912278311056422,0.6026842104532022,-0.6080934593745045,},{0.5904660367077724,0.38847170195866654,-0.3759757826102689,},{0.441201413951155,0.6470475662911156,-0.6190971782827507,},{0.4642592007406727,0.5004001767273568,-0.36932076326161334,},{0.2989504382165038,0.3945022220243591,-0.5598786960780961,},{0.5694557497282378,0.10540375182467557,-0.5911333617471268,},{0.6103669156544943,0.007908674901374747,-0.3474124054851631,},{0.3823291892986413,0.33708142271740343,-0.6577742474054664,},{0.3127791091276876,0.41737893537709786,-0.38985070586755866,},{0.4474137681830032,0.42977769966152835,-0.38924293336983073,},{0.3104142330217276,0.5867759700275272,-0.3804358258289586,},{0.722430489345456,0.7473857204216348,-0.41314075987339083,},{0.5463554414740792,0.2911735017980666,-0.3903673099107625,},{0.14333226324067677,0.2671429538169134,-0.4189806940775763,},{0.5229365529870172,0.4152933990982777,-0.5562343393108361,},{0.2387623898835959,0.4802403851910202,-0.4863263525057202,},{0.27110284789957007,0.283436454059123,-0.4375175852517991,},{0.7331156941711793,0.774256732669973,-0.37400921779093316,},{0.20511638795637072,0.43995242200026713,-0.5216214172705811,},{0.6131807543934934,0.7359328404292075,-0.49192962049328204,},{0.09122547615209325,0.003996144491217926,-0.4640636403705453,},{0.25421564799159846,0.8449508505979764,-0.4824576797978921,},{0.41106545705844744,0.38907459652732995,-0.3892078419159373,},{0.2816892240566973,0.43838584868722263,-0.3910737986214393,},{0.27810393957930085,0.0032129901354567792,-0.5405531269913333,},{0.3803563269630738,0.4129364808831023,-0.3961687287173554,},{0.5686747121846554,0.6148959676117154,-0.5473246768504296,},{0.5808709901541113,0.6380767808790473,-0.4190461895693948,},{0.6425181835819915,0.6485862241435527,-0.42510880579974786,},{0.4127766086433014,0.9498345281304826,-0.495664801733087,},{0.29670893257033726,0.8677693582308372,-0.361493142421571,},{0.5044460663047757,0.916930005819249,-0.4171953217657045,},{0.615712924811956,0.07380199510870857,-0.5097024416965429,},{0.571950743632811,0.47195954824846703,-0.4309059142475418,},{0.23600127299792406,0.41063039923540745,-0.3804409227157827,},{0.3206463738908153,0.475336392876636,-0.3890330812099778,},{0.5100650119325365,0.10452494401858668,-0.5365458030857962,},{0.5199861798624881,0.8879198225635113,-0.353527015914657,},{0.6051766244929326,0.027258455027432234,-0.409037994198744,},{0.27556746938610005,0.19405736732995435,-0.4115233235327135,},{0.19615764191356916,0.21748333390773916,-0.3872734136129942,},{0.27325366137395274,0.08829031761509887,-0.4971912879154963,},{0.6487450512073405,0.29129822834066205,-0.4072846915913804,},{0.18878359438809283,0.2702022104678876,-0.49962727568058657,},{0.5080863878988199,0.48868401822019625,-0.3887865169119071,},{0.15179455067717817,0.0018799938162624126,-0.49834733196662245,},{0.2911939753408581,0.28307745594368117,-0.4688287830360789,},{0.3088369433470281,0.49163683890880716,-0.554264116375454,},{0.5670226725798935,0.8163158723009241,-0.3851338126281209,},{0.28172388685612454,0.8520375408701859,-0.4214243288266623,},{0.13700015035981516,0.057826942798641354,-0.421337420456648,},{0.1791588463135485,0.15917455173690725,-0.4129873042205068,},{0.6290499660946225,0.24181317928585508,-0.37640579977430816,},{0.2254275315634888,0.4426454039939351,-0.4150507925774775,},{0.5465061981914355,0.35842345120956304,-0.550907249162222,},{0.43852324964273837,0.7404313970609784,-0.6471356785980564,},{0.557427824477374,0.6138851236459762,-0.37729560838868853,},{0.5958370507090959,0.8148146555638986,-0.4432001344704937,},{0.5966180221022975,0.21257008054007293,-0.3972126280282735,},{0.24891561334864415,0.1254485739995532,-0.53313204654526,},{0.2516316156747561,0.43212775808223697,-0.5499642093365839,},{0.4225555764076256,0.9541853709624041,-0.42762785198270226,},{0.5607603483505503,0.8383893943476222,-0.3894364285250761,},{0.6138795008636264,0.0,-0.4290195435345908,},{0.3988190437155452,0.28149050831341604,-0.7712725567009642,},{0.6343173885999478,0.004519857054319586,-0.44958709924693746,},{0.5380057419853358,0.6049482072287681,-0.5372263582012681,},{0.5833314535600184,0.7085560423709064,-0.5499540883283541,},{0.1663947334771399,0.3400015717330428,-0.3883282409667852,},{0.484664694635621,0.3882912569505032,-0.3992826123526178,},{0.34256411179123264,0.38806876014540126,-0.40910363522139975,},{0.3449410934168399,0.7159818194940012,-0.6376247753285011,},{0.574732300986084,0.7990826397521055,-0.549963547832778,},{0.10243803181185039,0.01431937443437291,-0.4172917557905232,},{0.5328139955154012,0.8681702295371901,-0.5640589370784856,},{0.15845820926553833,0.10817168219954779,-0.4796878310619828,},{0.5428699117706071,0.19462632675337704,-0.4225445590617389,},{0.24960007133657047,0.23918489236440052,-0.4014710984687444,},{0.4803767938908272,0.9109051614562107,-0.5513139417020665,},{0.635742333948157,0.12782707708391394,-0.5121727615091575,},{0.5010346911779405,0.18138692343245594,-0.47611061693101797,},{0.2575148982233398,0.04898521677909696,-0.5468286812967936,},{0.49337004503054865,0.7294442818982594,-0.6341428838959612,},{0.5186097227432485,0.2830489451296485,-0.4792813369732801,},{0.20583193662317265,0.2988308978637462,-0.5008665369104902,},{0.3270476800697702,0.9008047921452509,-0.40460636852205034,},{0.4143154847919945,0.4068433693272989,-0.4778545394144144,},{0.6243262997177166,0.42017382864709707,-0.5059189045285294,},{0.2490784755856476,0.7579149426499353,-0.5615652000311437,},{0.2511948247117448,0.2631133372331188,-0.4834615779736697,},{0.5360609207960987,0.4300947584356785,-0.3880104108791974,},{0.6786691681212585,0.6733518682289711,-0.4362410416673971,},{0.5867809974564518,0.6425611813293726,-0.4605420587096535,},{0.5167649870798385,0.8886851824668945,-0.4066828421987302,},{0.3575893769368419,0.9342082867772469,-0.41122763794653083,},{0.2391223802547465,0.6748092272636678,-0.4758842503286516,},{0.23816432429271525,0.1409083809952338,-0.41031417395605274,},{0.2402319205883204,0.2887096316475593,-0.3889417764856698,},{0.6027891911071928,0.4599455807279069,-0.4504573802689688,},{0.5520560166714836,0.5389691561281944,-0.47392566986025275,},{0.239230073074341,0.795396145192412,-0.4043201821305199,},{0.3518960121309215,0.34784164868974954,-0.47343238647222075,},{0.2822059908298374,0.6243749202474476,-0.5319714381178735,},{0.16633850565364158,0.7675707152529747,-0.4277339307330104,},{0.5584766387615697,0.0030822108330376716,-0.4191223088123354,},{0.5546520222072121,0.03961025254164646,-0.42385883482322734,},{0.4145810918001246,0.33224834361100775,-0.743313436842362,},{0.15494483025183917,0.16852676024343605,-0.43166515524072097,},{0.5289895112618047,0.2927672827626463,-0.41868363256347746,},{0.184102925758568,0.12049695341114691,-0.4295757160894462,},{0.13888398089815157,0.22880298703366547,-0.4436078788013896,},{0.5840816650262476,0.6884883983147265,-0.509860739557286,},{0.6094830142691002,0.34435426016058274,-0.5306713846882112,},{0.6960791544870035,0.7221423382876221,-0.4360653197964077,},{0.5579627826051754,0.8516513549483231,-0.4370438889914588,},{0.2051749310431896,0.04879080081055385,-0.41229853984280423,},{0.25155058145853787,0.09243324980083774,-0.44861927287369363,},{0.5269063034763812,0.23242326506239208,-0.45350603962897307,},{0.5528852116921328,0.601609597520578,-0.48191511437632334,},{0.4705342787633928,0.8654880962059385,-0.6116559881209793,},{0.29524237863273917,0.8888397759063247,-0.46038825907479036,},{0.4416530953648363,0.8023141519941264,-0.6400411825809379,},{0.16853747660509108,0.058847113968043166,-0.41235008421935704,},{0.1585113941715297,0.37725368889251104,-0.45702252771055984,},{0.29452927753001895,0.5903484874814705,-0.5168599790263604,},{0.2306083632206266,0.6600591477012975,-0.41246212973399415,},{0.31332590817361383,0.6320457845306144,-0.6012994845363894,},{0.746860089497496,0.954693538186068,-0.16406108035081662,},{0.7783983774232931,0.9008303546019436,-0.11936135698523871,},{0.5572125730695264,0.8312498488121323,-0.3785417858197895,},{0.3778897578770386,0.37355665988470915,-0.48859454983045336,},{0.39544768126089513,0.7418904315600245,-0.1021708654177688,},{0.5023369639446518,0.8441890483160138,-0.25536866515212137,},{0.17826562295782797,0.672128665037059,-0.3351958038596035,},{0.5379127322624447,0.5454503795898402,-0.5149900846152319,},{0.5873099576708788,0.004977437617338958,-0.4799154367871427,},{0.5230782570247902,0.6246665772754524,-0.5825851449662438,},{0.4753452883063703,0.9069864215233113,-0.33770190835000763,},{0.02084475652459521,0.7893997639308894,-0.08767783030890969,},{0.450046957569402,0.38285772828788717,-0.4728778709096205,},{0.4092781300324437,0.7734138478389186,-0.6392322746951448,},{0.3456784918840547,0.6483200123723807,-0.6145128592054936,},{0.4962089084535958,0.8632089248806712,-0.25988308364155993,},{0.598048131285418,0.43244759409591393,-0.42180224062892135,},{0.38501806136919364,0.39229833465827885,-0.562471005906724,},{0.28330506556441126,0.6340322798966956,-0.5603712188275892,},{0.5453864386528223,0.5702890013797864,-0.503974112965895,},{0.2926290550106443,0.6269441401416544,-0.5551916372388285,},{0.5111693468409305,0.6180236598569313,-0.5729730425037789,},{0.5042007624507711,0.8329738610960373,-0.2505356660394663,},{0.5567680010190876,0.8211707088884311,-0.36983712026764676,},{0.4075682783195647,0.7054782063004549,-0.18884523592641034,},{0.42214936060404284,0.7048051046821822,-0.20847312788880293,},{0.5535873308251275,0.8265028017664193,-0.37627748244682957,},{0.30815444912580636,0.5919336830153599,-0.3668785202671466,},{0.35590388186789296,0.35518883478360724,-0.485887700692995,},{0.5499527245077374,0.28209211904563153,-0.40982619506915413,},{0.35880916155211307,0.8723675469188107,-0.2257556911046358,},{0.19879508360196824,0.6926528781121789,-0.3126137920345286,},{0.1656246411517255,0.67786926274085,-0.3302414502376877,},{0.2572133668798767,0.08132121305798172,-0.5029754146985495,},{0.02550345035768312,0.8111482823289811,-0.2124955289085426,},{0.8035745151954371,0.8964606635769589,-0.19115412635159285,},{0.2931539581934308,0.43785511284620166,-0.5590397417911075,},{0.10152155766956114,0.837863227262889,-0.2182671937904139,},{0.3709220371533554,0.47775511995582753,-0.37277835421897604,},{0.6095390471145803,0.004050155883352988,-0.43963378282697324,},{0.12837970116653227,0.7223184160029305,-0.38924720783919464,},{0.17282712578513174,0.004427184052048821,-0.48633768722091525,},{0.41873306895093515,0.8358627066270174,-0.6230142036250863,},{0.5228981585543399,0.928627220764849,-0.2262051734468795,},{0.42880685668273466,0.7349907922182187,-0.09567095698104053,},{0.35002194001952436,0.4576491520415658,-0.38107268542912437,},{0.6034120693417492,0.05797182179041318,-0.4597410859353832,},{0.4434521094713961,0.739777073236912,-0.08984754456588477,},{0.7107835266597803,0.6965237528656474,-0.2895513583787732,},{0.4485601215359866,0.656617388104826,-0.6194497715396976,},{0.21020405123794464,0.7019936964440359,-0.3109109426399763,},{0.2427754015560355,0.024681155745625977,-0.5403917551217003,},{0.12219602386558208,0.8086991894751079,-0.2028304932314231,},{0.4331798373835076,0.38569147988167507,-0.47115162539615535,},{0.20807633659896935,0.7709799774197741,-0.4394123468594528,},{0.5215353495672597,0.6345417529778052,-0.5794128646912032,},{0.5448652376372828,0.27394106845242183,-0.41364333537563147,},{0.18527550240868182,0.7228385763450438,-0.44626333518108785,},{0.03695681717436304,0.7435182093606978,-0.10148901026634632,},{0.5085541811775434,0.31422489341963405,-0.45558330089931065,},{0.5034201517552928,0.8902605330661638,-0.22657046238378067,},{0.10585622042788588,0.7536519805986226,-0.18742493172123093,},{0.09578519101769208,0.7363515716449204,-0.18287830985131343,},{0.4961813264323537,0.8675262885106391,-0.22941367360749312,},{0.5923910646422901,0.06867514649072291,-0.4730393323925944,},{0.34490056728951735,0.44998953769285066,-0.39193158247758825,},{0.11997567248045045,0.7867113798532052,-0.19665011712728822,},{0.5079370949282479,0.5957462088944634,-0.5715801745134786,},{0.5019636194547211,0.6041736099728167,-0.5667111069195565,},{0.40057405673669466,0.8539815142263927,-0.45967975948575057,},{0.45503248588519546,0.6759986989052428,-0.4332662119501843,},{0.39775758928672017,0.5537980457348213,-0.48879826858145187,},{0.4708132803147924,0.5268944203317553,-0.5254120706593064,},{0.48791169532432727,0.834910513137393,-0.5061652754550379,},{0.5138900615541727,0.42294470535085366,-0.4607280529849399,},{0.3590950154623009,0.7481907646033525,-0.41801223072033133,},{0.5336657619984139,0.7362133476752878,-0.4328836239100987,},{0.29532790099554346,0.7325066361365516,-0.3735236603974827,},{0.26959308732754883,0.38345960968946635,-0.45082362701134526,},{0.4494139073098149,0.7576162679285863,-0.5516716387163992,},{0.40301969045469493,0.8316695271585487,-0.2594783586139901,},{0.14418639097749245,0.7434844670998431,-0.32811375671614845,},{0.32905882328512853,0.450397282511309,-0.4872201766725575,},{0.30343830011733075,0.7694527908266883,-0.4735408566378751,},{0.43773223883107815,0.6607919083731316,-0.5252948598444873,},{0.08514648489959555,0.7914473689906187,-0.2349154902848565,},{0.4305508621586132,0.6645166254642803,-0.5740784703688747,},{0.20486817397304258,0.7188857768091014,-0.3799935742058422,},{0.45392705418838425,0.8344731845849135,-0.2770725207599677,},{0.5063192830966329,0.5550332784161869,-0.4791170176347335,},{0.34824988709998184,0.6569044722134462,-0.4616939356750918,},{0.2455965239834369,0.7285996248243549,-0.4219103938475532,},{0.31762267960531937,0.8320410169042418,-0.4818477688462701,},{0.40952779603638473,0.5707356048936377,-0.4103392619403431,},{0.5312066105452661,0.7681312690045279,-0.38199557311324694,},{0.21127823279376154,0.183517465205882,-0.46981405505051366,},{0.5073315113431878,0.7090619164244576,-0.5321021406772216,},{0.5052856821476998,0.8285664016272538,-0.41464605401952964,},{0.47455051086818983,0.8715608217613355,-0.453641962827731,},{0.3338028592209918,0.6706467212459042,-0.559855416820736,},{0.43388608894623004,0.8637592363837057,-0.5357509886740397,},{0.36508092406222376,0.4997017300844364,-0.44403586468774864,},{0.530341029184289,0.8441285860204627,-0.3609539479522844,},{0.43115823168417294,0.781360393658198,-0.36545555760111065,},{0.718832389607727,0.7126759215321627,-0.3252454370268753,},{0.45067451777586176,0.9010586934390148,-0.39317000002334557,},{0.46379417968082043,0.43715262332776367,-0.49846101071043847,},{0.47409584771227914,0.5870217309179006,-0.42603440287140076,},{0.5832785365085192,0.3713020333048145,-0.46455277020477154,},{0.4209142265050266,0.7470120545900906,-0.19740341755743726,},{0.37324747894293103,0.6415068509608067,-0.3828361580857488,},{0.2796408917778136,0.8079387547747513,-0.47625269293460837,},{0.532932305990398,0.8031050027740495,-0.4011764922231001,},{0.32405163244413165,0.39670436627221806,-0.462608305905754,},{0.35042348488896724,0.6046718304501171,-0.372627111099216,},};
-int vertices_data[1770][4] = {{175,181,564,516,},{21,23,38,58,},{139,123,221,523,},{151,223,164,198,},{288,349,404,459,},{366,494,459,570,},{30,384,143,591,},{26,21,48,49,},{411,467,308,603,},{129,101,125,96,},{260,349,459,468,},{125,129,96,156,},{533,317,582,326,},{566,329,583,614,},{56,44,16,72,},{23,28,38,58,},{85,496,489,336,},{104,199,378,614,},{342,343,471,579,},{472,110,407,575,},{346,232,605,287,},{153,194,182,84,},{493,448,574,601,},{48,21,58,49,},{107,117,177,31,},{499,469,143,592,},{102,125,96,130,},{578,576,591,611,},{492,337,590,608,},{103,73,91,610,},{496,424,85,542,},{399,460,329,330,},{41,66,65,60,},{326,347,541,582,},{493,320,495,580,},{30,363,250,602,},{160,134,119,544,},{169,298,533,189,},{217,235,611,615,},{162,105,150,248,},{189,194,153,148,},{294,253,345,594,},{251,185,206,573,},{187,244,149,381,},{63,103,67,610,},{274,301,300,577,},{153,162,169,148,},{254,217,201,611,},{576,571,580,585,},{221,506,523,589,},{313,456,344,550,},{490,269,415,534,},{259,225,327,246,},{399,539,566,602,},{282,363,572,602,},{279,428,575,609,},{261,232,273,605,},{254,325,528,615,},{341,343,442,471,},{55,52,89,65,},{75,29,69,612,},{550,556,587,597,},{45,354,264,8,},{479,412,213,540,},{65,52,60,63,},{11,7,21,10,},{443,464,383,575,},{93,99,64,54,},{2,69,29,612,},{476,365,469,591,},{44,18,16,548,},{103,63,67,73,},{571,574,577,604,},{374,303,237,572,},{460,104,94,278,},{137,543,580,601,},{23,7,28,58,},{132,99,51,536,},{280,53,407,575,},{118,158,124,531,},{570,574,599,601,},{375,575,464,443,},{193,199,104,529,},{201,236,604,611,},{181,211,208,589,},{280,14,575,607,},{97,526,525,610,},{301,321,577,595,},{572,377,573,607,},{352,341,387,351,},{421,282,204,572,},{174,251,388,607,},{17,19,441,485,},{409,250,583,602,},{576,571,591,611,},{179,234,123,581,},{122,106,124,156,},{406,335,509,547,},{173,450,264,8,},{14,53,575,607,},{212,392,434,579,},{324,377,590,594,},{271,379,146,147,},{319,385,327,605,},{153,262,582,586,},{465,300,261,338,},{36,496,424,302,},{407,110,280,575,},{473,53,508,590,},{430,297,224,266,},{385,307,327,605,},{4,388,575,607,},{433,166,596,241,},{171,178,535,586,},{553,567,150,586,},{395,22,29,612,},{403,190,570,601,},{446,320,574,580,},{482,375,443,609,},{212,199,356,579,},{318,13,289,316,},{598,570,599,606,},{260,359,468,606,},{184,234,581,604,},{488,467,598,599,},{267,490,433,534,},{308,467,598,603,},{360,435,606,405,},{288,260,349,459,},{283,150,582,586,},{343,497,128,579,},{272,393,485,577,},{465,338,346,402,},{306,374,585,587,},{362,385,487,307,},{507,299,532,588,},{281,137,203,580,},{52,41,65,60,},{305,306,515,587,},{375,386,482,443,},{154,135,354,453,},{399,329,396,330,},{377,572,590,594,},{358,319,334,287,},{208,216,207,260,},{28,62,512,559,},{441,33,272,597,},{122,96,216,130,},{122,83,96,130,},{394,447,292,85,},{572,71,585,591,},{79,48,58,49,},{21,38,48,58,},{83,102,96,130,},{598,308,603,604,},{50,90,267,241,},{405,331,599,113,},{274,362,422,595,},{73,44,56,72,},{36,496,302,542,},{46,154,215,453,},{282,389,250,583,},{258,288,322,576,},{70,88,40,92,},{192,151,188,152,},{104,460,602,607,},{272,446,77,597,},{539,377,594,602,},{308,511,604,606,},{125,129,216,207,},{260,288,581,604,},{104,318,278,518,},{141,416,8,530,},{357,77,25,574,},{345,539,594,602,},{470,483,490,596,},{483,449,95,490,},{159,258,176,207,},{375,407,575,517,},{402,167,300,321,},{483,425,481,596,},{314,85,489,336,},{369,555,477,588,},{275,260,589,604,},{325,254,578,611,},{456,320,252,580,},{527,598,603,613,},{30,345,594,602,},{481,484,339,596,},{62,68,38,512,},{431,488,422,613,},{372,314,276,336,},{571,466,577,597,},{260,288,207,581,},{428,4,575,609,},{235,594,611,615,},{147,215,146,370,},{492,430,337,608,},{162,150,153,169,},{225,222,327,246,},{179,234,184,123,},{480,187,13,9,},{359,435,468,606,},{262,228,210,182,},{374,303,572,585,},{150,162,248,169,},{231,185,572,573,},{571,235,608,611,},{281,580,593,601,},{53,324,418,590,},{578,576,584,592,},{143,578,591,611,},{334,358,312,223,},{123,98,67,589,},{532,551,169,582,},{331,113,574,599,},{167,401,466,577,},{474,555,588,592,},{75,423,593,612,},{570,435,599,606,},{281,209,255,601,},{359,285,360,275,},{150,153,169,582,},{197,176,201,604,},{5,23,11,7,},{247,311,248,582,},{201,576,578,611,},{82,76,86,63,},{66,65,60,63,},{82,66,60,63,},{362,108,431,577,},{120,179,184,123,},{389,434,579,583,},{164,151,198,144,},{176,242,201,604,},{392,389,434,579,},{101,102,125,96,},{262,194,189,326,},{5,11,10,7,},{38,79,48,58,},{74,2,584,592,},{38,68,79,58,},{24,469,584,600,},{7,21,10,58,},{230,165,540,547,},{574,571,580,604,},{445,203,580,600,},{418,383,575,607,},{23,7,3,28,},{3,7,20,28,},{65,97,525,610,},{383,377,602,607,},{249,308,263,603,},{513,460,330,554,},{190,366,570,593,},{122,158,216,156,},{319,334,238,605,},{213,509,540,547,},{7,11,21,23,},{99,64,51,536,},{86,118,116,581,},{408,332,343,579,},{153,194,126,148,},{397,389,579,583,},{100,88,70,92,},{68,62,562,43,},{296,359,435,468,},{333,578,588,592,},{158,208,216,207,},{105,150,248,283,},{467,436,598,603,},{572,1,602,607,},{282,434,389,537,},{569,522,585,587,},{594,591,611,615,},{70,132,51,536,},{88,100,70,536,},{129,125,216,156,},{382,444,566,614,},{551,247,582,588,},{152,99,132,536,},{176,184,581,604,},{165,412,230,540,},{383,330,575,607,},{254,217,286,240,},{95,80,269,542,},{43,136,563,586,},{100,132,70,536,},{105,109,162,150,},{585,580,587,597,},{66,65,63,610,},{436,527,598,603,},{298,169,533,532,},{176,114,220,180,},{306,71,515,600,},{490,95,269,534,},{80,233,269,542,},{401,321,571,577,},{100,152,132,536,},{303,355,206,568,},{104,460,329,583,},{522,344,556,587,},{303,522,569,587,},{106,122,83,96,},{348,322,404,423,},{101,83,102,96,},{216,158,207,156,},{277,356,458,579,},{228,210,182,586,},{288,207,176,258,},{576,423,584,593,},{270,247,551,588,},{342,408,343,579,},{299,298,507,532,},{86,118,124,116,},{477,555,558,588,},{200,476,365,600,},{96,122,216,156,},{158,122,124,156,},{129,216,207,156,},{207,129,156,159,},{125,96,216,156,},{295,317,541,582,},{106,122,96,156,},{96,125,216,130,},{253,528,384,615,},{270,245,247,578,},{194,153,126,84,},{32,15,505,545,},{322,348,474,69,},{17,440,400,556,},{333,299,499,588,},{221,308,589,604,},{128,458,390,579,},{345,30,594,615,},{7,23,3,0,},{303,569,585,587,},{238,196,195,605,},{262,311,347,582,},{469,74,584,592,},{460,329,583,602,},{71,500,515,600,},{50,339,241,596,},{150,283,582,248,},{233,191,542,552,},{59,389,392,579,},{76,82,86,116,},{50,490,95,449,},{208,260,581,589,},{483,449,490,596,},{574,577,598,613,},{143,325,578,611,},{220,242,284,245,},{320,574,580,601,},{324,310,594,608,},{176,114,180,116,},{141,127,530,609,},{458,356,390,579,},{395,494,157,593,},{245,240,242,578,},{265,326,533,582,},{220,242,258,284,},{435,366,570,403,},{242,176,220,258,},{258,159,176,180,},{220,176,180,258,},{362,274,577,595,},{242,322,258,284,},{494,459,570,593,},{384,325,30,143,},{301,274,263,595,},{462,281,203,584,},{488,77,574,613,},{346,319,287,605,},{75,423,494,593,},{55,545,72,37,},{429,495,456,580,},{235,310,227,608,},{263,598,603,604,},{201,236,197,604,},{263,239,595,604,},{107,439,335,163,},{358,319,225,605,},{99,152,64,536,},{580,570,593,601,},{105,48,553,538,},{133,462,22,584,},{390,342,471,579,},{127,141,486,609,},{418,377,383,607,},{171,538,105,586,},{310,297,227,608,},{456,550,587,597,},{297,224,236,571,},{204,282,363,572,},{571,492,585,608,},{327,319,225,391,},{168,196,225,164,},{472,461,110,609,},{183,461,57,609,},{217,254,201,240,},{594,571,608,611,},{584,469,591,600,},{144,93,78,54,},{369,541,582,588,},{465,362,487,300,},{440,520,508,590,},{485,272,577,597,},{197,236,184,604,},{193,104,504,529,},{331,405,599,243,},{417,471,463,351,},{498,71,572,591,},{137,514,445,580,},{20,12,28,559,},{104,229,583,614,},{303,569,573,585,},{234,221,589,604,},{543,493,580,601,},{409,546,539,602,},{146,453,215,154,},{199,104,529,614,},{7,21,58,23,},{171,105,283,586,},{235,594,608,611,},{235,315,310,594,},{364,386,530,609,},{456,19,550,597,},{20,28,512,559,},{13,318,142,218,},{488,574,598,613,},{287,319,238,605,},{189,153,169,148,},{62,43,84,563,},{88,70,64,536,},{472,110,575,609,},{580,585,587,600,},{14,473,53,508,},{305,456,550,587,},{459,423,570,593,},{1,421,572,583,},{591,571,594,611,},{423,322,576,584,},{104,329,504,583,},{194,262,189,153,},{376,550,344,587,},{329,399,444,614,},{64,70,51,536,},{1,104,229,583,},{455,233,267,534,},{317,265,533,295,},{447,372,424,85,},{490,50,95,534,},{30,498,572,591,},{213,370,509,565,},{584,133,593,612,},{305,445,580,587,},{384,30,345,615,},{145,499,588,592,},{194,262,153,182,},{499,333,588,592,},{373,352,341,387,},{444,382,579,614,},{126,62,84,563,},{346,261,307,605,},{238,232,287,605,},{221,249,202,589,},{68,62,43,559,},{342,343,341,471,},{570,576,584,593,},{38,68,562,586,},{116,118,531,581,},{74,22,584,612,},{458,417,471,463,},{598,263,603,613,},{42,68,43,559,},{137,495,514,543,},{410,46,154,215,},{390,471,451,351,},{225,219,549,605,},{212,378,199,579,},{571,577,580,597,},{574,77,577,613,},{412,213,540,547,},{206,508,14,573,},{2,22,74,612,},{262,283,582,586,},{280,251,14,607,},{159,531,156,581,},{247,270,578,588,},{580,584,591,600,},{193,199,529,614,},{185,174,1,573,},{372,424,85,336,},{305,445,587,600,},{295,317,27,541,},{42,12,20,559,},{366,494,570,593,},{212,434,378,579,},{53,14,508,590,},{143,469,591,592,},{260,296,349,468,},{203,281,580,584,},{365,476,469,600,},{1,572,573,607,},{322,474,423,69,},{527,436,598,613,},{436,503,527,603,},{362,422,595,613,},{484,414,351,596,},{348,322,423,69,},{332,427,59,579,},{274,300,362,577,},{576,474,578,584,},{427,389,59,579,},{277,128,497,579,},{488,436,422,613,},{497,332,59,579,},{108,393,431,577,},{451,463,351,596,},{300,301,321,577,},{165,412,540,547,},{225,327,307,605,},{167,362,300,577,},{141,560,609,482,},{555,74,558,592,},{397,389,427,579,},{311,347,369,477,},{476,200,521,600,},{319,358,334,605,},{369,477,541,588,},{207,208,260,581,},{205,560,141,457,},{522,440,569,585,},{13,87,381,142,},{296,260,359,468,},{113,467,488,599,},{270,333,578,588,},{362,108,167,361,},{176,197,184,604,},{84,136,182,586,},{397,382,583,614,},{372,309,447,424,},{422,524,595,613,},{353,364,530,609,},{77,272,431,393,},{490,449,433,596,},{483,470,425,596,},{476,498,591,600,},{167,300,321,577,},{580,203,584,600,},{570,576,580,584,},{201,242,240,576,},{103,123,67,581,},{407,517,472,575,},{184,176,179,197,},{222,225,327,307,},{339,483,481,596,},{423,69,75,494,},{272,77,431,577,},{451,166,463,596,},{390,420,475,579,},{181,98,516,589,},{444,390,475,579,},{333,325,286,578,},{98,181,516,564,},{297,430,224,571,},{362,167,393,577,},{127,183,353,609,},{19,344,550,556,},{357,331,574,25,},{105,150,283,586,},{344,510,522,556,},{321,239,577,595,},{57,364,183,609,},{2,29,22,612,},{473,520,492,590,},{223,259,225,391,},{150,153,582,586,},{233,95,269,542,},{510,440,522,556,},{346,487,385,605,},{400,440,510,556,},{474,322,423,584,},{432,491,8,557,},{457,350,4,560,},{196,225,549,605,},{555,558,588,592,},{214,363,572,204,},{580,570,584,593,},{250,282,583,602,},{14,53,280,575,},{414,481,425,596,},{360,275,511,606,},{425,470,414,596,},{390,458,471,463,},{448,452,331,574,},{181,175,202,516,},{325,254,611,615,},{202,181,589,211,},{410,379,271,147,},{463,417,351,596,},{68,38,535,586,},{333,499,578,592,},{493,320,580,601,},{337,53,473,590,},{14,251,573,607,},{460,383,602,607,},{224,430,266,571,},{492,466,401,571,},{234,179,184,581,},{235,227,236,571,},{181,158,118,581,},{150,105,553,586,},{145,558,74,592,},{254,286,325,578,},{413,166,451,596,},{108,362,393,577,},{469,74,24,584,},{452,493,140,601,},{470,413,414,596,},{487,346,307,605,},{193,420,356,579,},{240,201,576,578,},{385,487,307,605,},{517,575,375,609,},{368,27,558,588,},{255,140,493,543,},{201,242,576,604,},{77,574,577,597,},{558,145,588,592,},{447,290,394,292,},{68,42,512,559,},{440,522,556,597,},{297,236,227,571,},{382,444,399,566,},{393,167,485,577,},{318,47,13,316,},{4,350,575,609,},{277,458,128,579,},{85,314,489,80,},{13,289,316,9,},{476,143,365,591,},{143,469,365,591,},{340,339,484,596,},{104,174,278,607,},{303,344,522,587,},{233,36,50,302,},{314,372,85,336,},{399,460,383,602,},{416,432,8,530,},{449,339,483,481,},{417,484,387,351,},{1,104,583,602,},{57,461,517,609,},{424,496,85,336,},{292,36,424,302,},{36,394,292,85,},{36,419,394,85,},{309,372,447,85,},{292,447,424,85,},{36,292,424,85,},{481,352,414,425,},{485,466,492,597,},{50,36,449,302,},{489,496,302,95,},{140,493,543,601,},{79,48,538,586,},{366,435,570,468,},{463,390,451,351,},{333,551,299,588,},{352,481,414,484,},{453,146,215,406,},{387,341,471,351,},{341,128,387,471,},{580,456,587,597,},{342,444,390,471,},{497,343,128,442,},{277,392,59,497,},{131,136,535,586,},{556,585,587,597,},{128,341,442,471,},{48,105,553,109,},{19,441,485,597,},{377,304,323,539,},{343,497,332,442,},{484,352,387,351,},{430,321,266,571,},{475,444,579,614,},{481,414,484,596,},{341,128,442,387,},{373,341,442,387,},{458,417,128,387,},{136,131,228,586,},{479,478,412,540,},{560,205,141,609,},{53,418,575,607,},{268,235,253,594,},{479,412,328,213,},{459,494,423,593,},{77,446,574,597,},{318,13,142,289,},{460,513,330,607,},{429,514,495,580,},{434,579,583,614,},{412,478,437,540,},{411,467,360,606,},{445,203,137,580,},{457,141,557,530,},{458,128,390,471,},{128,458,387,471,},{458,417,387,471,},{200,500,519,521,},{294,268,253,594,},{353,183,364,609,},{193,475,579,614,},{572,30,594,602,},{131,535,178,586,},{374,71,585,572,},{440,508,569,590,},{456,495,320,580,},{180,116,159,581,},{495,543,493,580,},{405,360,467,606,},{320,493,448,574,},{262,210,283,586,},{159,176,581,207,},{84,153,563,586,},{136,68,535,586,},{379,410,46,154,},{576,580,584,591,},{420,356,390,463,},{356,458,390,463,},{378,434,583,614,},{572,30,591,594,},{6,450,173,8,},{370,406,177,509,},{418,383,464,575,},{266,239,224,571,},{466,485,577,597,},{574,446,580,597,},{446,252,580,597,},{550,19,556,597,},{408,427,332,579,},{356,277,458,212,},{123,91,120,610,},{127,461,609,486,},{507,532,533,588,},{337,324,590,608,},{478,479,509,540,},{422,436,503,527,},{138,46,170,454,},{577,574,580,597,},{417,387,471,351,},{414,352,484,351,},{304,345,539,594,},{47,1,104,229,},{79,171,535,538,},{477,558,27,588,},{46,135,453,138,},{1,47,104,174,},{345,250,409,602,},{181,208,158,581,},{366,459,468,570,},{41,52,32,505,},{576,578,591,592,},{422,527,524,613,},{237,206,185,573,},{469,584,591,592,},{206,14,251,573,},{446,448,25,574,},{421,572,583,602,},{339,90,50,241,},{280,110,279,575,},{440,492,585,597,},{471,390,463,351,},{282,421,583,602,},{513,350,575,607,},{436,411,503,603,},{384,325,591,615,},{412,437,230,540,},{209,157,190,593,},{195,196,549,605,},{374,376,303,587,},{225,307,219,605,},{330,513,443,575,},{379,410,154,146,},{539,546,566,602,},{1,104,602,607,},{69,423,75,612,},{362,431,422,613,},{440,17,492,597,},{60,44,545,548,},{462,24,584,600,},{79,171,178,535,},{110,279,575,609,},{449,302,483,95,},{449,50,302,95,},{310,235,594,608,},{105,109,150,553,},{462,200,24,600,},{24,200,469,600,},{370,406,509,565,},{378,199,579,614,},{42,20,512,559,},{227,297,571,608,},{498,71,591,600,},{68,38,79,535,},{492,571,585,597,},{87,187,289,9,},{449,50,490,433,},{111,215,354,453,},{94,4,607,278,},{492,466,571,597,},{17,485,492,597,},{365,469,200,600,},{301,239,321,595,},{68,131,136,535,},{17,19,485,597,},{399,396,383,330,},{450,491,45,8,},{286,254,240,578,},{189,265,533,582,},{556,522,585,597,},{438,480,244,149,},{571,580,585,597,},{490,50,267,433,},{61,490,415,433,},{578,143,591,592,},{252,456,580,597,},{187,438,480,244,},{267,50,241,433,},{272,77,577,597,},{17,440,556,597,},{441,19,33,597,},{47,318,13,218,},{522,440,585,597,},{252,33,19,597,},{33,252,446,597,},{19,17,556,597,},{33,446,272,597,},{272,485,441,597,},{252,19,456,597,},{62,68,512,559,},{509,406,547,565,},{187,149,13,381,},{147,155,215,370,},{488,357,113,574,},{329,475,529,614,},{571,572,591,594,},{381,13,142,218,},{585,492,590,608,},{480,187,149,13,},{116,531,159,581,},{498,363,30,572,},{478,479,412,328,},{97,65,66,610,},{480,187,244,149,},{174,104,278,518,},{146,370,177,147,},{135,46,453,154,},{147,154,410,146,},{379,410,146,147,},{370,406,146,177,},{146,215,406,370,},{450,45,264,8,},{108,362,167,393,},{356,277,212,579,},{318,47,518,218,},{13,87,187,381,},{87,13,187,9,},{13,87,142,9,},{142,87,289,9,},{13,142,289,9,},{414,451,351,596,},{379,46,135,154,},{479,213,509,540,},{460,399,383,330,},{255,140,543,601,},{231,237,185,573,},{474,322,576,578,},{70,35,51,502,},{445,305,515,600,},{317,326,541,582,},{189,326,265,582,},{6,173,264,8,},{207,288,176,581,},{329,504,583,614,},{147,215,410,154,},{271,146,177,147,},{202,211,544,561,},{260,581,589,604,},{46,138,111,454,},{47,104,174,518,},{370,215,111,155,},{450,111,454,155,},{202,211,160,544,},{44,15,548,60,},{4,388,428,279,},{190,157,366,593,},{117,177,31,257,},{247,248,551,582,},{257,177,31,271,},{271,257,147,31,},{242,288,176,258,},{117,107,177,256,},{177,271,147,31,},{356,420,390,579,},{191,80,542,552,},{492,440,585,590,},{135,138,45,354,},{288,242,176,604,},{316,47,174,278,},{80,233,542,552,},{474,578,584,592,},{215,354,453,264,},{437,412,230,371,},{118,124,116,531,},{209,140,255,601,},{136,84,563,586,},{239,236,571,604,},{138,170,111,454,},{339,90,241,596,},{455,267,433,534,},{138,111,354,453,},{111,170,491,454,},{214,71,374,572,},{450,6,173,432,},{367,399,396,383,},{399,367,539,602,},{181,115,544,561,},{141,560,482,457,},{423,584,593,612,},{316,47,278,518,},{410,46,215,155,},{450,111,491,454,},{228,131,210,586,},{235,227,571,608,},{27,295,588,368,},{111,46,454,155,},{46,410,454,155,},{215,46,111,155,},{350,560,443,575,},{155,147,215,410,},{474,369,247,588,},{573,572,585,590,},{350,4,560,609,},{263,595,598,604,},{170,491,205,45,},{95,233,269,534,},{476,200,365,519,},{437,439,230,540,},{47,318,518,316,},{315,293,324,594,},{22,133,584,612,},{170,491,457,205,},{86,82,63,610,},{48,38,567,586,},{595,263,598,613,},{17,466,400,492,},{108,362,487,361,},{181,175,564,561,},{396,367,383,323,},{82,86,581,610,},{52,41,60,505,},{119,134,115,544,},{181,134,211,544,},{141,482,609,530,},{98,123,523,589,},{167,108,393,361,},{140,403,291,601,},{462,133,281,584,},{181,98,112,564,},{532,551,582,588,},{237,231,572,573,},{107,406,335,509,},{133,395,593,612,},{401,492,571,608,},{350,560,575,609,},{429,445,305,313,},{180,176,116,581,},{170,138,111,45,},{318,316,278,518,},{242,322,284,578,},{75,494,395,593,},{215,147,146,154,},{229,47,218,518,},{120,91,526,610,},{478,412,437,380,},{319,334,287,238,},{52,60,63,73,},{368,27,145,558,},{124,158,156,531,},{440,17,400,492,},{177,107,31,509,},{111,450,491,45,},{170,111,491,45,},{47,229,218,1,},{257,177,271,256,},{517,472,575,609,},{339,449,483,596,},{219,273,549,605,},{337,310,324,608,},{428,4,279,575,},{57,364,609,375,},{233,269,534,552,},{135,138,354,453,},{121,196,168,164,},{581,234,589,604,},{274,301,577,595,},{175,181,211,561,},{270,247,169,551,},{52,32,505,545,},{306,305,376,587,},{94,460,278,607,},{239,571,595,604,},{6,426,432,8,},{127,183,416,353,},{104,1,174,607,},{138,46,111,453,},{46,215,111,453,},{103,63,73,610,},{347,317,326,541,},{315,294,293,594,},{468,435,570,606,},{335,439,230,163,},{439,161,230,163,},{450,432,491,8,},{496,85,489,542,},{574,452,599,601,},{432,426,416,8,},{426,6,416,8,},{413,470,61,596,},{215,173,111,264,},{215,111,354,264,},{138,45,354,264,},{111,138,354,264,},{138,111,45,264,},{173,450,111,264,},{111,450,45,264,},{450,6,432,8,},{508,14,573,590,},{577,574,598,604,},{347,311,541,582,},{388,280,279,575,},{465,261,487,346,},{53,14,573,607,},{118,181,581,589,},{429,313,305,456,},{492,401,430,608,},{383,460,330,607,},{52,60,73,545,},{405,467,113,599,},{569,508,573,590,},{446,25,77,574,},{251,174,573,607,},{395,157,133,593,},{576,571,585,591,},{206,440,508,569,},{64,51,78,54,},{71,585,591,600,},{474,423,69,612,},{282,421,537,583,},{247,248,169,551,},{2,74,584,612,},{474,2,555,592,},{193,356,199,579,},{440,206,568,569,},{418,53,590,607,},{571,572,594,608,},{541,295,582,588,},{331,357,574,113,},{291,331,599,243,},{81,55,72,37,},{308,275,202,589,},{401,167,402,321,},{38,48,535,586,},{93,64,78,54,},{295,27,588,541,},{461,127,609,183,},{120,526,179,610,},{223,334,225,198,},{203,500,200,600,},{156,207,159,581,},{72,55,525,610,},{357,77,488,431,},{448,452,574,601,},{395,75,593,612,},{261,273,307,605,},{158,207,156,581,},{492,520,440,590,},{108,362,385,487,},{363,214,572,498,},{235,253,594,615,},{362,465,487,361,},{7,20,28,512,},{144,99,93,54,},{238,196,168,195,},{301,239,266,321,},{355,237,303,206,},{475,420,193,579,},{524,263,595,613,},{500,71,521,600,},{239,236,224,571,},{75,395,29,612,},{71,500,306,515,},{175,202,160,544,},{313,305,306,515,},{270,551,333,588,},{560,443,575,609,},{384,325,143,591,},{504,104,583,614,},{226,221,506,523,},{434,389,537,583,},{444,399,566,614,},{250,389,397,583,},{211,134,160,544,},{234,239,263,604,},{445,500,600,515,},{313,445,305,515,},{209,281,593,601,},{322,247,284,578,},{370,479,213,509,},{475,193,529,614,},{181,208,581,589,},{323,377,539,602,},{476,498,143,591,},{151,192,186,164,},{367,399,383,602,},{439,107,335,509,},{362,431,436,422,},{4,428,560,609,},{14,53,573,590,},{70,88,35,502,},{231,185,1,572,},{199,193,579,614,},{260,296,359,285,},{67,118,86,581,},{270,286,245,578,},{500,445,600,203,},{417,241,90,596,},{250,345,30,602,},{167,466,485,577,},{300,465,261,487,},{147,177,31,509,},{88,35,64,51,},{236,235,571,611,},{574,488,598,599,},{573,377,590,607,},{493,452,448,601,},{104,460,583,602,},{322,474,576,584,},{417,340,484,596,},{383,323,539,602,},{231,1,421,572,},{263,274,524,595,},{466,17,485,492,},{171,535,538,586,},{226,139,221,523,},{212,277,392,579,},{566,409,583,602,},{103,91,123,610,},{572,303,573,585,},{139,98,123,523,},{435,243,403,599,},{360,359,275,606,},{347,369,477,541,},{177,406,107,509,},{370,147,31,509,},{196,121,168,195,},{533,317,295,582,},{388,278,174,607,},{15,44,548,18,},{513,94,350,607,},{465,167,361,402,},{362,465,361,402,},{167,362,361,402,},{151,186,99,164,},{312,334,223,198,},{308,221,263,604,},{64,99,51,54,},{511,275,604,606,},{158,156,531,581,},{99,151,164,144,},{201,217,236,611,},{176,114,116,581,},{73,65,72,610,},{232,346,605,261,},{382,397,579,614,},{77,357,488,574,},{435,243,599,606,},{431,488,436,422,},{342,444,382,579,},{239,571,577,595,},{324,377,418,590,},{67,118,581,589,},{233,36,302,542,},{535,79,538,586,},{104,47,229,518,},{203,462,584,600,},{262,153,182,586,},{322,288,404,576,},{140,291,452,601,},{479,31,478,509,},{334,168,164,198,},{47,174,278,518,},{174,1,573,607,},{190,209,593,601,},{329,566,583,602,},{460,399,329,602,},{576,201,604,611,},{50,241,433,596,},{319,327,225,605,},{421,282,572,602,},{446,320,448,574,},{370,177,147,509,},{448,331,25,574,},{370,31,479,509,},{185,251,174,573,},{445,580,587,600,},{374,231,214,572,},{77,431,577,613,},{141,127,416,530,},{231,374,237,572,},{304,294,345,594,},{321,266,571,577,},{465,261,346,338,},{205,428,486,609,},{338,401,402,321,},{338,402,300,321,},{333,499,325,578,},{71,214,498,572,},{73,52,44,72,},{460,104,329,504,},{358,223,225,391,},{247,245,284,578,},{395,133,22,612,},{261,338,300,321,},{210,178,171,586,},{266,239,571,577,},{71,374,585,306,},{71,306,585,600,},{117,177,257,256,},{232,238,549,605,},{435,403,570,599,},{430,297,310,608,},{221,226,249,263,},{516,98,506,589,},{248,150,169,582,},{123,221,523,589,},{362,487,300,307,},{359,260,285,275,},{465,338,402,300,},{362,465,402,300,},{167,362,402,300,},{221,308,249,589,},{291,599,452,601,},{350,4,575,607,},{65,52,73,72,},{474,2,584,612,},{499,143,325,578,},{226,274,249,263,},{247,322,474,578,},{288,570,576,604,},{299,551,532,588,},{157,494,366,593,},{68,42,58,512,},{82,116,114,581,},{7,28,58,512,},{430,401,571,608,},{48,567,553,586,},{570,190,593,601,},{578,247,588,592,},{279,110,461,609,},{242,284,245,578,},{221,202,506,589,},{48,79,535,586,},{182,136,228,586,},{248,169,551,582,},{30,143,498,591,},{179,114,581,610,},{383,377,323,602,},{28,62,38,512,},{118,181,98,112,},{532,169,533,582,},{407,375,575,464,},{242,288,576,604,},{56,73,72,91,},{98,103,139,123,},{413,451,414,596,},{428,279,486,609,},{375,386,443,364,},{378,434,537,583,},{576,574,580,604,},{247,369,311,582,},{153,189,169,582,},{319,358,225,391,},{358,312,223,391,},{377,304,539,594,},{459,423,404,576,},{382,397,342,579,},{308,221,249,263,},{426,432,416,530,},{235,236,217,611,},{408,397,427,579,},{50,490,267,534,},{591,325,611,615,},{293,304,377,594,},{38,68,58,512,},{68,136,43,586,},{50,95,233,302,},{282,250,363,602,},{366,403,190,570,},{577,595,598,613,},{397,409,250,583,},{489,85,80,542,},{436,488,598,613,},{322,242,258,576,},{263,524,603,613,},{444,342,390,579,},{401,167,321,577,},{247,474,588,592,},{2,474,584,592,},{57,353,364,375,},{200,500,521,600,},{226,301,274,263,},{443,560,482,609,},{281,137,580,601,},{585,580,591,600,},{466,401,571,577,},{273,232,549,605,},{308,275,589,604,},{423,474,584,612,},{28,38,58,512,},{175,181,202,211,},{288,176,581,604,},{61,470,490,596,},{88,70,35,51,},{463,241,417,596,},{133,157,209,593,},{67,103,581,610,},{15,60,505,545,},{60,63,73,44,},{243,405,599,606,},{261,273,300,307,},{99,151,144,93,},{378,1,229,537,},{65,52,63,73,},{52,44,72,545,},{210,262,182,586,},{353,57,364,183,},{530,386,482,609,},{168,164,198,144,},{50,449,339,596,},{223,225,164,198,},{225,334,164,198,},{95,50,233,534,},{487,261,300,307,},{249,221,202,506,},{204,214,231,572,},{435,360,606,359,},{225,222,246,186,},{570,598,604,606,},{405,467,599,606,},{225,259,327,391,},{385,319,327,391,},{487,346,261,307,},{168,99,164,144,},{337,324,53,590,},{246,192,186,188,},{51,64,78,39,},{238,334,168,225,},{196,238,168,225,},{334,358,223,225,},{491,482,457,557,},{288,570,604,606,},{467,598,599,606,},{222,225,307,219,},{61,490,433,596,},{590,324,594,608,},{313,305,456,550,},{344,456,19,550,},{459,468,570,606,},{486,279,461,609,},{340,417,90,596,},{121,168,99,164,},{131,178,210,586,},{334,168,225,164,},{192,151,186,188,},{259,223,225,164,},{259,225,246,164,},{246,225,186,164,},{192,259,246,164,},{192,246,186,164,},{259,192,223,164,},{192,151,223,164,},{301,263,239,595,},{98,118,112,67,},{339,340,90,596,},{152,100,132,172,},{188,192,152,172,},{186,188,152,132,},{186,99,164,132,},{151,186,188,152,},{434,282,421,537,},{188,152,132,172,},{186,151,99,152,},{99,151,93,152,},{132,100,70,92,},{99,186,152,132,},{574,570,598,604,},{467,436,488,598,},{179,114,176,581,},{421,204,231,572,},{411,360,511,606,},{430,310,337,608,},{93,99,152,64,},{70,88,64,51,},{1,421,229,537,},{132,100,92,501,},{100,132,172,501,},{242,240,576,578,},{243,291,403,599,},{140,209,190,601,},{34,70,51,502,},{196,225,219,549,},{128,343,471,442,},{128,390,471,579,},{51,78,54,39,},{291,403,599,601,},{273,196,219,549,},{103,73,56,91,},{169,189,533,582,},{262,189,153,582,},{98,103,123,67,},{283,311,262,582,},{55,52,65,72,},{459,260,468,606,},{55,32,545,37,},{73,60,44,545,},{60,52,505,545,},{44,16,37,545,},{72,44,37,545,},{467,308,598,606,},{55,545,52,72,},{585,306,587,600,},{382,566,583,614,},{239,184,236,604,},{32,55,545,52,},{44,16,72,37,},{416,127,353,609,},{344,550,556,587,},{226,221,249,506,},{236,571,604,611,},{311,369,541,582,},{4,94,607,350,},{53,573,590,607,},{409,566,546,602,},{97,89,65,525,},{445,429,305,514,},{409,539,345,602,},{412,478,328,380,},{15,60,545,548,},{35,34,51,502,},{570,574,598,599,},{329,444,475,614,},{412,165,230,371,},{127,416,530,609,},{166,413,61,596,},{416,353,530,609,},{274,249,263,524,},{57,461,472,517,},{283,248,311,582,},{421,1,229,583,},{254,528,253,615,},{302,489,95,542,},{496,489,302,542,},{375,57,517,609,},{141,205,486,609,},{496,36,424,542,},{233,302,95,542,},{36,419,85,542,},{424,36,85,542,},{265,298,189,533,},{141,482,530,457,},{265,317,533,326,},{419,233,191,542,},{298,507,532,533,},{508,520,473,590,},{476,200,519,521,},{166,241,463,596,},{44,16,545,548,},{229,378,537,583,},{460,94,513,607,},{388,280,575,607,},{325,143,591,611,},{105,538,553,586,},{408,342,397,579,},{4,388,279,575,},{118,158,531,581,},{580,576,585,591,},{499,145,469,592,},{474,247,578,592,},{324,293,377,594,},{404,288,459,576,},{273,219,307,605,},{515,305,587,600,},{306,515,587,600,},{452,599,331,574,},{423,459,570,576,},{59,277,497,579,},{378,229,104,614,},{65,55,72,610,},{469,476,591,600,},{272,431,393,577,},{297,430,571,608,},{133,209,281,593,},{572,590,594,608,},{428,205,560,609,},{369,474,555,588,},{343,128,471,579,},{145,74,469,592,},{377,572,573,590,},{134,181,115,544,},{62,68,562,38,},{189,262,326,582,},{347,326,262,582,},{322,404,423,576,},{242,288,258,576,},{181,112,115,561,},{538,48,553,586,},{67,86,63,610,},{202,175,211,561,},{68,43,562,586,},{175,202,544,561,},{524,527,603,613,},{211,181,544,561,},{179,97,114,610,},{175,516,564,98,},{322,242,576,578,},{182,153,84,586,},{176,184,179,581,},{492,337,473,590,},{457,482,530,557,},{491,457,205,557,},{417,484,351,596,},{235,268,315,594,},{123,179,581,610,},{375,575,443,609,},{449,50,433,596,},{281,580,584,593,},{418,407,53,575,},{569,573,585,590,},{330,443,383,575,},{55,89,81,525,},{89,55,65,525,},{55,81,72,525,},{72,81,91,525,},{254,240,578,611,},{234,184,239,604,},{254,201,240,611,},{240,201,578,611,},{81,120,91,526,},{81,91,525,526,},{571,576,604,611,},{375,386,364,609,},{386,375,482,609,},{363,30,572,602,},{2,474,69,612,},{464,407,418,575,},{270,333,286,578,},{158,208,207,581,},{74,555,2,592,},{446,252,320,580,},{239,266,321,577,},{30,384,591,615,},{254,217,611,615,},{150,562,153,586,},{268,294,315,594,},{283,210,171,586,},{247,369,582,588,},{74,477,555,558,},{181,202,589,516,},{426,416,353,530,},{73,72,91,610,},{91,72,525,610,},{141,457,557,205,},{181,118,98,589,},{426,353,364,530,},{386,426,364,530,},{82,66,63,610,},{114,82,581,610,},{63,65,73,610,},{120,179,123,610,},{103,123,581,610,},{233,50,267,534,},{233,80,269,552,},{80,398,269,552,},{233,419,36,542,},{95,489,80,542,},{490,415,433,534,},{79,38,48,535,},{522,556,585,587,},{104,504,529,614,},{153,126,84,563,},{595,577,598,604,},{113,488,574,599,},{569,206,303,573,},{507,533,295,588,},{145,368,558,588,},{94,460,513,554,},{474,2,369,555,},{329,529,504,614,},{572,1,583,602,},{571,577,595,604,},{570,423,576,593,},{562,567,38,586,},{429,305,514,580,},{574,570,576,580,},{572,585,590,608,},{499,368,145,588,},{295,533,582,588,},{514,137,543,580,},{584,576,591,592,},{367,383,323,539,},{304,367,323,539,},{253,235,217,615,},{347,311,369,541,},{377,572,602,607,},{253,345,594,615,},{384,345,253,615,},{269,455,534,552,},{249,263,524,603,},{455,233,534,552,},{217,254,253,615,},{382,409,583,566,},{269,398,455,552,},{80,191,398,552,},{299,368,499,588,},{562,563,153,586,},{166,433,596,61,},{196,238,225,605,},{185,1,572,573,},{401,321,430,571,},{476,521,71,600,},{137,281,255,601,},{461,472,517,609,},{137,255,543,601,},{367,383,539,602,},{71,498,476,600,},{572,571,585,608,},{286,240,245,578,},{203,200,462,600,},{82,86,116,581,},{52,73,44,545,},{27,541,477,588,},{305,550,376,587,},{574,570,580,601,},{440,569,585,590,},{412,165,213,547,},{335,165,230,547,},{439,230,540,547,},{509,439,540,547,},{335,439,509,547,},{439,335,230,547,},{288,260,459,606,},{467,411,308,606,},{288,459,570,606,},{260,288,604,606,},{598,308,604,606,},{238,195,232,549,},{275,260,604,606,},{359,260,275,606,},{150,567,562,586,},{133,281,584,593,},{388,251,280,607,},{98,118,67,589,},{260,208,275,589,},{467,411,436,603,},{389,282,537,583,},{388,4,278,607,},{211,202,275,589,},{238,334,225,605,},{421,229,537,583,},{77,488,431,613,},{571,576,580,604,},{325,384,528,615,},{30,591,594,615,},{456,305,580,587,},{43,62,562,563,},{495,514,543,580,},{213,509,547,565,},{305,445,514,580,},{499,143,578,592,},{374,303,585,587,},{84,43,136,563,},{12,62,28,559,},{234,123,581,589,},{202,516,506,589,},{238,195,549,605,},{432,8,530,557,},{491,205,45,557,},{491,45,8,557,},{205,141,45,557,},{45,141,8,557,},{8,141,530,557,},{308,411,511,606,},{234,221,123,589,},{308,202,249,589,},{346,385,319,605,},{98,523,506,589,},{377,418,590,607,},{208,211,275,589,},{123,67,581,589,},{320,493,574,601,},{403,570,599,601,},{403,140,190,601,},{457,4,205,560,},{205,4,428,560,},{434,378,579,614,},{66,82,114,610,},{179,526,97,610,},{86,67,581,610,},{511,275,308,604,},{234,263,221,604,},{229,378,583,614,},{399,329,566,614,},{114,97,66,610,},{533,532,582,588,},{392,277,59,579,},{334,358,225,605,},{181,112,561,564,},{405,243,435,606,},{306,376,374,587,},{331,291,599,452,},{303,376,344,587,},{368,507,295,588,},{274,422,524,595,},{368,299,507,588,},{409,382,583,397,},{431,362,577,613,},{574,571,577,580,},{508,206,569,573,},{303,237,572,573,},{579,397,583,614,},{422,436,527,613,},{305,429,456,580,},{367,399,539,566,},{367,539,546,566,},{324,310,315,594,},{329,399,566,602,},{294,304,293,594,},{237,303,206,573,},{22,24,74,584,},{577,362,595,613,},{206,569,303,568,},{22,462,24,584,},{571,572,585,591,},{159,176,180,581,},{443,513,350,575,},{459,288,570,576,},{377,572,594,602,},{497,343,332,579,},{562,43,563,586,},{308,263,603,604,},{55,65,525,610,},{91,525,526,610,},{460,104,278,607,},{330,513,575,607,},{570,574,576,604,},};
-int indices_data[3414] = {291,140,403,106,122,83,146,271,379,357,25,331,244,149,438,20,12,28,47,174,316,11,5,23,3,23,0,3,20,28,329,444,475,23,5,7,5,10,7,484,387,417,28,23,3,20,42,12,252,320,446,206,237,355,109,48,553,452,331,448,370,147,31,308,249,603,114,220,176,568,303,569,545,16,548,539,409,546,58,21,49,187,438,480,12,62,28,485,17,441,11,21,10,205,170,457,161,230,439,306,500,515,23,28,38,23,38,21,282,389,250,476,519,521,44,15,18,339,50,449,402,401,167,187,244,438,155,410,147,421,1,537,21,58,10,379,271,410,26,49,21,32,41,52,175,561,564,443,330,513,243,331,291,21,48,26,41,60,66,44,60,15,366,190,157,191,233,552,48,49,26,79,178,535,52,55,32,213,370,479,42,68,43,357,77,25,35,34,51,273,232,549,20,3,7,28,62,38,42,58,68,60,44,63,37,32,55,19,33,441,64,39,78,250,363,282,476,498,143,13,480,149,490,61,470,92,40,88,38,48,21,510,440,522,51,39,64,32,15,505,37,72,16,491,454,450,51,54,39,40,70,88,350,94,4,244,187,381,44,73,63,39,54,78,231,185,1,64,78,93,422,436,503,41,65,52,251,174,185,381,149,244,143,499,469,41,66,65,73,44,56,10,58,7,209,281,133,88,35,64,146,379,154,46,379,410,49,79,58,52,65,89,7,3,0,35,51,64,49,48,79,46,454,170,55,52,89,13,9,480,490,95,269,45,354,135,16,44,18,63,82,60,107,117,256,381,13,149,58,79,68,187,480,9,410,454,46,446,320,448,87,381,187,62,43,84,146,177,271,103,67,73,66,97,65,33,252,446,288,207,260,81,72,37,51,99,54,91,103,56,425,470,414,193,199,104,53,14,473,468,435,366,55,81,37,66,82,114,82,63,76,62,12,559,89,81,55,76,63,86,143,365,476,74,145,558,513,330,554,63,67,86,93,78,144,51,34,70,94,278,4,499,368,145,316,174,278,115,119,134,135,154,379,103,98,67,126,62,84,54,99,144,66,60,82,76,116,82,99,51,132,118,86,67,354,264,453,72,56,16,132,51,70,101,96,83,256,257,271,497,392,277,86,116,76,67,112,118,213,165,547,366,403,190,96,106,83,73,56,103,56,72,91,171,79,538,109,105,48,27,317,541,143,469,365,92,132,70,289,316,318,83,102,101,392,59,389,68,136,43,332,59,497,434,421,537,132,92,501,130,83,122,114,97,66,38,62,562,130,102,83,87,187,289,485,466,17,289,187,9,78,54,144,214,204,363,480,438,149,357,331,113,44,16,56,166,451,413,393,485,272,190,140,209,136,84,43,91,81,120,141,205,486,547,406,565,82,116,114,506,98,523,67,63,73,118,124,86,74,24,469,359,285,360,88,100,92,164,121,99,114,116,180,127,416,141,96,156,106,152,64,93,218,1,47,91,120,123,164,196,121,68,131,136,99,168,144,345,409,539,57,472,517,432,426,530,339,340,90,313,306,515,144,151,93,164,132,186,158,118,181,65,97,89,134,119,160,91,123,103,491,482,457,128,417,387,99,121,168,132,164,99,86,124,116,124,118,158,449,483,481,72,81,91,401,492,466,211,181,134,455,433,534,181,118,112,136,182,84,124,106,156,124,122,106,197,176,201,142,318,218,101,102,125,103,139,98,407,472,110,94,513,554,501,172,132,115,134,181,492,440,400,463,166,241,81,525,526,14,53,280,114,180,220,58,42,512,107,31,117,181,112,115,158,216,122,122,124,158,460,104,94,306,374,71,77,272,446,126,194,148,495,456,429,152,100,536,243,405,331,277,458,128,130,122,216,214,498,71,251,388,174,139,103,123,19,441,17,348,423,69,409,382,566,561,112,564,494,69,423,132,172,188,179,97,114,524,422,527,501,100,172,198,144,168,150,162,109,79,171,178,36,419,394,335,163,107,492,430,337,4,428,205,152,172,100,165,335,547,398,269,80,196,195,121,370,155,147,133,22,395,94,104,278,462,203,200,132,188,186,121,195,168,96,129,156,472,461,110,194,126,84,46,135,379,162,153,148,150,153,162,179,114,176,129,159,156,329,330,396,175,202,160,363,498,214,130,125,102,184,123,120,313,445,429,186,225,164,299,298,507,494,459,366,120,179,184,193,420,356,1,218,229,562,62,563,158,181,208,171,210,178,37,16,545,463,417,458,400,17,466,169,162,148,123,221,139,331,452,291,116,159,180,138,135,46,192,172,152,151,144,198,31,147,257,169,148,189,184,234,123,214,231,204,452,448,493,476,365,519,412,213,328,188,172,192,462,133,281,431,357,488,210,131,178,216,158,208,77,431,393,211,134,160,84,182,194,169,248,162,221,123,234,256,271,177,231,1,421,257,147,271,422,503,527,151,192,152,181,211,208,313,429,456,148,194,189,197,184,179,182,136,228,105,162,248,128,497,277,282,204,421,1,229,378,367,539,546,159,129,207,356,463,458,478,509,540,463,420,390,486,461,127,270,169,551,164,225,196,504,329,529,398,80,191,29,395,22,202,211,160,168,195,238,225,219,196,75,69,494,131,210,228,221,226,139,107,439,509,198,223,151,191,419,233,129,125,207,125,216,207,2,74,555,246,186,188,176,197,179,220,242,176,258,220,180,432,530,557,31,257,117,222,186,246,489,496,336,130,216,125,435,403,366,222,225,186,105,283,171,219,273,196,252,33,19,217,286,254,368,299,507,344,376,550,174,388,278,335,107,406,105,171,538,201,176,242,192,246,188,198,168,334,162,105,109,316,9,13,236,227,297,224,236,297,201,240,217,286,217,240,334,168,238,183,127,461,302,449,36,245,242,220,284,245,220,185,174,1,192,259,246,456,495,320,519,500,521,137,445,203,478,479,31,481,483,425,240,201,242,222,219,225,170,491,457,167,485,393,489,95,496,223,259,192,258,180,159,378,212,434,207,216,260,239,236,224,224,297,266,140,291,452,238,195,232,200,24,462,316,278,318,45,141,8,182,228,262,184,239,234,219,307,273,45,170,205,307,219,222,263,301,226,226,221,263,141,416,8,75,494,395,354,45,8,500,306,71,455,398,552,189,265,298,214,71,374,197,236,184,298,169,189,150,109,553,398,191,552,192,151,223,119,115,544,446,448,25,242,245,240,190,403,140,483,302,95,344,313,456,236,217,235,201,217,236,155,111,450,150,553,567,257,256,117,159,207,258,208,260,216,273,261,232,194,182,262,239,224,266,228,210,262,457,4,205,274,226,301,171,283,210,217,253,235,235,227,236,236,239,184,326,189,194,275,211,202,4,457,350,141,486,127,167,466,485,212,378,199,444,471,390,249,226,274,253,217,254,475,420,193,197,201,236,194,262,326,406,453,215,245,286,240,247,169,270,111,155,370,263,234,239,221,234,263,354,8,264,275,260,208,346,232,261,247,248,169,247,245,284,301,239,266,223,198,312,301,263,239,198,334,312,27,145,368,284,220,258,22,24,74,431,108,393,462,281,203,463,356,420,361,167,393,178,131,535,507,298,533,6,264,8,473,492,337,235,268,315,297,227,310,530,482,557,189,326,265,237,185,231,245,270,286,258,322,284,484,339,481,320,493,448,461,472,57,100,88,536,238,232,287,417,340,484,428,279,486,327,259,391,245,247,270,259,223,391,327,307,222,454,491,170,222,246,327,7,0,23,13,218,47,333,286,270,334,238,287,104,318,278,403,243,291,376,305,550,208,211,275,506,202,516,260,275,285,305,306,313,388,4,278,288,258,207,493,320,495,268,294,315,247,322,474,268,235,253,227,235,310,218,318,518,70,40,92,321,301,266,273,307,300,77,357,431,283,248,311,246,259,327,349,288,260,498,476,71,294,293,315,252,456,320,266,297,430,493,140,452,346,287,232,249,202,506,303,237,374,258,288,322,296,349,260,235,315,310,279,428,388,440,568,569,266,430,321,286,333,325,322,404,348,210,283,262,247,311,248,280,279,388,137,495,514,264,215,453,308,411,511,484,340,339,349,404,288,7,58,512,293,294,304,398,455,269,369,2,555,300,301,321,13,47,316,205,141,45,179,120,526,323,377,304,293,304,377,5,11,10,59,392,497,286,325,254,481,339,449,261,321,338,295,265,317,321,261,300,283,311,262,391,223,312,254,325,528,322,288,404,360,285,275,361,465,167,124,156,531,430,401,321,273,300,261,145,469,499,296,260,285,362,300,307,393,108,361,148,153,126,363,204,282,462,22,133,268,253,294,287,319,358,287,358,334,23,21,11,237,206,185,407,110,280,98,506,516,310,315,324,137,203,281,334,358,312,280,388,251,375,57,517,446,272,33,326,317,265,372,309,85,393,272,77,53,407,280,315,293,324,345,304,294,434,212,392,206,440,508,301,300,274,203,445,500,296,359,435,304,367,323,336,276,314,458,417,128,317,326,347,421,434,282,499,325,333,104,378,229,373,442,387,202,249,308,174,47,1,490,269,415,296,285,359,328,380,412,275,308,511,419,191,542,293,377,324,454,410,155,193,504,529,321,401,338,326,262,347,311,347,262,247,284,322,157,395,494,478,380,328,170,138,46,341,373,352,362,274,300,544,115,561,253,345,294,50,36,449,498,30,143,338,346,261,473,508,520,410,271,147,93,151,152,405,113,331,428,486,205,372,276,336,343,341,342,87,289,142,408,343,342,297,310,430,346,319,287,233,419,36,344,510,522,31,107,509,373,341,442,469,24,200,87,142,381,341,471,342,343,442,341,41,32,505,375,443,364,464,443,375,135,354,154,345,253,384,247,369,311,314,276,372,85,309,447,406,215,370,153,562,563,470,425,483,341,352,351,353,364,426,387,352,373,375,364,353,397,408,342,351,451,471,377,323,383,169,532,551,14,251,206,111,370,215,391,358,319,470,61,413,516,175,98,133,157,209,349,459,404,360,435,359,95,80,269,408,332,343,367,399,396,396,383,323,499,333,299,319,346,385,30,498,363,358,391,312,395,29,75,460,329,504,19,456,252,146,406,177,305,376,306,336,314,489,228,136,131,483,449,302,367,396,323,471,341,351,104,199,378,364,386,426,479,370,31,356,199,193,316,289,9,382,342,444,145,74,469,107,163,439,418,383,464,418,377,383,421,204,231,496,95,302,324,337,310,368,499,299,154,453,146,166,413,61,4,388,428,474,369,247,404,423,348,435,360,405,349,468,459,282,434,389,203,500,200,279,461,486,342,382,397,499,143,325,418,324,377,346,338,402,13,381,218,277,212,458,474,322,348,105,248,283,417,463,241,414,351,352,509,439,540,267,90,241,30,345,384,232,195,549,337,430,310,267,455,233,477,311,369,375,353,57,354,453,154,241,433,267,468,349,296,468,296,435,412,371,165,424,309,372,488,436,431,444,342,471,443,386,364,435,243,403,464,383,443,346,402,465,391,385,327,492,401,430,441,33,272,451,351,414,445,137,514,101,129,96,466,167,401,332,442,343,374,376,303,382,444,399,38,562,567,319,385,391,327,385,307,280,251,14,69,29,2,411,467,360,24,22,462,451,414,413,420,475,390,67,98,112,409,397,382,345,250,409,347,311,477,69,474,348,408,397,427,409,250,397,309,424,447,336,424,372,470,413,414,489,314,80,426,6,416,295,507,533,30,363,250,433,455,267,335,165,230,394,290,292,436,467,411,362,385,108,436,362,431,111,215,173,412,437,371,137,255,543,417,241,90,161,439,163,361,487,465,306,376,374,490,415,61,22,2,29,36,50,233,422,274,362,314,372,85,447,292,290,425,352,481,432,6,426,443,482,386,183,353,416,508,440,520,231,214,374,325,143,30,267,50,90,212,356,458,422,362,436,356,212,199,437,380,478,206,251,185,416,353,426,450,173,432,108,385,487,111,173,450,57,353,183,389,434,392,464,375,407,255,137,281,140,493,255,474,2,369,360,467,405,437,412,380,416,6,8,424,336,496,491,450,432,332,497,442,330,443,383,332,408,427,418,53,324,110,279,280,485,441,272,340,417,90,277,392,212,50,339,90,478,328,479,406,146,453,484,352,387,163,335,230,157,494,366,396,330,383,229,218,518,19,344,456,30,384,325,36,292,302,318,142,289,424,302,292,487,361,108,314,85,80,475,444,390,352,484,481,468,366,459,167,465,402,107,177,406,209,255,281,128,387,442,166,61,433,396,399,329,418,464,407,374,237,231,368,295,27,57,183,461,330,329,460,19,17,556,328,213,479,116,124,531,230,161,163,15,545,548,113,488,357,451,166,463,36,394,292,397,389,427,466,492,400,250,345,30,317,27,295,424,496,302,69,2,474,381,142,218,423,459,494,355,237,303,215,264,173,432,173,6,110,461,279,497,128,442,75,29,69,233,50,267,401,402,338,337,53,473,250,389,397,414,352,425,256,177,107,365,469,200,85,447,394,230,165,371,85,394,419,329,399,444,465,487,346,22,74,2,487,385,346,85,419,542,133,395,157,25,448,331,209,140,255,447,290,394,213,412,165,446,25,77,138,45,135,264,6,173,113,467,488,332,427,59,404,459,423,43,62,559,431,362,108,183,416,127,255,493,543,371,437,230,61,415,433,483,490,470,457,482,560,488,467,436,53,337,324,451,463,390,166,433,241,175,544,561,418,407,53,389,59,427,95,489,80,243,435,405,482,491,557,510,344,556,471,451,390,467,113,405,344,303,376,482,443,560,230,437,439,190,209,157,450,454,155,138,170,45,129,101,125,490,483,95,503,411,603,447,424,292,501,92,100,477,74,558,88,70,502,70,34,502,436,411,503,35,88,502,34,35,502,325,384,528,104,460,504,193,104,504,60,41,505,15,60,505,226,249,506,384,253,528,295,368,507,269,455,534,14,206,508,473,14,508,478,31,509,477,27,541,226,506,523,400,440,510,360,275,511,411,360,511,20,7,512,42,20,512,350,443,513,94,350,513,429,445,514,495,429,514,445,313,515,500,445,515,308,275,202,202,175,516,407,375,517,472,407,517,104,229,518,318,104,518,200,500,519,365,200,519,492,473,520,440,492,520,71,476,521,500,71,521,303,344,522,139,226,523,98,139,523,274,422,524,249,274,524,89,97,525,81,89,525,120,81,526,97,179,526,525,97,526,253,254,528,475,193,529,329,475,529,386,482,530,426,386,530,159,116,531,156,159,531,298,299,532,169,298,532,298,265,533,265,295,533,415,269,534,433,415,534,68,79,535,131,68,535,64,152,536,88,64,536,378,434,537,1,378,537,48,105,538,79,48,538,304,345,539,367,304,539,439,437,540,437,478,540,347,477,541,317,347,541,80,85,542,191,80,542,495,137,543,493,495,543,160,119,544,175,160,544,32,37,545,15,32,545,562,150,567,527,503,603,546,409,566,335,406,547,18,15,548,16,18,548,196,273,549,195,196,549,313,344,550,305,313,550,333,270,551,299,333,551,532,299,551,233,455,552,440,206,568,330,460,554,460,94,554,477,369,555,74,477,555,344,19,556,17,400,556,400,510,556,491,432,557,27,477,558,145,27,558,42,43,559,12,42,559,350,457,560,443,350,560,213,547,565,115,112,561,206,355,568,153,150,562,126,153,563,62,126,563,98,175,564,112,98,564,370,213,565,406,370,565,382,399,566,367,546,566,399,367,566,48,38,567,553,48,567,355,303,568,303,522,569,522,440,569,385,362,307,411,308,603,249,524,603,524,527,603,};
-int edges_data[2954][2] = {{0,3,},{0,7,},{0,23,},{1,47,},{1,104,},{1,174,},{1,185,},{1,218,},{1,229,},{1,231,},{1,378,},{1,421,},{1,537,},{1,572,},{1,573,},{1,583,},{1,602,},{1,607,},{2,22,},{2,29,},{2,69,},{2,74,},{2,369,},{2,474,},{2,555,},{2,584,},{2,592,},{2,612,},{3,7,},{3,20,},{3,23,},{3,28,},{4,94,},{4,205,},{4,278,},{4,279,},{4,350,},{4,388,},{4,428,},{4,457,},{4,560,},{4,575,},{4,607,},{4,609,},{5,7,},{5,10,},{5,11,},{5,23,},{6,8,},{6,173,},{6,264,},{6,416,},{6,426,},{6,432,},{6,450,},{7,10,},{7,11,},{7,20,},{7,21,},{7,23,},{7,28,},{7,58,},{7,512,},{8,45,},{8,141,},{8,173,},{8,264,},{8,354,},{8,416,},{8,426,},{8,432,},{8,450,},{8,491,},{8,530,},{8,557,},{9,13,},{9,87,},{9,142,},{9,187,},{9,289,},{9,316,},{9,480,},{10,11,},{10,21,},{10,58,},{11,21,},{11,23,},{12,20,},{12,28,},{12,42,},{12,62,},{12,559,},{13,47,},{13,87,},{13,142,},{13,149,},{13,187,},{13,218,},{13,289,},{13,316,},{13,318,},{13,381,},{13,480,},{14,53,},{14,206,},{14,251,},{14,280,},{14,473,},{14,508,},{14,573,},{14,575,},{14,590,},{14,607,},{15,18,},{15,32,},{15,44,},{15,60,},{15,505,},{15,545,},{15,548,},{16,18,},{16,37,},{16,44,},{16,56,},{16,72,},{16,545,},{16,548,},{17,19,},{17,400,},{17,440,},{17,441,},{17,466,},{17,485,},{17,492,},{17,556,},{17,597,},{18,44,},{18,548,},{19,33,},{19,252,},{19,344,},{19,441,},{19,456,},{19,485,},{19,550,},{19,556,},{19,597,},{20,28,},{20,42,},{20,512,},{20,559,},{21,23,},{21,26,},{21,38,},{21,48,},{21,49,},{21,58,},{22,24,},{22,29,},{22,74,},{22,133,},{22,395,},{22,462,},{22,584,},{22,612,},{23,28,},{23,38,},{23,58,},{24,74,},{24,200,},{24,462,},{24,469,},{24,584,},{24,600,},{25,77,},{25,331,},{25,357,},{25,446,},{25,448,},{25,574,},{26,48,},{26,49,},{27,145,},{27,295,},{27,317,},{27,368,},{27,477,},{27,541,},{27,558,},{27,588,},{28,38,},{28,58,},{28,62,},{28,512,},{28,559,},{29,69,},{29,75,},{29,395,},{29,612,},{30,143,},{30,250,},{30,325,},{30,345,},{30,363,},{30,384,},{30,498,},{30,572,},{30,591,},{30,594,},{30,602,},{30,615,},{31,107,},{31,117,},{31,147,},{31,177,},{31,257,},{31,271,},{31,370,},{31,478,},{31,479,},{31,509,},{32,37,},{32,41,},{32,52,},{32,55,},{32,505,},{32,545,},{33,252,},{33,272,},{33,441,},{33,446,},{33,597,},{34,35,},{34,51,},{34,70,},{34,502,},{35,51,},{35,64,},{35,70,},{35,88,},{35,502,},{36,50,},{36,85,},{36,233,},{36,292,},{36,302,},{36,394,},{36,419,},{36,424,},{36,449,},{36,496,},{36,542,},{37,44,},{37,55,},{37,72,},{37,81,},{37,545,},{38,48,},{38,58,},{38,62,},{38,68,},{38,79,},{38,512,},{38,535,},{38,562,},{38,567,},{38,586,},{39,51,},{39,54,},{39,64,},{39,78,},{40,70,},{40,88,},{40,92,},{41,52,},{41,60,},{41,65,},{41,66,},{41,505,},{42,43,},{42,58,},{42,68,},{42,512,},{42,559,},{43,62,},{43,68,},{43,84,},{43,136,},{43,559,},{43,562,},{43,563,},{43,586,},{44,52,},{44,56,},{44,60,},{44,63,},{44,72,},{44,73,},{44,545,},{44,548,},{45,111,},{45,135,},{45,138,},{45,141,},{45,170,},{45,205,},{45,264,},{45,354,},{45,450,},{45,491,},{45,557,},{46,111,},{46,135,},{46,138,},{46,154,},{46,155,},{46,170,},{46,215,},{46,379,},{46,410,},{46,453,},{46,454,},{47,104,},{47,174,},{47,218,},{47,229,},{47,278,},{47,316,},{47,318,},{47,518,},{48,49,},{48,58,},{48,79,},{48,105,},{48,109,},{48,535,},{48,538,},{48,553,},{48,567,},{48,586,},{49,58,},{49,79,},{50,90,},{50,95,},{50,233,},{50,241,},{50,267,},{50,302,},{50,339,},{50,433,},{50,449,},{50,490,},{50,534,},{50,596,},{51,54,},{51,64,},{51,70,},{51,78,},{51,88,},{51,99,},{51,132,},{51,502,},{51,536,},{52,55,},{52,60,},{52,63,},{52,65,},{52,72,},{52,73,},{52,89,},{52,505,},{52,545,},{53,280,},{53,324,},{53,337,},{53,407,},{53,418,},{53,473,},{53,508,},{53,573,},{53,575,},{53,590,},{53,607,},{54,64,},{54,78,},{54,93,},{54,99,},{54,144,},{55,65,},{55,72,},{55,81,},{55,89,},{55,525,},{55,545,},{55,610,},{56,72,},{56,73,},{56,91,},{56,103,},{57,183,},{57,353,},{57,364,},{57,375,},{57,461,},{57,472,},{57,517,},{57,609,},{58,68,},{58,79,},{58,512,},{59,277,},{59,332,},{59,389,},{59,392,},{59,427,},{59,497,},{59,579,},{60,63,},{60,65,},{60,66,},{60,73,},{60,82,},{60,505,},{60,545,},{60,548,},{61,166,},{61,413,},{61,415,},{61,433,},{61,470,},{61,490,},{61,596,},{62,68,},{62,84,},{62,126,},{62,512,},{62,559,},{62,562,},{62,563,},{63,65,},{63,66,},{63,67,},{63,73,},{63,76,},{63,82,},{63,86,},{63,103,},{63,610,},{64,70,},{64,78,},{64,88,},{64,93,},{64,99,},{64,152,},{64,536,},{65,66,},{65,72,},{65,73,},{65,89,},{65,97,},{65,525,},{65,610,},{66,82,},{66,97,},{66,114,},{66,610,},{67,73,},{67,86,},{67,98,},{67,103,},{67,112,},{67,118,},{67,123,},{67,581,},{67,589,},{67,610,},{68,79,},{68,131,},{68,136,},{68,512,},{68,535,},{68,559,},{68,562,},{68,586,},{69,75,},{69,322,},{69,348,},{69,423,},{69,474,},{69,494,},{69,612,},{70,88,},{70,92,},{70,100,},{70,132,},{70,502,},{70,536,},{71,214,},{71,306,},{71,374,},{71,476,},{71,498,},{71,500,},{71,515,},{71,521,},{71,572,},{71,585,},{71,591,},{71,600,},{72,73,},{72,81,},{72,91,},{72,525,},{72,545,},{72,610,},{73,91,},{73,103,},{73,545,},{73,610,},{74,145,},{74,469,},{74,477,},{74,555,},{74,558,},{74,584,},{74,592,},{74,612,},{75,395,},{75,423,},{75,494,},{75,593,},{75,612,},{76,82,},{76,86,},{76,116,},{77,272,},{77,357,},{77,393,},{77,431,},{77,446,},{77,488,},{77,574,},{77,577,},{77,597,},{77,613,},{78,93,},{78,144,},{79,171,},{79,178,},{79,535,},{79,538,},{79,586,},{80,85,},{80,95,},{80,191,},{80,233,},{80,269,},{80,314,},{80,398,},{80,489,},{80,542,},{80,552,},{81,89,},{81,91,},{81,120,},{81,525,},{81,526,},{82,86,},{82,114,},{82,116,},{82,581,},{82,610,},{83,96,},{83,101,},{83,102,},{83,106,},{83,122,},{83,130,},{84,126,},{84,136,},{84,153,},{84,182,},{84,194,},{84,563,},{84,586,},{85,292,},{85,309,},{85,314,},{85,336,},{85,372,},{85,394,},{85,419,},{85,424,},{85,447,},{85,489,},{85,496,},{85,542,},{86,116,},{86,118,},{86,124,},{86,581,},{86,610,},{87,142,},{87,187,},{87,289,},{87,381,},{88,92,},{88,100,},{88,502,},{88,536,},{89,97,},{89,525,},{90,241,},{90,267,},{90,339,},{90,340,},{90,417,},{90,596,},{91,103,},{91,120,},{91,123,},{91,525,},{91,526,},{91,610,},{92,100,},{92,132,},{92,501,},{93,99,},{93,144,},{93,151,},{93,152,},{94,104,},{94,278,},{94,350,},{94,460,},{94,513,},{94,554,},{94,607,},{95,233,},{95,269,},{95,302,},{95,449,},{95,483,},{95,489,},{95,490,},{95,496,},{95,534,},{95,542,},{96,101,},{96,102,},{96,106,},{96,122,},{96,125,},{96,129,},{96,130,},{96,156,},{96,216,},{97,114,},{97,179,},{97,525,},{97,526,},{97,610,},{98,103,},{98,112,},{98,118,},{98,123,},{98,139,},{98,175,},{98,181,},{98,506,},{98,516,},{98,523,},{98,564,},{98,589,},{99,121,},{99,132,},{99,144,},{99,151,},{99,152,},{99,164,},{99,168,},{99,186,},{99,536,},{100,132,},{100,152,},{100,172,},{100,501,},{100,536,},{101,102,},{101,125,},{101,129,},{102,125,},{102,130,},{103,123,},{103,139,},{103,581,},{103,610,},{104,174,},{104,193,},{104,199,},{104,229,},{104,278,},{104,318,},{104,329,},{104,378,},{104,460,},{104,504,},{104,518,},{104,529,},{104,583,},{104,602,},{104,607,},{104,614,},{105,109,},{105,150,},{105,162,},{105,171,},{105,248,},{105,283,},{105,538,},{105,553,},{105,586,},{106,122,},{106,124,},{106,156,},{107,117,},{107,163,},{107,177,},{107,256,},{107,335,},{107,406,},{107,439,},{107,509,},{108,167,},{108,361,},{108,362,},{108,385,},{108,393,},{108,431,},{108,487,},{108,577,},{109,150,},{109,162,},{109,553,},{110,279,},{110,280,},{110,407,},{110,461,},{110,472,},{110,575,},{110,609,},{111,138,},{111,155,},{111,170,},{111,173,},{111,215,},{111,264,},{111,354,},{111,370,},{111,450,},{111,453,},{111,454,},{111,491,},{112,115,},{112,118,},{112,181,},{112,561,},{112,564,},{113,331,},{113,357,},{113,405,},{113,467,},{113,488,},{113,574,},{113,599,},{114,116,},{114,176,},{114,179,},{114,180,},{114,220,},{114,581,},{114,610,},{115,119,},{115,134,},{115,181,},{115,544,},{115,561,},{116,118,},{116,124,},{116,159,},{116,176,},{116,180,},{116,531,},{116,581,},{117,177,},{117,256,},{117,257,},{118,124,},{118,158,},{118,181,},{118,531,},{118,581,},{118,589,},{119,134,},{119,160,},{119,544,},{120,123,},{120,179,},{120,184,},{120,526,},{120,610,},{121,164,},{121,168,},{121,195,},{121,196,},{122,124,},{122,130,},{122,156,},{122,158,},{122,216,},{123,139,},{123,179,},{123,184,},{123,221,},{123,234,},{123,523,},{123,581,},{123,589,},{123,610,},{124,156,},{124,158,},{124,531,},{125,129,},{125,130,},{125,156,},{125,207,},{125,216,},{126,148,},{126,153,},{126,194,},{126,563,},{127,141,},{127,183,},{127,353,},{127,416,},{127,461,},{127,486,},{127,530,},{127,609,},{128,277,},{128,341,},{128,343,},{128,387,},{128,390,},{128,417,},{128,442,},{128,458,},{128,471,},{128,497,},{128,579,},{129,156,},{129,159,},{129,207,},{129,216,},{130,216,},{131,136,},{131,178,},{131,210,},{131,228,},{131,535,},{131,586,},{132,152,},{132,164,},{132,172,},{132,186,},{132,188,},{132,501,},{132,536,},{133,157,},{133,209,},{133,281,},{133,395,},{133,462,},{133,584,},{133,593,},{133,612,},{134,160,},{134,181,},{134,211,},{134,544,},{135,138,},{135,154,},{135,354,},{135,379,},{135,453,},{136,182,},{136,228,},{136,535,},{136,563,},{136,586,},{137,203,},{137,255,},{137,281,},{137,445,},{137,495,},{137,514,},{137,543,},{137,580,},{137,601,},{138,170,},{138,264,},{138,354,},{138,453,},{138,454,},{139,221,},{139,226,},{139,523,},{140,190,},{140,209,},{140,255,},{140,291,},{140,403,},{140,452,},{140,493,},{140,543,},{140,601,},{141,205,},{141,416,},{141,457,},{141,482,},{141,486,},{141,530,},{141,557,},{141,560,},{141,609,},{142,218,},{142,289,},{142,318,},{142,381,},{143,325,},{143,365,},{143,384,},{143,469,},{143,476,},{143,498,},{143,499,},{143,578,},{143,591,},{143,592,},{143,611,},{144,151,},{144,164,},{144,168,},{144,198,},{145,368,},{145,469,},{145,499,},{145,558,},{145,588,},{145,592,},{146,147,},{146,154,},{146,177,},{146,215,},{146,271,},{146,370,},{146,379,},{146,406,},{146,410,},{146,453,},{147,154,},{147,155,},{147,177,},{147,215,},{147,257,},{147,271,},{147,370,},{147,379,},{147,410,},{147,509,},{148,153,},{148,162,},{148,169,},{148,189,},{148,194,},{149,187,},{149,244,},{149,381,},{149,438,},{149,480,},{150,153,},{150,162,},{150,169,},{150,248,},{150,283,},{150,553,},{150,562,},{150,567,},{150,582,},{150,586,},{151,152,},{151,164,},{151,186,},{151,188,},{151,192,},{151,198,},{151,223,},{152,172,},{152,186,},{152,188,},{152,192,},{152,536,},{153,162,},{153,169,},{153,182,},{153,189,},{153,194,},{153,262,},{153,562,},{153,563,},{153,582,},{153,586,},{154,215,},{154,354,},{154,379,},{154,410,},{154,453,},{155,215,},{155,370,},{155,410,},{155,450,},{155,454,},{156,158,},{156,159,},{156,207,},{156,216,},{156,531,},{156,581,},{157,190,},{157,209,},{157,366,},{157,395,},{157,494,},{157,593,},{158,181,},{158,207,},{158,208,},{158,216,},{158,531,},{158,581,},{159,176,},{159,180,},{159,207,},{159,258,},{159,531,},{159,581,},{160,175,},{160,202,},{160,211,},{160,544,},{161,163,},{161,230,},{161,439,},{162,169,},{162,248,},{163,230,},{163,335,},{163,439,},{164,168,},{164,186,},{164,192,},{164,196,},{164,198,},{164,223,},{164,225,},{164,246,},{164,259,},{164,334,},{165,213,},{165,230,},{165,335,},{165,371,},{165,412,},{165,540,},{165,547,},{166,241,},{166,413,},{166,433,},{166,451,},{166,463,},{166,596,},{167,300,},{167,321,},{167,361,},{167,362,},{167,393,},{167,401,},{167,402,},{167,465,},{167,466,},{167,485,},{167,577,},{168,195,},{168,196,},{168,198,},{168,225,},{168,238,},{168,334,},{169,189,},{169,247,},{169,248,},{169,270,},{169,298,},{169,532,},{169,533,},{169,551,},{169,582,},{170,205,},{170,454,},{170,457,},{170,491,},{171,178,},{171,210,},{171,283,},{171,535,},{171,538,},{171,586,},{172,188,},{172,192,},{172,501,},{173,215,},{173,264,},{173,432,},{173,450,},{174,185,},{174,251,},{174,278,},{174,316,},{174,388,},{174,518,},{174,573,},{174,607,},{175,181,},{175,202,},{175,211,},{175,516,},{175,544,},{175,561,},{175,564,},{176,179,},{176,180,},{176,184,},{176,197,},{176,201,},{176,207,},{176,220,},{176,242,},{176,258,},{176,288,},{176,581,},{176,604,},{177,256,},{177,257,},{177,271,},{177,370,},{177,406,},{177,509,},{178,210,},{178,535,},{178,586,},{179,184,},{179,197,},{179,234,},{179,526,},{179,581,},{179,610,},{180,220,},{180,258,},{180,581,},{181,202,},{181,208,},{181,211,},{181,516,},{181,544,},{181,561,},{181,564,},{181,581,},{181,589,},{182,194,},{182,210,},{182,228,},{182,262,},{182,586,},{183,353,},{183,364,},{183,416,},{183,461,},{183,609,},{184,197,},{184,234,},{184,236,},{184,239,},{184,581,},{184,604,},{185,206,},{185,231,},{185,237,},{185,251,},{185,572,},{185,573,},{186,188,},{186,192,},{186,222,},{186,225,},{186,246,},{187,244,},{187,289,},{187,381,},{187,438,},{187,480,},{188,192,},{188,246,},{189,194,},{189,262,},{189,265,},{189,298,},{189,326,},{189,533,},{189,582,},{190,209,},{190,366,},{190,403,},{190,570,},{190,593,},{190,601,},{191,233,},{191,398,},{191,419,},{191,542,},{191,552,},{192,223,},{192,246,},{192,259,},{193,199,},{193,356,},{193,420,},{193,475,},{193,504,},{193,529,},{193,579,},{193,614,},{194,262,},{194,326,},{195,196,},{195,232,},{195,238,},{195,549,},{195,605,},{196,219,},{196,225,},{196,238,},{196,273,},{196,549,},{196,605,},{197,201,},{197,236,},{197,604,},{198,223,},{198,225,},{198,312,},{198,334,},{199,212,},{199,356,},{199,378,},{199,529,},{199,579,},{199,614,},{200,203,},{200,365,},{200,462,},{200,469,},{200,476,},{200,500,},{200,519,},{200,521,},{200,600,},{201,217,},{201,236,},{201,240,},{201,242,},{201,254,},{201,576,},{201,578,},{201,604,},{201,611,},{202,211,},{202,221,},{202,249,},{202,275,},{202,308,},{202,506,},{202,516,},{202,544,},{202,561,},{202,589,},{203,281,},{203,445,},{203,462,},{203,500,},{203,580,},{203,584,},{203,600,},{204,214,},{204,231,},{204,282,},{204,363,},{204,421,},{204,572,},{205,428,},{205,457,},{205,486,},{205,491,},{205,557,},{205,560,},{205,609,},{206,237,},{206,251,},{206,303,},{206,355,},{206,440,},{206,508,},{206,568,},{206,569,},{206,573,},{207,208,},{207,216,},{207,258,},{207,260,},{207,288,},{207,581,},{208,211,},{208,216,},{208,260,},{208,275,},{208,581,},{208,589,},{209,255,},{209,281,},{209,593,},{209,601,},{210,228,},{210,262,},{210,283,},{210,586,},{211,275,},{211,544,},{211,561,},{211,589,},{212,277,},{212,356,},{212,378,},{212,392,},{212,434,},{212,458,},{212,579,},{213,328,},{213,370,},{213,412,},{213,479,},{213,509,},{213,540,},{213,547,},{213,565,},{214,231,},{214,363,},{214,374,},{214,498,},{214,572,},{215,264,},{215,354,},{215,370,},{215,406,},{215,410,},{215,453,},{216,260,},{217,235,},{217,236,},{217,240,},{217,253,},{217,254,},{217,286,},{217,611,},{217,615,},{218,229,},{218,318,},{218,381,},{218,518,},{219,222,},{219,225,},{219,273,},{219,307,},{219,549,},{219,605,},{220,242,},{220,245,},{220,258,},{220,284,},{221,226,},{221,234,},{221,249,},{221,263,},{221,308,},{221,506,},{221,523,},{221,589,},{221,604,},{222,225,},{222,246,},{222,307,},{222,327,},{223,225,},{223,259,},{223,312,},{223,334,},{223,358,},{223,391,},{224,236,},{224,239,},{224,266,},{224,297,},{224,430,},{224,571,},{225,238,},{225,246,},{225,259,},{225,307,},{225,319,},{225,327,},{225,334,},{225,358,},{225,391,},{225,549,},{225,605,},{226,249,},{226,263,},{226,274,},{226,301,},{226,506,},{226,523,},{227,235,},{227,236,},{227,297,},{227,310,},{227,571,},{227,608,},{228,262,},{228,586,},{229,378,},{229,421,},{229,518,},{229,537,},{229,583,},{229,614,},{230,335,},{230,371,},{230,412,},{230,437,},{230,439,},{230,540,},{230,547,},{231,237,},{231,374,},{231,421,},{231,572,},{231,573,},{232,238,},{232,261,},{232,273,},{232,287,},{232,346,},{232,549,},{232,605,},{233,267,},{233,269,},{233,302,},{233,419,},{233,455,},{233,534,},{233,542,},{233,552,},{234,239,},{234,263,},{234,581,},{234,589,},{234,604,},{235,236,},{235,253,},{235,268,},{235,310,},{235,315,},{235,571,},{235,594,},{235,608,},{235,611,},{235,615,},{236,239,},{236,297,},{236,571,},{236,604,},{236,611,},{237,303,},{237,355,},{237,374,},{237,572,},{237,573,},{238,287,},{238,319,},{238,334,},{238,549,},{238,605,},{239,263,},{239,266,},{239,301,},{239,321,},{239,571,},{239,577,},{239,595,},{239,604,},{240,242,},{240,245,},{240,254,},{240,286,},{240,576,},{240,578,},{240,611,},{241,267,},{241,339,},{241,417,},{241,433,},{241,463,},{241,596,},{242,245,},{242,258,},{242,284,},{242,288,},{242,322,},{242,576,},{242,578,},{242,604,},{243,291,},{243,331,},{243,403,},{243,405,},{243,435,},{243,599,},{243,606,},{244,381,},{244,438,},{244,480,},{245,247,},{245,270,},{245,284,},{245,286,},{245,578,},{246,259,},{246,327,},{247,248,},{247,270,},{247,284,},{247,311,},{247,322,},{247,369,},{247,474,},{247,551,},{247,578,},{247,582,},{247,588,},{247,592,},{248,283,},{248,311,},{248,551,},{248,582,},{249,263,},{249,274,},{249,308,},{249,506,},{249,524,},{249,589,},{249,603,},{250,282,},{250,345,},{250,363,},{250,389,},{250,397,},{250,409,},{250,583,},{250,602,},{251,280,},{251,388,},{251,573,},{251,607,},{252,320,},{252,446,},{252,456,},{252,580,},{252,597,},{253,254,},{253,268,},{253,294,},{253,345,},{253,384,},{253,528,},{253,594,},{253,615,},{254,286,},{254,325,},{254,528,},{254,578,},{254,611,},{254,615,},{255,281,},{255,493,},{255,543,},{255,601,},{256,257,},{256,271,},{257,271,},{258,284,},{258,288,},{258,322,},{258,576,},{259,327,},{259,391,},{260,275,},{260,285,},{260,288,},{260,296,},{260,349,},{260,359,},{260,459,},{260,468,},{260,581,},{260,589,},{260,604,},{260,606,},{261,273,},{261,300,},{261,307,},{261,321,},{261,338,},{261,346,},{261,465,},{261,487,},{261,605,},{262,283,},{262,311,},{262,326,},{262,347,},{262,582,},{262,586,},{263,274,},{263,301,},{263,308,},{263,524,},{263,595,},{263,598,},{263,603,},{263,604,},{263,613,},{264,354,},{264,450,},{264,453,},{265,295,},{265,298,},{265,317,},{265,326,},{265,533,},{265,582,},{266,297,},{266,301,},{266,321,},{266,430,},{266,571,},{266,577,},{267,433,},{267,455,},{267,490,},{267,534,},{268,294,},{268,315,},{268,594,},{269,398,},{269,415,},{269,455,},{269,490,},{269,534,},{269,542,},{269,552,},{270,286,},{270,333,},{270,551,},{270,578,},{270,588,},{271,379,},{271,410,},{272,393,},{272,431,},{272,441,},{272,446,},{272,485,},{272,577,},{272,597,},{273,300,},{273,307,},{273,549,},{273,605,},{274,300,},{274,301,},{274,362,},{274,422,},{274,524,},{274,577,},{274,595,},{275,285,},{275,308,},{275,359,},{275,360,},{275,511,},{275,589,},{275,604,},{275,606,},{276,314,},{276,336,},{276,372,},{277,356,},{277,392,},{277,458,},{277,497,},{277,579,},{278,316,},{278,318,},{278,388,},{278,460,},{278,518,},{278,607,},{279,280,},{279,388,},{279,428,},{279,461,},{279,486,},{279,575,},{279,609,},{280,388,},{280,407,},{280,575,},{280,607,},{281,462,},{281,580,},{281,584,},{281,593,},{281,601,},{282,363,},{282,389,},{282,421,},{282,434,},{282,537,},{282,572,},{282,583,},{282,602,},{283,311,},{283,582,},{283,586,},{284,322,},{284,578,},{285,296,},{285,359,},{285,360,},{286,325,},{286,333,},{286,578,},{287,319,},{287,334,},{287,346,},{287,358,},{287,605,},{288,322,},{288,349,},{288,404,},{288,459,},{288,570,},{288,576,},{288,581,},{288,604,},{288,606,},{289,316,},{289,318,},{290,292,},{290,394,},{290,447,},{291,331,},{291,403,},{291,452,},{291,599,},{291,601,},{292,302,},{292,394,},{292,424,},{292,447,},{293,294,},{293,304,},{293,315,},{293,324,},{293,377,},{293,594,},{294,304,},{294,315,},{294,345,},{294,594,},{295,317,},{295,368,},{295,507,},{295,533,},{295,541,},{295,582,},{295,588,},{296,349,},{296,359,},{296,435,},{296,468,},{297,310,},{297,430,},{297,571,},{297,608,},{298,299,},{298,507,},{298,532,},{298,533,},{299,333,},{299,368,},{299,499,},{299,507,},{299,532,},{299,551,},{299,588,},{300,301,},{300,307,},{300,321,},{300,338,},{300,362,},{300,402,},{300,465,},{300,487,},{300,577,},{301,321,},{301,577,},{301,595,},{302,424,},{302,449,},{302,483,},{302,489,},{302,496,},{302,542,},{303,344,},{303,355,},{303,374,},{303,376,},{303,522,},{303,568,},{303,569,},{303,572,},{303,573,},{303,585,},{303,587,},{304,323,},{304,345,},{304,367,},{304,377,},{304,539,},{304,594,},{305,306,},{305,313,},{305,376,},{305,429,},{305,445,},{305,456,},{305,514,},{305,515,},{305,550,},{305,580,},{305,587,},{305,600,},{306,313,},{306,374,},{306,376,},{306,500,},{306,515,},{306,585,},{306,587,},{306,600,},{307,327,},{307,346,},{307,362,},{307,385,},{307,487,},{307,605,},{308,411,},{308,467,},{308,511,},{308,589,},{308,598,},{308,603,},{308,604,},{308,606,},{309,372,},{309,424,},{309,447,},{310,315,},{310,324,},{310,337,},{310,430,},{310,594,},{310,608,},{311,347,},{311,369,},{311,477,},{311,541,},{311,582,},{312,334,},{312,358,},{312,391,},{313,344,},{313,429,},{313,445,},{313,456,},{313,515,},{313,550,},{314,336,},{314,372,},{314,489,},{315,324,},{315,594,},{316,318,},{316,518,},{317,326,},{317,347,},{317,533,},{317,541,},{317,582,},{318,518,},{319,327,},{319,334,},{319,346,},{319,358,},{319,385,},{319,391,},{319,605,},{320,446,},{320,448,},{320,456,},{320,493,},{320,495,},{320,574,},{320,580,},{320,601,},{321,338,},{321,401,},{321,402,},{321,430,},{321,571,},{321,577,},{321,595,},{322,348,},{322,404,},{322,423,},{322,474,},{322,576,},{322,578,},{322,584,},{323,367,},{323,377,},{323,383,},{323,396,},{323,539,},{323,602,},{324,337,},{324,377,},{324,418,},{324,590,},{324,594,},{324,608,},{325,333,},{325,384,},{325,499,},{325,528,},{325,578,},{325,591,},{325,611,},{325,615,},{326,347,},{326,533,},{326,541,},{326,582,},{327,385,},{327,391,},{327,605,},{328,380,},{328,412,},{328,478,},{328,479,},{329,330,},{329,396,},{329,399,},{329,444,},{329,460,},{329,475,},{329,504,},{329,529,},{329,566,},{329,583,},{329,602,},{329,614,},{330,383,},{330,396,},{330,399,},{330,443,},{330,460,},{330,513,},{330,554,},{330,575,},{330,607,},{331,357,},{331,405,},{331,448,},{331,452,},{331,574,},{331,599,},{332,343,},{332,408,},{332,427,},{332,442,},{332,497,},{332,579,},{333,499,},{333,551,},{333,578,},{333,588,},{333,592,},{334,358,},{334,605,},{335,406,},{335,439,},{335,509,},{335,547,},{336,372,},{336,424,},{336,489,},{336,496,},{337,430,},{337,473,},{337,492,},{337,590,},{337,608,},{338,346,},{338,401,},{338,402,},{338,465,},{339,340,},{339,449,},{339,481,},{339,483,},{339,484,},{339,596,},{340,417,},{340,484,},{340,596,},{341,342,},{341,343,},{341,351,},{341,352,},{341,373,},{341,387,},{341,442,},{341,471,},{342,343,},{342,382,},{342,390,},{342,397,},{342,408,},{342,444,},{342,471,},{342,579,},{343,408,},{343,442,},{343,471,},{343,497,},{343,579,},{344,376,},{344,456,},{344,510,},{344,522,},{344,550,},{344,556,},{344,587,},{345,384,},{345,409,},{345,539,},{345,594,},{345,602,},{345,615,},{346,385,},{346,402,},{346,465,},{346,487,},{346,605,},{347,369,},{347,477,},{347,541,},{347,582,},{348,404,},{348,423,},{348,474,},{349,404,},{349,459,},{349,468,},{350,443,},{350,457,},{350,513,},{350,560,},{350,575,},{350,607,},{350,609,},{351,352,},{351,387,},{351,390,},{351,414,},{351,417,},{351,451,},{351,463,},{351,471,},{351,484,},{351,596,},{352,373,},{352,387,},{352,414,},{352,425,},{352,481,},{352,484,},{353,364,},{353,375,},{353,416,},{353,426,},{353,530,},{353,609,},{354,453,},{355,568,},{356,390,},{356,420,},{356,458,},{356,463,},{356,579,},{357,431,},{357,488,},{357,574,},{358,391,},{358,605,},{359,360,},{359,435,},{359,468,},{359,606,},{360,405,},{360,411,},{360,435,},{360,467,},{360,511,},{360,606,},{361,362,},{361,393,},{361,402,},{361,465,},{361,487,},{362,385,},{362,393,},{362,402,},{362,422,},{362,431,},{362,436,},{362,465,},{362,487,},{362,577,},{362,595,},{362,613,},{363,498,},{363,572,},{363,602,},{364,375,},{364,386,},{364,426,},{364,443,},{364,530,},{364,609,},{365,469,},{365,476,},{365,519,},{365,591,},{365,600,},{366,403,},{366,435,},{366,459,},{366,468,},{366,494,},{366,570,},{366,593,},{367,383,},{367,396,},{367,399,},{367,539,},{367,546,},{367,566,},{367,602,},{368,499,},{368,507,},{368,558,},{368,588,},{369,474,},{369,477,},{369,541,},{369,555,},{369,582,},{369,588,},{370,406,},{370,479,},{370,509,},{370,565,},{371,412,},{371,437,},{372,424,},{372,447,},{373,387,},{373,442,},{374,376,},{374,572,},{374,585,},{374,587,},{375,386,},{375,407,},{375,443,},{375,464,},{375,482,},{375,517,},{375,575,},{375,609,},{376,550,},{376,587,},{377,383,},{377,418,},{377,539,},{377,572,},{377,573,},{377,590,},{377,594,},{377,602,},{377,607,},{378,434,},{378,537,},{378,579,},{378,583,},{378,614,},{379,410,},{380,412,},{380,437,},{380,478,},{382,397,},{382,399,},{382,409,},{382,444,},{382,566,},{382,579,},{382,583,},{382,614,},{383,396,},{383,399,},{383,418,},{383,443,},{383,460,},{383,464,},{383,539,},{383,575,},{383,602,},{383,607,},{384,528,},{384,591,},{384,615,},{385,391,},{385,487,},{385,605,},{386,426,},{386,443,},{386,482,},{386,530,},{386,609,},{387,417,},{387,442,},{387,458,},{387,471,},{387,484,},{388,428,},{388,575,},{388,607,},{389,392,},{389,397,},{389,427,},{389,434,},{389,537,},{389,579,},{389,583,},{390,420,},{390,444,},{390,451,},{390,458,},{390,463,},{390,471,},{390,475,},{390,579,},{392,434,},{392,497,},{392,579,},{393,431,},{393,485,},{393,577,},{394,419,},{394,447,},{395,494,},{395,593,},{395,612,},{396,399,},{397,408,},{397,409,},{397,427,},{397,579,},{397,583,},{397,614,},{398,455,},{398,552,},{399,444,},{399,460,},{399,539,},{399,566,},{399,602,},{399,614,},{400,440,},{400,466,},{400,492,},{400,510,},{400,556,},{401,402,},{401,430,},{401,466,},{401,492,},{401,571,},{401,577,},{401,608,},{402,465,},{403,435,},{403,570,},{403,599,},{403,601,},{404,423,},{404,459,},{404,576,},{405,435,},{405,467,},{405,599,},{405,606,},{406,453,},{406,509,},{406,547,},{406,565,},{407,418,},{407,464,},{407,472,},{407,517,},{407,575,},{408,427,},{408,579,},{409,539,},{409,546,},{409,566,},{409,583,},{409,602,},{410,454,},{411,436,},{411,467,},{411,503,},{411,511,},{411,603,},{411,606,},{412,437,},{412,478,},{412,479,},{412,540,},{412,547,},{413,414,},{413,451,},{413,470,},{413,596,},{414,425,},{414,451,},{414,470,},{414,481,},{414,484,},{414,596,},{415,433,},{415,490,},{415,534,},{416,426,},{416,432,},{416,530,},{416,609,},{417,458,},{417,463,},{417,471,},{417,484,},{417,596,},{418,464,},{418,575,},{418,590,},{418,607,},{419,542,},{420,463,},{420,475,},{420,579,},{421,434,},{421,537,},{421,572,},{421,583,},{421,602,},{422,431,},{422,436,},{422,488,},{422,503,},{422,524,},{422,527,},{422,595,},{422,613,},{423,459,},{423,474,},{423,494,},{423,570,},{423,576,},{423,584,},{423,593,},{423,612,},{424,447,},{424,496,},{424,542,},{425,470,},{425,481,},{425,483,},{425,596,},{426,432,},{426,530,},{427,579,},{428,486,},{428,560,},{428,575,},{428,609,},{429,445,},{429,456,},{429,495,},{429,514,},{429,580,},{430,492,},{430,571,},{430,608,},{431,436,},{431,488,},{431,577,},{431,613,},{432,450,},{432,491,},{432,530,},{432,557,},{433,449,},{433,455,},{433,490,},{433,534,},{433,596,},{434,537,},{434,579,},{434,583,},{434,614,},{435,468,},{435,570,},{435,599,},{435,606,},{436,467,},{436,488,},{436,503,},{436,527,},{436,598,},{436,603,},{436,613,},{437,439,},{437,478,},{437,540,},{438,480,},{439,509,},{439,540,},{439,547,},{440,492,},{440,508,},{440,510,},{440,520,},{440,522,},{440,556,},{440,568,},{440,569,},{440,585,},{440,590,},{440,597,},{441,485,},{441,597,},{442,471,},{442,497,},{443,464,},{443,482,},{443,513,},{443,560,},{443,575,},{443,609,},{444,471,},{444,475,},{444,566,},{444,579,},{444,614,},{445,500,},{445,514,},{445,515,},{445,580,},{445,587,},{445,600,},{446,448,},{446,574,},{446,580,},{446,597,},{448,452,},{448,493,},{448,574,},{448,601,},{449,481,},{449,483,},{449,490,},{449,596,},{450,454,},{450,491,},{451,463,},{451,471,},{451,596,},{452,493,},{452,574,},{452,599,},{452,601,},{454,491,},{455,534,},{455,552,},{456,495,},{456,550,},{456,580,},{456,587,},{456,597,},{457,482,},{457,491,},{457,530,},{457,557,},{457,560,},{458,463,},{458,471,},{458,579,},{459,468,},{459,494,},{459,570,},{459,576,},{459,593,},{459,606,},{460,504,},{460,513,},{460,554,},{460,583,},{460,602,},{460,607,},{461,472,},{461,486,},{461,517,},{461,609,},{462,584,},{462,600,},{463,471,},{463,596,},{464,575,},{465,487,},{466,485,},{466,492,},{466,571,},{466,577,},{466,597,},{467,488,},{467,598,},{467,599,},{467,603,},{467,606,},{468,570,},{468,606,},{469,476,},{469,499,},{469,584,},{469,591,},{469,592,},{469,600,},{470,483,},{470,490,},{470,596,},{471,579,},{472,517,},{472,575,},{472,609,},{473,492,},{473,508,},{473,520,},{473,590,},{474,555,},{474,576,},{474,578,},{474,584,},{474,588,},{474,592,},{474,612,},{475,529,},{475,579,},{475,614,},{476,498,},{476,519,},{476,521,},{476,591,},{476,600,},{477,541,},{477,555,},{477,558,},{477,588,},{478,479,},{478,509,},{478,540,},{479,509,},{479,540,},{481,483,},{481,484,},{481,596,},{482,491,},{482,530,},{482,557,},{482,560,},{482,609,},{483,490,},{483,596,},{484,596,},{485,492,},{485,577,},{485,597,},{486,609,},{487,605,},{488,574,},{488,598,},{488,599,},{488,613,},{489,496,},{489,542,},{490,534,},{490,596,},{491,557,},{492,520,},{492,571,},{492,585,},{492,590,},{492,597,},{492,608,},{493,495,},{493,543,},{493,574,},{493,580,},{493,601,},{494,570,},{494,593,},{495,514,},{495,543,},{495,580,},{496,542,},{497,579,},{498,572,},{498,591,},{498,600,},{499,578,},{499,588,},{499,592,},{500,515,},{500,519,},{500,521,},{500,600,},{503,527,},{503,603,},{504,529,},{504,583,},{504,614,},{505,545,},{506,516,},{506,523,},{506,589,},{507,532,},{507,533,},{507,588,},{508,520,},{508,569,},{508,573,},{508,590,},{509,540,},{509,547,},{509,565,},{510,522,},{510,556,},{511,604,},{511,606,},{512,559,},{513,554,},{513,575,},{513,607,},{514,543,},{514,580,},{515,587,},{515,600,},{516,564,},{516,589,},{517,575,},{517,609,},{519,521,},{520,590,},{521,600,},{522,556,},{522,569,},{522,585,},{522,587,},{522,597,},{523,589,},{524,527,},{524,595,},{524,603,},{524,613,},{525,526,},{525,610,},{526,610,},{527,598,},{527,603,},{527,613,},{528,615,},{529,614,},{530,557,},{530,609,},{531,581,},{532,533,},{532,551,},{532,582,},{532,588,},{533,582,},{533,588,},{534,552,},{535,538,},{535,586,},{537,583,},{538,553,},{538,586,},{539,546,},{539,566,},{539,594,},{539,602,},{540,547,},{541,582,},{541,588,},{542,552,},{543,580,},{543,601,},{544,561,},{545,548,},{546,566,},{546,602,},{547,565,},{549,605,},{550,556,},{550,587,},{550,597,},{551,582,},{551,588,},{553,567,},{553,586,},{555,558,},{555,588,},{555,592,},{556,585,},{556,587,},{556,597,},{558,588,},{558,592,},{560,575,},{560,609,},{561,564,},{562,563,},{562,567,},{562,586,},{563,586,},{566,583,},{566,602,},{566,614,},{567,586,},{568,569,},{569,573,},{569,585,},{569,587,},{569,590,},{570,574,},{570,576,},{570,580,},{570,584,},{570,593,},{570,598,},{570,599,},{570,601,},{570,604,},{570,606,},{571,572,},{571,574,},{571,576,},{571,577,},{571,580,},{571,585,},{571,591,},{571,594,},{571,595,},{571,597,},{571,604,},{571,608,},{571,611,},{572,573,},{572,583,},{572,585,},{572,590,},{572,591,},{572,594,},{572,602,},{572,607,},{572,608,},{573,585,},{573,590,},{573,607,},{574,576,},{574,577,},{574,580,},{574,597,},{574,598,},{574,599,},{574,601,},{574,604,},{574,613,},{575,607,},{575,609,},{576,578,},{576,580,},{576,584,},{576,585,},{576,591,},{576,592,},{576,593,},{576,604,},{576,611,},{577,580,},{577,595,},{577,597,},{577,598,},{577,604,},{577,613,},{578,584,},{578,588,},{578,591,},{578,592,},{578,611,},{579,583,},{579,614,},{580,584,},{580,585,},{580,587,},{580,591,},{580,593,},{580,597,},{580,600,},{580,601,},{580,604,},{581,589,},{581,604,},{581,610,},{582,586,},{582,588,},{583,602,},{583,614,},{584,591,},{584,592,},{584,593,},{584,600,},{584,612,},{585,587,},{585,590,},{585,591,},{585,597,},{585,600,},{585,608,},{587,597,},{587,600,},{588,592,},{589,604,},{590,594,},{590,607,},{590,608,},{591,592,},{591,594,},{591,600,},{591,611,},{591,615,},{593,601,},{593,612,},{594,602,},{594,608,},{594,611,},{594,615,},{595,598,},{595,604,},{595,613,},{598,599,},{598,603,},{598,604,},{598,606,},{598,613,},{599,601,},{599,606,},{602,607,},{603,604,},{603,613,},{604,606,},{604,611,},{608,611,},{611,615,},};
-int c2e_data[1770][6] = {{1142,1148,1145,1185,1182,2737,},{151,153,156,166,167,258,},{914,916,820,823,825,1413,},{1006,1001,1005,1073,1072,1267,},{1786,1787,1788,2121,2122,2367,},{2209,2207,2210,2689,2579,2580,},{204,199,207,2290,941,947,},{180,181,152,154,155,330,},{2391,2394,2608,1905,1906,1910,},{690,689,832,653,648,652,},{1637,1639,1640,2122,2123,2578,},{832,834,860,652,653,655,},{2769,1945,1947,1943,1999,2001,},{2815,2817,2017,2018,2020,2907,},{395,293,296,123,122,124,},{165,166,167,190,191,258,},{595,594,588,2673,2056,2055,},{699,704,712,1273,1276,2266,},{2083,2089,2090,2093,2095,2621,},{2623,748,746,749,2379,2381,},{2113,1479,1481,1478,1782,1784,},{1016,1014,1188,580,582,581,},{2686,2688,2546,2547,2548,2865,},{331,330,154,156,155,340,},{725,727,794,211,212,214,},{2701,2613,2616,945,942,948,},{691,692,833,649,652,654,},{2887,2889,2870,2874,2878,2929,},{2681,2683,2059,2060,2061,2925,},{696,516,515,518,618,623,},{2694,2453,2454,595,592,596,},{2344,2011,2013,2009,2023,2025,},{277,276,275,455,419,418,},{1998,2000,2001,2116,2117,2782,},{2684,2687,1959,1960,1962,2693,},{203,200,209,2193,1591,1596,},{1059,886,889,804,803,805,},{1112,1114,1108,1836,1225,1227,},{1385,1391,1392,1503,1504,2953,},{1064,715,714,717,991,993,},{1222,1015,1016,983,984,980,},{1816,1817,1608,1609,1612,2106,},{1599,1207,1204,1209,1326,1333,},{1215,1217,1556,985,986,987,},{446,441,447,696,469,475,},{1717,1716,1721,1854,1844,1852,},{1012,1013,1063,980,981,982,},{1618,1389,1391,1290,1286,1294,},{2871,2873,2836,2838,2839,2893,},{1412,1413,1414,2713,2714,2749,},{1933,1930,1935,2566,2097,2100,},{2675,1694,1692,1695,2412,2413,},{1631,1434,1437,1433,1564,1565,},{2345,2346,2347,2778,2780,2816,},{1761,1766,1768,2192,2193,2853,},{1747,1750,1751,2464,2465,2869,},{1645,1653,1476,1477,1481,1715,},{1615,1616,1619,1993,1997,2760,},{2076,2081,2082,2092,2093,2522,},{391,388,363,369,366,458,},{531,196,195,198,484,490,},{2793,2794,2795,2804,2805,2919,},{307,306,1669,63,67,66,},{2652,2398,2399,1368,1367,1370,},{366,364,365,418,417,439,},{85,56,58,55,82,83,},{2524,2528,2598,2282,2284,2286,},{627,451,452,385,386,383,},{20,19,27,490,195,198,},{2642,2201,2200,2203,2612,2615,},{299,136,137,122,120,126,},{446,441,442,469,466,516,},{2835,2837,2844,2860,2866,2883,},{2240,1864,1869,1512,1510,1513,},{705,701,634,631,632,1742,},{906,907,908,2785,2786,2899,},{165,167,59,60,61,191,},{877,675,682,360,359,362,},{1753,1754,372,375,380,2381,},{798,797,800,1048,830,831,},{2824,2830,2831,2864,2865,2945,},{2249,2246,2245,2598,2528,2524,},{1243,1248,1274,698,699,708,},{1287,1293,1294,1508,1509,2951,},{1181,1180,1187,1357,1340,1345,},{1754,1755,106,110,112,2868,},{660,659,661,2756,2754,2755,},{1853,1854,1855,1969,1970,2880,},{2847,2854,2256,2257,2261,2858,},{2142,2078,2080,2077,2131,2132,},{2433,1763,1766,1316,1314,1317,},{1135,1138,1141,1598,1600,2307,},{127,130,132,141,143,2520,},{2387,2388,1594,1595,1596,2906,},{2874,2878,2836,2840,2846,2929,},{1172,1174,1492,821,824,826,},{815,817,722,723,724,829,},{2374,2375,2049,2051,2052,2723,},{1133,1131,1670,65,71,66,},{103,110,112,380,382,2868,},{1361,1362,1364,2323,2325,2488,},{1985,1987,1988,2258,2259,2923,},{1703,964,966,960,975,977,},{1953,1949,1955,2294,2002,2004,},{1017,1020,1021,1658,1659,2904,},{1850,1847,1651,1646,1649,2065,},{250,248,245,2453,1860,1856,},{2381,746,745,749,1753,1754,},{2626,2628,377,378,381,2721,},{1830,1430,1429,1428,1681,1678,},{2294,1902,1899,1904,2002,2004,},{37,41,42,2306,2307,2868,},{2486,1087,1090,1085,1538,1540,},{1121,1124,1126,1168,1169,2773,},{2798,2799,2818,995,997,999,},{2333,161,158,164,197,198,},{2363,2365,1231,1232,1234,2831,},{2542,2543,1956,1961,1962,2861,},{2660,2247,2245,2250,2525,2529,},{1359,1364,1271,1272,1275,2159,},{100,98,99,1795,1794,1941,},{2940,2943,2829,2830,2833,2946,},{1638,1640,1644,2167,2168,2611,},{1199,1202,1203,1492,1494,2902,},{2670,2671,2605,2606,2607,2940,},{1686,1684,1687,2675,2484,2485,},{1906,1909,1910,2606,2608,2941,},{2171,2174,2169,2494,2369,2372,},{1786,1788,1635,1637,1639,2122,},{1770,1771,994,998,999,2904,},{2094,2095,2695,851,858,859,},{1705,1709,1710,2327,2328,2665,},{2065,2062,2064,2111,2110,2361,},{1892,1896,1897,2241,2242,2913,},{2180,2187,2293,1901,1902,1903,},{2715,2717,1840,1841,1843,2768,},{1757,902,900,907,1305,1309,},{366,364,274,276,275,418,},{1879,1886,1889,1895,1897,2735,},{2243,2247,2245,2297,2296,2525,},{1023,1026,891,892,894,2153,},{2011,2010,2009,2334,2023,2022,},{2256,2258,2259,2850,2852,2923,},{1952,1950,2047,1783,1780,1781,},{1341,1342,1384,1334,1335,1337,},{192,193,194,435,436,2729,},{2521,229,228,231,1707,1711,},{819,816,651,656,654,864,},{816,576,572,577,651,654,},{2330,1805,1807,590,593,585,},{2849,2851,505,506,507,2915,},{332,331,330,408,341,340,},{153,154,156,257,258,331,},{574,572,577,692,649,654,},{2941,2942,1909,1910,1911,2948,},{342,346,345,613,612,1535,},{2371,2031,2035,770,768,774,},{1718,1719,1722,2183,2189,2442,},{297,293,296,396,395,509,},{250,245,251,2694,1860,1861,},{314,317,320,1022,1026,1383,},{1762,1767,2314,1589,1592,1595,},{1628,1629,1630,1785,1790,1975,},{491,492,606,271,272,273,},{1004,1003,1000,1220,1010,1009,},{705,710,711,2588,2589,2947,},{1708,1711,2544,535,539,543,},{2779,2780,2255,2259,2260,2933,},{1907,1911,1912,2727,2728,2950,},{832,836,835,863,862,1335,},{1635,1641,1643,1791,1792,2902,},{702,701,707,1948,1740,1743,},{927,931,2416,64,68,73,},{2162,536,541,176,174,179,},{2105,2106,2107,2779,2780,2933,},{2618,2619,2620,2661,2662,2676,},{2661,2550,2551,642,641,644,},{1053,1050,1052,1157,1154,1336,},{2244,2249,2248,2381,2380,2739,},{1097,1091,1092,1849,1846,1966,},{2662,2457,2456,2458,2653,2655,},{1938,1936,587,594,588,2055,},{2226,2224,2228,2801,2645,2647,},{1728,1729,1633,1642,1643,2922,},{1994,1996,1615,1617,1618,2889,},{2567,1958,1962,1603,1601,1604,},{2757,2758,2759,2941,2944,2949,},{202,208,209,2106,2107,2933,},{2654,2655,2663,2068,2070,2071,},{432,435,479,259,260,262,},{2475,2477,2672,2436,2438,2443,},{1937,1936,1733,1731,1732,2053,},{2837,2843,2602,2603,2604,2881,},{1635,1641,1791,1337,1338,1339,},{2464,2465,38,41,43,2869,},{1501,1503,1504,2935,2936,2953,},{973,976,1380,960,963,965,},{2683,2471,2473,2059,2057,2061,},{1063,991,990,992,1012,1013,},{1437,1433,1416,1419,1417,1565,},{1172,1170,1199,821,824,822,},{1219,102,96,81,78,75,},{2166,2167,2168,2491,2494,2611,},{1455,1351,1350,1191,1190,1189,},{2240,2241,1864,1869,1871,2849,},{991,993,992,1064,1063,1110,},{1473,1474,1205,1208,1209,2847,},{2845,2846,1500,1502,1503,2952,},{1757,1759,1760,2896,2899,2931,},{373,376,381,1986,1987,2425,},{2885,2888,2870,2872,2875,2909,},{946,947,949,2887,2889,2929,},{2047,1927,1928,1423,1424,1422,},{827,665,673,472,468,474,},{2766,2767,2796,1113,1115,1116,},{2034,2035,768,773,774,2864,},{1096,1099,1101,2356,2359,2603,},{2629,2633,2634,2801,2802,2921,},{528,530,531,2450,2451,2932,},{2830,2833,2492,2493,2494,2946,},{1760,1347,1346,1349,1620,1623,},{2165,1775,1776,1725,1723,1726,},{990,992,998,1013,1020,1116,},{1264,1266,1152,1153,1160,1293,},{47,46,44,86,59,56,},{1569,1566,1575,1926,1579,1581,},{1291,1292,1294,2870,2878,2889,},{567,532,533,444,443,445,},{455,419,418,417,440,439,},{462,421,419,417,444,440,},{2184,2188,735,738,740,2476,},{807,808,806,1170,821,822,},{2311,2313,2314,2488,2489,2890,},{1072,1001,1005,951,950,953,},{1156,1153,1160,1548,1289,1293,},{2323,2325,2308,2311,2313,2488,},{688,689,691,648,649,652,},{1656,1251,1252,1223,1222,1226,},{46,45,44,82,56,55,},{261,257,258,332,331,408,},{524,525,21,25,26,2909,},{260,261,258,476,407,408,},{171,172,173,2614,2617,2911,},{58,55,61,156,83,84,},{1468,1469,1079,1083,1084,2781,},{2861,2866,2835,2838,2844,2900,},{2538,2540,1306,1309,1311,2898,},{2424,2426,2281,2286,2288,2868,},{165,59,60,30,28,31,},{28,29,31,57,60,147,},{459,460,461,659,661,2755,},{2287,2288,2253,2260,2261,2947,},{1584,1582,1588,1910,1662,1666,},{2730,2585,2586,2026,2025,2027,},{1230,1232,1233,2210,2211,2828,},{818,819,817,1047,1032,1035,},{1950,1955,2048,1516,1517,1519,},{1369,1370,1371,2722,2723,2781,},{56,58,59,85,86,151,},{682,452,454,359,355,362,},{598,597,600,801,787,793,},{2383,2037,2036,2041,2091,2095,},{1016,838,839,837,980,984,},{2338,2339,2309,2313,2314,2890,},{607,606,493,491,492,624,},{482,432,437,285,284,289,},{1826,1827,1828,2166,2167,2491,},{2044,2045,2046,2886,2888,2921,},{1046,1047,1045,1341,1334,1335,},{714,717,718,993,994,1578,},{2606,2608,2495,2499,2500,2941,},{2853,2854,13,16,17,2947,},{1764,1762,1765,2487,2311,2312,},{2821,2822,2745,2746,2747,2913,},{2935,2936,2927,2929,2930,2953,},{494,496,877,356,360,362,},{607,609,687,491,493,496,},{863,860,832,836,834,1035,},{2274,2275,2278,2532,2534,2817,},{2796,2797,1573,1575,1576,2905,},{1011,678,675,682,871,877,},{1151,1159,1160,1202,1203,2902,},{1082,1079,1083,2399,1465,1468,},{2286,2288,2021,2028,2029,2868,},{1614,1389,1390,1387,1530,1531,},{639,647,553,556,560,1696,},{287,290,291,898,899,2814,},{683,687,877,493,494,496,},{713,715,714,742,741,991,},{2913,2916,2893,2894,2897,2919,},{465,455,461,440,439,447,},{2498,2499,2500,2757,2758,2941,},{1836,1835,1112,1114,1113,2765,},{1155,1150,776,779,778,1176,},{1895,1898,498,503,508,2736,},{2675,644,639,646,1694,1695,},{555,556,560,1483,1488,1696,},{2358,2359,1965,1968,1969,2837,},{684,683,687,1011,871,877,},{1863,1867,2154,1327,1328,1331,},{705,703,709,2587,2013,2018,},{2744,2747,2099,2101,2102,2804,},{1866,1868,1872,2745,2747,2822,},{722,575,576,572,650,651,},{2118,2119,1971,1972,1973,2366,},{688,573,574,572,648,649,},{1047,1045,1335,1035,1032,1034,},{1734,1736,1738,2157,2159,2577,},{1456,1350,1353,1190,1189,1192,},{1338,1336,1158,1154,1157,1628,},{2872,2876,2448,2449,2450,2910,},{1700,1702,1567,1573,1576,2797,},{2087,2083,2090,2383,2091,2095,},{1840,1841,1833,1834,1835,2715,},{598,599,597,797,787,788,},{2645,2646,2647,2800,2801,2806,},{1281,1278,1285,2643,2201,2204,},{651,656,655,819,817,1035,},{818,815,817,830,829,1032,},{863,862,860,1335,1035,1034,},{862,860,861,1034,1033,1052,},{836,834,652,656,655,1035,},{1818,1822,1823,1946,1947,2782,},{722,724,817,650,651,655,},{652,656,654,836,833,864,},{1611,1610,1613,2760,2289,2291,},{1701,1560,1559,1563,1567,1574,},{1016,839,838,582,580,578,},{225,226,114,117,118,2711,},{1971,1974,2120,485,486,488,},{129,128,134,2514,2349,2353,},{2042,2045,1837,1839,1843,2700,},{1411,1414,1415,1908,1911,2922,},{856,853,859,2577,2318,2322,},{2106,2108,202,208,210,2936,},{59,28,30,1,2,0,},{1868,1871,1872,2821,2822,2913,},{1519,1260,1263,1255,1253,1257,},{1655,1657,1658,1922,1926,2117,},{2614,2616,520,524,525,2909,},{2587,2588,2013,2018,2019,2906,},{502,503,508,2702,2705,2736,},{348,345,353,2071,1536,1540,},{994,998,993,1770,1578,1581,},{1488,1489,1235,1238,1239,2784,},{412,413,416,2308,2313,2325,},{532,533,534,567,569,597,},{351,343,350,644,641,2551,},{1342,1344,1345,1641,1642,2901,},{2661,2662,2550,2551,2552,2676,},{2860,2863,2867,2882,2884,2944,},{939,946,949,1994,1996,2889,},{1403,1406,1404,1543,1541,1561,},{1961,1962,1963,2861,2865,2899,},{1988,1989,1917,1920,1921,2934,},{1150,776,778,775,790,791,},{931,934,841,847,848,2763,},{2577,2157,2155,2159,2318,2322,},{2331,2332,2690,1041,1042,1043,},{1563,1529,1528,1533,1541,1547,},{1675,1676,1677,1999,2001,2769,},{1403,1405,1406,1542,1543,1627,},{2492,2206,2210,2205,2362,2363,},{1542,1156,1155,1157,1403,1405,},{1053,1050,1051,1157,1150,1177,},{1405,1155,1150,1157,1176,1177,},{2188,2189,1718,1721,1722,2880,},{1545,1542,1543,1629,1627,1772,},{2689,2690,2579,2580,2582,2828,},{1991,204,201,199,941,939,},{1855,1717,1722,1661,1660,1664,},{2594,1756,1758,1307,1305,1310,},{2669,2672,540,541,544,2867,},{2113,1951,1955,1782,1780,1784,},{528,529,530,2446,2450,2690,},{393,389,513,253,256,254,},{2468,2467,2470,2693,2565,2567,},{1498,1502,1921,1449,1452,1454,},{1665,1666,1667,2941,2942,2948,},{1287,1293,1508,1264,1265,1266,},{1664,1667,1520,1526,1527,2938,},{731,729,726,2050,1067,1066,},{2164,1952,1955,1439,1436,1442,},{678,682,1011,452,453,454,},{2896,2899,2826,2828,2831,2931,},{720,719,333,337,336,2775,},{882,883,2594,160,162,163,},{2320,2322,2085,2089,2090,2621,},{841,846,848,930,934,2667,},{2426,2254,2253,2261,2281,2288,},{1125,1126,2776,716,719,721,},{1921,1829,1832,1452,1451,1454,},{2566,2568,2569,2794,2795,2919,},{1831,1429,1426,1431,1506,1507,},{1314,1315,1317,1761,1766,2192,},{2839,2845,2679,2680,2683,2918,},{2003,1949,1954,1437,1436,1440,},{1103,1105,1259,1068,1071,1074,},{2624,2590,2593,748,747,750,},{1196,1197,2593,399,403,406,},{1389,1387,1286,1290,1288,1530,},{2934,2935,2841,2845,2846,2952,},{2908,2911,2614,2615,2617,2928,},{628,546,545,387,385,384,},{2225,2227,2228,2782,2783,2905,},{2599,2186,2187,1850,1848,1851,},{2512,2510,2518,2742,2718,2721,},{2665,2666,1709,1710,1711,2881,},{1265,1266,1508,1198,1200,1203,},{1247,1248,698,706,708,2708,},{2031,2035,2371,1550,1552,1554,},{2420,2419,2596,2135,2138,2137,},{2696,2697,501,505,507,2851,},{905,903,907,2734,2536,2538,},{147,150,87,88,91,194,},{700,709,712,1461,1462,2907,},{1868,1870,1871,2820,2821,2856,},{1493,1494,1408,1414,1415,2922,},{2785,2786,2685,2687,2688,2899,},{2385,2384,2388,2790,2777,2780,},{969,963,961,1383,1026,1022,},{1274,1276,699,708,712,2761,},{58,61,59,156,151,167,},{1123,1126,716,718,721,1771,},{1501,1502,1503,2934,2935,2952,},{1499,1498,1501,1940,1916,1920,},{2195,2198,2199,2298,2299,2763,},{2566,2569,142,144,146,2795,},{147,149,150,193,194,2729,},{100,94,97,937,935,1394,},{2669,2670,2672,2863,2867,2944,},{1780,1784,1955,1515,1516,1519,},{1015,1013,1108,983,980,982,},{433,438,284,286,290,583,},{609,491,496,450,448,454,},{2623,2624,748,749,750,2869,},{2893,2894,2898,2913,2917,2920,},{107,103,108,2626,377,378,},{1884,1887,1889,2566,2568,2794,},{2580,2582,2444,2447,2450,2828,},{11,13,15,2433,2434,2848,},{2927,2929,2840,2841,2846,2935,},{2448,2449,1973,1975,1977,2872,},{703,706,709,2015,2018,2709,},{1251,1222,1223,1016,1017,1015,},{2251,2252,2794,2096,2100,2102,},{2011,2012,2020,2343,2348,2534,},{448,454,496,355,356,362,},{4,8,15,700,709,1461,},{2563,1486,1482,1487,1685,1687,},{1945,1674,1676,1672,1818,1821,},{2236,2235,2452,593,589,592,},{2675,351,343,352,644,646,},{205,206,207,2696,2697,2851,},{1366,1369,1372,2231,2232,2724,},{2910,2912,883,884,885,2932,},{1883,1888,1889,2538,2539,2894,},{2291,204,202,210,2103,2108,},{956,958,959,2700,2701,2921,},{1251,1016,1017,1014,1188,1191,},{2700,2701,2042,2045,2046,2921,},{2237,2141,2142,2079,2078,2080,},{2533,2534,2274,2276,2278,2891,},{840,434,433,438,578,583,},{2113,1650,1647,1653,1900,1904,},{1515,1519,1475,1478,1481,1784,},{1409,1414,1587,1296,1297,1304,},{481,432,436,285,284,288,},{2083,2089,2093,2075,2076,2082,},{2825,2827,2828,2872,2876,2910,},{260,264,266,482,483,2813,},{787,792,793,800,801,2764,},{524,526,159,163,164,2912,},{2576,2575,2418,2420,2419,2596,},{2941,2944,1665,1666,1668,2949,},{281,279,283,481,285,288,},{904,905,906,2691,2692,2733,},{319,314,317,1025,1022,1382,},{2320,2317,2556,2133,2138,2136,},{1441,1442,1398,1401,1402,2792,},{1360,1364,2264,1271,1273,1275,},{2837,2838,2843,2879,2881,2897,},{2860,2867,541,542,544,2884,},{2399,2400,1367,1370,1371,2781,},{1330,1333,2720,104,108,109,},{18,21,27,159,164,526,},{1654,1658,1659,1770,1771,2904,},{1755,1597,1600,106,105,112,},{1054,1055,2764,1033,1036,1037,},{1567,1574,1576,1701,1702,2886,},{2892,2895,2898,2908,2911,2928,},{1243,1248,1250,1274,1276,2761,},{1209,1134,1140,6,5,14,},{2235,589,592,588,2053,2054,},{1883,1889,1890,2539,2540,2920,},{1818,1822,1946,183,184,187,},{283,89,87,91,148,150,},{2209,2210,2211,2689,2690,2828,},{1362,1360,1364,2488,2262,2264,},{378,381,103,108,111,2721,},{942,947,948,2615,2616,2926,},{1636,1637,1640,1825,1828,2123,},{1305,1309,1310,1757,1758,2892,},{2201,2200,2204,2643,2612,2617,},{13,14,17,2847,2854,2858,},{1974,1973,2445,485,488,487,},{2757,2759,2498,2499,2501,2944,},{2497,2498,2500,2706,2707,2758,},{2183,2189,2190,2442,2443,2939,},{2663,2409,2410,2139,2134,2140,},{2119,1971,1973,486,485,487,},{2038,2041,2461,411,414,416,},{1716,1718,1721,1848,1852,2188,},{2870,2872,2630,2631,2632,2885,},{2461,2310,2313,414,412,416,},{1737,1738,849,858,859,2695,},{2672,2496,2501,2438,2437,2443,},{2695,2040,2041,415,411,416,},{737,738,740,2326,2328,2476,},{2555,2557,2597,2136,2137,2140,},{1844,1846,1852,1853,1854,1969,},{1082,1083,1084,2399,2400,2781,},{1437,1435,1442,2004,1899,1904,},{1094,1091,1101,2188,1848,1852,},{933,934,929,2809,2659,2660,},{2800,2802,522,523,525,2807,},{2337,2338,2309,2310,2313,2461,},{1922,1923,1924,2114,2115,2224,},{2641,2643,1281,1284,1285,2743,},{1952,1950,1955,2164,2047,2048,},{2224,2225,2228,2644,2647,2783,},{1334,1337,1339,1342,1344,1641,},{1323,1319,926,933,928,2574,},{2745,2746,2513,2516,2517,2821,},{93,101,94,605,602,938,},{1826,1828,1636,1638,1640,2167,},{771,772,774,2605,2607,2671,},{1699,1701,1702,2044,2045,2886,},{735,733,734,1094,1093,2175,},{1152,1151,1160,1266,1198,1203,},{579,581,584,895,899,1192,},{2339,2340,2271,2277,2278,2907,},{2236,2235,1913,1915,1914,2452,},{2440,2442,2443,2751,2753,2939,},{2147,2151,2152,2198,2199,2763,},{535,538,537,1706,1705,2326,},{2676,2551,2552,2484,2482,2486,},{2662,2618,2620,2457,2455,2458,},{2639,2642,2643,2697,2698,2928,},{1091,1092,1101,1846,1852,1969,},{2892,2898,1309,1310,1311,2911,},{2825,2826,2827,2871,2872,2892,},{1289,1288,1291,1546,1528,1532,},{693,695,826,469,472,473,},{2380,2379,2381,2739,2622,2623,},{1198,1151,1149,1152,1170,1171,},{1416,1419,1418,1437,1435,1899,},{2069,2068,2071,2662,2653,2655,},{2446,487,484,489,528,529,},{1706,1710,535,538,542,2476,},{2555,2557,1088,1089,1090,2597,},{2315,2321,2322,2429,2430,2637,},{1182,1187,668,670,673,2738,},{2531,2533,2316,2321,2322,2637,},{2044,1990,1994,1778,1777,1779,},{668,670,672,1182,1185,2737,},{1830,1831,2472,1429,1430,1431,},{2181,2188,1094,1095,1101,2328,},{842,843,848,1193,1197,2152,},{140,144,145,2100,2101,2793,},{2162,2030,2034,176,175,179,},{714,718,721,994,999,1771,},{2098,2099,2101,2725,2726,2744,},{1969,1970,1523,1525,1526,2880,},{401,399,406,2199,1194,1197,},{19,18,27,198,158,164,},{2627,2625,2628,2742,2678,2681,},{1421,1420,1425,1632,1434,1440,},{990,998,999,1020,1021,2904,},{1483,1488,638,639,647,1696,},{2725,2726,2511,2513,2514,2744,},{2112,2109,2113,2668,2293,2294,},{2349,2352,2353,2511,2514,2726,},{2632,1974,1973,1977,2445,2449,},{2479,2481,2677,70,72,74,},{2574,2125,2127,39,36,40,},{1259,1262,1263,1441,1442,2792,},{2800,2801,2802,2806,2807,2921,},{1374,1377,2192,1312,1315,1317,},{2892,2896,2826,2827,2828,2910,},{1589,1595,1596,1767,1768,2906,},{103,106,110,372,380,1754,},{2408,2405,2410,2655,2456,2458,},{2173,2174,1726,1727,1730,2728,},{2455,2458,2620,2405,2407,2410,},{2318,2320,2319,2576,2575,2596,},{2545,2547,2559,2032,2033,2034,},{1179,1182,1142,1143,1145,1301,},{1996,1997,1615,1618,1619,2953,},{1304,1295,1179,1187,1181,1357,},{2267,1704,1703,978,977,975,},{2597,2419,2422,2137,2135,2140,},{480,483,260,263,266,2773,},{2042,2044,2046,2699,2701,2888,},{2687,2688,1959,1962,1963,2899,},{2058,2060,374,377,381,2628,},{105,109,112,1599,1600,2858,},{2588,2589,2283,2287,2288,2947,},{1430,1428,1431,2472,1681,1682,},{2679,2601,2602,2357,2356,2358,},{1492,1172,1170,1174,1199,1202,},{1495,1500,1449,1450,1453,1507,},{1186,1044,1049,799,798,801,},{995,999,714,720,721,2799,},{957,959,2807,519,523,525,},{1614,1615,1617,1777,1779,1994,},{2402,2404,1086,1088,1090,2557,},{735,737,740,2181,2188,2328,},{2614,520,524,171,168,172,},{2558,2561,2688,922,923,925,},{2620,2403,2401,2404,2407,2410,},{2668,2112,2113,1903,1900,1904,},{1245,1244,1249,2430,2156,2159,},{1532,1533,1288,1291,1292,2870,},{2293,2294,2668,1902,1903,1904,},{2739,2740,2869,2248,2249,2250,},{2221,2222,185,188,189,2806,},{1621,1622,919,923,924,2685,},{1289,1291,1293,1546,1548,2877,},{541,542,543,2860,2862,2881,},{2806,2807,957,958,959,2921,},{1798,1797,1796,2330,1807,1805,},{479,481,281,282,283,2729,},{2513,2514,2519,2744,2748,2805,},{1831,1506,1507,1451,1450,1453,},{2274,2272,2275,2532,2343,2346,},{2327,2328,1095,1100,1101,2665,},{328,327,100,92,99,1941,},{36,41,43,2128,2130,2869,},{1736,1738,2577,849,856,859,},{587,594,1938,552,557,559,},{98,99,1794,75,79,80,},{2642,943,940,947,2201,2203,},{942,940,947,2615,2200,2203,},{2073,2074,2066,2070,2071,2663,},{697,701,711,1136,1141,1744,},{1862,1866,1872,2099,2102,2747,},{1484,243,241,245,344,347,},{1937,1936,587,589,588,2053,},{2344,2347,2588,2280,2283,2287,},{2415,2416,2480,68,70,73,},{2550,2549,2067,2069,2068,2653,},{2421,2300,2304,2135,2139,2132,},{4,15,16,709,710,2906,},{403,405,406,2592,2593,2740,},{2453,592,595,588,2054,2056,},{1806,1804,244,248,245,1856,},{246,244,242,1805,590,585,},{247,246,242,2329,591,590,},{1913,1915,2236,586,589,593,},{1807,1806,2452,585,593,592,},{244,248,242,1806,585,592,},{2145,2143,2144,2408,2405,2456,},{2664,2666,2600,2601,2604,2682,},{350,347,241,249,245,1857,},{2673,1859,1860,643,645,640,},{923,924,925,2685,2688,2786,},{550,551,332,336,339,2776,},{2206,2210,2208,2492,2491,2610,},{2319,2317,2555,2137,2133,2136,},{2043,2045,2797,1837,1842,1843,},{2145,2143,2146,2654,2408,2409,},{969,963,967,1383,1381,2373,},{2303,2080,2082,2077,2132,2138,},{2080,2082,850,852,857,2303,},{2894,2897,2567,2568,2569,2919,},{2088,2085,2089,2530,2316,2320,},{2094,2092,858,851,855,2523,},{1735,1737,2324,410,413,415,},{865,869,870,897,899,2773,},{2803,2804,2805,2913,2916,2919,},{850,855,857,2081,2082,2522,},{333,337,334,720,713,743,},{141,143,146,2520,2521,2666,},{2255,1876,1873,1877,1979,1982,},{2094,2092,2036,2040,2039,2523,},{2146,2142,2304,2139,2131,2132,},{2472,1967,1968,1681,1680,1682,},{2637,2638,2531,2533,2534,2891,},{2654,2655,2408,2409,2410,2663,},{2081,2080,850,855,852,2301,},{2238,2237,2079,2081,2080,2301,},{2418,856,854,852,2302,2300,},{896,899,865,868,870,1456,},{2652,2648,2650,2398,2397,2399,},{2809,1323,1324,933,926,934,},{376,380,382,2424,2426,2868,},{1690,1497,1496,1501,1607,1612,},{2398,2008,2006,1368,1367,1365,},{2579,2582,2690,2444,2446,2450,},{539,541,543,2542,2544,2862,},{100,94,98,937,936,1795,},{2585,2589,2732,2025,2026,2029,},{2469,2468,2470,2734,2691,2693,},{2488,2489,2490,2890,2891,2907,},{2397,2396,2399,2650,2503,2504,},{2391,2395,2609,2170,2172,2174,},{2538,1306,1309,903,900,907,},{2573,2572,928,932,931,2762,},{2576,856,853,857,2318,2320,},{856,852,857,2576,2302,2303,},{2576,2418,2420,2302,2300,2303,},{1282,1283,1284,2703,2704,2741,},{1817,1688,1690,1608,1607,1612,},{2147,2152,1193,1194,1197,2199,},{1246,1249,1250,2637,2638,2891,},{2852,2853,206,208,209,2933,},{869,866,870,2773,1168,1169,},{2241,2240,499,506,505,2849,},{2510,2516,2518,2719,2721,2823,},{2565,2567,2693,1958,1960,1962,},{1178,791,789,793,1051,1055,},{2692,2693,2785,2684,2685,2687,},{2370,2372,2169,2172,2174,2609,},{1959,1957,1961,2686,2546,2547,},{1654,1659,1351,1352,1353,1771,},{1050,1055,1052,1159,1154,1339,},{580,583,584,1019,1021,2814,},{897,899,478,480,483,2773,},{2267,318,319,314,1024,1025,},{2871,2872,2874,2892,2895,2908,},{2428,2156,2155,2158,2315,2319,},{2157,2155,2158,2575,2318,2319,},{2262,2265,2266,2489,2490,2907,},{2851,2852,206,207,208,2927,},{54,49,48,1133,71,65,},{2229,2231,2374,1164,1165,1166,},{2423,2424,2281,2284,2286,2598,},{1682,1521,1524,1428,1427,1431,},{2600,2603,2604,2665,2666,2881,},{2861,2862,2542,2543,2544,2897,},{2543,2544,1602,1604,1605,2897,},{2793,2795,144,145,146,2805,},{2382,2383,2461,2037,2038,2041,},{2157,1734,1736,1359,1358,1363,},{828,620,619,623,806,810,},{845,848,846,2593,2591,2667,},{2715,2716,2717,2765,2768,2770,},{2060,2061,1984,1987,1989,2925,},{2648,2649,2650,2651,2652,2722,},{2437,2439,2441,2497,2498,2706,},{909,913,313,316,321,1118,},{2879,2881,2860,2861,2862,2897,},{2420,2300,2303,2135,2132,2138,},{2409,2143,2146,2134,2131,2139,},{1874,1877,1878,2105,2106,2779,},{322,325,3,4,8,700,},{547,549,550,1124,1125,2772,},{2646,2647,2806,186,188,189,},{312,320,313,894,890,912,},{3,4,5,322,323,697,},{2104,2107,1590,1594,1596,2388,},{1180,1186,1344,1044,1046,1049,},{2207,2208,2210,2578,2580,2610,},{274,278,370,222,223,225,},{2870,2874,2875,2887,2888,2926,},{2441,2440,2443,2759,2750,2753,},{1514,1325,1333,1206,1204,1209,},{2614,2615,2616,2908,2909,2926,},{1326,1333,104,105,109,1599,},{2541,2542,2547,177,178,179,},{2433,2434,2435,2848,2853,2906,},{614,612,348,342,345,1536,},{1754,745,744,749,1745,1750,},{2509,2517,2519,2680,2682,2916,},{2320,2319,2596,2138,2133,2137,},{1763,1767,1768,2434,2435,2906,},{2731,2732,2126,2128,2129,2868,},{2497,2500,2390,2392,2394,2707,},{2290,2291,1991,1995,1997,2930,},{2396,2399,2504,1465,1466,1468,},{1348,1039,1038,1043,1229,1233,},{1253,1256,1257,1262,1263,2792,},{2239,2242,2252,1864,1865,1872,},{1435,1442,1904,1398,1400,1402,},{2026,2024,2028,2731,2526,2528,},{2267,1024,1025,966,968,961,},{2777,2778,2780,2789,2790,2816,},{4,16,17,710,711,2947,},{487,484,490,2451,528,531,},{2184,2183,2190,2477,2436,2443,},{2509,2519,129,133,135,2682,},{423,424,294,298,299,2788,},{2594,2595,170,172,173,2911,},{547,548,549,1121,1124,1168,},{744,749,750,1750,1751,2869,},{2550,1857,1858,641,640,642,},{350,347,343,1857,641,640,},{1920,1921,1498,1501,1502,2934,},{713,714,720,741,743,995,},{2595,1279,1285,170,169,173,},{169,171,173,1280,1285,2617,},{2229,2231,2232,2374,2376,2724,},{2264,2266,1273,1275,1276,2891,},{282,283,148,149,150,2729,},{1451,1453,1454,1831,1832,2845,},{2697,2698,501,507,508,2928,},{476,480,260,261,263,549,},{2679,2680,2682,2839,2843,2916,},{603,604,1216,76,78,79,},{2551,350,351,349,2482,2484,},{755,757,760,1379,1383,2153,},{637,632,32,42,34,1744,},{2679,2682,2601,2602,2604,2843,},{132,133,135,2664,2666,2682,},{2200,2204,2617,1278,1280,1285,},{1853,1855,1522,1523,1526,1970,},{477,478,480,865,869,897,},{127,132,135,143,146,2666,},{2334,2280,2279,2023,2022,2021,},{2554,308,309,71,72,63,},{1779,1614,1617,1531,1530,1533,},{1224,1227,1228,1676,1677,2769,},{2803,2805,2744,2746,2748,2916,},{2505,1557,1558,988,989,986,},{2838,2839,2843,2893,2897,2916,},{351,346,349,1686,1684,2484,},{430,427,428,2412,2411,2484,},{2887,2888,946,947,948,2926,},{1603,1604,1605,2567,2569,2897,},{1218,1219,1215,2505,1557,1558,},{1684,346,345,349,1535,1538,},{1710,1711,535,542,543,2881,},{129,134,135,2514,2519,2805,},{2521,141,138,146,229,231,},{328,324,92,100,97,1394,},{2746,2748,2513,2517,2519,2916,},{1605,227,231,139,138,146,},{227,230,231,1602,1605,2544,},{145,146,127,134,135,2805,},{230,228,231,2544,1708,1711,},{1709,1707,1711,2666,2520,2521,},{1603,1605,139,142,146,2569,},{432,435,436,479,481,2729,},{2723,2724,2374,2375,2376,2791,},{1217,985,987,96,95,101,},{971,973,976,1027,1028,1380,},{2669,2161,2162,772,769,773,},{2014,2016,2020,2636,2638,2761,},{2834,2840,2841,2851,2852,2927,},{101,94,97,938,935,1395,},{2914,2918,2680,2681,2683,2925,},{1219,989,985,102,96,95,},{792,789,793,2764,1054,1055,},{2696,2191,2192,205,203,206,},{2648,2397,2398,2007,2008,2006,},{661,459,455,461,463,465,},{1219,1215,1558,989,985,986,},{1136,1139,697,701,707,1743,},{965,962,960,1164,976,972,},{894,891,312,320,314,1026,},{970,978,1025,960,961,968,},{2267,966,968,960,977,978,},{2229,965,967,962,1164,1165,},{963,967,965,1381,1380,2229,},{308,306,1670,71,63,66,},{735,733,737,2181,1094,1095,},{2159,1734,1738,1359,1358,1364,},{1948,328,329,324,1394,1396,},{93,96,101,603,605,1217,},{603,93,96,76,75,78,},{93,94,602,75,76,77,},{936,602,604,77,76,79,},{94,98,936,75,77,79,},{2406,2410,2557,2134,2136,2140,},{318,312,314,893,891,1024,},{2651,2652,1368,1369,1370,2722,},{2344,2283,2280,2025,2023,2021,},{1622,1623,919,924,925,2786,},{1470,1474,1514,1205,1206,1209,},{2630,2631,1974,1975,1976,2870,},{495,238,236,240,356,361,},{2537,2540,1883,1886,1890,2736,},{1943,1946,1947,2000,2001,2782,},{1226,1224,1228,2001,1675,1677,},{49,50,48,1131,65,66,},{1338,1339,1791,1154,1158,1159,},{2015,2018,2020,2709,2710,2907,},{973,978,970,1382,1022,1025,},{964,962,960,1163,975,972,},{1295,1302,1303,1355,1356,2787,},{1641,1642,1643,2901,2902,2922,},{313,311,321,913,751,761,},{322,323,329,697,707,1139,},{1380,758,755,752,1028,1027,},{2553,759,761,752,1030,1031,},{1295,1302,1355,1057,1058,1059,},{299,294,115,119,116,424,},{37,38,35,2305,1746,1747,},{1230,1233,1038,1040,1043,2211,},{794,796,1162,212,214,215,},{1566,1573,1575,1580,1581,2796,},{1626,1162,1163,215,214,216,},{1626,975,974,216,215,213,},{1544,1542,1156,1158,1157,1628,},{794,795,725,727,728,1161,},{1163,972,975,214,216,213,},{2156,2155,2159,2430,2315,2322,},{1238,1239,554,560,561,2784,},{2680,2681,2509,2517,2518,2914,},{890,892,911,301,302,307,},{1792,1544,1548,1158,1156,1160,},{327,323,326,1137,1136,1739,},{555,560,561,1488,1489,2784,},{2631,2632,2634,2885,2888,2909,},{1379,1383,1378,2153,1669,1671,},{2396,1466,1465,1464,2234,2233,},{797,800,831,787,788,792,},{1346,1349,918,919,925,1623,},{898,899,579,583,584,2814,},{1524,1527,1505,1507,1508,2844,},{909,913,1118,751,753,761,},{2071,614,612,617,1536,1540,},{2563,1685,1684,1687,2483,2485,},{911,912,751,757,760,2153,},{753,762,761,1120,1118,2562,},{1375,1377,497,499,505,2240,},{54,49,53,1133,1132,2478,},{2214,2213,2212,2334,2280,2279,},{2345,2347,2214,2215,2218,2780,},{1183,1184,784,785,786,2787,},{933,929,928,2659,2574,2570,},{2449,2450,2451,2910,2912,2932,},{1942,327,326,329,1739,1743,},{319,317,315,1382,1029,1027,},{2554,2553,759,762,761,2562,},{1456,868,867,870,1350,1353,},{1500,1502,1449,1453,1454,2845,},{183,189,185,1824,1819,2222,},{761,752,311,321,315,1031,},{319,321,315,2389,1029,1031,},{317,311,315,755,752,1027,},{2127,2124,2128,2808,2527,2528,},{1027,1029,971,973,978,1382,},{2633,2223,2228,1572,1571,1576,},{2856,2857,2847,2849,2850,2914,},{2127,2130,36,40,43,2809,},{1664,1665,1667,2937,2938,2942,},{1120,1117,1321,304,309,305,},{638,639,646,1483,1487,1695,},{2640,1281,1278,1283,2201,2202,},{2502,2504,2507,1466,1467,1468,},{328,329,327,1948,1941,1942,},{1939,1940,1810,1811,1813,1988,},{160,163,164,883,885,2912,},{1120,1119,1117,2571,1321,1319,},{601,567,571,445,444,447,},{338,339,257,265,266,2818,},{2937,2939,1664,1665,1668,2944,},{131,128,133,2601,2350,2351,},{735,739,734,2187,2175,2179,},{1185,1184,1142,1148,1147,2810,},{2213,2212,2279,1981,1978,1980,},{567,570,571,600,601,2903,},{364,370,274,275,278,422,},{803,805,889,782,783,785,},{1181,1183,887,888,889,1355,},{929,934,931,2660,2657,2763,},{665,671,673,825,827,2749,},{1095,1093,733,737,734,2176,},{921,920,925,2365,1800,1803,},{2594,882,880,883,1756,1758,},{1185,668,663,672,765,767,},{2766,2767,2768,2796,2797,2905,},{1513,1514,1470,1473,1474,2847,},{730,729,732,2374,2049,2051,},{881,884,885,2332,2333,2932,},{2357,2358,2360,2679,2683,2845,},{2127,2128,2130,2808,2809,2869,},{2466,1882,1883,1880,1931,1932,},{1178,1150,1159,791,790,793,},{909,753,751,304,302,300,},{1948,1941,1942,1740,1739,1743,},{1545,1543,1547,1976,1772,1773,},{529,527,530,2690,2331,2332,},{973,970,963,960,961,1022,},{1459,325,324,329,1393,1396,},{809,810,619,622,623,2756,},{2397,2396,2503,2270,2268,2269,},{1950,1780,1781,1516,1517,1515,},{364,365,368,417,420,442,},{2221,185,182,188,954,957,},{830,829,831,1048,1032,1036,},{2509,129,128,133,2349,2351,},{1166,727,732,214,211,220,},{759,762,2554,300,308,309,},{1120,753,762,304,300,309,},{325,324,1393,3,8,7,},{1626,1162,1163,1161,1624,1625,},{2739,2740,2622,2623,2624,2869,},{2067,2069,2071,2550,2552,2662,},{1399,1401,1402,1714,1715,2792,},{2061,1918,1917,1921,1984,1989,},{2464,38,35,41,1747,1750,},{401,406,402,2199,2194,2250,},{1483,1487,1489,1695,1697,2771,},{890,892,894,911,912,2153,},{814,812,811,1103,1071,1068,},{2901,2902,1492,1493,1494,2922,},{1717,1721,1722,1854,1855,2880,},{1142,1144,1147,1181,1184,1356,},{1700,1567,1573,1111,1109,1115,},{370,371,223,225,226,2711,},{1893,1897,1879,1881,1889,2252,},{634,632,637,2589,1742,1744,},{1524,1526,1527,2842,2844,2938,},{52,53,48,2459,69,70,},{842,844,843,1195,1193,2149,},{697,711,4,5,17,1141,},{912,313,311,320,751,760,},{317,311,320,1383,755,760,},{696,446,442,447,516,518,},{2116,1944,1943,1946,1998,2000,},{1940,1815,1817,1810,1808,1813,},{2610,2611,2491,2492,2494,2833,},{2050,1463,1467,1066,1067,1065,},{1062,1061,1060,1467,1067,1065,},{2554,2478,2479,71,70,72,},{2694,595,594,596,2673,2674,},{2864,2865,2559,2560,2561,2945,},{2459,2415,2414,70,69,68,},{52,51,48,2414,69,68,},{2403,2404,2620,426,429,431,},{1378,1130,1131,755,754,756,},{1379,1378,755,757,756,1669,},{911,910,302,307,306,1669,},{751,757,756,911,910,1669,},{910,751,756,302,300,306,},{1133,1131,754,759,756,1670,},{759,756,300,308,306,1670,},{54,53,48,2478,71,70,},{2720,2721,108,109,111,2857,},{2882,2883,2860,2863,2866,2942,},{2116,2117,1922,1925,1926,2782,},{2306,1752,1754,1746,1745,1750,},{2599,1651,1652,1650,2111,2112,},{379,382,103,109,112,2858,},{799,801,802,1186,1187,2901,},{2467,1931,1933,1882,1880,1884,},{2683,2357,2355,2360,2471,2473,},{2283,2288,2589,2021,2025,2029,},{364,368,371,420,423,517,},{2370,2371,2607,770,771,774,},{2820,2823,2719,2720,2721,2857,},{2542,177,174,179,539,541,},{1599,1600,1135,1140,1141,2858,},{2332,1041,1043,881,878,884,},{2873,2874,2836,2839,2840,2915,},{1329,1330,1332,2510,2516,2719,},{449,355,357,354,383,384,},{506,507,508,2915,2917,2928,},{2635,2445,2451,488,487,490,},{1763,1765,1767,2432,2434,2774,},{1566,1573,1580,1109,1110,1115,},{21,25,27,524,526,2912,},{2629,2634,23,24,26,2802,},{1244,1243,1249,2159,1272,1275,},{2515,2516,1329,1331,1332,2819,},{2425,2426,376,381,382,2924,},{2834,2841,2845,2852,2855,2934,},{2782,2783,1822,1823,1824,2905,},{2030,2034,2162,768,769,773,},{1799,1802,2035,1549,1550,1554,},{390,389,510,255,253,254,},{1908,1724,1728,1299,1298,1304,},{2354,1096,1097,1092,1965,1966,},{257,263,266,335,339,2773,},{451,449,545,385,383,384,},{1824,1822,183,189,187,2783,},{2593,845,848,842,1196,1197,},{809,807,810,2756,1173,1175,},{1423,1420,1438,1267,1270,1268,},{1308,1311,2705,1277,1282,1285,},{1034,1033,1037,1339,1052,1055,},{512,514,389,392,394,2755,},{2161,2160,536,540,538,2475,},{2545,2547,2548,2559,2561,2865,},{2332,2333,527,530,531,2932,},{1645,1647,1653,1713,1715,1904,},{1045,1049,1339,1032,1034,1037,},{2678,2681,2742,2509,2512,2518,},{735,736,739,2180,2187,2293,},{2192,2191,1374,1377,1376,2696,},{1496,1501,1504,1612,1613,2936,},{2186,2187,2599,2175,2178,2179,},{57,60,62,147,149,193,},{676,628,627,387,386,385,},{1260,1106,1103,1102,1255,1253,},{1853,1522,1521,1523,1679,1680,},{1511,1510,1863,1328,1325,1327,},{2637,2429,2430,1246,1245,1249,},{2751,2753,1663,1664,1668,2939,},{2704,2705,502,504,508,2743,},{1524,1505,1507,1427,1426,1431,},{527,531,2333,196,197,198,},{502,498,503,2702,1894,1895,},{1143,1146,1302,1056,1057,1059,},{1934,1880,1879,1886,1891,1895,},{1700,1699,1702,2797,2043,2045,},{2808,2809,2527,2528,2529,2869,},{2290,1991,1995,941,939,947,},{2709,2710,706,709,712,2907,},{1447,1448,1407,1412,1413,2713,},{2487,2489,2311,2312,2314,2774,},{2532,2534,2343,2346,2348,2817,},{1592,1593,1595,2309,2314,2339,},{1355,888,886,889,1058,1059,},{1490,1491,1494,1520,1527,1667,},{2535,2540,2537,2705,2702,2736,},{1932,1934,2537,1880,1883,1886,},{1347,1348,1349,1759,1760,2931,},{1976,1570,1568,1574,1772,1773,},{2230,2231,2651,1366,1368,1369,},{2636,2638,1246,1248,1250,2761,},{1180,1186,1187,1344,1345,2901,},{1979,1982,1983,2255,2260,2780,},{2639,2642,2697,943,944,947,},{1004,1002,1001,1211,1070,1069,},{2214,2212,2218,2347,2280,2287,},{2506,731,729,732,2050,2051,},{2184,2185,2183,2474,2436,2437,},{38,40,43,2463,2465,2809,},{103,109,111,379,381,2857,},{491,495,608,238,239,240,},{1473,1205,1208,9,6,13,},{1275,1276,1243,1249,1250,2891,},{1636,1638,1634,1826,1774,1775,},{471,467,473,801,598,600,},{1698,1701,1779,1560,1562,1563,},{2705,2535,2540,1308,1306,1311,},{2422,1537,1540,616,612,617,},{1590,1596,2107,200,202,209,},{1099,1100,1101,2600,2603,2665,},{1850,1851,2599,1646,1651,1652,},{972,979,1166,213,214,220,},{239,237,236,450,358,355,},{1507,1509,1495,1500,1503,2846,},{2863,2864,2669,2670,2671,2940,},{2857,2858,2257,2258,2261,2924,},{2688,2558,2561,2546,2545,2548,},{705,709,710,2587,2588,2906,},{1974,1975,1977,2630,2632,2872,},{2421,2422,2072,2073,2074,2663,},{2285,2287,1980,1982,1983,2780,},{1472,1473,9,11,13,2433,},{1660,1663,1664,1720,1722,2751,},{2600,2601,131,132,133,2664,},{1124,1125,1126,2772,2773,2776,},{1448,915,914,916,1407,1413,},{1358,1361,1364,1735,1738,2325,},{2815,2816,2386,2387,2388,2906,},{693,696,618,620,623,828,},{2847,2849,1869,1870,1871,2856,},{916,666,665,671,820,825,},{2493,1553,1551,1554,2362,2364,},{2174,2165,2168,1726,1725,1730,},{2114,2115,2116,2224,2225,2644,},{1165,1166,2374,727,730,732,},{2231,976,979,217,213,220,},{814,812,813,1103,1102,1253,},{2769,1945,1947,1821,1818,1823,},{2307,1741,1744,1138,1136,1141,},{115,119,113,299,136,137,},{2732,635,633,637,2126,2129,},{1098,1093,1097,2178,2177,2361,},{2186,2182,2175,2178,2177,2361,},{1094,1093,1097,2182,2175,2177,},{1002,1001,677,681,679,1069,},{1927,1422,1423,1269,1270,1267,},{1911,1411,1410,1415,1662,1667,},{452,355,359,354,383,386,},{2727,2728,1727,1729,1730,2950,},{1048,1049,1032,1036,1037,2764,},{677,679,676,1001,950,951,},{1286,1287,1294,1386,1391,1509,},{1159,776,775,780,790,793,},{518,457,456,461,509,514,},{1479,1481,1476,2113,1650,1653,},{2271,2276,2278,2338,2340,2891,},{536,540,541,2161,2162,2669,},{2493,2494,1553,1554,1555,2946,},{2475,2474,2496,2436,2438,2437,},{2088,2084,2090,2533,2274,2276,},{1524,1525,1526,2837,2842,2880,},{1985,1986,1987,2254,2258,2425,},{471,473,474,801,802,2901,},{1484,1488,243,245,251,1861,},{2772,2773,549,550,551,2776,},{700,707,322,325,329,1459,},{1307,1310,1311,2594,2595,2911,},{1659,1017,1014,1021,1191,1192,},{1972,1975,1785,1787,1790,2368,},{920,922,925,1801,1803,2561,},{2651,219,218,220,2648,2649,},{1107,1104,1077,1068,1072,1270,},{323,326,329,1136,1139,1743,},{1140,1141,5,14,17,2858,},{1229,1233,1234,1348,1349,2931,},{2017,2018,2019,2815,2816,2906,},{2588,2344,2347,2013,2011,2019,},{2877,2878,1291,1293,1294,2951,},{345,349,353,1538,1540,2486,},{1949,1955,2004,1436,1437,1442,},{2433,2435,1763,1766,1768,2853,},{2541,2542,1956,1957,1961,2547,},{2231,1164,1166,976,972,979,},{2547,2032,2034,178,175,179,},{2230,2231,217,219,220,2651,},{1207,1209,1599,1134,1135,1140,},{2538,2539,2540,2894,2898,2920,},{2240,1471,1473,1375,1373,1377,},{538,542,544,2476,2477,2884,},{927,931,841,844,847,2416,},{1471,1470,1473,2240,1512,1513,},{1874,1878,1814,1816,1817,2106,},{1968,1969,1680,1682,1683,2837,},{1651,1650,1649,2111,2065,2062,},{1318,1320,1324,2462,2465,2667,},{2063,2064,2354,1964,1965,1966,},{2064,1847,1849,1846,1964,1966,},{2042,2044,2699,1990,1992,1994,},{497,501,505,1376,1377,2696,},{368,367,297,292,296,509,},{2584,705,703,706,2013,2015,},{2163,1424,1420,1425,1439,1440,},{1568,1574,1559,1561,1563,1773,},{2333,881,885,161,160,164,},{1649,1646,1648,1847,1846,1964,},{1353,1167,1169,1122,1121,1126,},{1682,1683,1521,1524,1525,2837,},{499,506,498,2241,1892,1896,},{498,506,508,1896,1898,2917,},{794,796,795,1162,1161,1624,},{1475,1480,1481,1518,1519,2792,},{2492,2493,2362,2363,2364,2830,},{2473,1830,1829,1832,1919,1921,},{1407,1409,1410,1443,1444,1582,},{2738,670,669,673,2712,2714,},{1581,993,992,998,1110,1116,},{823,825,827,1413,1414,2749,},{2187,1848,1851,1845,1901,1903,},{1638,1634,1633,1775,1725,1723,},{2065,2064,2361,1850,1847,1849,},{2186,2182,2361,1848,1850,1849,},{1094,1097,1091,2182,1848,1849,},{1411,1409,1414,1908,1584,1587,},{1802,1801,1803,2945,2560,2561,},{2128,2129,36,41,42,2868,},{457,456,366,368,367,509,},{2632,2635,23,25,27,2912,},{2699,945,939,946,1992,1994,},{1445,1443,1444,1583,1582,1660,},{1570,1572,1574,1974,1976,2631,},{1789,1790,1792,2825,2832,2877,},{1842,1841,1843,2797,2766,2768,},{1042,1040,1043,2690,2209,2211,},{479,281,280,282,407,409,},{569,568,570,793,775,780,},{60,61,62,191,193,409,},{2472,2473,2355,2358,2360,2845,},{338,337,339,2818,2798,2799,},{2828,2831,1232,1233,1234,2931,},{2886,2888,1574,1576,1577,2921,},{1748,1751,744,747,750,2593,},{1543,1541,1547,1773,1561,1563,},{1412,1414,1296,1300,1304,2714,},{332,335,339,549,551,2773,},{1190,1192,895,896,899,1456,},{1580,1581,1110,1115,1116,2796,},{199,205,207,944,947,2697,},{1174,1175,777,780,781,2903,},{2287,2253,2260,1980,1979,1983,},{192,190,193,435,259,262,},{799,664,668,663,764,765,},{2765,2767,1113,1114,1116,2769,},{2381,2378,2244,2249,2246,2598,},{1544,1546,1548,1790,1792,2877,},{396,395,397,515,509,511,},{662,666,665,694,693,820,},{2402,2401,2404,2557,2406,2410,},{2462,2465,1747,1749,1751,2667,},{2243,2245,2296,2194,2195,2197,},{2262,2263,2265,2487,2489,2774,},{2871,2877,2859,2861,2866,2900,},{1571,1569,1575,2227,1923,1926,},{1015,1013,1020,1228,1108,1116,},{1952,1954,2163,1436,1439,1440,},{2163,1928,1929,1424,1422,1425,},{2255,2259,1876,1877,1878,2779,},{2581,2444,2448,2367,2366,2368,},{2271,2276,2338,2084,2086,2090,},{1411,1409,1410,1584,1582,1662,},{2459,2460,2480,2414,2415,2416,},{1495,1503,1509,1385,1386,1391,},{2382,2383,2335,2337,2338,2461,},{351,346,352,2675,1686,1687,},{2929,2930,1995,1996,1997,2953,},{1809,1812,1813,1876,1878,2259,},{260,258,262,479,407,409,},{478,483,899,285,287,291,},{343,344,347,638,640,1484,},{1761,1768,1589,1591,1596,2193,},{2205,2210,2363,1230,1231,1232,},{2880,2882,2884,2937,2939,2944,},{2336,2339,2387,1593,1594,1595,},{2674,594,596,559,552,560,},{2496,2499,2501,2670,2672,2944,},{1975,1545,1542,1546,1629,1630,},{1663,1666,1668,2752,2753,2949,},{2533,2088,2085,2090,2316,2322,},{2359,1096,1092,1101,1965,1969,},{1572,1576,1577,2633,2634,2921,},{23,25,26,2632,2634,2909,},{400,401,402,2147,2148,2194,},{1282,1284,1285,2704,2705,2743,},{1446,1445,1444,1717,1661,1660,},{2527,2525,2529,2809,2659,2660,},{1757,1760,902,907,908,2899,},{2915,2917,2893,2895,2898,2928,},{2602,2603,2356,2358,2359,2837,},{1714,1715,1477,1480,1481,2792,},{1908,1911,1724,1728,1729,2922,},{2445,2449,2451,2632,2635,2912,},{190,191,193,258,262,409,},{1142,1143,1144,1179,1181,1295,},{1791,1792,1158,1159,1160,2902,},{429,430,431,2619,2620,2676,},{491,239,238,236,358,356,},{2597,1539,1537,1540,2419,2422,},{878,879,884,1039,1043,1348,},{469,473,475,695,696,2903,},{116,117,118,422,423,2711,},{417,420,442,294,295,297,},{1552,1554,1555,2371,2372,2946,},{1645,1646,1647,1712,1713,1845,},{677,676,950,627,629,628,},{2263,10,8,12,1457,1460,},{457,366,365,368,439,442,},{367,371,292,296,298,513,},{1351,1353,1659,1189,1191,1192,},{2147,400,401,399,1193,1194,},{2763,2298,2297,2299,2657,2660,},{1104,1068,1072,952,951,953,},{350,348,353,2552,2067,2071,},{1420,1073,1074,1072,1267,1268,},{1438,1074,1077,1072,1268,1270,},{638,646,343,344,352,1487,},{1652,1646,1647,1851,1845,1903,},{1585,1409,1412,1297,1296,1300,},{1312,1313,1317,1373,1377,1473,},{2494,2171,2174,2166,2165,2168,},{1433,1416,1417,1213,1212,1214,},{2829,2832,2833,2942,2943,2950,},{2370,2371,2372,2607,2609,2946,},{1434,1437,1440,1631,1632,2003,},{2292,1953,1949,1954,2002,2003,},{2112,1652,1650,1647,1903,1900,},{680,679,676,1068,952,951,},{2060,1984,1987,374,373,381,},{1241,1214,1211,1210,1221,1220,},{355,357,449,267,269,270,},{1517,1106,1107,1105,1432,1438,},{1260,1259,1103,1106,1105,1432,},{2047,1423,1424,1420,1438,1439,},{2677,2656,2658,2571,2570,2573,},{1789,1792,1793,2832,2833,2950,},{2606,2607,2609,2940,2943,2946,},{1416,1418,1435,1397,1398,1400,},{430,428,431,2676,2484,2486,},{2923,2925,1987,1988,1989,2934,},{1933,1935,1880,1884,1887,2566,},{2097,2100,2566,140,142,144,},{2578,2580,2583,2610,2611,2833,},{2667,1749,1748,1751,2591,2593,},{2072,2074,2422,615,616,617,},{812,811,674,680,679,1068,},{866,867,870,1167,1169,1353,},{1107,1105,1438,1077,1068,1074,},{1004,1002,1003,1211,1210,1220,},{1421,1420,1434,1076,1073,1074,},{1434,1433,1564,1076,1074,1075,},{1433,1214,1213,1075,1074,1069,},{1242,1241,1564,1070,1076,1075,},{1241,1211,1214,1070,1075,1069,},{1242,1240,1421,1076,1070,1073,},{1240,1004,1006,1001,1070,1073,},{1855,1661,1664,1522,1520,1526,},{664,663,764,468,471,470,},{2066,2071,2074,614,615,617,},{1007,684,683,685,871,873,},{1220,1009,1010,1007,1127,1128,},{1210,1008,1009,874,875,871,},{681,679,675,1069,874,872,},{1002,1003,1000,1210,1008,1009,},{2487,1764,1763,1765,2431,2432,},{1009,1007,875,871,873,1127,},{1002,1000,681,677,678,1008,},{677,678,1000,627,629,630,},{683,494,493,492,625,624,},{681,678,675,1008,874,871,},{2863,2866,2824,2829,2832,2942,},{2605,2606,2495,2496,2499,2670,},{1174,777,776,780,1149,1159,},{2433,1316,1313,1317,1472,1473,},{2393,2395,2170,2173,2174,2728,},{2473,1919,1918,1921,2057,2061,},{627,630,678,451,452,453,},{491,448,450,356,358,355,},{11,8,12,2432,1458,1460,},{876,683,686,625,624,626,},{683,685,686,873,876,1129,},{1546,1547,1528,1532,1533,2870,},{1549,1551,1554,1800,1802,2364,},{918,917,925,1349,1229,1234,},{234,233,235,495,356,361,},{1259,1258,1262,1441,1398,1401,},{851,857,855,2093,2092,2522,},{853,857,859,2320,2322,2621,},{357,354,384,267,270,268,},{1800,1802,1803,2364,2365,2945,},{1714,1261,1258,1262,1399,1401,},{516,515,398,396,397,618,},{1108,1114,1116,1227,1228,2769,},{1658,1223,1228,1017,1015,1020,},{662,665,693,468,469,472,},{1769,1770,1926,1654,1655,1658,},{388,389,363,366,367,456,},{2578,2583,1639,1640,1644,2611,},{393,224,226,221,253,256,},{517,420,423,297,294,298,},{422,423,364,370,371,2711,},{298,122,121,125,252,256,},{513,296,298,254,252,256,},{2606,2609,1906,1909,1912,2943,},{393,389,363,371,367,513,},{2913,2917,1896,1897,1898,2920,},{2275,2277,2278,2815,2817,2907,},{1527,1201,1200,1203,1505,1508,},{224,226,223,393,363,371,},{296,122,124,121,252,254,},{2417,844,843,848,2149,2152,},{2100,2101,2102,2793,2794,2804,},{1443,1447,1407,1409,1412,1585,},{1507,1508,1509,2844,2846,2951,},{1923,1925,1926,2225,2227,2782,},{32,42,36,637,633,2129,},{379,381,382,2857,2858,2924,},{2386,2385,2388,2816,2789,2790,},{659,610,611,459,458,460,},{2536,2466,2469,1883,1882,1885,},{2384,2388,2780,2104,2105,2107,},{2397,2006,2007,2005,2268,2270,},{116,118,119,423,424,2788,},{236,240,232,233,235,361,},{2824,2829,2830,2863,2864,2940,},{2012,2014,2020,2531,2534,2638,},{1082,1079,1081,1465,1464,2233,},{844,847,848,2416,2417,2763,},{1086,1090,2404,425,426,431,},{2416,2417,2149,2151,2152,2763,},{1720,1583,1582,1586,1660,1663,},{403,404,405,2590,2592,2622,},{1769,1770,1578,1579,1581,1926,},{2434,11,8,15,1458,1461,},{1616,1619,2760,1606,1611,1613,},{1859,1861,2674,640,643,647,},{2694,2673,2674,1860,1859,1861,},{2248,2250,402,405,406,2740,},{926,930,934,1320,1324,2667,},{2694,250,248,251,2453,2454,},{1484,1488,1861,638,640,647,},{247,242,251,2427,591,596,},{2454,248,242,251,592,596,},{1673,1676,1836,1224,1225,1227,},{929,931,928,2657,2570,2572,},{1674,1676,1675,1945,1943,1999,},{2427,1485,1488,1237,1235,1238,},{1834,1835,1836,2715,2716,2765,},{2718,2721,2742,2626,2627,2628,},{2640,2641,1281,1283,1284,2741,},{1085,1089,1090,1539,1540,2597,},{298,299,122,125,126,2788,},{1457,1460,1461,2263,2265,2774,},{2585,2589,634,635,637,2732,},{2306,2307,1752,1754,1755,2868,},{1995,1996,939,947,949,2929,},{719,720,721,2775,2776,2799,},{2383,2087,2086,2090,2335,2338,},{37,35,41,2306,1746,1750,},{798,800,801,1048,1049,2764,},{2893,2895,2871,2873,2874,2915,},{2701,956,955,959,2613,2616,},{2631,2634,1572,1574,1577,2888,},{1985,1988,1811,1812,1813,2259,},{2367,2368,1787,1788,1790,2581,},{1713,1715,1399,1400,1402,1904,},{2735,2736,1886,1889,1890,2920,},{1895,1897,1898,2735,2736,2920,},{2560,2559,2033,2035,2034,2864,},{2444,2447,2448,2580,2581,2825,},{410,415,416,1737,1738,2695,},{2266,1457,1462,704,700,712,},{456,461,388,389,394,514,},{2612,2615,2617,2642,2643,2928,},{1706,1705,1710,2476,2326,2328,},{1830,1831,1832,2472,2473,2845,},{879,880,884,1347,1348,1759,},{2850,2852,2855,2923,2925,2934,},{2463,2465,1318,1323,1324,2809,},{2223,2226,2228,2629,2633,2801,},{2093,2095,851,857,859,2621,},{955,959,519,520,525,2616,},{2256,2257,2258,2847,2850,2857,},{887,889,1183,783,784,785,},{432,437,482,259,260,264,},{1223,1226,1228,1656,1658,2001,},{2117,1998,2001,1657,1656,1658,},{1972,1973,1975,2366,2368,2448,},{1544,1542,1546,1790,1628,1630,},{1184,765,763,766,784,786,},{2775,2776,336,337,339,2799,},{467,475,601,441,445,447,},{1295,1303,1143,1144,1147,1356,},{482,483,285,289,291,2813,},{1143,1146,1147,1302,1303,2787,},{2750,2752,2753,2758,2759,2949,},{1355,1356,1181,1183,1184,2787,},{1175,658,657,661,777,781,},{1145,1148,2737,667,670,672,},{1975,1976,1545,1546,1547,2870,},{1192,1014,1021,581,580,584,},{1151,1149,1159,1202,1170,1174,},{2681,2059,2058,2060,2625,2628,},{2570,2572,2573,2657,2658,2762,},{2677,2571,2573,1321,1319,1322,},{2421,2422,2663,2135,2139,2140,},{1497,1499,1501,1689,1690,1940,},{821,826,828,1174,1175,2903,},{2249,2245,2250,2869,2528,2529,},{2552,350,349,353,2482,2486,},{1757,1758,1759,2892,2896,2910,},{2424,2377,2381,376,375,380,},{2820,2821,2823,2856,2857,2914,},{2024,2021,2028,2528,2282,2286,},{391,390,392,611,562,565,},{611,391,388,392,458,460,},{390,389,392,565,510,512,},{510,511,512,563,565,621,},{1617,1618,1530,1533,1534,2889,},{1490,1494,1199,1201,1203,1527,},{1618,1290,1288,1294,1530,1534,},{1533,1534,1288,1292,1294,2889,},{564,563,566,809,619,622,},{563,565,566,621,622,2754,},{2836,2844,2846,2877,2878,2951,},{2243,2250,2299,2194,2195,2199,},{2297,2299,2243,2247,2250,2660,},{2192,2193,203,206,209,2853,},{23,20,27,2635,488,490,},{2598,2378,2377,2381,2423,2424,},{1699,1698,1701,2044,1778,1779,},{1046,1045,1049,1344,1334,1339,},{522,525,2802,21,24,26,},{2543,1602,1601,1604,1956,1962,},{1521,1523,1525,1680,1683,1969,},{204,207,210,2290,2291,2930,},{1618,1619,1389,1391,1392,2953,},{996,990,999,2813,1018,1021,},{1688,1689,1690,1815,1817,1940,},{1771,1352,1353,1123,1122,1126,},{1571,1575,1576,2227,2228,2905,},{521,522,523,2645,2646,2800,},{1179,1187,1182,1304,1301,2738,},{2460,2414,2416,2150,2149,2151,},{515,518,509,511,514,623,},{621,623,511,512,514,2755,},{928,932,926,2573,1319,1322,},{1187,799,802,668,664,673,},{2460,2150,2147,2151,2196,2198,},{2295,2298,2460,2195,2196,2198,},{571,462,465,444,440,447,},{780,781,568,570,571,2903,},{439,442,447,457,461,518,},{807,806,810,1175,821,828,},{693,695,696,826,828,2903,},{1482,1487,344,346,352,1687,},{1483,1489,555,556,561,1697,},{558,556,561,2342,1691,1697,},{1485,1488,2427,243,247,251,},{643,647,2674,553,559,560,},{2675,2412,2411,2413,2484,2485,},{549,261,257,263,332,335,},{2744,2746,2747,2803,2804,2913,},{706,708,712,2708,2710,2761,},{1019,838,840,580,578,583,},{2937,2938,2880,2882,2883,2942,},{772,773,774,2669,2671,2864,},{2820,1332,1327,1333,1868,1870,},{2716,2717,2770,1820,1821,1824,},{954,957,958,2221,2222,2806,},{634,635,636,2585,2586,2730,},{2629,23,22,24,2223,2226,},{2016,2015,2020,2761,2708,2710,},{2848,2853,13,15,16,2906,},{2837,2842,2844,2880,2883,2938,},{2825,2828,2447,2448,2450,2876,},{2812,2813,2818,264,265,266,},{2469,2470,1882,1885,1888,2734,},{2859,2861,2824,2825,2826,2871,},{2849,2850,2855,2914,2918,2925,},{2700,2219,2222,956,954,958,},{1821,1823,1824,2769,2770,2905,},{2733,2734,905,906,907,2785,},{2908,2909,2872,2874,2875,2926,},{2212,2215,2285,1978,1980,1982,},{1875,1873,1877,2215,1978,1982,},{1613,1496,1504,1388,1385,1392,},{2114,2116,1922,1923,1925,2225,},{2256,2260,2261,2853,2854,2947,},{1609,1612,1613,2106,2108,2936,},{2291,2103,2108,1610,1609,1613,},{1693,1695,1697,2563,2564,2771,},{1582,1586,1588,1663,1666,2752,},{2563,2564,1486,1487,1489,2771,},{1389,1388,1392,1619,1606,1613,},{2273,2277,2275,2387,2386,2815,},{1691,1693,1697,2341,2342,2564,},{554,558,561,1236,1239,2342,},{1838,1839,1843,2219,2222,2700,},{2811,2813,2814,1018,1019,1021,},{1087,1090,2486,425,428,431,},{1260,1259,1263,1519,1432,1442,},{1208,1209,6,13,14,2847,},{2355,2358,1965,1967,1968,2472,},{2641,2643,2743,500,504,508,},{902,901,908,1760,1620,1623,},{2590,2592,2593,2622,2624,2740,},{901,906,908,1622,1623,2786,},{2212,2215,2218,2285,2287,2780,},{501,500,508,2698,2639,2643,},{2849,2855,2834,2839,2845,2918,},{1779,1531,1529,1533,1562,1563,},{1307,1311,1277,1279,1285,2595,},{567,569,570,597,600,793,},{368,371,517,292,297,298,},{187,186,189,2783,2644,2647,},{1887,1881,1889,2794,2251,2252,},{2861,2865,2824,2826,2831,2899,},{2516,2517,2518,2821,2823,2914,},{2400,1082,1078,1084,1367,1371,},{2052,1080,1079,1084,1463,1469,},{2507,2508,1467,1468,1469,2781,},{2722,2723,2506,2507,2508,2781,},{2050,2051,2052,2506,2508,2723,},{2508,2050,2052,1467,1463,1469,},{1788,1793,1635,1639,1644,2583,},{2609,2391,2395,1906,1905,1912,},{1788,1789,1793,2580,2583,2833,},{1635,1643,1644,1792,1793,2950,},{2942,2943,1909,1911,1912,2950,},{1518,1255,1254,1256,1475,1480,},{1729,1730,1633,1643,1644,2950,},{2168,1638,1633,1644,1725,1730,},{997,996,999,2818,2812,2813,},{880,883,884,1758,1759,2910,},{2307,1598,1597,1600,1752,1755,},{664,673,802,468,471,474,},{1633,1642,1342,1343,1345,1728,},{2608,2391,2390,2394,2495,2500,},{2312,2314,1762,1765,1767,2774,},{2307,37,34,42,1741,1744,},{1354,1357,1295,1298,1304,1728,},{1517,1519,2048,1432,1438,1442,},{2432,2434,1458,1460,1461,2774,},{540,538,544,2672,2475,2477,},{2836,2838,2844,2871,2877,2900,},{1991,1993,1997,2289,2291,2760,},{207,208,210,2927,2930,2936,},{2567,2568,1884,1888,1889,2894,},{284,289,290,437,438,2811,},{2691,2692,2693,2733,2734,2785,},{1369,1371,1372,2723,2724,2791,},{1883,1885,1888,2536,2538,2734,},{2699,2701,945,946,948,2888,},{2241,2242,1864,1871,1872,2913,},{579,583,286,287,290,898,},{90,88,91,436,192,194,},{1492,1493,824,826,827,2901,},{1301,1300,1304,2738,2712,2714,},{1518,1519,1255,1256,1257,2792,},{2480,2481,70,73,74,2762,},{2677,1321,1322,309,305,310,},{2677,309,310,72,63,74,},{1322,926,932,305,303,310,},{303,310,932,63,64,74,},{64,73,74,931,932,2762,},{1905,1907,1912,2393,2395,2728,},{1493,1408,1414,824,823,827,},{1908,1299,1297,1304,1584,1587,},{2109,2113,2294,1951,1953,1955,},{671,669,673,2749,2713,2714,},{2254,2258,2261,2425,2426,2924,},{1340,1343,1345,1354,1357,1728,},{826,827,472,473,474,2901,},{1959,1961,1963,2686,2688,2865,},{2363,2364,2365,2830,2831,2945,},{2365,921,917,925,1231,1234,},{2574,39,33,40,1319,1323,},{1318,1323,33,38,40,2463,},{2488,2490,2262,2264,2266,2891,},{462,464,465,568,571,781,},{1173,1175,2756,658,660,661,},{600,601,467,473,475,2903,},{2727,1727,1724,1729,1907,1911,},{1491,1494,1667,1408,1410,1415,},{1457,1461,1462,2265,2266,2907,},{2346,2348,2011,2017,2020,2817,},{781,657,661,464,463,465,},{2769,2770,2765,2767,2768,2905,},{2325,1735,1738,413,410,416,},{2047,2048,2164,1438,1439,1442,},{1184,1185,765,766,767,2810,},{2369,2372,1552,1553,1555,2494,},{1893,1892,1897,2252,2239,2242,},{2035,2033,1799,1802,1801,2560,},{1865,1862,1872,2252,2096,2102,},{2220,2222,2717,1819,1820,1824,},{1719,1720,1722,2440,2442,2751,},{2220,2222,1838,1840,1843,2717,},{2387,2273,2277,2271,2336,2339,},{2476,2477,2184,2188,2190,2884,},{2860,2861,2835,2837,2838,2879,},{2719,2720,1330,1332,1333,2820,},{1869,1870,1510,1513,1514,2847,},{2890,2891,2338,2339,2340,2907,},{2437,2441,2443,2498,2501,2759,},{1882,1884,1888,2467,2470,2567,},{2214,2215,2217,2345,2346,2778,},{2215,2216,2217,2777,2778,2789,},{1988,1917,1916,1920,1939,1940,},{2011,2017,2019,2346,2347,2816,},{1814,1817,1878,1808,1809,1813,},{1510,1514,1870,1325,1327,1333,},{157,159,163,168,172,524,},{2880,2884,2188,2189,2190,2939,},{1332,1327,1331,1868,1867,2819,},{162,157,163,2594,170,172,},{2834,2839,2840,2849,2851,2915,},{1050,1051,1055,1150,1159,1178,},{2526,2528,2731,2124,2126,2128,},{2580,2581,1788,1789,1790,2825,},{2256,2259,2260,2852,2853,2933,},{2695,2094,2095,2040,2036,2041,},{2811,2813,289,290,291,2814,},{1910,1911,1662,1666,1667,2948,},{388,392,394,460,461,2755,},{621,622,623,2754,2755,2756,},{2589,705,701,711,1742,1744,},{2026,2028,2029,2731,2732,2868,},{2824,2825,2832,2859,2866,2877,},};
+constexpr int N_COLORS = 39;
+float ox_data[616][3] = {{0.13438152139392615,0.0051534453995750774,-0.31441619874643706,},{0.6994690307401481,0.004174618218039707,-0.41447312776396966,},{0.6765413088289393,0.000605937486170434,-0.35786460221030914,},{0.6138795008636264,0.0,-0.4290195435345908,},{0.6103669156544943,0.007908674901374747,-0.3474124054851631,},{0.6423067008152572,0.02656427293355969,-0.44290843775226035,},{0.6749295548059543,0.025055316602005776,-0.46489925197811144,},{0.14122841653651036,0.013854469559612424,-0.3850766659758362,},{0.07887050341961091,0.021182807172103624,-0.3454561601251989,},{0.1646578890844662,0.043133421811672394,-0.3915234168047501,},{0.10243803181185039,0.01431937443437291,-0.4172917557905232,},{0.056568894860651316,0.011078534988689251,-0.4118063214758997,},{0.1886813258997064,0.006166009275209448,-0.37496504448513873,},{0.6343173885999478,0.004519857054319586,-0.44958709924693746,},{0.506056166568246,0.0037613106401365483,-0.5754328335164928,},{0.6161056596214969,0.05481240380494341,-0.43129146512575084,},{0.6051766244929326,0.027258455027432234,-0.409037994198744,},{0.6095390471145803,0.004050155883352988,-0.43963378282697324,},{0.5584766387615697,0.0030822108330376716,-0.4191223088123354,},{0.5825557741972636,0.04390804276833788,-0.39878783396598455,},{0.6034120693417492,0.05797182179041318,-0.4597410859353832,},{0.6181762326842284,0.0031432676343188344,-0.527784317477903,},{0.6536121316093575,0.04538134404475575,-0.48353745246020213,},{0.5482775730827751,0.010007824928519544,-0.6012622418721193,},{0.5150342946725593,0.02918078508726987,-0.5940303515145229,},{0.2051749310431896,0.04879080081055385,-0.41229853984280423,},{0.13083665479906795,0.0032373996258931136,-0.4125471329730475,},{0.13700015035981516,0.057826942798641354,-0.421337420456648,},{0.16853747660509108,0.058847113968043166,-0.41235008421935704,},{0.10433714308810224,0.05060351968975999,-0.4388499068371115,},{0.09122547615209325,0.003996144491217926,-0.4640636403705453,},{0.17282712578513174,0.004427184052048821,-0.48633768722091525,},{0.23286184208567923,0.001072893022729089,-0.45780363140452285,},{0.15179455067717817,0.0018799938162624126,-0.49834733196662245,},{0.2082570757258467,0.005431078546895739,-0.5485993285339468,},{0.2427754015560355,0.024681155745625977,-0.5403917551217003,},{0.27810393957930085,0.0032129901354567792,-0.5405531269913333,},{0.7545415378415569,0.9260573691821651,-0.13532178290357966,},{0.7783983774232931,0.9008303546019436,-0.11936135698523871,},{0.7661297615126635,0.8935028485346137,-0.09349641871762061,},{0.7989257971997354,0.8954195558121015,-0.11115737962731008,},{0.7923308027064238,0.9091515810172488,-0.14873397101859218,},{0.8091384237065502,0.8611057657928577,-0.09131219930104183,},{0.5873099576708788,0.004977437617338958,-0.4799154367871427,},{0.5975222316545317,0.057159353157764485,-0.5586044412968623,},{0.5107587971241255,0.005722603274139562,-0.5293048501260595,},{0.5755220042295232,0.06496681797684223,-0.4465203411428047,},{0.5546520222072121,0.03961025254164646,-0.42385883482322734,},{0.5923910646422901,0.06867514649072291,-0.4730393323925944,},{0.615712924811956,0.07380199510870857,-0.5097024416965429,},{0.6015177807923242,0.09059420307015822,-0.5678302364260908,},{0.536577026065433,0.06753398194663501,-0.5790707075464553,},{0.5226207510700983,0.0725655121947896,-0.5348538748015407,},{0.26135148799658353,0.05931473100840766,-0.4879361881676682,},{0.22671475181931744,0.06846299789158894,-0.44395429511444384,},{0.16118902927690168,0.08182100884490126,-0.46806732600515016,},{0.13969061863902082,0.052937635868747335,-0.48678669300422023,},{0.1966134180358087,0.052732503538549226,-0.540180898799774,},{0.2572133668798767,0.08132121305798172,-0.5029754146985495,},{0.2575148982233398,0.04898521677909696,-0.5468286812967936,},{0.27325366137395274,0.08829031761509887,-0.4971912879154963,},{0.7805156832299063,0.8915338824564627,-0.15736600033167802,},{0.7830290007899018,0.9242216961208954,-0.21371434982345458,},{0.773033678283313,0.9342669621648269,-0.16516513020280182,},{0.746860089497496,0.954693538186068,-0.16406108035081662,},{0.8326155245285283,0.8122248020135648,-0.15805197977835786,},{0.7945540508475486,0.8550801937756329,-0.14227312949710957,},{0.8327705810206224,0.8620439104903325,-0.1710396147507675,},{0.8035745151954371,0.8964606635769589,-0.19115412635159285,},{0.8043527082726543,0.8123332224873457,-0.15011816773236034,},{0.8472041971622679,0.8301800659664825,-0.1951496424141952,},{0.7669145696279392,0.9205330185986427,-0.23906701238619568,},{0.5471475261312195,0.07578769723314788,-0.4852919590044924,},{0.6013636504055582,0.16840180217450856,-0.41923024638833806,},{0.597974038753936,0.11621027644839403,-0.4619915458490604,},{0.6168321231010955,0.1377591598266622,-0.5595643494695501,},{0.5694557497282378,0.10540375182467557,-0.5911333617471268,},{0.635742333948157,0.12782707708391394,-0.5121727615091575,},{0.5100650119325365,0.10452494401858668,-0.5365458030857962,},{0.5250244574494624,0.13264031107613375,-0.4645938356709445,},{0.25155058145853787,0.09243324980083774,-0.44861927287369363,},{0.15845820926553833,0.10817168219954779,-0.4796878310619828,},{0.184102925758568,0.12049695341114691,-0.4295757160894462,},{0.23816432429271525,0.1409083809952338,-0.41031417395605274,},{0.17928082761534964,0.10543358564632001,-0.5266364099235891,},{0.14621304616482922,0.16817728778279867,-0.4894281438514115,},{0.21377606812854164,0.10364785612239304,-0.5404097791166027,},{0.24891561334864415,0.1254485739995532,-0.53313204654526,},{0.2867163222293526,0.14665903203074193,-0.4816401933946067,},{0.8148182276844503,0.883769746136669,-0.23357428168459354,},{0.7522525362221294,0.8889104245127909,-0.2075820772423441,},{0.8134206685938038,0.7837801383614591,-0.21418620048817663,},{0.780471759377197,0.7880922170703571,-0.2013946352438247,},{0.7530988641913505,0.8640972183037311,-0.2632067415705066,},{0.8268738037943991,0.8187621133750052,-0.24786421919960552,},{0.7802163527577533,0.8612729278045993,-0.2765484795301947,},{0.15494483025183917,0.16852676024343605,-0.43166515524072097,},{0.1791588463135485,0.15917455173690725,-0.4129873042205068,},{0.6428008441582368,0.1764857094340564,-0.45682857479468086,},{0.6486079214683851,0.20200057272999514,-0.5155596609951757,},{0.6148941815514395,0.21862998460482194,-0.5546618124635387,},{0.6381763372018298,0.21065304251068215,-0.4253230007320863,},{0.5428699117706071,0.19462632675337704,-0.4225445590617389,},{0.640576669911784,0.23680063419692876,-0.46505113325193753,},{0.5966180221022975,0.21257008054007293,-0.3972126280282735,},{0.5512435576971229,0.14112978631905615,-0.4439778380348945,},{0.5285089948972259,0.16758147130485795,-0.5593805837122814,},{0.5716743011923409,0.23207068353386714,-0.5481779506096122,},{0.5010346911779405,0.18138692343245594,-0.47611061693101797,},{0.19615764191356916,0.21748333390773916,-0.3872734136129942,},{0.27556746938610005,0.19405736732995435,-0.4115233235327135,},{0.17860563068070537,0.2129976766001827,-0.5355156432089259,},{0.15248350689098444,0.21629176710223824,-0.5066208923673112,},{0.13888398089815157,0.22880298703366547,-0.4436078788013896,},{0.21127823279376154,0.183517465205882,-0.46981405505051366,},{0.22590493886018007,0.20182778793590372,-0.5354212466158292,},{0.27699023177175003,0.2338607128325322,-0.4902982859576436,},{0.3988190437155452,0.28149050831341604,-0.7712725567009642,},{0.8429455679608836,0.7867290561776153,-0.2713327204721073,},{0.7388401496559751,0.8531782380330158,-0.2513245456080745,},{0.7563131773344189,0.777088167410208,-0.2202204382052582,},{0.7988594483680074,0.7328153052929367,-0.2337322487934336,},{0.7613104416854297,0.7441026108827564,-0.20778244674514,},{0.7322301390262705,0.8484881098990671,-0.3043534690020309,},{0.8048301155693455,0.8389791911409294,-0.31549378844618775,},{0.7638241561477089,0.8495467805899702,-0.31767470034373724,},{0.8118796293276656,0.8118164557142056,-0.35707109531998626,},{0.6290499660946225,0.24181317928585508,-0.37640579977430816,},{0.16289689980287853,0.2393895616419345,-0.38946064154888205,},{0.14645165058760398,0.3102275368025989,-0.37889188322261635,},{0.6057971150628321,0.2524888584567738,-0.5126803333793961,},{0.6487450512073405,0.29129822834066205,-0.4072846915913804,},{0.6349703590067151,0.30485278530477233,-0.3837163720405891,},{0.6547406571021596,0.3114031415212643,-0.4612241352838788,},{0.6317662991726375,0.4184049476251055,-0.4296990667041254,},{0.6586863288529903,0.35321072382341795,-0.4354107088602018,},{0.5499527245077374,0.28209211904563153,-0.40982619506915413,},{0.617505864727367,0.2985422440630199,-0.5008366369384651,},{0.5269063034763812,0.23242326506239208,-0.45350603962897307,},{0.5448652376372828,0.27394106845242183,-0.41364333537563147,},{0.5343372403291616,0.2451498044826277,-0.5076134126776278,},{0.6094830142691002,0.34435426016058274,-0.5306713846882112,},{0.6243262997177166,0.42017382864709707,-0.5059189045285294,},{0.21442936928721185,0.24598052096203032,-0.38748135601135963,},{0.24960007133657047,0.23918489236440052,-0.4014710984687444,},{0.18878359438809283,0.2702022104678876,-0.49962727568058657,},{0.14333226324067677,0.2671429538169134,-0.4189806940775763,},{0.1663947334771399,0.3400015717330428,-0.3883282409667852,},{0.2511948247117448,0.2631133372331188,-0.4834615779736697,},{0.4145810918001246,0.33224834361100775,-0.743313436842362,},{0.42151772853352354,0.3152523924773523,-0.7216894066317476,},{0.38851536782489154,0.336977566619883,-0.745137996639693,},{0.3785927379715291,0.29458243597585804,-0.7492396509879461,},{0.4098763312019902,0.31111923731786406,-0.6561033549422371,},{0.44578151415707457,0.7520390027935968,-0.07160196575116967,},{0.8185250965613644,0.7279252707088563,-0.33374290561974607,},{0.7875339740085895,0.7448594373870442,-0.3720478193163213,},{0.7663782884925262,0.686224666140683,-0.3047914506718927,},{0.7450281208575392,0.688439380882712,-0.26328552667378485,},{0.7496656594389218,0.6912614884192845,-0.33904672406446995,},{0.43448988894740265,0.3608781264571689,-0.6553618753262455,},{0.6971196338232454,0.7744582928796194,-0.2967065511566361,},{0.6869730915466363,0.8082123845287227,-0.2914708146836117,},{0.7212675656547489,0.7146156156837526,-0.24515463346041041,},{0.7107835266597803,0.6965237528656474,-0.2895513583787732,},{0.6761568428169717,0.7542324171130771,-0.2883661788715552,},{0.7529705324530129,0.7326519138528886,-0.37158737297721234,},{0.7053889605995766,0.7826903108412999,-0.35885799570564964,},{0.7331156941711793,0.774256732669973,-0.37400921779093316,},{0.4451272538178858,0.3460579367524304,-0.6131692442272714,},{0.5289895112618047,0.2927672827626463,-0.41868363256347746,},{0.5863955391887755,0.3159684108118564,-0.3659102480897259,},{0.5463554414740792,0.2911735017980666,-0.3903673099107625,},{0.19527995866395023,0.31021036416379866,-0.368903030223249,},{0.5904660367077724,0.38847170195866654,-0.3759757826102689,},{0.598048131285418,0.43244759409591393,-0.42180224062892135,},{0.6027891911071928,0.4599455807279069,-0.4504573802689688,},{0.5639003746162203,0.28618447316943874,-0.5184695500867861,},{0.5465061981914355,0.35842345120956304,-0.550907249162222,},{0.5832785365085192,0.3713020333048145,-0.46455277020477154,},{0.5085541811775434,0.31422489341963405,-0.45558330089931065,},{0.5186097227432485,0.2830489451296485,-0.4792813369732801,},{0.565580792734254,0.4217070886284784,-0.5468243153716749,},{0.5917979746208775,0.45437002974981067,-0.4998344586725828,},{0.2402319205883204,0.2887096316475593,-0.3889417764856698,},{0.27110284789957007,0.283436454059123,-0.4375175852517991,},{0.15823925150579773,0.32733769656833656,-0.4622878334037063,},{0.20583193662317265,0.2988308978637462,-0.5008665369104902,},{0.2677471713931886,0.30196471260867935,-0.5161472748259236,},{0.19775907647718274,0.36041126948467733,-0.37005017704818616,},{0.1585113941715297,0.37725368889251104,-0.45702252771055984,},{0.19403388394484625,0.3665274576007482,-0.5226431098987364,},{0.1774809419099772,0.4043253021699773,-0.41373572962646005,},{0.2911939753408581,0.28307745594368117,-0.4688287830360789,},{0.4024158515892398,0.37197834157159154,-0.6517120942277773,},{0.3823291892986413,0.33708142271740343,-0.6577742474054664,},{0.41309734537861215,0.33607147839684026,-0.5984525706070972,},{0.24946400000370447,0.3740161701959328,-0.5546372706723413,},{0.5369095640286403,0.9810141131175478,-0.1999469341646937,},{0.2953134241414888,0.9878264777614659,-0.17789993842061072,},{0.46647918105299635,0.7252598734238928,-0.11367784142840898,},{0.4388088340658056,0.7140375936581895,-0.12794158339270884,},{0.42880685668273466,0.7349907922182187,-0.09567095698104053,},{0.46435183111860767,0.7676241647604884,-0.12503367881251598,},{0.41923391244243025,0.7550452068393408,-0.06478457367832696,},{0.4434521094713961,0.739777073236912,-0.08984754456588477,},{0.39580390275338395,0.7238634388897163,-0.13447783634805976,},{0.3998023360477702,0.7277726617808438,-0.09997393013501094,},{0.39544768126089513,0.7418904315600245,-0.1021708654177688,},{0.5680888844141831,0.9670535383474749,-0.23802547464386453,},{0.4396546196019057,0.6934280456842467,-0.18625631909779347,},{0.718832389607727,0.7126759215321627,-0.3252454370268753,},{0.7154045912730054,0.6817400010888354,-0.3001264596825668,},{0.7072349531202177,0.6623786446461752,-0.3967329980787945,},{0.571950743632811,0.47195954824846703,-0.4309059142475418,},{0.4516110958266983,0.3843200379226902,-0.5955605421182449,},{0.6757130399136183,0.7557260927067155,-0.32790801868959935,},{0.6826309144145716,0.7031699460828094,-0.31114459937378086,},{0.6786691681212585,0.6733518682289711,-0.4362410416673971,},{0.6960791544870035,0.7221423382876221,-0.4360653197964077,},{0.722430489345456,0.7473857204216348,-0.41314075987339083,},{0.6534875704427136,0.7392500835644683,-0.4765134065984079,},{0.41799033225417814,0.35677024603509505,-0.5758817961495319,},{0.3414640309620826,0.34026995044211944,-0.4993345602464922,},{0.38501806136919364,0.39229833465827885,-0.562471005906724,},{0.30841490391888754,0.3571984129729893,-0.5426502263566799,},{0.484664694635621,0.3882912569505032,-0.3992826123526178,},{0.5360609207960987,0.4300947584356785,-0.3880104108791974,},{0.4331798373835076,0.38569147988167507,-0.47115162539615535,},{0.3518960121309215,0.34784164868974954,-0.47343238647222075,},{0.35590388186789296,0.35518883478360724,-0.485887700692995,},{0.34256411179123264,0.38806876014540126,-0.40910363522139975,},{0.41106545705844744,0.38907459652732995,-0.3892078419159373,},{0.2641270918156038,0.36184784076227466,-0.37185335042747375,},{0.23600127299792406,0.41063039923540745,-0.3804409227157827,},{0.20511638795637072,0.43995242200026713,-0.5216214172705811,},{0.20795278397514974,0.45778014801941463,-0.4722117134992619,},{0.2254275315634888,0.4426454039939351,-0.4150507925774775,},{0.5138900615541727,0.42294470535085366,-0.4607280529849399,},{0.49615325614333633,0.36107220108974813,-0.5238527357581374,},{0.4516187097355037,0.39314395625978077,-0.5397697741844304,},{0.42587641944659793,0.39212580929202495,-0.43469727700557864,},{0.5229365529870172,0.4152933990982777,-0.5562343393108361,},{0.47183246013728464,0.3627419954566596,-0.4816401933946067,},{0.5564180389177243,0.45435772577902167,-0.5289794564039556,},{0.450046957569402,0.38285772828788717,-0.4728778709096205,},{0.4384605589270568,0.38103915103659963,-0.4975098681484,},{0.26959308732754883,0.38345960968946635,-0.45082362701134526,},{0.32405163244413165,0.39670436627221806,-0.462608305905754,},{0.3127791091276876,0.41737893537709786,-0.38985070586755866,},{0.3778897578770386,0.37355665988470915,-0.48859454983045336,},{0.2989504382165038,0.3945022220243591,-0.5598786960780961,},{0.407278552836062,0.421671499723723,-0.599007903052119,},{0.3837086827203498,0.39833482292965355,-0.5816822584216215,},{0.3623613397066139,0.4167112729708024,-0.5532558522745576,},{0.2516316156747561,0.43212775808223697,-0.5499642093365839,},{0.2931539581934308,0.43785511284620166,-0.5590397417911075,},{0.5228981585543399,0.928627220764849,-0.2262051734468795,},{0.5067333480143078,0.8681890162452768,-0.256499026828676,},{0.5034201517552928,0.8902605330661638,-0.22657046238378067,},{0.4961813264323537,0.8675262885106391,-0.22941367360749312,},{0.5167360793635223,0.9877184541899685,-0.22622265913813597,},{0.4994136099512929,0.9169509093395143,-0.19037881081593122,},{0.4890334245304531,0.867077359099524,-0.21106615163744355,},{0.4829729515724311,0.7468962076052961,-0.15759501294926775,},{0.3495550163123532,0.980016829979829,-0.22221262306699494,},{0.31159958169145335,1.0,-0.2190943602765377,},{0.3645793487375961,0.9375499394029438,-0.19117274768372788,},{0.3487345531419414,0.925746197791887,-0.18392412127984317,},{0.32612441920792734,0.952728408829991,-0.21544993735889711,},{0.2735744907197963,0.9919173495976834,-0.18037819627889556,},{0.44465378246883946,0.7242717190386948,-0.1548136540471365,},{0.4532212556255111,0.781423927955356,-0.1506133033310487,},{0.45894783453752397,0.7323178544309279,-0.18181445334218516,},{0.41680054290940366,0.7105390323297417,-0.15432070141100748,},{0.4075682783195647,0.7054782063004549,-0.18884523592641034,},{0.42214936060404284,0.7048051046821822,-0.20847312788880293,},{0.40301048397536804,0.6949247641953921,-0.18147834325842618,},{0.3956163135041174,0.7289167326130837,-0.16677556121817513,},{0.41286360962384855,0.7997808570191938,-0.1522252558051755,},{0.3868577914332744,0.7621574311584566,-0.10988193413922577,},{0.38033096490715707,0.7335302586063134,-0.1259307441236467,},{0.36212001650319703,0.8775862070106043,-0.21444537767931368,},{0.3775607854193449,0.828467829515387,-0.16077353873643907,},{0.4945512923766781,0.8467838776440224,-0.23055623672072456,},{0.4962089084535958,0.8632089248806712,-0.25988308364155993,},{0.5572125730695264,0.8312498488121323,-0.3785417858197895,},{0.46910140859958926,0.9105396144530908,-0.28416185913263226,},{0.4976518930155187,0.8775072234561841,-0.28541263052875787,},{0.5219651346481076,0.8376473193782049,-0.3179223673686523,},{0.5023369639446518,0.8441890483160138,-0.25536866515212137,},{0.520631212223585,0.8094591207516325,-0.2845552554459789,},{0.5042007624507711,0.8329738610960373,-0.2505356660394663,},{0.5064164876912995,0.7790416542993018,-0.23342703093740844,},{0.4387660810748326,0.7126475095605491,-0.21754988119060895,},{0.6749173831359264,0.6680911269120852,-0.3289662594030286,},{0.6425181835819915,0.6485862241435527,-0.42510880579974786,},{0.6309247340308186,0.6501568326298132,-0.3792867083841837,},{0.5567680010190876,0.8211707088884311,-0.36983712026764676,},{0.5670226725798935,0.8163158723009241,-0.3851338126281209,},{0.5080863878988199,0.48868401822019625,-0.3887865169119071,},{0.5448063318615095,0.5284638141872854,-0.46534510554326297,},{0.4508849895591548,0.451778059387298,-0.5768020802442484,},{0.5404080592067075,0.5176733641060494,-0.5202335822858807,},{0.49552013085074487,0.47451996487944,-0.5654341373404941,},{0.5520560166714836,0.5389691561281944,-0.47392566986025275,},{0.5453864386528223,0.5702890013797864,-0.503974112965895,},{0.4735817871067749,0.585232350896546,-0.6108315559277323,},{0.5686747121846554,0.6148959676117154,-0.5473246768504296,},{0.5194780126388242,0.5538981724700507,-0.5685144959628754,},{0.5379127322624447,0.5454503795898402,-0.5149900846152319,},{0.5079370949282479,0.5957462088944634,-0.5715801745134786,},{0.5230782570247902,0.6246665772754524,-0.5825851449662438,},{0.6148926600926861,0.7873893692766278,-0.39987453257314204,},{0.6096962830961105,0.7237542907617488,-0.3422425217160123,},{0.6160109322764974,0.6799515593993043,-0.4769487422530463,},{0.5958370507090959,0.8148146555638986,-0.4432001344704937,},{0.5895270320553501,0.7800423772568112,-0.36383525618157114,},{0.6131807543934934,0.7359328404292075,-0.49192962049328204,},{0.5731925847275575,0.7305927186556179,-0.33477033348589813,},{0.6322272350245627,0.7837180893044692,-0.44776318110829805,},{0.5840816650262476,0.6884883983147265,-0.509860739557286,},{0.5665235018079892,0.6346485374051627,-0.5401647581069111,},{0.5833314535600184,0.7085560423709064,-0.5499540883283541,},{0.5947699127694778,0.7536934899624406,-0.5151096399560471,},{0.545833581121634,0.6671326740477703,-0.5855293661053785,},{0.5749253277966347,0.724268676121188,-0.5680850476921092,},{0.47748180186492484,0.6344371869391896,-0.6178456130820581,},{0.4485601215359866,0.656617388104826,-0.6194497715396976,},{0.441201413951155,0.6470475662911156,-0.6190971782827507,},{0.5607603483505503,0.8383893943476222,-0.3894364285250761,},{0.5535873308251275,0.8265028017664193,-0.37627748244682957,},{0.41943446650478794,0.6854212697684625,-0.6446361203172228,},{0.4572147871766959,0.9271191489409556,-0.543974292374495,},{0.4089126590726471,0.9177203044161134,-0.5687791636356011,},{0.3839747726262582,0.4022956695777906,-0.522927159632974,},{0.4474137681830032,0.42977769966152835,-0.38924293336983073,},{0.4143154847919945,0.4068433693272989,-0.4778545394144144,},{0.39298688218107863,0.3935020414999705,-0.45135480279215473,},{0.3803563269630738,0.4129364808831023,-0.3961687287173554,},{0.34490056728951735,0.44998953769285066,-0.39193158247758825,},{0.3912226316857281,0.4328419175910466,-0.36990783465924054,},{0.4397764024525651,0.47060062098008276,-0.3554962862845587,},{0.35002194001952436,0.4576491520415658,-0.38107268542912437,},{0.2816892240566973,0.43838584868722263,-0.3910737986214393,},{0.2387623898835959,0.4802403851910202,-0.4863263525057202,},{0.3206463738908153,0.475336392876636,-0.3890330812099778,},{0.5409067007755669,0.5734748484015191,-0.43181372238047966,},{0.46379417968082043,0.43715262332776367,-0.49846101071043847,},{0.32905882328512853,0.450397282511309,-0.4872201766725575,},{0.3673027003709913,0.4480827668269865,-0.5752464217440005,},{0.3088369433470281,0.49163683890880716,-0.554264116375454,},{0.2855156928217114,0.5133248365374484,-0.5226259769501646,},{0.3968021516866595,0.5333425370562856,-0.5999744262628653,},{0.44029275247830757,0.5423485144708258,-0.6013776742862423,},{0.44986361445282624,0.48833381810537246,-0.5920842734680548,},{0.3356169326716797,0.5273263583931042,-0.5847821975566564,},{0.4642592007406727,0.5004001767273568,-0.36932076326161334,},{0.3709220371533554,0.47775511995582753,-0.37277835421897604,},{0.4893532946957781,0.5371245527655456,-0.3817840856869694,},{0.49741236248741577,0.5612398724594203,-0.3671086482295413,},{0.38362770803947416,0.4845439305008226,-0.3564138780587854,},{0.45622009051885787,0.5521654294009732,-0.3296666199424479,},{0.3806463434616402,0.539500409834683,-0.3412635159284494,},{0.439690856780391,0.5317017430162232,-0.33800781910728606,},{0.3789764829443482,0.5479810209266068,-0.3308172330473278,},{0.34064892597249835,0.5832555790734859,-0.5917625841672636,},{0.28330506556441126,0.6340322798966956,-0.5603712188275892,},{0.46845271150740786,0.8893176462556802,-0.23183935565295685,},{0.48014489711664393,0.7719518549592047,-0.2348980169505058,},{0.42119937122740253,0.867851583153906,-0.20372465009921564,},{0.47295672554557705,0.8216460715174256,-0.1760260304393622,},{0.48190021731061533,0.7765668362608075,-0.19869636121970982,},{0.3923852113944561,0.8386174808598835,-0.1767582490020719,},{0.5167649870798385,0.8886851824668945,-0.4066828421987302,},{0.4806729557597501,0.9270640456739272,-0.34686331102103046,},{0.5199861798624881,0.8879198225635113,-0.353527015914657,},{0.5044460663047757,0.916930005819249,-0.4171953217657045,},{0.49205590156982143,0.9306345124660723,-0.4756493503271897,},{0.4233981304976342,0.9469192808580446,-0.36361836231370487,},{0.43283841162087555,0.9520263548408286,-0.34090887050805013,},{0.3761038365170079,0.9446716232264836,-0.3415249686926787,},{0.38016136194637185,0.925378930878872,-0.2793472359824201,},{0.39247156410127343,0.8931391537421502,-0.22332242800209118,},{0.4090650298592896,0.9263829613554108,-0.28394971486209203,},{0.31565975975107885,0.9617763255858229,-0.2476616005838697,},{0.36128233438871865,0.8907997455327159,-0.23498440934755152,},{0.35880916155211307,0.8723675469188107,-0.2257556911046358,},{0.30239918830837015,0.9236204553117466,-0.23551453849757006,},{0.4209142265050266,0.7470120545900906,-0.19740341755743726,},{0.3937392435346769,0.7232694746224319,-0.24452984311577292,},{0.37335353521856196,0.7813287375576924,-0.1832121447335929,},{0.3870604166640483,0.7131800201242687,-0.1904999321627847,},{0.37380023550858504,0.7476139392346574,-0.17215411636288538,},{0.3550268434936901,0.8441784787542508,-0.21164185839968602,},{0.45392705418838425,0.8344731845849135,-0.2770725207599677,},{0.5172996806061175,0.7813434890925631,-0.32501812685804016,},{0.5070947275434508,0.8617543702745063,-0.3456304134577393,},{0.530341029184289,0.8441285860204627,-0.3609539479522844,},{0.44910914951712544,0.9181921550808356,-0.3284012491573269,},{0.4935395223056107,0.8039171080164934,-0.29722576549385793,},{0.4398932967900992,0.7191285269481107,-0.2839713460365437,},{0.4740871760144542,0.7497236733226961,-0.28664084464510353,},{0.4753452883063703,0.9069864215233113,-0.33770190835000763,},{0.5312066105452661,0.7681312690045279,-0.38199557311324694,},{0.5793171838645199,0.6709364532322433,-0.3586105271318763,},{0.5123763062302216,0.7352131242884287,-0.3106815467096768,},{0.557427824477374,0.6138851236459762,-0.37729560838868853,},{0.5808709901541113,0.6380767808790473,-0.4190461895693948,},{0.5867809974564518,0.6425611813293726,-0.4605420587096535,},{0.509853859917705,0.6044627295856453,-0.30969147396344177,},{0.5461043346293737,0.6824947107809444,-0.3092828630625602,},{0.43964591421182064,0.6082621428449996,-0.30348749436977573,},{0.48363764382663826,0.6791289794167138,-0.29036709558352936,},{0.532932305990398,0.8031050027740495,-0.4011764922231001,},{0.5579627826051754,0.8516513549483231,-0.4370438889914588,},{0.5908211981011402,0.8036393425684116,-0.5071330286138102,},{0.5317938243459993,0.9015578480778453,-0.4958408940462078,},{0.4803767938908272,0.9109051614562107,-0.5513139417020665,},{0.5328139955154012,0.8681702295371901,-0.5640589370784856,},{0.5700458772734481,0.8549379043069918,-0.49140663558436687,},{0.5437917834744576,0.8857981152565866,-0.47856148853174013,},{0.5639577931465692,0.8573412137840725,-0.5198749810727223,},{0.5063192830966329,0.5550332784161869,-0.4791170176347335,},{0.4708132803147924,0.5268944203317553,-0.5254120706593064,},{0.5528852116921328,0.601609597520578,-0.48191511437632334,},{0.5380057419853358,0.6049482072287681,-0.5372263582012681,},{0.4678892028753454,0.6034413015590124,-0.5945861470122089,},{0.5215353495672597,0.6345417529778052,-0.5794128646912032,},{0.5019636194547211,0.6041736099728167,-0.5667111069195565,},{0.3912278311056422,0.6026842104532022,-0.6080934593745045,},{0.5111693468409305,0.6180236598569313,-0.5729730425037789,},{0.5336657619984139,0.7362133476752878,-0.4328836239100987,},{0.5073315113431878,0.7090619164244576,-0.5321021406772216,},{0.49337004503054865,0.7294442818982594,-0.6341428838959612,},{0.4705342787633928,0.8654880962059385,-0.6116559881209793,},{0.574732300986084,0.7990826397521055,-0.549963547832778,},{0.5212159815879678,0.8241479450615798,-0.6030010046258301,},{0.41873306895093515,0.8358627066270174,-0.6230142036250863,},{0.4416530953648363,0.8023141519941264,-0.6400411825809379,},{0.4092781300324437,0.7734138478389186,-0.6392322746951448,},{0.43852324964273837,0.7404313970609784,-0.6471356785980564,},{0.5479437121119562,0.7313615183787918,-0.5996710606174966,},{0.4305508621586132,0.6645166254642803,-0.5740784703688747,},{0.42147314119249696,0.6773905474149061,-0.6209521672551515,},{0.36682321595234957,0.6144581182426146,-0.6044465227424016,},{0.3456784918840547,0.6483200123723807,-0.6145128592054936,},{0.2926290550106443,0.6269441401416544,-0.5551916372388285,},{0.47455051086818983,0.8715608217613355,-0.453641962827731,},{0.5052856821476998,0.8285664016272538,-0.41464605401952964,},{0.4225555764076256,0.9541853709624041,-0.42762785198270226,},{0.3575893769368419,0.9342082867772469,-0.41122763794653083,},{0.4127766086433014,0.9498345281304826,-0.495664801733087,},{0.3837109715235181,0.8634171262409234,-0.6161112824038467,},{0.3449410934168399,0.7159818194940012,-0.6376247753285011,},{0.31332590817361383,0.6320457845306144,-0.6012994845363894,},{0.3722340458677479,0.8092696660616334,-0.6332098327777915,},{0.43388608894623004,0.8637592363837057,-0.5357509886740397,},{0.3503005311015607,0.9152716157779507,-0.5383497239643844,},{0.3385825203837437,0.9331975089618882,-0.482340329022732,},{0.3347323697824797,0.8780672525782276,-0.5775296682803169,},{0.2968466576627179,0.8924355121438539,-0.49225686642604244,},{0.36508092406222376,0.4997017300844364,-0.44403586468774864,},{0.2805903339343978,0.5163115923713,-0.4423240652901611,},{0.28790610297457764,0.5603764776920079,-0.5146604788718662,},{0.3449729117499019,0.5351651784925797,-0.3764475803546865,},{0.47409584771227914,0.5870217309179006,-0.42603440287140076,},{0.4152492635643506,0.6129628550398422,-0.3167276253448833,},{0.4203835597517536,0.6672258137836359,-0.30599446149323506,},{0.4035535785999815,0.7119848811982163,-0.2863962205376954,},{0.35605482040800107,0.5670861107948756,-0.3494413434983536,},{0.39775758928672017,0.5537980457348213,-0.48879826858145187,},{0.40952779603638473,0.5707356048936377,-0.4103392619403431,},{0.3275746340015206,0.6106320463798841,-0.575746981673897,},{0.2777956788057688,0.6491489654312003,-0.5651460524330407,},{0.2822059908298374,0.6243749202474476,-0.5319714381178735,},{0.29452927753001895,0.5903484874814705,-0.5168599790263604,},{0.2500102036962055,0.6362354188850473,-0.5149793898566727,},{0.40301969045469493,0.8316695271585487,-0.2594783586139901,},{0.45067451777586176,0.9010586934390148,-0.39317000002334557,},{0.375006362012853,0.9131584418701216,-0.32593470653144385,},{0.3398890565507036,0.9148733904868214,-0.3440796236255026,},{0.3541418837022067,0.886523784931618,-0.28732232586590356,},{0.3454006401107728,0.8726933279601585,-0.2479344709037882,},{0.3495255132426117,0.7911357299307519,-0.2750829178483054,},{0.3588538348467108,0.7668584079548215,-0.1975538118462234,},{0.32365978832804326,0.831142090951349,-0.25328504443751043,},{0.43115823168417294,0.781360393658198,-0.36545555760111065,},{0.45503248588519546,0.6759986989052428,-0.4332662119501843,},{0.48791169532432727,0.834910513137393,-0.5061652754550379,},{0.43773223883107815,0.6607919083731316,-0.5252948598444873,},{0.3270476800697702,0.9008047921452509,-0.40460636852205034,},{0.4494139073098149,0.7576162679285863,-0.5516716387163992,},{0.3338028592209918,0.6706467212459042,-0.559855416820736,},{0.40057405673669466,0.8539815142263927,-0.45967975948575057,},{0.31592733804055034,0.8374490666875879,-0.5906165949739868,},{0.29293690556854574,0.7355303815137206,-0.6152850641503239,},{0.31762267960531937,0.8320410169042418,-0.4818477688462701,},{0.29524237863273917,0.8888397759063247,-0.46038825907479036,},{0.25955629896823273,0.8147354074079562,-0.5400986738767054,},{0.2490784755856476,0.7579149426499353,-0.5615652000311437,},{0.25421564799159846,0.8449508505979764,-0.4824576797978921,},{0.24950957761592843,0.8389215741594388,-0.4625775720706743,},{0.35042348488896724,0.6046718304501171,-0.372627111099216,},{0.2988045104769304,0.568461641808787,-0.43614139934911994,},{0.3104142330217276,0.5867759700275272,-0.3804358258289586,},{0.30815444912580636,0.5919336830153599,-0.3668785202671466,},{0.2300770433637575,0.7238300329475201,-0.516477563676191,},{0.3593069451086127,0.637258963723859,-0.2794839026687115,},{0.37324747894293103,0.6415068509608067,-0.3828361580857488,},{0.37121734759332686,0.7054158838044751,-0.3054434288229512,},{0.3001156771705313,0.6179215537189712,-0.3194470013404052,},{0.34824988709998184,0.6569044722134462,-0.4616939356750918,},{0.2391223802547465,0.6748092272636678,-0.4758842503286516,},{0.25347330842065907,0.6346599152706236,-0.43200428839687266,},{0.33441961078306776,0.8763872313624776,-0.3380306277585122,},{0.29670893257033726,0.8677693582308372,-0.361493142421571,},{0.3184259040656752,0.7247040117758263,-0.30646505530072593,},{0.3178726222824515,0.777737036493379,-0.3058218089999048,},{0.30680956648281943,0.8234541598699907,-0.3076599296252561,},{0.3180912492902892,0.8012283596471831,-0.27632303903315664,},{0.3590950154623009,0.7481907646033525,-0.41801223072033133,},{0.28172388685612454,0.8520375408701859,-0.4214243288266623,},{0.26033025842109236,0.8400869454142276,-0.3690546601256288,},{0.30343830011733075,0.7694527908266883,-0.4735408566378751,},{0.2796408917778136,0.8079387547747513,-0.47625269293460837,},{0.23691229603935848,0.823184861670624,-0.4205542396407347,},{0.2256340530516792,0.7680516946702176,-0.4975764154312698,},{0.2301753428293087,0.8167179343141274,-0.4533499247307895,},{0.2835485128038362,0.6046976295871073,-0.37583582163502444,},{0.22371377365363973,0.7529576331287987,-0.4712866004267626,},{0.2691962616303119,0.7027309060068581,-0.31417891733127407,},{0.2306083632206266,0.6600591477012975,-0.41246212973399415,},{0.18527550240868182,0.7228385763450438,-0.44626333518108785,},{0.19684864878917357,0.6955010001606794,-0.4575873858103862,},{0.29532790099554346,0.7325066361365516,-0.3735236603974827,},{0.2455965239834369,0.7285996248243549,-0.4219103938475532,},{0.2701396983582336,0.824897825775906,-0.36491732426208756,},{0.27538727574938304,0.7418653388609475,-0.3056558376950138,},{0.2661000930669705,0.793739938113673,-0.31837450521995964,},{0.239230073074341,0.795396145192412,-0.4043201821305199,},{0.23344442848750271,0.7851012937625285,-0.43495129446703007,},{0.20807633659896935,0.7709799774197741,-0.4394123468594528,},{0.24398079495690675,0.6769937112817689,-0.3420651328554321,},{0.1689147983759553,0.6646599728214547,-0.40213461986121524,},{0.2185179920104894,0.6646949002224043,-0.33998932068255816,},{0.17826562295782797,0.672128665037059,-0.3351958038596035,},{0.16349218707777458,0.7118202990513176,-0.44192641550734274,},{0.16633850565364158,0.7675707152529747,-0.4277339307330104,},{0.24490028524705623,0.7217453037033431,-0.3242032335496738,},{0.1822293485292224,0.6752945726060294,-0.30682107664904135,},{0.20486817397304258,0.7188857768091014,-0.3799935742058422,},{0.2388945583440073,0.7757957874246937,-0.33779791733464776,},{0.1656246411517255,0.67786926274085,-0.3302414502376877,},{0.12837970116653227,0.7223184160029305,-0.38924720783919464,},{0.18906513040786813,0.7928906333773256,-0.4006612392043406,},{0.21020405123794464,0.7019936964440359,-0.3109109426399763,},{0.13472464341802726,0.6826605497850742,-0.3738248434501631,},{0.19879508360196824,0.6926528781121789,-0.3126137920345286,},{0.10878039800170289,0.6989532562227168,-0.36937532409552093,},{0.13359492721837454,0.6702094605496,-0.3209535696432199,},{0.10217111502618467,0.703412717979561,-0.34593300514365516,},{0.11191685214682133,0.7414882816916055,-0.3829445036012598,},{0.1288273369887593,0.7929624065402617,-0.35112447378199124,},{0.1460201516550396,0.6947478119273238,-0.2775318049376099,},{0.17253937617942003,0.7298713487553244,-0.2761706947066664,},{0.16569532550320104,0.7842031700453085,-0.29505603301062755,},{0.1719434935510987,0.7775706682862044,-0.24521972543490736,},{0.10181006624894473,0.6805103978144974,-0.2694590770923812,},{0.13635095052474128,0.6939774907453965,-0.23067629966148867,},{0.14418639097749245,0.7434844670998431,-0.32811375671614845,},{0.08811978193394743,0.735478188863438,-0.3305417167121859,},{0.11869964757061742,0.7941177890875819,-0.3277229299247189,},{0.041705235094814365,0.7945327504249998,-0.30739850332117913,},{0.05947547643323238,0.7046208223802085,-0.2852971981146348,},{0.02734636888323145,0.7307873330753027,-0.2902467018908623,},{0.1257823688199917,0.7191144369170457,-0.22836434385999776,},{0.1453603677590719,0.7856092625350507,-0.23405327659041888,},{0.019889368780499916,0.7359082324876295,-0.22006121423918693,},{0.0,0.7730197867033899,-0.23585997578499168,},{0.08449957005560142,0.8406923536973533,-0.25147609612999766,},{0.026724026102675626,0.8300105886914205,-0.24460928972285703,},{0.13290782321522474,0.8325756358490346,-0.23480540641768502,},{0.12219602386558208,0.8086991894751079,-0.2028304932314231,},{0.10152155766956114,0.837863227262889,-0.2182671937904139,},{0.1389831403186504,0.8152830664088301,-0.19524496511262004,},{0.05517027736391534,0.7069609582438292,-0.1989065209788325,},{0.09578519101769208,0.7363515716449204,-0.18287830985131343,},{0.11287629726684492,0.7019422611695084,-0.2026772249730123,},{0.03625814815581673,0.7446564218690248,-0.1653999640538832,},{0.08514648489959555,0.7914473689906187,-0.2349154902848565,},{0.02550345035768312,0.8111482823289811,-0.2124955289085426,},{0.10585622042788588,0.7536519805986226,-0.18742493172123093,},{0.11997567248045045,0.7867113798532052,-0.19665011712728822,},{0.02078021595585551,0.7850788687835097,-0.1765487507467551,},{0.04926152691880595,0.84666738682381,-0.19073006933684444,},{0.09754773262624758,0.8332682964841536,-0.16960752516145486,},{0.04521272672464135,0.8804477401740061,-0.1373668880697855,},{0.1012199387037344,0.9191871891056146,-0.0812957086726655,},{0.07107117509734528,0.7505528683433452,-0.14540336550645297,},{0.03695681717436304,0.7435182093606978,-0.10148901026634632,},{0.011755319532467673,0.74616213683193,-0.10116642304584003,},{0.037501841461219605,0.7426303018620473,-0.05163275346130213,},{0.02084475652459521,0.7893997639308894,-0.08767783030890969,},{0.03551792539705614,0.8560890532299545,-0.08840045799877504,},{0.08593007203578001,0.7881895242801996,-0.1464855195824641,},{0.01731320835894735,0.8307474377807712,-0.13275508198645097,},{0.06997446793760519,0.868287448011589,-0.09264294650729629,},{0.0725758316541611,0.8571320462806585,-0.0677894547164593,},{0.08485096087727581,0.848765081542582,-0.02151276527046806,},{0.05714638768316964,0.782612121091447,-0.07856177959341461,},{0.02223069535097115,0.783083177951602,-0.06836397077185123,},{0.02708831624856434,0.8190998110678982,-0.07841247818443138,},{0.06064203839487164,0.820646473116386,-0.06746776541566814,},{0.04489520489782714,0.787301389270448,-0.043050998437461845,},{0.08539670151711275,0.8035823870907268,-0.0,},};
+int vertices_data[1770][4] = {{7,12,0,9,},{13,1,5,6,},{3,16,5,2,},{16,15,5,2,},{18,16,3,4,},{3,13,5,17,},{16,3,5,17,},{16,18,3,17,},{16,18,19,4,},{22,13,5,6,},{13,5,17,20,},{13,22,5,20,},{15,16,5,17,},{5,15,17,20,},{22,15,5,20,},{21,13,22,6,},{8,7,10,26,},{7,8,10,27,},{12,7,26,9,},{7,27,26,9,},{10,7,27,26,},{12,26,25,9,},{26,28,25,9,},{27,28,26,9,},{10,11,30,29,},{29,10,27,26,},{30,10,29,26,},{26,12,25,32,},{43,13,17,20,},{22,13,43,20,},{13,21,22,43,},{14,21,44,23,},{21,14,44,45,},{14,44,24,23,},{14,44,45,24,},{15,16,17,20,},{16,15,46,20,},{47,18,16,17,},{16,46,17,20,},{47,16,46,17,},{18,47,16,19,},{47,16,19,46,},{18,47,43,17,},{46,43,17,20,},{47,46,43,17,},{47,45,18,43,},{49,22,43,20,},{46,43,20,48,},{43,49,20,48,},{21,49,22,43,},{44,21,45,43,},{44,49,21,43,},{24,44,51,23,},{24,44,45,51,},{51,24,52,45,},{28,26,25,31,},{25,26,32,31,},{28,25,55,31,},{25,28,55,54,},{54,25,32,31,},{55,25,54,31,},{28,27,26,31,},{56,29,27,26,},{27,56,26,31,},{56,30,29,26,},{56,33,30,26,},{56,33,26,31,},{28,56,27,31,},{56,28,27,55,},{29,56,27,55,},{56,28,55,31,},{34,32,31,35,},{32,57,31,35,},{54,32,53,31,},{32,57,53,31,},{33,57,34,31,},{57,33,56,31,},{57,34,31,35,},{57,54,53,31,},{57,55,54,31,},{57,56,55,31,},{32,34,36,35,},{32,36,53,35,},{57,32,53,35,},{53,36,59,35,},{57,53,58,35,},{53,59,58,35,},{59,57,58,35,},{61,41,37,63,},{40,39,66,38,},{39,61,66,38,},{61,41,40,38,},{61,40,66,38,},{41,61,40,66,},{41,40,67,66,},{62,41,61,63,},{41,62,61,68,},{61,41,67,66,},{41,61,67,68,},{66,67,65,42,},{66,65,69,42,},{52,44,45,43,},{72,49,44,43,},{72,44,52,43,},{72,45,47,43,},{72,52,45,43,},{72,47,46,43,},{46,72,43,48,},{72,49,43,48,},{44,51,52,45,},{72,49,50,44,},{51,50,44,52,},{50,72,44,52,},{50,74,49,72,},{77,50,74,49,},{51,76,50,52,},{52,74,50,72,},{74,52,50,75,},{52,75,78,50,},{76,78,50,52,},{50,77,74,75,},{76,78,75,50,},{78,76,51,52,},{52,79,74,72,},{52,74,78,75,},{79,52,74,78,},{54,57,53,58,},{80,54,53,58,},{80,53,60,58,},{84,54,57,55,},{81,55,82,54,},{81,84,55,54,},{54,84,57,58,},{80,84,54,58,},{82,81,54,80,},{84,80,54,81,},{57,56,84,55,},{84,56,81,55,},{59,57,86,58,},{57,84,86,58,},{59,86,87,58,},{80,60,87,58,},{84,80,86,58,},{86,80,87,58,},{88,80,60,87,},{90,62,61,63,},{62,90,61,68,},{67,61,66,68,},{61,90,66,68,},{90,62,63,64,},{62,90,71,64,},{62,89,90,68,},{89,62,90,71,},{67,66,65,69,},{70,67,65,69,},{91,70,65,69,},{92,67,66,68,},{67,92,66,69,},{90,92,66,68,},{92,89,67,68,},{70,92,67,69,},{70,92,89,67,},{89,92,90,68,},{91,92,70,69,},{92,94,70,89,},{92,94,91,70,},{93,89,90,71,},{93,95,89,71,},{72,74,105,79,},{74,73,105,98,},{101,73,98,103,},{73,102,98,103,},{73,102,105,98,},{101,102,73,103,},{102,101,73,104,},{106,75,74,77,},{78,106,75,74,},{74,99,77,98,},{105,74,99,77,},{106,74,105,77,},{78,106,74,79,},{74,106,105,79,},{74,105,99,98,},{76,78,106,75,},{76,106,100,75,},{75,100,99,77,},{100,106,77,75,},{100,107,99,77,},{107,105,99,77,},{106,100,77,107,},{107,106,105,77,},{106,78,108,79,},{102,105,108,79,},{105,106,108,79,},{82,81,80,114,},{81,84,80,87,},{80,81,87,114,},{83,82,80,114,},{88,83,80,114,},{80,84,86,87,},{88,80,87,114,},{81,85,82,96,},{85,81,82,114,},{84,81,85,114,},{81,84,87,114,},{82,83,97,114,},{85,82,96,114,},{82,97,96,114,},{110,83,88,114,},{97,83,109,114,},{83,110,109,114,},{85,111,84,115,},{84,85,115,114,},{86,84,115,87,},{84,111,86,115,},{84,115,87,114,},{96,113,85,114,},{85,112,111,114,},{85,111,115,114,},{112,85,113,114,},{116,87,114,88,},{87,116,114,115,},{116,110,88,114,},{92,119,89,90,},{119,93,89,90,},{119,94,92,89,},{95,94,93,89,},{94,119,93,89,},{119,92,120,90,},{92,94,120,91,},{121,92,120,91,},{120,94,118,91,},{121,120,118,91,},{94,119,92,120,},{122,121,92,120,},{95,94,119,93,},{123,95,119,93,},{94,95,119,120,},{95,94,124,120,},{94,124,120,118,},{95,123,119,120,},{95,125,123,120,},{125,95,124,120,},{109,96,97,114,},{96,128,109,97,},{96,109,113,114,},{128,96,109,113,},{130,99,98,103,},{105,107,99,98,},{107,130,99,98,},{102,130,98,103,},{105,102,130,98,},{107,105,130,98,},{100,107,130,99,},{102,101,104,103,},{101,127,104,103,},{127,101,131,103,},{102,104,138,103,},{102,138,130,103,},{102,105,138,108,},{105,102,138,130,},{104,127,131,103,},{131,104,103,136,},{104,103,136,139,},{104,138,103,139,},{130,137,103,139,},{138,130,103,139,},{137,131,103,136,},{103,137,136,139,},{127,104,131,136,},{106,107,105,108,},{107,140,105,108,},{140,107,105,130,},{105,140,138,108,},{140,105,138,130,},{107,106,140,108,},{110,144,109,114,},{113,109,143,114,},{109,128,113,143,},{109,144,143,114,},{110,116,144,114,},{112,145,111,114,},{145,115,111,114,},{145,112,113,114,},{145,113,143,114,},{113,128,146,143,},{145,113,146,143,},{116,115,148,114,},{148,115,145,114,},{144,116,148,114,},{144,148,143,114,},{148,145,143,114,},{150,117,149,152,},{117,149,152,151,},{155,121,120,118,},{124,161,120,118,},{161,155,120,118,},{126,155,124,118,},{124,155,161,118,},{123,161,119,120,},{161,162,123,119,},{122,163,121,120,},{155,121,161,120,},{121,163,161,120,},{125,161,123,120,},{125,124,161,120,},{163,122,121,158,},{157,155,121,161,},{157,163,121,158,},{163,157,121,161,},{125,161,167,123,},{161,162,167,123,},{124,125,161,168,},{155,156,126,124,},{156,126,124,168,},{155,156,124,161,},{156,124,161,168,},{161,125,167,168,},{127,131,132,136,},{127,132,171,136,},{172,127,171,136,},{129,128,173,146,},{128,173,146,143,},{129,173,147,146,},{177,137,130,139,},{138,177,130,139,},{140,138,177,130,},{133,135,131,132,},{131,133,132,179,},{131,132,136,179,},{137,133,131,136,},{133,131,136,179,},{133,135,132,179,},{132,134,171,135,},{134,132,171,174,},{132,135,171,179,},{132,171,136,179,},{142,133,179,135,},{137,133,136,179,},{133,137,141,179,},{133,142,179,141,},{135,142,134,179,},{134,171,135,179,},{134,142,176,175,},{134,142,175,179,},{134,171,179,174,},{174,134,175,179,},{181,137,139,136,},{137,170,179,136,},{137,170,136,181,},{181,170,136,139,},{136,172,170,179,},{171,172,136,179,},{137,181,139,177,},{137,177,141,179,},{137,180,179,170,},{137,180,170,181,},{180,177,137,179,},{177,180,137,181,},{138,170,181,139,},{138,181,177,139,},{140,138,181,177,},{141,182,142,179,},{177,178,141,179,},{178,182,141,179,},{142,176,175,179,},{176,142,183,179,},{182,183,142,179,},{148,185,144,143,},{185,184,144,143,},{145,146,184,143,},{145,184,148,143,},{146,173,184,143,},{184,185,148,143,},{187,145,146,184,},{187,145,186,146,},{187,145,184,148,},{173,186,147,146,},{173,186,146,184,},{186,187,146,184,},{186,173,147,184,},{173,189,147,184,},{186,189,184,147,},{190,189,186,147,},{189,190,192,147,},{185,187,184,148,},{188,187,185,148,},{193,188,185,148,},{149,150,152,151,},{149,150,151,194,},{149,150,194,160,},{150,152,151,195,},{150,151,194,195,},{153,150,169,160,},{153,194,150,160,},{194,153,150,195,},{196,153,169,160,},{194,153,196,160,},{194,153,195,196,},{203,154,200,205,},{204,203,205,154,},{156,166,155,159,},{155,156,161,211,},{166,156,155,211,},{166,155,159,157,},{157,155,161,211,},{166,155,157,211,},{166,156,161,168,},{156,166,161,211,},{157,163,158,211,},{157,158,164,211,},{157,158,212,164,},{159,166,157,211,},{157,212,159,211,},{163,157,161,211,},{212,157,164,211,},{158,163,164,211,},{213,166,159,211,},{213,212,211,159,},{194,196,169,160,},{194,169,215,160,},{162,161,216,165,},{162,161,167,216,},{163,161,165,164,},{163,161,164,211,},{161,165,164,211,},{161,216,165,211,},{167,166,161,168,},{166,167,161,211,},{161,167,216,211,},{217,163,165,164,},{165,217,164,211,},{217,212,164,211,},{217,165,216,211,},{220,166,167,168,},{166,220,167,211,},{213,220,166,211,},{220,216,167,211,},{222,194,196,169,},{222,194,169,215,},{172,174,170,179,},{174,172,170,226,},{170,174,226,179,},{226,180,170,179,},{174,172,171,179,},{174,172,226,171,},{233,189,173,184,},{175,238,174,179,},{174,214,238,175,},{174,238,226,179,},{214,174,238,227,},{174,238,227,226,},{175,176,238,179,},{214,175,176,238,},{176,183,238,179,},{176,183,214,238,},{178,177,180,179,},{177,239,178,180,},{181,239,177,180,},{239,178,180,179,},{182,178,238,179,},{178,239,238,179,},{178,239,182,238,},{239,242,178,182,},{180,226,238,179,},{243,180,238,179,},{243,239,180,179,},{183,182,238,179,},{239,243,238,179,},{181,243,239,180,},{243,180,226,238,},{244,183,182,238,},{239,242,182,238,},{242,244,182,238,},{214,183,244,238,},{187,186,185,184,},{186,185,184,247,},{233,231,185,184,},{185,233,184,247,},{189,186,184,247,},{233,189,184,247,},{186,187,185,247,},{187,188,185,247,},{188,193,185,247,},{185,193,229,247,},{231,185,229,247,},{231,233,185,247,},{191,187,186,247,},{189,190,186,247,},{191,186,190,247,},{188,191,187,197,},{191,188,187,247,},{188,191,197,247,},{223,193,188,247,},{197,225,188,247,},{223,188,225,247,},{190,189,192,247,},{234,192,189,247,},{233,234,189,247,},{191,235,236,190,},{236,191,190,247,},{190,192,236,247,},{197,191,235,247,},{235,191,236,247,},{234,237,192,247,},{192,237,236,247,},{229,193,223,247,},{195,194,196,253,},{194,222,196,253,},{222,252,194,215,},{252,222,194,253,},{197,251,225,247,},{197,235,255,247,},{197,255,251,247,},{209,261,198,257,},{198,261,262,257,},{199,266,269,265,},{267,199,269,265,},{270,199,266,269,},{268,267,199,269,},{203,200,201,202,},{203,200,271,201,},{203,200,202,205,},{264,203,200,271,},{271,203,201,202,},{274,207,202,201,},{274,202,271,201,},{210,274,271,201,},{280,203,202,205,},{206,203,271,202,},{206,272,203,202,},{272,280,203,202,},{204,280,202,205,},{207,204,208,202,},{204,280,208,202,},{206,207,208,202,},{207,274,202,206,},{280,206,208,202,},{274,202,206,271,},{206,280,272,202,},{203,204,205,280,},{272,206,203,271,},{272,203,264,271,},{280,279,272,203,},{281,206,207,208,},{206,281,280,208,},{278,206,272,271,},{274,206,278,271,},{278,206,279,272,},{206,280,279,272,},{274,206,277,278,},{278,206,280,279,},{206,281,278,280,},{258,288,209,257,},{287,261,209,257,},{288,287,209,257,},{271,210,273,275,},{274,210,271,275,},{210,273,275,276,},{210,294,273,276,},{274,277,210,275,},{212,213,211,295,},{295,212,217,211,},{219,213,216,211,},{213,295,216,211,},{213,219,220,211,},{295,217,216,211,},{220,219,216,211,},{219,213,295,216,},{218,295,219,213,},{218,295,213,297,},{218,297,213,296,},{227,214,300,238,},{244,301,214,238,},{300,214,301,238,},{222,215,240,224,},{252,222,224,215,},{215,252,240,224,},{215,252,302,240,},{295,217,314,216,},{313,220,219,216,},{219,295,314,216,},{313,219,314,216,},{313,218,219,221,},{314,218,295,219,},{218,313,219,314,},{313,218,221,296,},{218,315,221,296,},{218,314,295,297,},{218,297,296,314,},{313,218,296,314,},{320,313,220,219,},{320,313,219,221,},{315,313,221,296,},{313,320,315,221,},{315,320,318,221,},{335,222,240,224,},{222,252,224,253,},{223,225,230,248,},{223,225,335,230,},{225,223,247,248,},{229,223,230,248,},{223,229,247,248,},{223,335,250,230,},{252,302,240,224,},{302,335,240,224,},{254,252,253,224,},{335,252,254,224,},{252,335,302,224,},{225,335,230,248,},{251,225,247,248,},{335,225,251,248,},{226,227,336,238,},{241,245,226,238,},{241,226,336,238,},{226,245,243,238,},{300,336,227,238,},{245,337,241,228,},{246,337,245,228,},{338,229,230,248,},{229,231,247,248,},{338,231,229,248,},{335,250,230,248,},{338,230,250,248,},{233,231,249,247,},{231,249,247,248,},{249,231,340,248,},{338,339,231,248,},{231,339,340,248,},{249,231,339,340,},{339,232,336,241,},{339,338,232,241,},{341,339,232,336,},{232,341,336,342,},{234,233,344,247,},{249,344,233,247,},{234,344,237,247,},{236,345,235,247,},{235,345,255,247,},{237,345,236,247,},{344,345,237,247,},{239,242,238,348,},{243,239,238,348,},{241,245,238,348,},{336,241,238,348,},{242,244,238,348,},{245,243,238,348,},{303,301,244,238,},{244,303,238,348,},{301,300,238,348,},{300,336,238,348,},{303,301,238,348,},{242,239,240,348,},{246,239,348,240,},{239,246,348,243,},{242,240,302,348,},{337,335,246,240,},{246,337,240,348,},{335,302,240,348,},{337,335,240,348,},{337,245,241,348,},{337,339,336,241,},{336,337,241,348,},{339,337,338,241,},{242,304,244,348,},{302,304,242,348,},{245,246,243,348,},{244,304,303,348,},{337,246,245,348,},{249,344,247,248,},{255,251,247,248,},{255,247,349,248,},{247,344,349,248,},{345,255,247,349,},{344,345,247,349,},{249,340,349,248,},{344,249,349,248,},{250,335,349,248,},{338,250,349,248,},{251,254,335,248,},{254,251,349,248,},{251,255,349,248,},{335,254,349,248,},{339,338,340,248,},{340,338,349,248,},{249,346,349,340,},{346,249,349,344,},{337,335,338,250,},{335,338,250,349,},{254,251,256,349,},{251,350,254,256,},{251,255,256,349,},{252,254,253,350,},{252,350,335,254,},{350,252,335,302,},{351,254,256,349,},{350,351,254,256,},{350,335,254,349,},{351,350,254,349,},{255,345,256,349,},{352,255,345,256,},{255,352,351,256,},{345,352,256,349,},{352,351,256,349,},{258,288,257,259,},{368,262,257,259,},{288,287,257,259,},{287,368,257,259,},{261,368,262,257,},{368,261,287,257,},{368,258,260,259,},{288,258,287,259,},{258,368,287,259,},{258,285,260,284,},{258,368,260,285,},{368,258,288,285,},{258,368,288,287,},{368,263,259,260,},{368,263,262,259,},{368,284,263,260,},{284,368,285,260,},{370,368,284,263,},{284,370,263,371,},{264,272,271,273,},{372,272,264,273,},{266,385,269,265,},{267,269,382,265,},{269,385,382,265,},{270,266,385,269,},{268,267,269,386,},{267,268,282,386,},{269,267,382,386,},{383,267,282,386,},{267,383,382,386,},{388,270,385,269,},{385,269,382,386,},{385,388,269,386,},{272,271,273,389,},{272,278,271,389,},{273,271,275,389,},{271,274,275,389,},{278,274,271,389,},{372,272,273,389,},{279,278,272,389,},{372,279,371,272,},{372,279,272,389,},{273,275,276,389,},{294,273,276,389,},{369,273,294,389,},{372,273,369,389,},{277,274,278,275,},{274,278,275,389,},{392,276,275,389,},{392,277,278,275,},{278,392,275,389,},{294,276,390,389,},{390,276,392,389,},{393,278,280,279,},{393,278,279,389,},{281,393,278,280,},{392,278,393,389,},{391,393,280,279,},{391,283,373,279,},{279,372,371,389,},{371,373,279,389,},{373,391,279,389,},{391,393,279,389,},{373,370,282,394,},{370,383,282,387,},{370,282,394,387,},{282,383,386,387,},{283,391,373,394,},{285,284,290,395,},{368,284,285,395,},{284,292,290,395,},{293,284,369,292,},{284,369,292,395,},{284,372,293,369,},{368,370,284,395,},{284,372,369,371,},{369,284,371,395,},{284,370,371,395,},{288,285,290,395,},{368,288,395,285,},{299,330,286,331,},{330,286,331,398,},{330,376,286,398,},{288,368,395,287,},{287,288,399,395,},{368,287,384,395,},{384,287,399,395,},{289,400,288,290,},{397,288,289,395,},{400,289,288,395,},{400,288,290,395,},{397,399,288,395,},{291,400,289,290,},{291,317,289,396,},{400,291,289,396,},{317,289,396,298,},{289,396,298,398,},{400,397,289,395,},{289,397,396,398,},{397,400,289,396,},{291,400,290,292,},{400,290,292,395,},{291,293,400,292,},{291,319,317,396,},{293,369,400,292,},{369,400,292,395,},{294,390,369,389,},{294,390,401,369,},{295,297,314,405,},{297,296,314,405,},{297,408,296,405,},{315,313,296,314,},{296,315,314,405,},{408,315,296,405,},{317,299,298,404,},{299,331,298,414,},{299,298,404,414,},{396,317,298,404,},{298,331,398,414,},{396,298,398,414,},{298,396,404,414,},{313,316,330,299,},{313,316,299,414,},{317,313,299,404,},{313,299,404,414,},{316,415,330,299,},{316,415,299,414,},{299,330,331,414,},{415,330,299,414,},{300,301,423,348,},{301,359,300,423,},{300,357,336,348,},{357,300,423,348,},{359,357,300,423,},{303,305,301,310,},{301,303,310,423,},{301,303,424,348,},{303,301,424,423,},{305,301,310,423,},{347,301,305,423,},{347,359,301,423,},{301,424,423,348,},{304,302,424,348,},{355,304,302,424,},{335,350,302,348,},{302,350,424,348,},{355,302,350,424,},{309,303,304,424,},{303,304,424,348,},{309,310,303,424,},{310,303,424,423,},{304,355,309,424,},{310,306,305,423,},{305,306,425,423,},{425,347,305,423,},{426,306,310,423,},{425,306,426,423,},{427,307,309,311,},{307,354,427,309,},{308,426,312,428,},{322,409,308,425,},{426,322,308,425,},{322,426,308,428,},{310,309,429,424,},{309,426,310,429,},{426,309,311,429,},{309,429,427,311,},{354,309,355,424,},{354,427,309,424,},{429,309,427,424,},{429,310,424,423,},{426,310,429,423,},{327,312,431,428,},{312,426,431,428,},{315,313,314,432,},{317,314,313,432,},{320,313,315,318,},{313,315,318,432,},{313,320,316,432,},{316,313,432,414,},{313,317,432,404,},{320,313,318,432,},{432,313,404,414,},{315,314,405,432,},{317,319,314,432,},{314,319,405,432,},{318,315,321,432,},{315,409,321,432,},{408,315,405,432,},{315,408,409,432,},{320,318,316,432,},{416,324,316,318,},{324,316,318,432,},{324,416,316,432,},{416,415,316,414,},{416,316,432,414,},{420,416,415,316,},{319,317,396,404,},{317,319,432,404,},{324,318,321,432,},{319,396,406,404,},{319,406,405,404,},{319,405,432,404,},{319,406,411,405,},{322,325,323,321,},{322,325,321,433,},{409,322,321,425,},{322,321,425,433,},{324,321,323,433,},{325,323,321,433,},{321,324,432,433,},{321,409,425,433,},{409,321,432,433,},{325,322,428,433,},{426,322,425,433,},{322,426,428,433,},{323,326,324,433,},{323,325,326,433,},{326,436,324,433,},{324,416,432,433,},{324,436,416,433,},{442,326,325,433,},{325,327,328,428,},{327,434,325,328,},{328,325,428,433,},{434,325,328,433,},{442,325,434,433,},{326,442,436,433,},{329,328,327,443,},{332,434,327,328,},{327,328,428,443,},{427,329,327,443,},{427,327,431,443,},{431,327,428,443,},{444,328,329,443,},{332,444,434,328,},{328,428,443,433,},{434,328,443,433,},{444,434,328,443,},{430,329,427,443,},{445,329,430,443,},{445,444,329,443,},{330,331,449,398,},{331,330,449,414,},{374,376,330,398,},{374,330,449,398,},{374,330,415,449,},{330,415,449,414,},{331,449,398,414,},{441,332,444,434,},{441,454,444,332,},{332,444,445,446,},{332,454,444,446,},{334,333,418,457,},{334,452,333,457,},{333,417,448,378,},{378,333,452,448,},{417,333,448,418,},{333,448,418,457,},{333,452,448,457,},{418,435,334,457,},{453,334,435,438,},{334,435,438,457,},{453,334,438,457,},{452,334,458,457,},{460,334,453,457,},{334,460,458,457,},{335,337,338,349,},{335,337,462,348,},{335,337,349,462,},{350,335,462,348,},{350,335,349,462,},{339,337,336,462,},{337,336,462,348,},{341,339,336,462,},{341,336,342,358,},{341,336,358,462,},{336,357,342,462,},{336,342,358,462,},{336,357,462,348,},{337,339,338,462,},{337,338,349,462,},{338,339,340,462,},{338,340,349,462,},{341,339,358,340,},{339,358,340,462,},{339,341,358,462,},{341,358,343,340,},{346,340,343,462,},{358,343,340,462,},{340,346,349,462,},{361,341,342,358,},{357,361,342,358,},{342,357,358,462,},{346,343,358,462,},{463,345,344,349,},{344,346,463,349,},{352,345,463,349,},{346,463,349,462,},{346,358,465,462,},{465,463,346,462,},{347,360,359,466,},{347,359,423,466,},{407,360,347,466,},{425,407,347,466,},{425,347,423,466,},{350,471,424,348,},{471,350,462,348,},{424,357,423,348,},{471,357,424,348,},{357,471,462,348,},{350,351,471,349,},{471,350,349,462,},{352,351,349,462,},{351,471,349,462,},{463,352,349,462,},{353,350,351,471,},{353,355,350,471,},{355,350,471,424,},{351,352,356,471,},{351,352,471,462,},{351,356,353,471,},{356,352,464,471,},{352,463,464,462,},{352,464,471,462,},{353,354,355,424,},{354,353,471,424,},{353,430,354,471,},{353,355,471,424,},{356,366,353,471,},{430,353,366,471,},{427,354,471,424,},{430,427,354,471,},{366,464,471,356,},{357,361,358,472,},{358,357,472,462,},{359,364,357,472,},{359,357,423,472,},{364,361,357,472,},{357,471,424,423,},{357,471,423,472,},{357,471,472,462,},{361,465,358,472,},{465,358,472,462,},{359,360,362,472,},{359,360,472,466,},{362,364,359,472,},{423,359,472,466,},{467,362,360,472,},{407,410,360,466,},{360,410,412,466,},{467,360,412,466,},{360,467,472,466,},{363,361,364,472,},{361,363,465,472,},{362,363,364,472,},{365,363,362,472,},{467,365,362,472,},{363,365,470,472,},{363,470,465,472,},{365,467,470,472,},{366,473,430,471,},{464,366,471,476,},{473,366,476,471,},{474,455,367,447,},{475,474,367,447,},{475,474,477,367,},{368,383,370,478,},{370,368,478,395,},{368,384,383,478,},{368,384,478,395,},{372,369,371,478,},{369,371,478,395,},{372,369,478,389,},{369,390,478,389,},{390,402,401,369,},{390,402,369,478,},{402,400,369,395,},{402,369,478,395,},{371,370,373,478,},{371,370,478,395,},{373,370,394,478,},{370,383,387,478,},{394,370,387,478,},{371,372,478,389,},{373,371,478,389,},{391,373,478,389,},{391,373,394,478,},{376,374,375,479,},{377,375,374,479,},{376,374,397,398,},{374,376,397,479,},{377,374,421,448,},{377,374,448,479,},{397,374,449,398,},{374,397,449,479,},{421,374,415,448,},{415,374,449,448,},{374,449,448,479,},{376,375,403,479,},{375,450,479,377,},{379,380,375,399,},{375,379,399,479,},{450,375,479,379,},{375,399,403,479,},{397,376,403,479,},{417,377,448,378,},{378,377,448,479,},{377,378,450,479,},{377,417,448,421,},{450,378,452,448,},{450,378,448,479,},{480,381,379,380,},{379,480,380,399,},{381,379,450,451,},{381,480,379,451,},{379,480,399,479,},{379,450,451,479,},{480,379,451,479,},{480,381,481,451,},{383,384,382,482,},{382,383,482,386,},{384,382,482,480,},{388,385,382,386,},{385,388,382,482,},{388,382,482,386,},{383,384,482,478,},{383,386,387,478,},{383,482,386,478,},{480,384,399,395,},{384,480,478,395,},{482,384,480,478,},{483,387,386,478,},{482,388,386,483,},{386,482,483,478,},{394,387,483,478,},{390,392,485,389,},{390,485,478,389,},{393,391,485,389,},{485,391,478,389,},{485,392,393,389,},{402,390,401,478,},{401,484,390,469,},{484,401,390,478,},{390,485,484,478,},{391,394,485,478,},{486,394,483,478,},{484,485,394,478,},{486,484,394,478,},{484,485,486,394,},{397,399,395,487,},{400,397,395,487,},{399,480,395,487,},{402,400,395,487,},{478,402,395,487,},{480,478,395,487,},{397,396,398,487,},{397,400,396,487,},{449,396,398,414,},{396,449,398,487,},{402,396,400,487,},{402,406,396,487,},{396,406,404,487,},{404,396,449,414,},{396,404,449,487,},{449,397,398,487,},{403,399,397,487,},{397,403,487,479,},{449,397,487,479,},{403,399,487,479,},{399,480,487,479,},{402,401,406,487,},{401,402,478,487,},{406,401,468,487,},{469,468,401,487,},{484,469,401,487,},{484,401,478,487,},{405,406,432,404,},{406,488,432,404,},{406,488,404,487,},{432,404,449,414,},{404,432,449,487,},{488,432,404,487,},{406,411,405,432,},{408,405,407,488,},{407,405,411,488,},{408,405,488,432,},{405,411,488,432,},{411,406,413,488,},{411,406,488,432,},{406,468,413,488,},{406,468,488,487,},{425,408,407,466,},{407,408,488,466,},{407,410,413,411,},{410,407,413,488,},{410,407,488,466,},{413,407,411,488,},{425,409,408,488,},{409,408,488,432,},{408,425,488,466,},{425,409,488,433,},{488,409,432,433,},{412,410,488,466,},{410,468,412,488,},{410,413,468,488,},{467,412,488,466,},{467,412,468,488,},{415,416,489,414,},{415,489,449,414,},{489,416,432,414,},{489,432,449,414,},{416,420,415,489,},{415,420,421,489,},{421,415,489,448,},{489,415,449,448,},{420,416,422,489,},{436,422,416,489,},{416,489,432,433,},{416,436,489,433,},{419,418,417,489,},{418,448,417,489,},{419,417,422,489,},{417,420,489,421,},{420,417,489,422,},{417,421,489,448,},{435,418,419,457,},{419,418,489,457,},{489,418,448,457,},{436,419,422,489,},{437,435,419,489,},{435,419,489,457,},{436,437,419,489,},{429,424,490,423,},{424,471,490,423,},{425,426,490,423,},{490,425,423,466,},{426,429,490,423,},{471,423,472,466,},{471,490,423,466,},{427,429,424,490,},{471,427,424,490,},{426,425,490,433,},{425,488,490,433,},{488,425,490,466,},{426,431,428,433,},{431,426,429,490,},{431,426,490,433,},{427,431,429,443,},{427,429,490,443,},{430,427,490,443,},{430,427,471,490,},{428,431,490,433,},{431,428,490,443,},{428,490,443,433,},{429,431,490,443,},{445,430,490,443,},{473,430,490,445,},{430,473,490,471,},{488,432,492,433,},{432,489,492,433,},{432,489,449,487,},{488,489,432,487,},{489,488,432,492,},{442,434,492,433,},{492,434,443,433,},{436,442,492,433,},{489,436,492,433,},{490,492,443,433,},{488,492,490,433,},{434,439,437,492,},{434,437,442,492,},{441,439,434,492,},{444,441,434,492,},{434,444,492,443,},{435,437,439,492,},{437,435,489,457,},{435,437,492,457,},{439,438,435,492,},{438,435,492,457,},{436,442,437,492,},{436,437,489,492,},{437,489,492,457,},{456,439,440,438,},{439,440,438,492,},{440,456,438,492,},{456,453,438,457,},{456,438,492,457,},{441,440,439,492,},{454,441,444,440,},{441,444,440,492,},{444,454,440,492,},{456,440,454,492,},{444,445,446,443,},{446,444,443,493,},{444,454,492,443,},{444,454,443,493,},{445,446,443,493,},{490,445,443,493,},{454,492,443,493,},{492,490,443,493,},{454,444,446,493,},{473,455,445,446,},{445,473,446,493,},{473,445,490,493,},{454,455,493,446,},{473,455,446,493,},{455,473,447,493,},{474,455,447,493,},{475,447,473,493,},{475,474,447,493,},{449,494,448,479,},{494,489,449,448,},{450,452,494,448,},{494,450,448,479,},{452,494,448,457,},{494,489,448,457,},{494,449,487,479,},{489,494,449,487,},{459,450,494,451,},{451,450,494,479,},{450,459,494,452,},{459,491,451,494,},{491,480,451,479,},{491,451,494,479,},{480,481,491,451,},{452,458,494,457,},{459,452,458,494,},{456,495,453,457,},{495,460,453,457,},{455,454,493,496,},{454,496,456,492,},{454,496,492,493,},{496,455,474,493,},{495,456,492,457,},{495,456,496,492,},{458,460,497,457,},{494,458,497,457,},{460,495,497,457,},{489,494,492,457,},{492,494,497,457,},{495,492,497,457,},{458,461,459,497,},{458,459,494,497,},{460,461,458,497,},{461,498,459,497,},{459,498,491,494,},{459,498,494,497,},{499,461,460,497,},{499,460,495,497,},{501,498,461,497,},{501,461,499,497,},{504,464,463,462,},{463,465,504,462,},{464,504,471,462,},{504,465,472,462,},{471,504,472,462,},{476,464,504,471,},{470,465,472,503,},{505,465,470,503,},{465,504,472,503,},{505,504,465,503,},{467,472,466,509,},{488,467,466,509,},{488,471,472,466,},{471,488,490,466,},{472,488,466,509,},{468,467,488,509,},{467,468,508,509,},{467,470,472,503,},{470,467,508,503,},{467,472,509,503,},{508,467,509,503,},{510,468,469,487,},{468,488,487,509,},{510,468,487,509,},{510,508,468,509,},{469,484,510,487,},{470,506,505,503,},{511,506,470,503,},{508,511,470,503,},{488,471,512,472,},{471,504,512,472,},{476,473,471,512,},{471,473,490,512,},{504,476,471,512,},{488,471,490,512,},{512,488,472,509,},{504,512,472,503,},{472,512,509,503,},{473,476,475,493,},{476,473,512,493,},{473,490,512,493,},{474,475,477,493,},{477,513,474,493,},{496,474,500,493,},{500,474,507,493,},{507,474,513,493,},{475,476,512,493,},{475,476,514,512,},{477,475,513,493,},{475,477,513,512,},{475,514,477,512,},{513,475,512,493,},{504,514,476,512,},{514,513,477,512,},{480,515,482,478,},{480,515,478,487,},{483,484,478,482,},{482,515,484,478,},{483,484,486,478,},{515,484,478,487,},{480,515,487,479,},{515,480,491,479,},{515,494,487,479,},{515,491,494,479,},{515,480,481,491,},{515,481,516,491,},{483,519,484,482,},{515,482,484,519,},{519,483,484,486,},{484,485,520,486,},{520,484,486,519,},{484,518,510,487,},{515,518,484,487,},{518,515,484,519,},{518,484,520,519,},{489,488,492,487,},{488,521,492,487,},{488,521,487,509,},{521,489,492,487,},{494,489,521,487,},{515,494,521,487,},{521,510,487,509,},{510,518,521,487,},{518,515,521,487,},{521,488,492,490,},{521,488,490,512,},{521,488,512,509,},{489,494,521,492,},{490,492,512,493,},{492,521,490,512,},{498,491,494,497,},{491,522,494,497,},{491,515,494,521,},{522,491,494,521,},{491,498,522,497,},{516,515,491,521,},{491,522,516,521,},{492,496,524,493,},{492,524,512,493,},{492,494,524,497,},{494,521,492,524,},{496,495,492,524,},{495,492,524,497,},{521,492,524,512,},{496,500,524,493,},{500,507,524,493,},{507,513,524,493,},{524,513,512,493,},{494,522,521,497,},{494,521,524,497,},{500,495,496,524,},{499,495,524,497,},{500,499,495,524,},{502,498,501,497,},{502,522,498,497,},{499,501,497,525,},{524,499,497,525,},{501,502,497,525,},{502,522,497,525,},{521,522,524,497,},{522,524,497,525,},{522,526,502,498,},{499,500,527,524,},{501,499,527,525,},{527,499,524,525,},{527,500,507,524,},{502,501,528,525,},{501,527,528,525,},{526,522,502,525,},{502,528,526,525,},{504,505,512,503,},{529,505,506,503,},{505,529,512,503,},{511,529,506,503,},{511,508,509,503,},{529,511,509,503,},{512,529,509,503,},{504,505,514,512,},{505,529,504,514,},{505,529,514,512,},{513,530,507,524,},{527,507,530,524,},{511,508,510,509,},{508,511,510,517,},{511,508,531,517,},{511,510,517,509,},{517,510,535,509,},{510,521,535,509,},{511,517,535,509,},{529,511,535,509,},{529,514,512,509,},{514,535,512,509,},{535,521,512,509,},{514,529,535,509,},{510,518,517,521,},{517,510,521,535,},{531,511,517,535,},{511,531,529,535,},{514,513,512,536,},{513,524,512,536,},{535,514,512,536,},{524,521,512,536,},{521,535,512,536,},{532,513,514,536,},{513,530,524,536,},{534,530,513,536,},{532,534,513,536,},{532,514,529,535,},{532,514,535,536,},{537,515,516,521,},{518,515,519,521,},{519,515,537,521,},{537,516,522,521,},{523,537,516,522,},{518,517,521,535,},{538,517,518,535,},{531,517,538,535,},{520,518,519,539,},{537,518,519,521,},{518,537,519,539,},{520,518,539,538,},{537,518,521,535,},{518,537,539,535,},{518,539,538,535,},{522,537,521,524,},{535,521,524,536,},{521,540,535,524,},{537,540,521,524,},{540,537,521,535,},{523,537,522,526,},{522,540,524,525,},{540,537,522,524,},{540,522,526,525,},{537,540,522,526,},{537,523,540,526,},{530,527,524,525,},{541,530,524,525,},{540,541,524,525,},{530,541,524,536,},{540,535,524,536,},{541,540,524,536,},{541,526,528,525,},{541,540,526,525,},{541,528,527,525,},{541,527,530,525,},{543,529,531,535,},{543,532,529,535,},{534,533,530,536,},{542,530,533,536,},{530,548,542,533,},{530,542,541,536,},{549,531,538,535,},{549,543,531,535,},{534,532,551,536,},{532,544,534,551,},{543,532,535,536,},{532,543,551,536,},{543,545,532,551,},{545,544,532,551,},{533,534,551,536,},{544,547,534,533,},{534,544,533,551,},{542,533,551,536,},{548,542,533,551,},{544,547,533,551,},{548,533,547,551,},{540,552,535,536,},{543,535,551,536,},{535,552,551,536,},{537,552,539,535,},{552,537,540,535,},{552,538,539,535,},{549,538,552,535,},{549,543,535,551,},{552,549,535,551,},{540,541,542,536,},{540,542,551,536,},{552,540,551,536,},{540,541,555,542,},{555,540,542,551,},{540,555,552,551,},{555,542,548,551,},{543,556,545,551,},{549,556,543,551,},{544,545,546,551,},{544,546,557,551,},{547,557,551,544,},{545,550,546,558,},{546,545,558,551,},{545,556,558,551,},{550,546,558,553,},{546,553,557,551,},{546,558,553,551,},{547,554,548,551,},{557,547,551,554,},{557,559,547,554,},{555,548,554,551,},{562,555,548,554,},{563,562,555,548,},{549,552,556,551,},{549,552,565,556,},{550,565,553,558,},{560,550,564,553,},{565,550,553,564,},{552,555,570,551,},{556,552,570,551,},{557,553,570,551,},{553,558,570,551,},{555,554,570,551,},{554,557,570,551,},{558,556,570,551,},{552,555,563,570,},{552,566,565,556,},{552,566,556,570,},{552,563,566,570,},{559,560,553,557,},{553,559,557,570,},{558,565,553,570,},{560,559,553,561,},{553,559,570,561,},{560,561,553,570,},{564,560,553,570,},{565,564,553,570,},{562,563,555,554,},{563,555,554,570,},{557,559,554,570,},{562,559,561,554,},{559,561,554,570,},{561,562,554,570,},{562,563,554,570,},{558,556,565,570,},{566,565,556,570,},{564,561,560,570,},{562,561,571,570,},{571,568,564,561,},{564,571,561,570,},{571,563,562,570,},{572,566,563,570,},{572,563,571,570,},{564,576,565,569,},{576,564,565,570,},{564,568,576,569,},{568,571,564,576,},{571,564,576,570,},{577,567,566,565,},{566,577,565,570,},{576,567,565,569,},{567,577,576,565,},{577,576,565,570,},{567,582,577,566,},{577,572,570,566,},{582,577,566,572,},{582,585,567,577,},{576,568,588,569,},{568,571,576,574,},{576,568,574,586,},{568,576,588,586,},{571,572,570,590,},{576,571,570,590,},{572,577,570,590,},{577,576,570,590,},{571,573,572,590,},{571,575,573,574,},{573,571,574,590,},{571,576,574,590,},{572,573,580,590,},{582,577,572,590,},{580,582,572,590,},{575,573,574,590,},{575,579,573,590,},{579,581,573,590,},{573,581,580,590,},{574,578,575,590,},{574,576,586,590,},{586,578,574,590,},{578,579,575,590,},{577,592,576,590,},{576,588,586,587,},{586,576,587,590,},{592,587,576,590,},{582,585,577,583,},{577,582,583,590,},{583,593,577,590,},{577,593,592,590,},{579,578,591,590,},{594,579,578,591,},{586,589,578,587,},{578,586,587,590,},{589,578,587,590,},{594,578,589,590,},{578,594,591,590,},{579,591,581,590,},{580,581,591,590,},{595,580,581,591,},{580,584,582,590,},{580,591,584,590,},{595,580,591,584,},{582,584,583,590,},{582,596,583,584,},{596,582,583,585,},{584,596,583,590,},{596,593,583,590,},{591,595,584,590,},{595,596,584,590,},{588,599,586,587,},{599,589,586,587,},{592,589,587,590,},{589,599,592,587,},{594,589,592,590,},{594,599,592,589,},{594,599,589,600,},{601,594,589,600,},{594,605,591,590,},{596,595,591,590,},{605,596,591,590,},{592,593,605,590,},{605,594,592,590,},{596,605,593,590,},{594,605,595,591,},{595,605,596,591,},{599,594,592,605,},{605,594,595,606,},{599,594,603,600,},{599,594,605,603,},{594,601,603,600,},{594,601,606,603,},{605,594,606,603,},{595,596,606,597,},{605,595,596,606,},{598,607,596,597,},{596,607,606,597,},{607,605,596,606,},{602,599,610,600,},{610,599,603,600,},{610,599,605,603,},{601,602,611,600,},{601,611,603,600,},{611,602,610,600,},{611,610,603,600,},{610,605,606,603,},{612,610,606,603,},{612,611,610,603,},{612,607,604,606,},{608,612,607,604,},{609,608,604,612,},{607,613,605,606,},{613,610,605,606,},{612,607,606,613,},{613,612,610,606,},{612,608,607,613,},{609,613,608,612,},{614,612,611,610,},{613,612,614,610,},{612,613,614,615,},};
+int indices_data[3414] = {333,334,452,268,267,199,50,51,76,420,422,417,152,151,117,611,602,610,252,302,215,608,609,613,614,613,615,614,611,610,338,231,229,613,609,612,609,604,612,113,146,145,610,613,614,611,601,602,442,437,436,309,354,307,585,596,583,418,417,419,72,52,45,397,289,398,485,520,484,311,427,429,202,200,205,358,346,343,606,607,597,150,117,149,602,599,610,321,322,323,608,607,604,177,140,181,1,5,13,445,455,446,613,610,605,613,605,607,352,345,463,475,367,447,203,204,154,85,84,81,296,408,315,150,152,117,79,78,52,351,350,256,607,606,604,76,51,78,598,597,607,207,281,206,258,259,260,226,241,245,378,417,333,607,596,598,281,280,393,203,280,204,459,458,461,34,57,35,596,597,598,595,581,591,206,274,207,46,72,47,601,594,589,420,416,422,40,39,66,217,212,164,611,614,612,610,599,605,601,606,594,280,203,279,201,207,274,325,326,323,67,42,65,463,464,352,475,476,514,194,149,151,80,88,83,63,37,41,605,596,607,312,426,431,66,42,67,207,204,208,201,271,200,138,108,102,66,69,42,37,61,41,243,246,239,152,150,195,203,272,279,42,69,65,353,355,350,67,65,70,299,330,286,281,278,206,304,302,355,195,151,152,514,532,513,281,393,278,272,203,264,604,606,612,460,495,499,41,40,67,50,76,75,106,76,78,597,595,606,206,278,277,612,614,615,40,66,67,597,596,595,106,108,140,274,206,277,194,160,149,80,54,53,130,99,100,200,203,154,279,391,280,21,14,23,195,194,151,606,595,594,150,149,160,78,108,106,436,437,419,153,195,150,599,589,586,50,44,51,372,371,272,393,392,278,326,442,436,515,482,480,210,271,201,66,92,69,273,372,264,97,83,109,223,225,335,301,303,305,451,450,459,274,210,201,393,391,485,391,279,283,599,602,600,277,210,274,283,279,373,514,477,475,530,534,533,245,241,228,279,371,373,70,65,91,66,39,61,246,240,239,532,544,534,215,302,240,262,198,261,100,75,76,372,284,371,588,599,586,69,92,91,393,280,391,283,394,391,92,66,90,370,373,371,99,98,77,271,264,200,90,66,61,270,269,199,23,24,51,190,235,191,373,394,283,371,263,370,46,15,20,459,452,458,269,268,199,272,264,372,264,271,273,580,595,584,585,582,596,547,559,554,514,513,477,63,90,61,169,215,222,199,266,270,235,236,345,594,578,589,192,236,190,255,351,256,90,63,64,265,199,267,485,392,393,605,599,592,265,266,199,153,150,169,321,409,322,169,150,160,65,69,91,366,356,464,149,117,151,420,417,421,203,200,264,116,144,110,318,321,324,458,334,460,578,586,589,273,210,294,137,177,141,20,49,48,391,394,485,290,284,292,371,279,272,370,282,373,530,507,513,379,380,375,41,62,63,120,122,92,485,394,486,133,131,137,269,386,268,89,67,70,253,350,252,273,294,369,120,163,122,594,579,578,92,121,91,465,346,358,134,176,175,104,127,136,85,112,111,332,445,446,91,94,70,120,90,119,383,370,368,278,392,277,261,198,209,273,369,372,138,170,181,186,145,146,92,122,121,90,120,92,373,282,394,282,370,383,81,82,96,271,210,273,408,425,409,287,368,261,59,87,58,368,370,263,578,574,586,282,268,386,282,267,268,469,484,510,196,222,253,270,266,385,372,293,284,214,176,183,246,245,228,64,71,90,262,261,368,425,426,308,148,116,115,210,275,276,303,301,244,485,486,520,606,601,603,21,45,14,368,263,262,383,382,267,267,282,383,337,335,246,445,430,473,416,324,436,588,568,569,439,434,441,89,62,68,378,377,417,191,187,186,265,267,382,366,476,473,304,242,302,293,372,369,325,323,322,523,522,526,346,249,340,259,263,260,498,526,522,90,71,93,390,392,485,298,299,331,64,62,71,118,91,121,577,567,585,595,580,581,56,33,30,22,6,21,425,407,347,239,178,177,89,71,62,15,22,20,36,53,32,163,158,122,72,79,52,499,527,501,246,335,240,500,496,474,90,93,119,122,158,121,269,388,386,176,142,183,568,588,586,106,100,76,567,576,569,577,576,567,390,485,484,388,483,386,338,241,232,258,288,209,464,476,366,265,385,266,401,369,294,332,454,441,119,161,120,545,550,546,498,491,459,294,390,401,223,193,188,350,253,254,592,599,587,383,368,384,580,573,581,201,200,202,148,145,187,308,322,409,565,567,569,369,400,293,417,418,333,394,483,486,107,100,106,95,71,89,94,91,118,45,52,24,565,569,564,401,402,369,366,353,356,418,419,435,475,477,367,16,46,19,93,71,95,500,499,495,316,420,415,573,579,581,382,383,384,416,316,318,287,261,209,586,574,568,565,566,567,400,369,402,23,51,44,353,350,351,24,52,51,299,286,331,94,95,89,368,287,384,332,441,434,569,568,564,469,401,390,574,578,575,582,567,566,186,190,191,352,356,351,350,254,251,341,358,343,483,388,482,188,148,187,18,43,17,148,193,185,141,142,133,549,565,556,120,161,163,250,338,230,36,32,34,528,501,527,288,287,209,121,158,157,161,165,163,502,526,498,579,573,575,400,291,293,21,13,43,118,124,94,34,33,57,388,385,482,385,382,482,541,530,542,123,119,93,484,469,390,520,518,484,519,520,486,104,136,139,45,24,14,162,119,123,25,28,9,265,382,385,450,452,459,162,161,119,582,572,580,165,217,163,442,326,325,508,531,511,544,545,546,327,329,328,302,242,240,22,21,49,582,580,584,510,484,518,95,123,93,118,121,155,567,582,585,215,160,194,468,412,410,413,468,410,510,517,508,531,508,517,155,121,157,135,133,142,55,81,56,538,518,520,539,538,520,355,302,350,95,125,123,434,439,437,367,455,447,456,454,496,18,47,45,96,82,97,517,510,518,162,165,161,140,138,181,315,321,318,25,54,28,124,125,95,519,486,483,251,197,255,482,382,480,406,468,413,413,410,411,334,333,418,157,158,212,474,507,500,215,240,222,130,137,103,574,575,571,401,406,402,165,216,217,130,140,177,216,165,162,396,319,291,291,400,396,137,131,103,502,498,501,99,130,103,455,445,473,59,36,35,564,560,550,366,473,430,469,468,401,550,565,564,577,585,583,36,34,35,95,94,124,198,262,257,436,419,422,518,538,517,458,452,334,82,55,54,327,332,434,468,508,467,510,508,468,79,105,102,577,583,593,24,23,14,483,482,519,384,480,382,217,295,212,568,574,571,406,413,411,575,573,571,181,239,177,317,291,319,580,572,573,508,470,467,467,412,468,468,406,401,561,564,568,399,287,288,239,181,243,137,141,133,315,409,321,197,251,225,231,184,185,289,291,317,470,508,511,229,193,223,469,510,468,568,571,561,49,77,74,538,531,517,552,565,549,105,79,72,396,402,406,400,402,396,99,103,98,399,480,384,213,212,295,552,566,565,552,538,539,319,406,411,124,118,126,319,396,406,118,155,126,547,534,544,539,520,519,527,507,530,316,320,318,500,495,496,148,188,193,221,315,318,581,579,591,546,550,553,101,98,103,305,425,347,467,365,362,410,412,360,136,170,139,564,561,560,354,355,353,538,549,531,519,537,539,113,85,96,437,435,419,142,176,134,62,41,68,157,212,159,145,112,113,178,182,141,167,125,168,538,552,549,125,124,168,167,216,162,108,138,140,162,123,167,612,615,613,194,253,252,543,531,549,155,157,159,335,222,240,452,378,333,329,444,328,384,287,399,290,288,285,480,399,380,444,445,332,242,239,240,515,519,482,435,437,439,365,363,362,552,537,540,365,467,470,412,467,360,253,222,224,61,37,63,405,319,411,217,216,314,416,420,316,572,566,563,123,125,167,481,515,480,476,475,473,363,364,362,442,434,437,411,410,407,435,334,418,213,159,212,289,288,290,427,354,430,519,515,537,381,481,480,467,362,360,182,178,242,426,311,429,411,407,405,531,543,529,537,516,523,573,572,571,552,563,566,244,182,242,456,439,440,98,74,77,397,376,403,113,112,85,481,516,515,612,606,603,364,363,361,36,59,53,555,541,542,314,319,405,194,252,215,177,137,130,390,294,276,342,357,361,364,361,357,609,608,604,236,235,190,531,529,511,96,85,81,295,405,297,557,560,559,405,295,314,572,563,571,168,124,126,511,529,506,537,515,516,375,380,399,221,218,315,282,386,387,407,408,405,217,314,295,534,513,532,381,480,380,313,314,216,318,320,221,569,576,588,464,356,352,500,527,499,365,470,363,159,166,156,159,156,155,613,607,608,354,309,355,214,183,244,284,290,285,360,362,359,456,496,495,155,156,126,244,242,304,174,134,175,436,324,326,561,559,560,7,8,26,318,324,416,301,214,244,362,364,359,465,361,363,255,197,235,309,426,310,319,314,317,496,454,455,381,379,450,361,341,342,9,0,12,187,145,186,559,561,562,351,255,352,532,529,543,335,251,254,129,147,146,288,289,397,302,252,350,80,53,60,381,380,379,19,4,16,399,397,403,33,34,31,364,357,359,108,78,79,223,250,230,405,408,297,561,571,562,563,562,571,552,539,537,461,501,498,18,4,19,140,107,106,173,129,128,313,317,314,257,262,259,470,465,363,84,56,81,476,504,514,297,213,295,305,310,306,78,51,52,70,94,89,377,421,417,178,141,177,7,0,9,189,173,233,153,169,196,234,189,233,410,360,407,213,166,159,57,33,56,327,312,431,45,21,43,129,173,147,513,507,474,153,196,195,173,184,233,189,147,173,281,207,208,174,226,171,227,226,174,100,99,75,465,470,505,552,555,563,12,0,7,26,8,10,49,74,72,576,592,587,83,97,82,173,128,143,132,171,127,146,128,129,174,171,132,344,234,233,143,144,184,357,342,336,565,558,556,303,304,309,105,72,74,168,156,166,83,88,110,285,258,284,499,461,460,481,491,516,375,450,379,54,32,53,234,192,189,341,339,232,232,336,342,532,543,545,166,213,220,504,476,464,156,168,126,501,528,502,337,338,250,325,434,442,50,49,44,444,329,445,9,12,25,575,578,579,82,81,55,341,232,342,184,173,143,335,225,251,171,172,127,47,72,45,188,225,223,215,169,160,249,233,231,534,530,513,21,6,13,300,336,227,300,357,336,351,356,353,28,54,55,359,347,360,544,532,545,75,77,50,116,110,88,239,242,178,540,555,552,516,522,523,450,375,377,481,451,491,352,255,345,496,455,474,182,142,141,233,249,344,532,514,529,300,359,357,213,297,296,194,195,253,191,197,187,540,537,523,582,566,572,145,148,115,109,143,128,43,13,17,86,111,115,504,465,505,212,158,164,347,407,360,86,59,57,548,563,555,174,132,134,99,77,75,115,87,86,451,481,381,451,381,450,16,2,15,27,8,7,415,330,316,231,233,184,226,172,171,450,378,452,227,336,226,213,296,218,168,220,167,425,408,407,323,326,324,144,143,109,454,456,440,270,388,269,409,315,408,192,147,189,430,329,427,249,231,339,605,592,593,166,220,168,167,220,216,244,304,303,526,528,541,376,374,375,507,527,500,144,109,110,193,229,185,371,284,263,346,344,249,465,463,346,562,563,548,526,540,523,234,344,237,346,463,344,8,27,10,9,27,7,83,110,109,25,12,32,127,101,131,557,546,553,504,464,463,87,59,86,22,15,5,30,11,29,330,374,376,313,220,320,330,313,316,105,74,73,16,3,2,456,453,438,145,115,111,1,13,6,221,219,218,445,329,430,80,60,88,527,541,528,56,84,57,299,317,313,12,7,26,10,29,11,97,128,96,104,101,127,226,170,172,135,132,131,310,426,306,353,366,430,529,514,504,86,84,111,197,188,187,299,313,330,188,197,225,3,4,18,309,304,355,131,132,127,102,73,104,320,220,219,105,73,102,134,132,135,345,255,235,227,174,214,453,456,495,334,435,453,540,541,555,375,374,377,3,16,4,131,101,103,27,9,28,138,102,104,192,190,147,241,226,336,192,234,237,300,301,359,183,182,244,321,323,324,112,145,111,191,235,197,84,85,111,18,19,47,49,50,77,113,128,146,6,22,5,461,498,459,232,241,336,254,253,224,325,327,434,504,505,529,56,29,55,222,196,169,27,55,29,219,221,320,12,26,32,229,231,185,128,113,96,451,459,491,315,218,296,21,44,49,460,453,495,186,146,147,116,88,87,232,339,338,300,227,214,430,354,353,544,557,547,134,135,142,241,338,337,325,322,428,19,46,47,394,282,387,5,1,6,204,202,205,421,415,420,144,116,148,56,30,29,344,345,237,409,425,308,463,465,504,559,547,557,27,28,55,526,541,540,195,196,253,522,491,498,307,354,427,74,98,73,104,73,101,183,142,182,190,186,147,502,528,526,57,84,86,408,296,297,347,301,305,463,345,344,109,128,97,23,44,21,477,513,474,26,10,30,5,15,2,26,30,33,338,339,231,218,219,213,527,530,541,219,220,213,26,33,31,499,501,461,422,419,417,460,334,453,10,11,30,46,16,15,436,422,416,107,130,100,98,101,73,421,374,415,192,237,236,516,491,522,589,599,600,316,313,320,135,131,133,453,435,438,2,3,5,88,60,87,82,80,83,181,170,180,415,374,330,301,347,359,144,148,185,116,87,115,258,257,259,300,214,301,345,236,237,54,25,32,378,450,377,170,138,139,312,327,428,184,144,185,374,421,377,327,427,329,170,226,180,5,3,13,458,460,461,102,108,79,107,140,130,388,270,385,80,82,54,286,376,398,10,27,29,64,63,62,548,530,533,41,61,38,61,39,38,330,376,286,40,41,38,39,40,38,529,505,506,335,337,250,223,335,250,280,281,208,204,280,208,291,289,290,505,470,506,557,544,546,53,59,58,303,309,310,305,303,310,18,45,43,548,547,554,291,290,292,308,426,312,375,399,403,376,375,403,611,612,603,601,611,603,243,226,245,246,243,245,441,454,440,439,441,440,454,332,446,455,454,446,397,399,288,288,258,285,214,174,175,176,214,175,335,254,224,222,335,224,474,455,367,477,474,367,425,305,306,426,425,306,473,475,447,455,473,447,427,327,431,293,291,292,284,293,292,317,299,298,289,317,298,277,392,275,210,277,275,294,210,276,392,390,276,275,392,276,470,511,506,229,223,230,338,229,230,172,170,136,127,172,136,483,394,387,386,483,387,550,545,558,565,550,558,550,560,553,560,557,553,60,53,58,87,60,58,594,595,591,579,594,591,67,89,68,41,67,68,251,255,256,350,251,256,596,582,584,595,596,584,361,465,358,341,361,358,13,3,17,3,18,17,562,548,554,559,562,554,32,26,31,34,32,31,439,456,438,435,439,438,209,198,257,258,209,257,207,201,202,204,207,202,592,577,593,331,286,398,343,346,340,22,49,20,154,204,205,200,154,205,163,217,164,158,163,164,332,327,328,444,332,328,543,549,556,545,543,556,558,545,556,57,59,35,426,309,311,241,337,228,337,246,228,548,555,542,530,548,542,327,325,428,322,308,428,308,312,428,138,104,139,547,548,533,534,547,533,601,589,600,602,601,600,243,181,180,226,243,180,46,20,48,262,263,259,309,307,311,576,577,592,588,576,587,599,588,587,284,258,260,263,284,260,72,46,48,49,72,48,249,339,340,341,343,340,339,341,340,596,605,593,583,596,593,307,427,311,427,431,429,431,426,429,220,313,216,376,397,398,289,298,398,298,331,398,};
+int edges_data[2954][2] = {{0,7,},{0,9,},{0,12,},{1,5,},{1,6,},{1,13,},{2,3,},{2,5,},{2,15,},{2,16,},{3,4,},{3,5,},{3,13,},{3,16,},{3,17,},{3,18,},{4,16,},{4,18,},{4,19,},{5,6,},{5,13,},{5,15,},{5,16,},{5,17,},{5,20,},{5,22,},{6,13,},{6,21,},{6,22,},{7,8,},{7,9,},{7,10,},{7,12,},{7,26,},{7,27,},{8,10,},{8,26,},{8,27,},{9,12,},{9,25,},{9,26,},{9,27,},{9,28,},{10,11,},{10,26,},{10,27,},{10,29,},{10,30,},{11,29,},{11,30,},{12,25,},{12,26,},{12,32,},{13,17,},{13,20,},{13,21,},{13,22,},{13,43,},{14,21,},{14,23,},{14,24,},{14,44,},{14,45,},{15,16,},{15,17,},{15,20,},{15,22,},{15,46,},{16,17,},{16,18,},{16,19,},{16,20,},{16,46,},{16,47,},{17,18,},{17,20,},{17,43,},{17,46,},{17,47,},{18,19,},{18,43,},{18,45,},{18,47,},{19,46,},{19,47,},{20,22,},{20,43,},{20,46,},{20,48,},{20,49,},{21,22,},{21,23,},{21,43,},{21,44,},{21,45,},{21,49,},{22,43,},{22,49,},{23,24,},{23,44,},{23,51,},{24,44,},{24,45,},{24,51,},{24,52,},{25,26,},{25,28,},{25,31,},{25,32,},{25,54,},{25,55,},{26,27,},{26,28,},{26,29,},{26,30,},{26,31,},{26,32,},{26,33,},{26,56,},{27,28,},{27,29,},{27,31,},{27,55,},{27,56,},{28,31,},{28,54,},{28,55,},{28,56,},{29,30,},{29,55,},{29,56,},{30,33,},{30,56,},{31,32,},{31,33,},{31,34,},{31,35,},{31,53,},{31,54,},{31,55,},{31,56,},{31,57,},{32,34,},{32,35,},{32,36,},{32,53,},{32,54,},{32,57,},{33,34,},{33,56,},{33,57,},{34,35,},{34,36,},{34,57,},{35,36,},{35,53,},{35,57,},{35,58,},{35,59,},{36,53,},{36,59,},{37,41,},{37,61,},{37,63,},{38,39,},{38,40,},{38,41,},{38,61,},{38,66,},{39,40,},{39,61,},{39,66,},{40,41,},{40,61,},{40,66,},{40,67,},{41,61,},{41,62,},{41,63,},{41,66,},{41,67,},{41,68,},{42,65,},{42,66,},{42,67,},{42,69,},{43,44,},{43,45,},{43,46,},{43,47,},{43,48,},{43,49,},{43,52,},{43,72,},{44,45,},{44,49,},{44,50,},{44,51,},{44,52,},{44,72,},{45,47,},{45,51,},{45,52,},{45,72,},{46,47,},{46,48,},{46,72,},{47,72,},{48,49,},{48,72,},{49,50,},{49,72,},{49,74,},{49,77,},{50,51,},{50,52,},{50,72,},{50,74,},{50,75,},{50,76,},{50,77,},{50,78,},{51,52,},{51,76,},{51,78,},{52,72,},{52,74,},{52,75,},{52,76,},{52,78,},{52,79,},{53,54,},{53,57,},{53,58,},{53,59,},{53,60,},{53,80,},{54,55,},{54,57,},{54,58,},{54,80,},{54,81,},{54,82,},{54,84,},{55,56,},{55,57,},{55,81,},{55,82,},{55,84,},{56,57,},{56,81,},{56,84,},{57,58,},{57,59,},{57,84,},{57,86,},{58,59,},{58,60,},{58,80,},{58,84,},{58,86,},{58,87,},{59,86,},{59,87,},{60,80,},{60,87,},{60,88,},{61,62,},{61,63,},{61,66,},{61,67,},{61,68,},{61,90,},{62,63,},{62,64,},{62,68,},{62,71,},{62,89,},{62,90,},{63,64,},{63,90,},{64,71,},{64,90,},{65,66,},{65,67,},{65,69,},{65,70,},{65,91,},{66,67,},{66,68,},{66,69,},{66,90,},{66,92,},{67,68,},{67,69,},{67,70,},{67,89,},{67,92,},{68,89,},{68,90,},{68,92,},{69,70,},{69,91,},{69,92,},{70,89,},{70,91,},{70,92,},{70,94,},{71,89,},{71,90,},{71,93,},{71,95,},{72,74,},{72,79,},{72,105,},{73,74,},{73,98,},{73,101,},{73,102,},{73,103,},{73,104,},{73,105,},{74,75,},{74,77,},{74,78,},{74,79,},{74,98,},{74,99,},{74,105,},{74,106,},{75,76,},{75,77,},{75,78,},{75,99,},{75,100,},{75,106,},{76,78,},{76,100,},{76,106,},{77,98,},{77,99,},{77,100,},{77,105,},{77,106,},{77,107,},{78,79,},{78,106,},{78,108,},{79,102,},{79,105,},{79,106,},{79,108,},{80,81,},{80,82,},{80,83,},{80,84,},{80,86,},{80,87,},{80,88,},{80,114,},{81,82,},{81,84,},{81,85,},{81,87,},{81,96,},{81,114,},{82,83,},{82,85,},{82,96,},{82,97,},{82,114,},{83,88,},{83,97,},{83,109,},{83,110,},{83,114,},{84,85,},{84,86,},{84,87,},{84,111,},{84,114,},{84,115,},{85,96,},{85,111,},{85,112,},{85,113,},{85,114,},{85,115,},{86,87,},{86,111,},{86,115,},{87,88,},{87,114,},{87,115,},{87,116,},{88,110,},{88,114,},{88,116,},{89,90,},{89,92,},{89,93,},{89,94,},{89,95,},{89,119,},{90,92,},{90,93,},{90,119,},{90,120,},{91,92,},{91,94,},{91,118,},{91,120,},{91,121,},{92,94,},{92,119,},{92,120,},{92,121,},{92,122,},{93,94,},{93,95,},{93,119,},{93,123,},{94,95,},{94,118,},{94,119,},{94,120,},{94,124,},{95,119,},{95,120,},{95,123,},{95,124,},{95,125,},{96,97,},{96,109,},{96,113,},{96,114,},{96,128,},{97,109,},{97,114,},{97,128,},{98,99,},{98,101,},{98,102,},{98,103,},{98,105,},{98,107,},{98,130,},{99,100,},{99,103,},{99,105,},{99,107,},{99,130,},{100,106,},{100,107,},{100,130,},{101,102,},{101,103,},{101,104,},{101,127,},{101,131,},{102,103,},{102,104,},{102,105,},{102,108,},{102,130,},{102,138,},{103,104,},{103,127,},{103,130,},{103,131,},{103,136,},{103,137,},{103,138,},{103,139,},{104,127,},{104,131,},{104,136,},{104,138,},{104,139,},{105,106,},{105,107,},{105,108,},{105,130,},{105,138,},{105,140,},{106,107,},{106,108,},{106,140,},{107,108,},{107,130,},{107,140,},{108,138,},{108,140,},{109,110,},{109,113,},{109,114,},{109,128,},{109,143,},{109,144,},{110,114,},{110,116,},{110,144,},{111,112,},{111,114,},{111,115,},{111,145,},{112,113,},{112,114,},{112,145,},{113,114,},{113,128,},{113,143,},{113,145,},{113,146,},{114,115,},{114,116,},{114,143,},{114,144,},{114,145,},{114,148,},{115,116,},{115,145,},{115,148,},{116,144,},{116,148,},{117,149,},{117,150,},{117,151,},{117,152,},{118,120,},{118,121,},{118,124,},{118,126,},{118,155,},{118,161,},{119,120,},{119,123,},{119,161,},{119,162,},{120,121,},{120,122,},{120,123,},{120,124,},{120,125,},{120,155,},{120,161,},{120,163,},{121,122,},{121,155,},{121,157,},{121,158,},{121,161,},{121,163,},{122,158,},{122,163,},{123,125,},{123,161,},{123,162,},{123,167,},{124,125,},{124,126,},{124,155,},{124,156,},{124,161,},{124,168,},{125,161,},{125,167,},{125,168,},{126,155,},{126,156,},{126,168,},{127,131,},{127,132,},{127,136,},{127,171,},{127,172,},{128,129,},{128,143,},{128,146,},{128,173,},{129,146,},{129,147,},{129,173,},{130,137,},{130,138,},{130,139,},{130,140,},{130,177,},{131,132,},{131,133,},{131,135,},{131,136,},{131,137,},{131,179,},{132,133,},{132,134,},{132,135,},{132,136,},{132,171,},{132,174,},{132,179,},{133,135,},{133,136,},{133,137,},{133,141,},{133,142,},{133,179,},{134,135,},{134,142,},{134,171,},{134,174,},{134,175,},{134,176,},{134,179,},{135,142,},{135,171,},{135,179,},{136,137,},{136,139,},{136,170,},{136,171,},{136,172,},{136,179,},{136,181,},{137,139,},{137,141,},{137,170,},{137,177,},{137,179,},{137,180,},{137,181,},{138,139,},{138,140,},{138,170,},{138,177,},{138,181,},{139,170,},{139,177,},{139,181,},{140,177,},{140,181,},{141,142,},{141,177,},{141,178,},{141,179,},{141,182,},{142,175,},{142,176,},{142,179,},{142,182,},{142,183,},{143,144,},{143,145,},{143,146,},{143,148,},{143,173,},{143,184,},{143,185,},{144,148,},{144,184,},{144,185,},{145,146,},{145,148,},{145,184,},{145,186,},{145,187,},{146,147,},{146,173,},{146,184,},{146,186,},{146,187,},{147,173,},{147,184,},{147,186,},{147,189,},{147,190,},{147,192,},{148,184,},{148,185,},{148,187,},{148,188,},{148,193,},{149,150,},{149,151,},{149,152,},{149,160,},{149,194,},{150,151,},{150,152,},{150,153,},{150,160,},{150,169,},{150,194,},{150,195,},{151,152,},{151,194,},{151,195,},{152,195,},{153,160,},{153,169,},{153,194,},{153,195,},{153,196,},{154,200,},{154,203,},{154,204,},{154,205,},{155,156,},{155,157,},{155,159,},{155,161,},{155,166,},{155,211,},{156,159,},{156,161,},{156,166,},{156,168,},{156,211,},{157,158,},{157,159,},{157,161,},{157,163,},{157,164,},{157,166,},{157,211,},{157,212,},{158,163,},{158,164,},{158,211,},{158,212,},{159,166,},{159,211,},{159,212,},{159,213,},{160,169,},{160,194,},{160,196,},{160,215,},{161,162,},{161,163,},{161,164,},{161,165,},{161,166,},{161,167,},{161,168,},{161,211,},{161,216,},{162,165,},{162,167,},{162,216,},{163,164,},{163,165,},{163,211,},{163,217,},{164,165,},{164,211,},{164,212,},{164,217,},{165,211,},{165,216,},{165,217,},{166,167,},{166,168,},{166,211,},{166,213,},{166,220,},{167,168,},{167,211,},{167,216,},{167,220,},{168,220,},{169,194,},{169,196,},{169,215,},{169,222,},{170,172,},{170,174,},{170,179,},{170,180,},{170,181,},{170,226,},{171,172,},{171,174,},{171,179,},{171,226,},{172,174,},{172,179,},{172,226,},{173,184,},{173,186,},{173,189,},{173,233,},{174,175,},{174,179,},{174,214,},{174,226,},{174,227,},{174,238,},{175,176,},{175,179,},{175,214,},{175,238,},{176,179,},{176,183,},{176,214,},{176,238,},{177,178,},{177,179,},{177,180,},{177,181,},{177,239,},{178,179,},{178,180,},{178,182,},{178,238,},{178,239,},{178,242,},{179,180,},{179,182,},{179,183,},{179,226,},{179,238,},{179,239,},{179,243,},{180,181,},{180,226,},{180,238,},{180,239,},{180,243,},{181,239,},{181,243,},{182,183,},{182,238,},{182,239,},{182,242,},{182,244,},{183,214,},{183,238,},{183,244,},{184,185,},{184,186,},{184,187,},{184,189,},{184,231,},{184,233,},{184,247,},{185,186,},{185,187,},{185,188,},{185,193,},{185,229,},{185,231,},{185,233,},{185,247,},{186,187,},{186,189,},{186,190,},{186,191,},{186,247,},{187,188,},{187,191,},{187,197,},{187,247,},{188,191,},{188,193,},{188,197,},{188,223,},{188,225,},{188,247,},{189,190,},{189,192,},{189,233,},{189,234,},{189,247,},{190,191,},{190,192,},{190,235,},{190,236,},{190,247,},{191,197,},{191,235,},{191,236,},{191,247,},{192,234,},{192,236,},{192,237,},{192,247,},{193,223,},{193,229,},{193,247,},{194,195,},{194,196,},{194,215,},{194,222,},{194,252,},{194,253,},{195,196,},{195,253,},{196,222,},{196,253,},{197,225,},{197,235,},{197,247,},{197,251,},{197,255,},{198,209,},{198,257,},{198,261,},{198,262,},{199,265,},{199,266,},{199,267,},{199,268,},{199,269,},{199,270,},{200,201,},{200,202,},{200,203,},{200,205,},{200,264,},{200,271,},{201,202,},{201,203,},{201,207,},{201,210,},{201,271,},{201,274,},{202,203,},{202,204,},{202,205,},{202,206,},{202,207,},{202,208,},{202,271,},{202,272,},{202,274,},{202,280,},{203,204,},{203,205,},{203,206,},{203,264,},{203,271,},{203,272,},{203,279,},{203,280,},{204,205,},{204,207,},{204,208,},{204,280,},{205,280,},{206,207,},{206,208,},{206,271,},{206,272,},{206,274,},{206,277,},{206,278,},{206,279,},{206,280,},{206,281,},{207,208,},{207,274,},{207,281,},{208,280,},{208,281,},{209,257,},{209,258,},{209,261,},{209,287,},{209,288,},{210,271,},{210,273,},{210,274,},{210,275,},{210,276,},{210,277,},{210,294,},{211,212,},{211,213,},{211,216,},{211,217,},{211,219,},{211,220,},{211,295,},{212,213,},{212,217,},{212,295,},{213,216,},{213,218,},{213,219,},{213,220,},{213,295,},{213,296,},{213,297,},{214,227,},{214,238,},{214,244,},{214,300,},{214,301,},{215,222,},{215,224,},{215,240,},{215,252,},{215,302,},{216,217,},{216,219,},{216,220,},{216,295,},{216,313,},{216,314,},{217,295,},{217,314,},{218,219,},{218,221,},{218,295,},{218,296,},{218,297,},{218,313,},{218,314,},{218,315,},{219,220,},{219,221,},{219,295,},{219,313,},{219,314,},{219,320,},{220,313,},{220,320,},{221,296,},{221,313,},{221,315,},{221,318,},{221,320,},{222,224,},{222,240,},{222,252,},{222,253,},{222,335,},{223,225,},{223,229,},{223,230,},{223,247,},{223,248,},{223,250,},{223,335,},{224,240,},{224,252,},{224,253,},{224,254,},{224,302,},{224,335,},{225,230,},{225,247,},{225,248,},{225,251,},{225,335,},{226,227,},{226,238,},{226,241,},{226,243,},{226,245,},{226,336,},{227,238,},{227,300,},{227,336,},{228,241,},{228,245,},{228,246,},{228,337,},{229,230,},{229,231,},{229,247,},{229,248,},{229,338,},{230,248,},{230,250,},{230,335,},{230,338,},{231,233,},{231,247,},{231,248,},{231,249,},{231,338,},{231,339,},{231,340,},{232,241,},{232,336,},{232,338,},{232,339,},{232,341,},{232,342,},{233,234,},{233,247,},{233,249,},{233,344,},{234,237,},{234,247,},{234,344,},{235,236,},{235,247,},{235,255,},{235,345,},{236,237,},{236,247,},{236,345,},{237,247,},{237,344,},{237,345,},{238,239,},{238,241,},{238,242,},{238,243,},{238,244,},{238,245,},{238,300,},{238,301,},{238,303,},{238,336,},{238,348,},{239,240,},{239,242,},{239,243,},{239,246,},{239,348,},{240,242,},{240,246,},{240,252,},{240,302,},{240,335,},{240,337,},{240,348,},{241,245,},{241,336,},{241,337,},{241,338,},{241,339,},{241,348,},{242,244,},{242,302,},{242,304,},{242,348,},{243,245,},{243,246,},{243,348,},{244,301,},{244,303,},{244,304,},{244,348,},{245,246,},{245,337,},{245,348,},{246,335,},{246,337,},{246,348,},{247,248,},{247,249,},{247,251,},{247,255,},{247,344,},{247,345,},{247,349,},{248,249,},{248,250,},{248,251,},{248,254,},{248,255,},{248,335,},{248,338,},{248,339,},{248,340,},{248,344,},{248,349,},{249,339,},{249,340,},{249,344,},{249,346,},{249,349,},{250,335,},{250,337,},{250,338,},{250,349,},{251,254,},{251,255,},{251,256,},{251,335,},{251,349,},{251,350,},{252,253,},{252,254,},{252,302,},{252,335,},{252,350,},{253,254,},{253,350,},{254,256,},{254,335,},{254,349,},{254,350,},{254,351,},{255,256,},{255,345,},{255,349,},{255,351,},{255,352,},{256,345,},{256,349,},{256,350,},{256,351,},{256,352,},{257,258,},{257,259,},{257,261,},{257,262,},{257,287,},{257,288,},{257,368,},{258,259,},{258,260,},{258,284,},{258,285,},{258,287,},{258,288,},{258,368,},{259,260,},{259,262,},{259,263,},{259,287,},{259,288,},{259,368,},{260,263,},{260,284,},{260,285,},{260,368,},{261,262,},{261,287,},{261,368,},{262,263,},{262,368,},{263,284,},{263,368,},{263,370,},{263,371,},{264,271,},{264,272,},{264,273,},{264,372,},{265,266,},{265,267,},{265,269,},{265,382,},{265,385,},{266,269,},{266,270,},{266,385,},{267,268,},{267,269,},{267,282,},{267,382,},{267,383,},{267,386,},{268,269,},{268,282,},{268,386,},{269,270,},{269,382,},{269,385,},{269,386,},{269,388,},{270,385,},{270,388,},{271,272,},{271,273,},{271,274,},{271,275,},{271,278,},{271,389,},{272,273,},{272,278,},{272,279,},{272,280,},{272,371,},{272,372,},{272,389,},{273,275,},{273,276,},{273,294,},{273,369,},{273,372,},{273,389,},{274,275,},{274,277,},{274,278,},{274,389,},{275,276,},{275,277,},{275,278,},{275,389,},{275,392,},{276,294,},{276,389,},{276,390,},{276,392,},{277,278,},{277,392,},{278,279,},{278,280,},{278,281,},{278,389,},{278,392,},{278,393,},{279,280,},{279,283,},{279,371,},{279,372,},{279,373,},{279,389,},{279,391,},{279,393,},{280,281,},{280,391,},{280,393,},{281,393,},{282,370,},{282,373,},{282,383,},{282,386,},{282,387,},{282,394,},{283,373,},{283,391,},{283,394,},{284,285,},{284,290,},{284,292,},{284,293,},{284,368,},{284,369,},{284,370,},{284,371,},{284,372,},{284,395,},{285,288,},{285,290,},{285,368,},{285,395,},{286,299,},{286,330,},{286,331,},{286,376,},{286,398,},{287,288,},{287,368,},{287,384,},{287,395,},{287,399,},{288,289,},{288,290,},{288,368,},{288,395,},{288,397,},{288,399,},{288,400,},{289,290,},{289,291,},{289,298,},{289,317,},{289,395,},{289,396,},{289,397,},{289,398,},{289,400,},{290,291,},{290,292,},{290,395,},{290,400,},{291,292,},{291,293,},{291,317,},{291,319,},{291,396,},{291,400,},{292,293,},{292,369,},{292,395,},{292,400,},{293,369,},{293,372,},{293,400,},{294,369,},{294,389,},{294,390,},{294,401,},{295,297,},{295,314,},{295,405,},{296,297,},{296,313,},{296,314,},{296,315,},{296,405,},{296,408,},{297,314,},{297,405,},{297,408,},{298,299,},{298,317,},{298,331,},{298,396,},{298,398,},{298,404,},{298,414,},{299,313,},{299,316,},{299,317,},{299,330,},{299,331,},{299,404,},{299,414,},{299,415,},{300,301,},{300,336,},{300,348,},{300,357,},{300,359,},{300,423,},{301,303,},{301,305,},{301,310,},{301,347,},{301,348,},{301,359,},{301,423,},{301,424,},{302,304,},{302,335,},{302,348,},{302,350,},{302,355,},{302,424,},{303,304,},{303,305,},{303,309,},{303,310,},{303,348,},{303,423,},{303,424,},{304,309,},{304,348,},{304,355,},{304,424,},{305,306,},{305,310,},{305,347,},{305,423,},{305,425,},{306,310,},{306,423,},{306,425,},{306,426,},{307,309,},{307,311,},{307,354,},{307,427,},{308,312,},{308,322,},{308,409,},{308,425,},{308,426,},{308,428,},{309,310,},{309,311,},{309,354,},{309,355,},{309,424,},{309,426,},{309,427,},{309,429,},{310,423,},{310,424,},{310,426,},{310,429,},{311,426,},{311,427,},{311,429,},{312,327,},{312,426,},{312,428,},{312,431,},{313,314,},{313,315,},{313,316,},{313,317,},{313,318,},{313,320,},{313,330,},{313,404,},{313,414,},{313,432,},{314,315,},{314,317,},{314,319,},{314,405,},{314,432,},{315,318,},{315,320,},{315,321,},{315,405,},{315,408,},{315,409,},{315,432,},{316,318,},{316,320,},{316,324,},{316,330,},{316,414,},{316,415,},{316,416,},{316,420,},{316,432,},{317,319,},{317,396,},{317,404,},{317,432,},{318,320,},{318,321,},{318,324,},{318,416,},{318,432,},{319,396,},{319,404,},{319,405,},{319,406,},{319,411,},{319,432,},{320,432,},{321,322,},{321,323,},{321,324,},{321,325,},{321,409,},{321,425,},{321,432,},{321,433,},{322,323,},{322,325,},{322,409,},{322,425,},{322,426,},{322,428,},{322,433,},{323,324,},{323,325,},{323,326,},{323,433,},{324,326,},{324,416,},{324,432,},{324,433,},{324,436,},{325,326,},{325,327,},{325,328,},{325,428,},{325,433,},{325,434,},{325,442,},{326,433,},{326,436,},{326,442,},{327,328,},{327,329,},{327,332,},{327,427,},{327,428,},{327,431,},{327,434,},{327,443,},{328,329,},{328,332,},{328,428,},{328,433,},{328,434,},{328,443,},{328,444,},{329,427,},{329,430,},{329,443,},{329,444,},{329,445,},{330,331,},{330,374,},{330,376,},{330,398,},{330,414,},{330,415,},{330,449,},{331,398,},{331,414,},{331,449,},{332,434,},{332,441,},{332,444,},{332,445,},{332,446,},{332,454,},{333,334,},{333,378,},{333,417,},{333,418,},{333,448,},{333,452,},{333,457,},{334,418,},{334,435,},{334,438,},{334,452,},{334,453,},{334,457,},{334,458,},{334,460,},{335,337,},{335,338,},{335,348,},{335,349,},{335,350,},{335,462,},{336,337,},{336,339,},{336,341,},{336,342,},{336,348,},{336,357,},{336,358,},{336,462,},{337,338,},{337,339,},{337,348,},{337,349,},{337,462,},{338,339,},{338,340,},{338,349,},{338,462,},{339,340,},{339,341,},{339,358,},{339,462,},{340,341,},{340,343,},{340,346,},{340,349,},{340,358,},{340,462,},{341,342,},{341,343,},{341,358,},{341,361,},{341,462,},{342,357,},{342,358,},{342,361,},{342,462,},{343,346,},{343,358,},{343,462,},{344,345,},{344,346,},{344,349,},{344,463,},{345,349,},{345,352,},{345,463,},{346,349,},{346,358,},{346,462,},{346,463,},{346,465,},{347,359,},{347,360,},{347,407,},{347,423,},{347,425,},{347,466,},{348,350,},{348,357,},{348,423,},{348,424,},{348,462,},{348,471,},{349,350,},{349,351,},{349,352,},{349,462,},{349,463,},{349,471,},{350,351,},{350,353,},{350,355,},{350,424,},{350,462,},{350,471,},{351,352,},{351,353,},{351,356,},{351,462,},{351,471,},{352,356,},{352,462,},{352,463,},{352,464,},{352,471,},{353,354,},{353,355,},{353,356,},{353,366,},{353,424,},{353,430,},{353,471,},{354,355,},{354,424,},{354,427,},{354,430,},{354,471,},{355,424,},{355,471,},{356,366,},{356,464,},{356,471,},{357,358,},{357,359,},{357,361,},{357,364,},{357,423,},{357,424,},{357,462,},{357,471,},{357,472,},{358,361,},{358,462,},{358,465,},{358,472,},{359,360,},{359,362,},{359,364,},{359,423,},{359,466,},{359,472,},{360,362,},{360,407,},{360,410,},{360,412,},{360,466,},{360,467,},{360,472,},{361,363,},{361,364,},{361,465,},{361,472,},{362,363,},{362,364,},{362,365,},{362,467,},{362,472,},{363,364,},{363,365,},{363,465,},{363,470,},{363,472,},{364,472,},{365,467,},{365,470,},{365,472,},{366,430,},{366,464,},{366,471,},{366,473,},{366,476,},{367,447,},{367,455,},{367,474,},{367,475,},{367,477,},{368,370,},{368,383,},{368,384,},{368,395,},{368,478,},{369,371,},{369,372,},{369,389,},{369,390,},{369,395,},{369,400,},{369,401,},{369,402,},{369,478,},{370,371,},{370,373,},{370,383,},{370,387,},{370,394,},{370,395,},{370,478,},{371,372,},{371,373,},{371,389,},{371,395,},{371,478,},{372,389,},{372,478,},{373,389,},{373,391,},{373,394,},{373,478,},{374,375,},{374,376,},{374,377,},{374,397,},{374,398,},{374,415,},{374,421,},{374,448,},{374,449,},{374,479,},{375,376,},{375,377,},{375,379,},{375,380,},{375,399,},{375,403,},{375,450,},{375,479,},{376,397,},{376,398,},{376,403,},{376,479,},{377,378,},{377,417,},{377,421,},{377,448,},{377,450,},{377,479,},{378,417,},{378,448,},{378,450,},{378,452,},{378,479,},{379,380,},{379,381,},{379,399,},{379,450,},{379,451,},{379,479,},{379,480,},{380,381,},{380,399,},{380,480,},{381,450,},{381,451,},{381,480,},{381,481,},{382,383,},{382,384,},{382,385,},{382,386,},{382,388,},{382,480,},{382,482,},{383,384,},{383,386,},{383,387,},{383,478,},{383,482,},{384,395,},{384,399,},{384,478,},{384,480,},{384,482,},{385,386,},{385,388,},{385,482,},{386,387,},{386,388,},{386,478,},{386,482,},{386,483,},{387,394,},{387,478,},{387,483,},{388,482,},{388,483,},{389,390,},{389,391,},{389,392,},{389,393,},{389,478,},{389,485,},{390,392,},{390,401,},{390,402,},{390,469,},{390,478,},{390,484,},{390,485,},{391,393,},{391,394,},{391,478,},{391,485,},{392,393,},{392,485,},{393,485,},{394,478,},{394,483,},{394,484,},{394,485,},{394,486,},{395,397,},{395,399,},{395,400,},{395,402,},{395,478,},{395,480,},{395,487,},{396,397,},{396,398,},{396,400,},{396,402,},{396,404,},{396,406,},{396,414,},{396,449,},{396,487,},{397,398,},{397,399,},{397,400,},{397,403,},{397,449,},{397,479,},{397,487,},{398,414,},{398,449,},{398,487,},{399,403,},{399,479,},{399,480,},{399,487,},{400,402,},{400,487,},{401,402,},{401,406,},{401,468,},{401,469,},{401,478,},{401,484,},{401,487,},{402,406,},{402,478,},{402,487,},{403,479,},{403,487,},{404,405,},{404,406,},{404,414,},{404,432,},{404,449,},{404,487,},{404,488,},{405,406,},{405,407,},{405,408,},{405,411,},{405,432,},{405,488,},{406,411,},{406,413,},{406,432,},{406,468,},{406,487,},{406,488,},{407,408,},{407,410,},{407,411,},{407,413,},{407,425,},{407,466,},{407,488,},{408,409,},{408,425,},{408,432,},{408,466,},{408,488,},{409,425,},{409,432,},{409,433,},{409,488,},{410,411,},{410,412,},{410,413,},{410,466,},{410,468,},{410,488,},{411,413,},{411,432,},{411,488,},{412,466,},{412,467,},{412,468,},{412,488,},{413,468,},{413,488,},{414,415,},{414,416,},{414,432,},{414,449,},{414,489,},{415,416,},{415,420,},{415,421,},{415,448,},{415,449,},{415,489,},{416,420,},{416,422,},{416,432,},{416,433,},{416,436,},{416,489,},{417,418,},{417,419,},{417,420,},{417,421,},{417,422,},{417,448,},{417,489,},{418,419,},{418,435,},{418,448,},{418,457,},{418,489,},{419,422,},{419,435,},{419,436,},{419,437,},{419,457,},{419,489,},{420,421,},{420,422,},{420,489,},{421,448,},{421,489,},{422,436,},{422,489,},{423,424,},{423,425,},{423,426,},{423,429,},{423,466,},{423,471,},{423,472,},{423,490,},{424,427,},{424,429,},{424,471,},{424,490,},{425,426,},{425,433,},{425,466,},{425,488,},{425,490,},{426,428,},{426,429,},{426,431,},{426,433,},{426,490,},{427,429,},{427,430,},{427,431,},{427,443,},{427,471,},{427,490,},{428,431,},{428,433,},{428,443,},{428,490,},{429,431,},{429,443,},{429,490,},{430,443,},{430,445,},{430,471,},{430,473,},{430,490,},{431,433,},{431,443,},{431,490,},{432,433,},{432,449,},{432,487,},{432,488,},{432,489,},{432,492,},{433,434,},{433,436,},{433,442,},{433,443,},{433,488,},{433,489,},{433,490,},{433,492,},{434,437,},{434,439,},{434,441,},{434,442,},{434,443,},{434,444,},{434,492,},{435,437,},{435,438,},{435,439,},{435,453,},{435,457,},{435,489,},{435,492,},{436,437,},{436,442,},{436,489,},{436,492,},{437,439,},{437,442,},{437,457,},{437,489,},{437,492,},{438,439,},{438,440,},{438,453,},{438,456,},{438,457,},{438,492,},{439,440,},{439,441,},{439,456,},{439,492,},{440,441,},{440,444,},{440,454,},{440,456,},{440,492,},{441,444,},{441,454,},{441,492,},{442,492,},{443,444,},{443,445,},{443,446,},{443,454,},{443,490,},{443,492,},{443,493,},{444,445,},{444,446,},{444,454,},{444,492,},{444,493,},{445,446,},{445,455,},{445,473,},{445,490,},{445,493,},{446,454,},{446,455,},{446,473,},{446,493,},{447,455,},{447,473,},{447,474,},{447,475,},{447,493,},{448,449,},{448,450,},{448,452,},{448,457,},{448,479,},{448,489,},{448,494,},{449,479,},{449,487,},{449,489,},{449,494,},{450,451,},{450,452,},{450,459,},{450,479,},{450,494,},{451,459,},{451,479,},{451,480,},{451,481,},{451,491,},{451,494,},{452,457,},{452,458,},{452,459,},{452,494,},{453,456,},{453,457,},{453,460,},{453,495,},{454,455,},{454,456,},{454,492,},{454,493,},{454,496,},{455,473,},{455,474,},{455,493,},{455,496,},{456,457,},{456,492,},{456,495,},{456,496,},{457,458,},{457,460,},{457,489,},{457,492,},{457,494,},{457,495,},{457,497,},{458,459,},{458,460,},{458,461,},{458,494,},{458,497,},{459,461,},{459,491,},{459,494,},{459,497,},{459,498,},{460,461,},{460,495,},{460,497,},{460,499,},{461,497,},{461,498,},{461,499,},{461,501,},{462,463,},{462,464,},{462,465,},{462,471,},{462,472,},{462,504,},{463,464,},{463,465,},{463,504,},{464,471,},{464,476,},{464,504,},{465,470,},{465,472,},{465,503,},{465,504,},{465,505,},{466,467,},{466,471,},{466,472,},{466,488,},{466,490,},{466,509,},{467,468,},{467,470,},{467,472,},{467,488,},{467,503,},{467,508,},{467,509,},{468,469,},{468,487,},{468,488,},{468,508,},{468,509,},{468,510,},{469,484,},{469,487,},{469,510,},{470,472,},{470,503,},{470,505,},{470,506,},{470,508,},{470,511,},{471,472,},{471,473,},{471,476,},{471,488,},{471,490,},{471,504,},{471,512,},{472,488,},{472,503,},{472,504,},{472,509,},{472,512,},{473,475,},{473,476,},{473,490,},{473,493,},{473,512,},{474,475,},{474,477,},{474,493,},{474,496,},{474,500,},{474,507,},{474,513,},{475,476,},{475,477,},{475,493,},{475,512,},{475,513,},{475,514,},{476,493,},{476,504,},{476,512,},{476,514,},{477,493,},{477,512,},{477,513,},{477,514,},{478,480,},{478,482,},{478,483,},{478,484,},{478,485,},{478,486,},{478,487,},{478,515,},{479,480,},{479,487,},{479,491,},{479,494,},{479,515,},{480,481,},{480,482,},{480,487,},{480,491,},{480,515,},{481,491,},{481,515,},{481,516,},{482,483,},{482,484,},{482,515,},{482,519,},{483,484,},{483,486,},{483,519,},{484,485,},{484,486,},{484,487,},{484,510,},{484,515,},{484,518,},{484,519,},{484,520,},{485,486,},{485,520,},{486,519,},{486,520,},{487,488,},{487,489,},{487,492,},{487,494,},{487,509,},{487,510,},{487,515,},{487,518,},{487,521,},{488,489,},{488,490,},{488,492,},{488,509,},{488,512,},{488,521,},{489,492,},{489,494,},{489,521,},{490,492,},{490,493,},{490,512,},{490,521,},{491,494,},{491,497,},{491,498,},{491,515,},{491,516,},{491,521,},{491,522,},{492,493,},{492,494,},{492,495,},{492,496,},{492,497,},{492,512,},{492,521,},{492,524,},{493,496,},{493,500,},{493,507,},{493,512,},{493,513,},{493,524,},{494,497,},{494,498,},{494,515,},{494,521,},{494,522,},{494,524,},{495,496,},{495,497,},{495,499,},{495,500,},{495,524,},{496,500,},{496,524,},{497,498,},{497,499,},{497,501,},{497,502,},{497,521,},{497,522,},{497,524,},{497,525,},{498,501,},{498,502,},{498,522,},{498,526,},{499,500,},{499,501,},{499,524,},{499,525,},{499,527,},{500,507,},{500,524,},{500,527,},{501,502,},{501,525,},{501,527,},{501,528,},{502,522,},{502,525,},{502,526,},{502,528,},{503,504,},{503,505,},{503,506,},{503,508,},{503,509,},{503,511,},{503,512,},{503,529,},{504,505,},{504,512,},{504,514,},{504,529,},{505,506,},{505,512,},{505,514,},{505,529,},{506,511,},{506,529,},{507,513,},{507,524,},{507,527,},{507,530,},{508,509,},{508,510,},{508,511,},{508,517,},{508,531,},{509,510,},{509,511,},{509,512,},{509,514,},{509,517,},{509,521,},{509,529,},{509,535,},{510,511,},{510,517,},{510,518,},{510,521,},{510,535,},{511,517,},{511,529,},{511,531,},{511,535,},{512,513,},{512,514,},{512,521,},{512,524,},{512,529,},{512,535,},{512,536,},{513,514,},{513,524,},{513,530,},{513,532,},{513,534,},{513,536,},{514,529,},{514,532,},{514,535,},{514,536,},{515,516,},{515,518,},{515,519,},{515,521,},{515,537,},{516,521,},{516,522,},{516,523,},{516,537,},{517,518,},{517,521,},{517,531,},{517,535,},{517,538,},{518,519,},{518,520,},{518,521,},{518,535,},{518,537,},{518,538,},{518,539,},{519,520,},{519,521,},{519,537,},{519,539,},{520,538,},{520,539,},{521,522,},{521,524,},{521,535,},{521,536,},{521,537,},{521,540,},{522,523,},{522,524,},{522,525,},{522,526,},{522,537,},{522,540,},{523,526,},{523,537,},{523,540,},{524,525,},{524,527,},{524,530,},{524,535,},{524,536,},{524,537,},{524,540,},{524,541,},{525,526,},{525,527,},{525,528,},{525,530,},{525,540,},{525,541,},{526,528,},{526,537,},{526,540,},{526,541,},{527,528,},{527,530,},{527,541,},{528,541,},{529,531,},{529,532,},{529,535,},{529,543,},{530,533,},{530,534,},{530,536,},{530,541,},{530,542,},{530,548,},{531,535,},{531,538,},{531,543,},{531,549,},{532,534,},{532,535,},{532,536,},{532,543,},{532,544,},{532,545,},{532,551,},{533,534,},{533,536,},{533,542,},{533,544,},{533,547,},{533,548,},{533,551,},{534,536,},{534,544,},{534,547,},{534,551,},{535,536,},{535,537,},{535,538,},{535,539,},{535,540,},{535,543,},{535,549,},{535,551,},{535,552,},{536,540,},{536,541,},{536,542,},{536,543,},{536,551,},{536,552,},{537,539,},{537,540,},{537,552,},{538,539,},{538,549,},{538,552,},{539,552,},{540,541,},{540,542,},{540,551,},{540,552,},{540,555,},{541,542,},{541,555,},{542,548,},{542,551,},{542,555,},{543,545,},{543,549,},{543,551,},{543,556,},{544,545,},{544,546,},{544,547,},{544,551,},{544,557,},{545,546,},{545,550,},{545,551,},{545,556,},{545,558,},{546,550,},{546,551,},{546,553,},{546,557,},{546,558,},{547,548,},{547,551,},{547,554,},{547,557,},{547,559,},{548,551,},{548,554,},{548,555,},{548,562,},{548,563,},{549,551,},{549,552,},{549,556,},{549,565,},{550,553,},{550,558,},{550,560,},{550,564,},{550,565,},{551,552,},{551,553,},{551,554,},{551,555,},{551,556,},{551,557,},{551,558,},{551,570,},{552,555,},{552,556,},{552,563,},{552,565,},{552,566,},{552,570,},{553,557,},{553,558,},{553,559,},{553,560,},{553,561,},{553,564,},{553,565,},{553,570,},{554,555,},{554,557,},{554,559,},{554,561,},{554,562,},{554,563,},{554,570,},{555,562,},{555,563,},{555,570,},{556,558,},{556,565,},{556,566,},{556,570,},{557,559,},{557,560,},{557,570,},{558,565,},{558,570,},{559,560,},{559,561,},{559,562,},{559,570,},{560,561,},{560,564,},{560,570,},{561,562,},{561,564,},{561,568,},{561,570,},{561,571,},{562,563,},{562,570,},{562,571,},{563,566,},{563,570,},{563,571,},{563,572,},{564,565,},{564,568,},{564,569,},{564,570,},{564,571,},{564,576,},{565,566,},{565,567,},{565,569,},{565,570,},{565,576,},{565,577,},{566,567,},{566,570,},{566,572,},{566,577,},{566,582,},{567,569,},{567,576,},{567,577,},{567,582,},{567,585,},{568,569,},{568,571,},{568,574,},{568,576,},{568,586,},{568,588,},{569,576,},{569,588,},{570,571,},{570,572,},{570,576,},{570,577,},{570,590,},{571,572,},{571,573,},{571,574,},{571,575,},{571,576,},{571,590,},{572,573,},{572,577,},{572,580,},{572,582,},{572,590,},{573,574,},{573,575,},{573,579,},{573,580,},{573,581,},{573,590,},{574,575,},{574,576,},{574,578,},{574,586,},{574,590,},{575,578,},{575,579,},{575,590,},{576,577,},{576,586,},{576,587,},{576,588,},{576,590,},{576,592,},{577,582,},{577,583,},{577,585,},{577,590,},{577,592,},{577,593,},{578,579,},{578,586,},{578,587,},{578,589,},{578,590,},{578,591,},{578,594,},{579,581,},{579,590,},{579,591,},{579,594,},{580,581,},{580,582,},{580,584,},{580,590,},{580,591,},{580,595,},{581,590,},{581,591,},{581,595,},{582,583,},{582,584,},{582,585,},{582,590,},{582,596,},{583,584,},{583,585,},{583,590,},{583,593,},{583,596,},{584,590,},{584,591,},{584,595,},{584,596,},{585,596,},{586,587,},{586,588,},{586,589,},{586,590,},{586,599,},{587,588,},{587,589,},{587,590,},{587,592,},{587,599,},{588,599,},{589,590,},{589,592,},{589,594,},{589,599,},{589,600,},{589,601,},{590,591,},{590,592,},{590,593,},{590,594,},{590,595,},{590,596,},{590,605,},{591,594,},{591,595,},{591,596,},{591,605,},{592,593,},{592,594,},{592,599,},{592,605,},{593,596,},{593,605,},{594,595,},{594,599,},{594,600,},{594,601,},{594,603,},{594,605,},{594,606,},{595,596,},{595,597,},{595,605,},{595,606,},{596,597,},{596,598,},{596,605,},{596,606,},{596,607,},{597,598,},{597,606,},{597,607,},{598,607,},{599,600,},{599,602,},{599,603,},{599,605,},{599,610,},{600,601,},{600,602,},{600,603,},{600,610,},{600,611,},{601,602,},{601,603,},{601,606,},{601,611,},{602,610,},{602,611,},{603,605,},{603,606,},{603,610,},{603,611,},{603,612,},{604,606,},{604,607,},{604,608,},{604,609,},{604,612,},{605,606,},{605,607,},{605,610,},{605,613,},{606,607,},{606,610,},{606,612,},{606,613,},{607,608,},{607,612,},{607,613,},{608,609,},{608,612,},{608,613,},{609,612,},{609,613,},{610,611,},{610,612,},{610,613,},{610,614,},{611,612,},{611,614,},{612,613,},{612,614,},{612,615,},{613,614,},{613,615,},{614,615,},};
+int c2e_data[1770][6] = {{32,30,0,2,1,38,},{5,3,4,20,19,26,},{13,11,22,6,9,7,},{63,22,21,9,8,7,},{69,15,13,10,17,16,},{12,11,14,53,20,23,},{68,13,11,14,22,23,},{69,68,13,15,14,74,},{69,70,79,16,17,18,},{56,25,20,19,28,26,},{53,54,20,23,24,75,},{56,54,20,25,24,85,},{63,64,68,21,22,23,},{21,23,24,64,65,75,},{66,65,25,21,24,85,},{90,55,56,27,26,28,},{35,36,29,31,33,44,},{29,31,34,35,37,45,},{51,32,33,30,38,40,},{34,33,30,111,41,40,},{45,44,31,34,33,111,},{51,50,105,38,40,39,},{112,105,106,40,42,39,},{119,111,112,41,42,40,},{43,47,46,49,48,128,},{46,45,44,120,113,111,},{47,46,44,128,114,113,},{116,51,50,52,105,108,},{57,53,54,76,75,86,},{96,56,57,54,85,86,},{55,56,57,90,92,96,},{58,61,59,93,91,99,},{93,94,58,61,62,194,},{61,60,59,101,99,98,},{61,62,60,194,101,102,},{63,64,65,68,71,75,},{72,71,63,67,65,87,},{82,73,69,68,78,74,},{72,68,71,77,75,87,},{73,72,68,204,78,77,},{82,79,69,73,70,84,},{73,70,72,84,83,204,},{82,80,189,74,78,76,},{188,77,76,75,87,86,},{204,189,188,78,77,76,},{200,82,81,80,189,187,},{97,96,191,89,85,86,},{205,188,190,87,86,88,},{191,190,86,89,88,208,},{95,90,92,97,96,191,},{194,93,94,92,186,187,},{195,93,95,92,186,191,},{101,103,197,98,99,100,},{101,102,103,194,197,201,},{222,103,104,102,201,202,},{124,112,115,106,105,107,},{105,108,107,116,115,133,},{126,124,106,110,107,139,},{106,110,109,126,125,237,},{109,108,107,146,138,133,},{110,109,107,237,139,138,},{124,119,121,112,111,115,},{130,123,120,118,113,111,},{123,121,111,118,115,140,},{132,130,128,118,114,113,},{149,132,131,118,117,114,},{149,118,117,115,140,134,},{127,124,119,123,121,140,},{127,126,123,119,122,244,},{130,129,120,123,122,244,},{127,126,124,244,140,139,},{151,142,143,135,133,136,},{147,143,133,141,136,156,},{146,145,231,138,133,137,},{147,145,232,133,141,137,},{150,148,153,134,141,135,},{150,149,249,141,134,140,},{153,151,141,135,136,156,},{238,232,231,141,138,137,},{245,238,237,141,139,138,},{249,245,244,141,140,139,},{142,144,143,152,151,154,},{144,145,143,159,154,155,},{147,145,143,232,156,155,},{234,159,160,155,154,158,},{252,232,233,156,155,157,},{234,233,256,155,158,157,},{253,252,256,158,156,157,},{268,176,178,162,161,163,},{174,169,171,165,164,168,},{170,171,269,164,167,168,},{176,173,172,167,166,165,},{269,173,174,167,165,168,},{176,179,269,172,173,174,},{180,179,172,175,174,288,},{273,177,176,178,267,268,},{177,176,181,275,267,271,},{270,269,176,180,179,288,},{176,180,181,270,271,293,},{288,283,284,183,184,182,},{290,283,285,183,182,185,},{198,194,202,192,186,187,},{211,199,195,193,191,186,},{199,198,225,193,186,192,},{203,200,207,193,187,189,},{225,203,202,193,192,187,},{207,206,204,193,189,188,},{206,205,188,193,190,209,},{211,193,191,190,209,208,},{197,198,194,222,201,202,},{211,210,216,199,195,196,},{222,214,215,197,196,198,},{216,215,196,199,198,225,},{217,216,210,212,211,312,},{220,217,323,213,210,212,},{223,222,214,219,215,228,},{226,225,215,217,216,312,},{322,226,227,217,215,218,},{227,229,332,215,218,221,},{336,219,221,215,228,229,},{220,217,218,323,322,331,},{336,330,332,219,221,218,},{336,224,223,222,229,228,},{230,226,225,325,313,312,},{226,229,227,324,322,332,},{230,226,229,325,324,345,},{238,239,252,231,232,233,},{240,239,236,231,233,258,},{236,235,233,264,258,257,},{243,238,237,254,248,245,},{360,246,247,241,237,242,},{361,246,248,241,243,237,},{243,238,239,254,252,259,},{355,240,243,239,258,259,},{360,242,241,240,353,352,},{355,352,243,240,241,361,},{254,249,251,245,244,248,},{251,250,361,248,244,246,},{262,253,255,252,256,260,},{254,255,252,377,259,260,},{262,263,388,256,260,261,},{357,264,265,258,257,261,},{377,355,356,259,258,260,},{388,356,357,260,258,261,},{358,357,266,264,265,391,},{278,273,272,267,268,280,},{278,275,267,272,271,299,},{293,270,269,271,288,289,},{272,269,271,291,289,299,},{278,273,274,280,279,282,},{278,276,274,309,282,281,},{277,278,275,398,298,299,},{398,277,278,276,308,309,},{294,288,290,284,283,285,},{295,294,286,284,285,301,},{305,287,286,285,302,301,},{297,293,292,288,289,300,},{297,294,288,292,290,303,},{404,291,292,289,299,300,},{399,297,296,293,300,298,},{306,295,297,294,301,303,},{306,304,399,295,297,296,},{399,398,404,298,300,299,},{408,305,306,302,303,301,},{413,306,307,304,399,401,},{413,408,409,306,307,305,},{400,398,405,310,308,309,},{419,400,402,310,311,308,},{312,314,313,328,325,349,},{328,326,315,321,316,444,},{456,317,316,319,441,443,},{318,316,319,460,442,443,},{318,321,316,462,442,444,},{455,456,460,317,318,319,},{461,455,457,318,317,320,},{335,331,329,322,323,343,},{346,332,335,324,329,322,},{327,323,326,340,339,440,},{328,327,323,449,342,340,},{329,328,323,479,343,342,},{346,345,324,329,325,350,},{329,328,325,479,350,349,},{328,327,326,449,444,440,},{336,338,346,330,332,335,},{338,337,452,330,335,334,},{334,333,331,447,341,340,},{452,341,343,334,335,331,},{453,447,450,341,344,340,},{480,450,449,344,342,340,},{485,452,453,343,341,344,},{485,480,479,344,343,342,},{486,346,347,345,350,351,},{462,463,481,348,349,351,},{479,481,486,349,350,351,},{370,360,365,353,352,359,},{361,363,378,352,355,357,},{352,357,359,363,365,392,},{375,366,370,354,353,359,},{396,371,375,358,354,359,},{355,356,357,377,378,388,},{396,358,357,359,391,392,},{362,360,364,382,367,368,},{386,362,360,365,367,370,},{376,380,361,362,365,386,},{361,363,365,378,380,392,},{366,369,370,372,375,438,},{382,386,367,368,370,435,},{369,368,370,438,432,435,},{499,374,371,375,395,396,},{437,438,372,373,375,495,},{374,373,375,499,493,495,},{383,387,504,376,379,381,},{376,381,380,387,386,514,},{390,388,377,381,378,393,},{379,377,381,504,389,390,},{381,378,380,393,392,514,},{434,435,509,382,385,386,},{384,383,386,507,502,503,},{383,387,386,504,503,514,},{506,507,384,385,386,509,},{394,392,391,515,397,396,},{394,392,393,515,514,520,},{500,499,397,395,396,515,},{414,399,403,398,404,406,},{420,403,400,398,406,405,},{424,414,413,403,401,399,},{422,419,418,402,401,400,},{424,418,420,401,403,400,},{535,414,415,406,404,407,},{413,415,425,408,409,411,},{416,415,539,412,408,411,},{425,423,529,411,409,410,},{539,530,529,412,411,410,},{424,425,535,413,414,415,},{547,417,416,415,540,539,},{427,422,424,419,418,420,},{429,427,536,421,419,420,},{422,424,425,427,428,535,},{430,428,422,426,425,542,},{426,425,423,542,531,529,},{429,427,428,536,535,541,},{431,429,428,555,543,541,},{431,430,428,559,543,542,},{495,433,432,435,437,438,},{436,433,432,496,439,437,},{433,434,435,494,495,509,},{436,433,434,496,494,510,},{451,448,446,440,443,468,},{480,449,450,444,445,440,},{489,450,451,445,446,440,},{464,460,442,446,443,468,},{482,462,464,444,442,446,},{489,480,482,445,444,446,},{453,454,489,447,450,451,},{461,460,455,457,456,466,},{458,457,456,474,467,466,},{571,458,459,456,467,469,},{461,465,460,477,466,472,},{465,464,460,584,472,468,},{462,465,463,483,481,491,},{483,482,462,465,464,584,},{474,475,571,466,467,469,},{591,475,476,469,466,470,},{476,478,466,470,473,618,},{477,478,631,466,472,473,},{583,585,624,468,471,473,},{631,584,585,472,468,473,},{592,591,471,469,470,617,},{471,470,473,624,617,618,},{571,573,474,475,476,591,},{485,486,488,479,480,481,},{490,488,480,484,481,492,},{490,489,484,480,482,586,},{484,483,481,632,492,491,},{484,483,482,632,586,584,},{490,488,485,487,486,492,},{501,499,493,498,495,517,},{511,509,494,497,495,516,},{496,494,497,577,510,511,},{498,497,495,651,517,516,},{500,501,499,523,515,517,},{508,507,502,505,503,518,},{521,505,504,503,518,514,},{508,506,507,512,509,518,},{512,511,509,652,518,516,},{510,513,511,578,577,653,},{661,512,513,511,652,653,},{524,520,522,515,514,519,},{522,521,662,519,514,518,},{658,523,524,517,515,519,},{658,651,654,517,519,516,},{662,654,652,519,518,516,},{688,526,525,528,682,684,},{525,528,527,684,683,694,},{548,544,539,533,530,529,},{563,542,545,531,534,529,},{710,545,544,534,533,529,},{568,560,561,532,533,531,},{561,563,710,531,533,534,},{556,536,537,535,541,545,},{738,556,557,537,538,536,},{554,547,552,540,546,539,},{710,548,551,544,539,545,},{552,551,739,539,546,545,},{565,555,556,543,545,541,},{565,559,563,543,542,545,},{554,553,552,547,550,726,},{720,708,710,549,548,551,},{721,718,549,552,550,726,},{721,720,552,549,551,739,},{565,566,743,555,556,558,},{738,743,748,556,557,558,},{559,563,564,565,567,744,},{707,568,569,561,562,560,},{716,569,570,562,560,564,},{707,710,714,561,562,563,},{714,716,562,563,564,744,},{743,744,565,566,567,766,},{571,572,573,588,591,597,},{572,574,573,598,597,620,},{575,574,573,781,621,620,},{582,580,576,579,578,667,},{579,578,577,667,655,653,},{582,581,580,671,667,666,},{627,624,587,583,585,637,},{634,631,584,587,585,637,},{639,632,634,586,584,587,},{601,589,590,588,594,596,},{589,588,593,606,594,600,},{588,591,593,597,600,622,},{603,602,592,589,591,617,},{602,606,589,591,593,622,},{601,606,616,594,596,600,},{595,598,596,609,607,615,},{609,610,595,598,599,782,},{596,598,600,615,616,783,},{598,597,600,783,620,622,},{648,605,606,601,614,616,},{628,603,602,606,617,622,},{603,604,606,625,628,644,},{605,606,604,648,641,644,},{614,616,648,607,608,613,},{609,607,613,783,615,616,},{608,612,611,647,646,798,},{608,611,613,646,648,799,},{609,613,610,783,782,793,},{792,793,610,611,613,799,},{630,624,638,623,617,618,},{626,628,777,617,619,622,},{626,630,779,617,619,623,},{779,623,619,618,638,636,},{621,619,622,786,775,777,},{781,783,786,620,621,622,},{630,624,627,638,637,809,},{627,625,628,807,642,644,},{629,628,626,817,778,777,},{629,626,630,824,778,779,},{808,807,629,627,628,817,},{808,809,824,627,629,630,},{633,635,631,779,636,638,},{635,634,631,809,638,637,},{640,639,632,635,634,809,},{645,641,644,649,648,818,},{806,807,811,642,643,644,},{813,811,643,645,644,818,},{647,646,648,802,798,799,},{803,802,647,650,648,819,},{831,649,650,648,818,819,},{678,658,660,654,657,651,},{839,660,659,657,656,651,},{661,663,668,652,653,656,},{663,662,677,652,656,654,},{667,668,788,653,655,656,},{839,677,678,656,657,654,},{665,661,663,670,668,841,},{665,664,661,854,670,669,},{665,663,662,841,679,677,},{789,671,673,667,669,666,},{789,788,667,669,668,840,},{854,669,670,668,840,841,},{789,788,673,671,672,840,},{790,788,671,674,672,842,},{855,840,842,673,674,672,},{869,856,855,675,674,673,},{869,870,875,674,675,676,},{847,839,841,678,679,677,},{859,848,847,680,679,678,},{864,849,848,681,680,678,},{682,684,683,688,687,694,},{682,683,686,687,692,695,},{682,686,685,692,690,735,},{688,687,693,697,694,696,},{687,692,693,695,696,890,},{699,698,689,691,690,734,},{700,698,689,692,690,735,},{890,700,701,692,689,693,},{702,699,698,772,736,734,},{891,700,702,698,735,736,},{890,891,700,701,702,896,},{938,704,703,706,917,918,},{945,937,938,705,704,706,},{715,713,707,711,709,730,},{707,710,712,714,717,745,},{763,715,717,711,707,712,},{711,709,708,730,723,719,},{720,724,708,710,712,745,},{763,711,708,712,723,724,},{762,715,714,716,742,744,},{715,714,717,763,742,745,},{721,718,724,752,726,728,},{718,722,724,727,728,755,},{718,725,722,729,727,756,},{730,731,763,719,723,724,},{725,719,724,732,731,977,},{752,721,720,724,739,745,},{725,722,724,756,755,977,},{726,727,728,750,752,755,},{764,763,733,730,731,978,},{984,978,977,733,732,731,},{891,771,772,735,736,734,},{892,771,773,735,734,737,},{749,747,738,746,741,759,},{748,749,738,743,746,768,},{751,750,739,741,740,754,},{750,752,739,740,745,755,},{741,740,745,758,754,755,},{746,741,745,759,758,979,},{766,761,762,743,742,744,},{761,763,767,742,743,745,},{743,746,745,768,767,979,},{753,751,750,760,757,754,},{760,758,754,757,755,980,},{985,757,756,755,980,977,},{760,759,758,1004,980,979,},{765,761,762,769,766,770,},{765,761,763,769,767,982,},{990,764,765,763,978,982,},{1006,769,768,767,982,979,},{893,891,898,774,771,772,},{893,892,774,771,773,999,},{785,786,793,775,776,777,},{795,785,787,776,775,780,},{776,780,777,795,793,820,},{825,780,778,777,820,817,},{793,785,786,782,781,783,},{795,785,787,782,781,784,},{871,791,790,788,844,842,},{801,799,792,797,793,821,},{794,797,792,995,800,801,},{797,795,793,1057,821,820,},{995,994,794,797,796,1062,},{797,796,795,1062,1057,1056,},{798,801,799,805,802,821,},{995,800,798,801,804,805,},{803,805,802,837,819,821,},{803,804,805,836,837,995,},{812,811,806,808,807,817,},{810,806,808,815,812,827,},{829,809,810,808,824,827,},{815,812,811,827,822,817,},{832,813,814,811,818,821,},{815,814,811,1108,822,821,},{815,813,814,833,832,1108,},{1120,815,816,813,833,834,},{825,826,1057,817,820,821,},{828,826,1111,823,817,821,},{1121,828,827,823,822,817,},{837,831,832,819,818,821,},{1121,1108,1111,822,823,821,},{830,829,1121,824,828,827,},{828,825,826,1059,1057,1111,},{838,837,835,831,832,1112,},{1120,833,834,832,1108,1110,},{1137,834,835,832,1110,1112,},{996,995,836,838,837,1112,},{854,847,846,841,840,839,},{858,846,853,840,839,845,},{1078,852,851,844,843,839,},{852,853,1092,839,844,845,},{873,855,858,842,840,845,},{1092,871,873,844,842,845,},{854,858,862,846,847,853,},{859,862,868,847,848,853,},{864,868,889,848,849,853,},{849,850,853,888,889,1071,},{1079,851,850,853,1070,1071,},{1078,1079,1092,851,852,853,},{882,860,862,857,854,858,},{869,873,878,855,856,858,},{882,857,856,858,874,878,},{863,865,879,859,860,861,},{882,863,868,860,859,862,},{863,865,868,879,882,902,},{1041,887,889,866,864,868,},{900,902,1052,865,867,868,},{1038,1041,866,867,868,1052,},{875,878,869,870,873,886,},{1096,883,886,872,870,873,},{1091,1092,1096,871,872,873,},{880,881,1098,874,876,877,},{1103,881,882,877,874,878,},{875,877,878,884,886,1103,},{901,902,879,880,882,1099,},{1098,1099,880,881,882,1103,},{1095,1096,1105,883,885,886,},{885,884,886,1105,1102,1103,},{1071,888,887,889,1039,1041,},{896,897,890,891,895,899,},{893,891,895,1036,898,899,},{1035,893,894,892,999,1002,},{1187,1035,1036,894,893,895,},{903,900,902,1054,1052,1156,},{901,904,902,1100,1099,1157,},{904,903,902,1182,1157,1156,},{967,965,905,907,906,1211,},{907,908,906,1233,1211,1212,},{910,913,909,1251,1246,1248,},{1255,911,913,909,1247,1248,},{914,910,913,1252,1251,1263,},{1260,1254,1255,912,911,913,},{917,915,916,922,921,927,},{941,917,920,915,922,925,},{938,917,916,918,927,929,},{1242,940,941,919,917,920,},{941,925,922,921,933,927,},{961,935,931,926,923,921,},{935,933,1272,926,921,925,},{972,970,1272,924,926,925,},{944,938,936,927,929,949,},{952,939,941,930,927,933,},{953,939,942,930,934,927,},{1279,942,944,934,936,927,},{948,945,928,936,929,949,},{960,946,947,931,928,932,},{948,947,963,928,936,932,},{950,951,960,930,931,932,},{961,931,935,930,950,954,},{958,951,963,936,930,932,},{935,930,933,954,952,1272,},{958,953,1279,930,936,934,},{937,938,944,945,948,949,},{953,952,942,939,941,1270,},{942,940,941,1243,1242,1270,},{1310,1279,1278,944,943,942,},{959,950,951,962,960,964,},{959,958,951,1318,964,963,},{956,953,952,1277,1274,1270,},{1291,954,956,952,1272,1274,},{1304,956,957,953,1277,1278,},{958,957,953,1310,1279,1278,},{1290,1291,954,955,956,1302,},{1305,1304,956,958,957,1310,},{959,956,958,1306,1305,1318,},{1221,966,969,965,1209,1214,},{1234,968,967,965,1213,1211,},{1350,969,968,965,1214,1213,},{1271,1273,970,971,973,1283,},{1289,972,970,973,1272,1273,},{971,973,974,1283,1284,1293,},{976,971,974,1285,1284,1298,},{1290,1289,972,975,973,1294,},{984,986,991,977,978,983,},{986,985,1010,983,977,980,},{989,987,1005,981,978,979,},{991,987,1007,978,983,979,},{989,990,1020,978,981,982,},{1010,1007,1004,983,980,979,},{1020,1006,1005,982,981,979,},{1022,989,991,987,1005,1007,},{1014,1012,1022,988,991,989,},{1014,1016,1392,988,991,993,},{1016,1015,988,993,992,1395,},{1063,1062,994,997,995,1114,},{1144,996,998,995,1112,1115,},{1419,997,998,995,1114,1115,},{1034,1033,999,1001,1000,1045,},{1035,1033,1046,1002,999,1000,},{1002,1001,1000,1126,1046,1045,},{1002,1003,1001,1189,1126,1127,},{1393,1010,1011,1007,1004,1009,},{1026,1023,1020,1008,1006,1005,},{1022,1024,1393,1005,1007,1009,},{1488,1023,1024,1008,1005,1009,},{1017,1012,1013,1023,1021,1029,},{1018,1014,1012,1393,1024,1022,},{1017,1012,1018,1488,1023,1024,},{1017,1013,1015,1029,1028,1396,},{1019,1013,1015,1030,1028,1398,},{1018,1014,1016,1393,1392,1401,},{1016,1015,1018,1401,1395,1397,},{1488,1017,1015,1018,1396,1397,},{1493,1027,1026,1025,1023,1020,},{1493,1025,1023,1021,1032,1029,},{1489,1030,1029,1028,1398,1396,},{1493,1489,1504,1029,1032,1030,},{1504,1503,1523,1030,1032,1031,},{1037,1034,1033,1128,1050,1045,},{1035,1033,1036,1187,1046,1047,},{1038,1040,1042,1051,1053,1074,},{1038,1044,1040,1055,1051,1076,},{1052,1053,1038,1041,1042,1154,},{1069,1072,1039,1040,1042,1074,},{1039,1041,1042,1071,1072,1154,},{1044,1043,1040,1177,1076,1075,},{1189,1126,1127,1046,1049,1045,},{1434,1127,1128,1049,1050,1045,},{1188,1187,1192,1048,1046,1047,},{1190,1188,1195,1050,1046,1048,},{1190,1189,1434,1046,1050,1049,},{1055,1051,1053,1076,1074,1166,},{1054,1052,1053,1156,1154,1163,},{1055,1054,1053,1184,1166,1163,},{1056,1061,1057,1064,1062,1117,},{1131,1058,1060,1057,1109,1113,},{1132,1058,1061,1057,1109,1117,},{1060,1059,1057,1141,1113,1111,},{1420,1063,1064,1062,1114,1117,},{1149,1131,1133,1066,1068,1065,},{1152,1148,1149,1067,1068,1066,},{1073,1069,1072,1077,1074,1167,},{1070,1071,1072,1079,1080,1154,},{1082,1080,1073,1070,1072,1167,},{1177,1076,1075,1074,1166,1162,},{1077,1075,1074,1179,1167,1162,},{1093,1092,1078,1081,1079,1155,},{1081,1079,1080,1155,1154,1161,},{1173,1081,1084,1080,1161,1169,},{1639,1082,1083,1080,1167,1168,},{1083,1084,1080,1643,1168,1169,},{1172,1173,1081,1083,1084,1643,},{1088,1086,1085,1627,1135,1132,},{1639,1088,1087,1085,1135,1134,},{1644,1089,1088,1086,1628,1627,},{1089,1086,1090,1653,1628,1629,},{1097,1096,1091,1094,1092,1158,},{1174,1093,1094,1092,1155,1158,},{1097,1095,1096,1106,1105,1158,},{1104,1103,1098,1101,1099,1159,},{1101,1100,1099,1200,1159,1157,},{1107,1105,1102,1104,1103,1159,},{1665,1106,1107,1105,1158,1159,},{1120,1123,1140,1108,1110,1118,},{1143,1121,1123,1111,1108,1118,},{1131,1136,1150,1109,1113,1118,},{1630,1132,1136,1117,1109,1118,},{1137,1140,1147,1110,1112,1118,},{1150,1141,1143,1113,1111,1118,},{1425,1145,1144,1116,1115,1112,},{1145,1147,1443,1112,1116,1118,},{1429,1419,1421,1115,1114,1118,},{1420,1421,1630,1114,1117,1118,},{1443,1425,1429,1116,1115,1118,},{1140,1120,1119,1123,1124,1130,},{1153,1122,1123,1119,1125,1130,},{1122,1123,1121,1153,1142,1143,},{1138,1140,1124,1127,1130,1435,},{1620,1152,1151,1129,1128,1125,},{1152,1153,1636,1125,1129,1130,},{1622,1434,1435,1128,1127,1130,},{1636,1620,1622,1129,1128,1130,},{1636,1149,1150,1133,1131,1136,},{1635,1626,1627,1133,1135,1132,},{1626,1630,1636,1132,1133,1136,},{1635,1634,1639,1135,1133,1134,},{1139,1137,1140,1447,1146,1147,},{1433,1435,1447,1138,1139,1140,},{1148,1150,1153,1141,1142,1143,},{1146,1145,1147,1447,1439,1443,},{1636,1152,1153,1149,1148,1150,},{1174,1155,1158,1154,1161,1170,},{1182,1157,1156,1154,1165,1163,},{1201,1157,1160,1154,1165,1171,},{1158,1160,1154,1667,1170,1171,},{1669,1200,1201,1159,1157,1160,},{1665,1667,1669,1158,1159,1160,},{1173,1176,1650,1161,1169,1171,},{1667,1174,1176,1170,1161,1171,},{1177,1180,1623,1162,1166,1171,},{1641,1179,1180,1167,1162,1171,},{1181,1184,1195,1163,1164,1166,},{1196,1181,1185,1164,1163,1171,},{1182,1185,1201,1163,1165,1171,},{1623,1195,1196,1166,1164,1171,},{1643,1639,1640,1168,1167,1169,},{1650,1640,1641,1169,1167,1171,},{1175,1176,1173,1672,1649,1650,},{1672,1175,1176,1174,1666,1667,},{1634,1620,1621,1178,1177,1179,},{1621,1623,1641,1177,1179,1180,},{1194,1196,1181,1183,1185,1205,},{1186,1181,1183,1197,1194,1206,},{1182,1183,1185,1199,1201,1205,},{1188,1187,1191,1197,1192,1193,},{1191,1190,1188,1624,1197,1195,},{1191,1190,1189,1624,1436,1434,},{1198,1194,1196,1207,1205,1690,},{1695,1197,1198,1194,1206,1207,},{1624,1623,1197,1195,1196,1689,},{1695,1198,1197,1196,1690,1689,},{1200,1199,1201,1669,1204,1205,},{1203,1200,1199,1670,1208,1204,},{1203,1202,1199,1701,1208,1207,},{1670,1669,1204,1208,1205,1691,},{1701,1208,1207,1205,1691,1690,},{1221,1216,1209,1214,1210,1227,},{1237,1215,1212,1210,1228,1224,},{1350,1214,1213,1210,1227,1226,},{1351,1213,1215,1210,1226,1228,},{1235,1233,1237,1211,1215,1212,},{1235,1234,1351,1215,1211,1213,},{1222,1217,1216,1232,1228,1223,},{1221,1220,1216,1350,1227,1226,},{1222,1220,1216,1351,1228,1226,},{1219,1217,1218,1231,1230,1331,},{1222,1217,1219,1232,1231,1343,},{1222,1221,1219,1357,1343,1341,},{1222,1221,1220,1357,1351,1350,},{1239,1228,1225,1223,1232,1229,},{1239,1237,1236,1228,1225,1224,},{1335,1239,1238,1232,1230,1229,},{1335,1331,1343,1230,1232,1231,},{1782,1337,1335,1240,1239,1238,},{1337,1338,1796,1238,1240,1241,},{1243,1242,1244,1276,1270,1271,},{1281,1276,1245,1243,1244,1287,},{1253,1251,1265,1246,1250,1248,},{1255,1257,1264,1247,1248,1249,},{1265,1264,1863,1248,1250,1249,},{1268,1252,1253,1251,1263,1265,},{1260,1262,1254,1255,1259,1266,},{1254,1256,1259,1261,1262,1325,},{1264,1266,1255,1257,1259,1864,},{1869,1258,1256,1259,1324,1325,},{1258,1257,1259,1869,1861,1864,},{1269,1268,1879,1267,1263,1265,},{1878,1265,1264,1266,1863,1864,},{1879,1878,1265,1267,1266,1882,},{1276,1282,1270,1271,1275,1288,},{1277,1282,1307,1270,1274,1275,},{1283,1288,1271,1273,1275,1296,},{1272,1273,1275,1289,1292,1296,},{1307,1291,1292,1274,1272,1275,},{1808,1281,1276,1282,1287,1288,},{1315,1304,1307,1278,1277,1282,},{1313,1312,1803,1281,1278,1280,},{1808,1313,1315,1281,1278,1282,},{1283,1284,1288,1293,1296,1299,},{1389,1285,1284,1288,1298,1299,},{1789,1286,1285,1288,1388,1389,},{1808,1287,1286,1288,1788,1789,},{1302,1290,1291,1289,1294,1295,},{1291,1289,1292,1307,1295,1296,},{1301,1299,1297,1293,1296,1893,},{1303,1302,1308,1297,1294,1295,},{1308,1307,1295,1297,1296,1893,},{1390,1389,1298,1300,1299,1891,},{1897,1300,1301,1299,1891,1893,},{1309,1305,1304,1320,1317,1310,},{1309,1304,1307,1317,1315,1894,},{1321,1306,1309,1305,1318,1320,},{1908,1308,1309,1307,1893,1894,},{1904,1319,1320,1316,1317,1310,},{1329,1328,1811,1316,1311,1314,},{1313,1312,1315,1808,1803,1805,},{1804,1805,1810,1312,1314,1315,},{1811,1810,1314,1316,1315,1892,},{1904,1316,1317,1315,1892,1894,},{1812,1797,1800,1323,1322,1327,},{1798,1799,1870,1322,1324,1326,},{1800,1799,1322,1327,1326,1886,},{1324,1325,1326,1869,1870,1881,},{1329,1328,1330,1905,1811,1812,},{1342,1344,1331,1332,1340,1373,},{1785,1335,1331,1340,1343,1344,},{1333,1332,1340,1383,1372,1373,},{1385,1334,1336,1333,1381,1382,},{1336,1333,1340,1791,1382,1383,},{1339,1334,1336,1386,1385,1788,},{1782,1785,1801,1335,1337,1340,},{1339,1336,1338,1788,1787,1803,},{1787,1791,1336,1338,1340,1806,},{1337,1338,1340,1796,1801,1806,},{1356,1358,1341,1342,1344,1373,},{1785,1357,1358,1343,1341,1344,},{1414,1415,1589,1345,1346,1347,},{1589,1592,1346,1347,1349,1596,},{1591,1592,1833,1346,1348,1349,},{1357,1358,1785,1350,1351,1353,},{1350,1354,1353,1360,1358,1917,},{1784,1785,1351,1352,1353,1873,},{1874,1873,1352,1354,1353,1917,},{1370,1362,1355,1361,1356,1374,},{1359,1355,1358,1368,1366,1916,},{1370,1366,1361,1355,1358,1918,},{1361,1356,1358,1374,1373,1918,},{1933,1359,1360,1358,1916,1917,},{1380,1363,1370,1362,1371,1374,},{1377,1379,1520,1363,1365,1367,},{1380,1379,1370,1363,1367,1925,},{1520,1365,1367,1364,1405,1407,},{1367,1364,1369,1924,1407,1408,},{1934,1370,1368,1366,1918,1916,},{1368,1367,1369,1932,1923,1924,},{1934,1368,1370,1367,1923,1925,},{1380,1375,1371,1374,1372,1384,},{1374,1372,1373,1384,1383,1918,},{1376,1380,1375,1387,1381,1384,},{1378,1377,1379,1528,1519,1520,},{1385,1387,1792,1381,1382,1384,},{1792,1791,1382,1384,1383,1918,},{1390,1388,1389,1790,1789,1891,},{1390,1391,1388,1898,1790,1793,},{1392,1393,1394,1401,1402,1501,},{1401,1402,1395,1397,1399,1501,},{1403,1402,1395,1400,1399,1969,},{1489,1488,1398,1396,1397,1498,},{1398,1397,1399,1506,1498,1501,},{1507,1506,1400,1398,1399,1969,},{1521,1413,1416,1405,1404,1409,},{1415,1417,1597,1404,1406,1410,},{1416,1417,1404,1409,1410,1962,},{1927,1520,1521,1407,1405,1409,},{1406,1408,1410,1596,1597,1939,},{1924,1929,1407,1408,1410,1939,},{1407,1409,1410,1927,1929,1962,},{1490,1494,1513,1411,1412,1414,},{1490,1496,1514,1411,1412,1417,},{1521,1491,1495,1413,1411,1416,},{1495,1496,1411,1416,1417,1962,},{1515,1513,1594,1412,1418,1414,},{1515,1514,1412,1418,1417,2010,},{1414,1415,1417,1589,1593,1597,},{1594,1593,1418,1414,1417,2010,},{1419,1424,1421,1431,1429,1685,},{1430,1431,1744,1419,1423,1424,},{1422,1420,1421,1631,1630,1684,},{1732,1422,1424,1421,1684,1685,},{1744,1729,1732,1423,1422,1424,},{1440,1442,1451,1425,1426,1427,},{1425,1427,1431,1442,1444,1477,},{1425,1432,1429,1445,1443,1686,},{1445,1444,1425,1432,1431,2052,},{1451,1453,1426,1427,1431,1477,},{1680,1428,1426,1431,1452,1453,},{1677,1680,1744,1428,1430,1431,},{1432,1431,1429,2052,1686,1685,},{1449,1447,1433,1438,1435,1686,},{1723,1448,1449,1437,1433,1438,},{1624,1622,1434,1436,1435,1683,},{1436,1438,1435,1698,1683,1686,},{1723,1437,1436,1438,1697,1698,},{1473,1441,1439,1445,1446,1449,},{1439,1445,1443,1449,1447,1686,},{1469,1473,1478,1441,1442,1445,},{1478,1477,1442,1445,1444,2052,},{1448,1446,1449,1723,1472,1473,},{1477,1455,1456,1451,1450,1453,},{1450,1454,1453,1457,1456,2053,},{1681,1680,1454,1452,1453,2053,},{1458,1455,1456,1479,1477,2054,},{2064,1457,1458,1456,2053,2054,},{1462,1459,1460,1475,1470,1482,},{1461,1462,1459,1720,1471,1475,},{1467,1463,1468,2069,1485,1486,},{1545,1546,1991,1464,1465,1466,},{1547,1546,1467,1464,1466,2064,},{1547,1548,2069,1464,1467,1468,},{1480,1478,1469,1476,1473,2061,},{1474,1469,1476,2070,1479,1480,},{2070,1474,1470,1476,1481,1483,},{1476,1475,1470,2074,1483,1482,},{1718,1719,1471,1472,1473,1723,},{1720,1719,1471,1475,1473,2060,},{1476,1475,1473,2074,2061,2060,},{1480,1478,1477,2061,2055,2052,},{2070,1479,1480,1477,2054,2055,},{1574,1573,1484,1487,1486,2080,},{1485,1487,1486,2071,2069,2080,},{1509,1489,1488,1497,1498,1502,},{1522,1499,1502,1491,1488,1497,},{1493,1489,1492,1504,1503,1523,},{1489,1492,1497,1503,1509,1527,},{1493,1490,1497,1534,1511,1518,},{1518,1514,1490,1497,1496,2012,},{1491,1497,1495,1522,1521,1963,},{1534,1493,1492,1497,1523,1527,},{1497,1495,1496,1963,1962,2012,},{1506,1509,1498,1501,1502,1971,},{1519,1522,1533,1499,1500,1502,},{1500,1501,1502,1530,1533,1971,},{1524,1527,1503,1505,1509,1541,},{1508,1505,1509,1992,1539,1541,},{1988,1507,1506,1509,1969,1971,},{1507,1508,1509,1986,1988,1992,},{1534,1523,1527,1511,1510,1518,},{1555,1516,1512,1510,1526,1525,},{1556,1512,1510,1518,1525,1527,},{1555,1556,2023,1512,1516,1518,},{2015,1516,1515,1514,2011,2010,},{2023,1516,1518,1514,2011,2012,},{2021,2016,2015,1517,1516,1515,},{1528,1529,1519,1520,1521,1927,},{1519,1522,1521,1533,1529,1963,},{1556,1525,1524,1527,1537,1541,},{1528,1531,1529,1928,1927,1961,},{1531,1530,1529,1967,1961,1960,},{1530,1533,1529,1971,1960,1963,},{1531,1532,1530,1973,1967,1970,},{1544,1543,1551,1535,1538,1536,},{1544,1549,1563,1535,1538,1542,},{1991,1545,1546,1539,1535,1540,},{1546,1549,1535,1540,1542,2065,},{1557,1537,1536,1542,1550,1553,},{1563,1551,1553,1538,1536,1542,},{1537,1541,1542,1556,1557,2095,},{1539,1540,1542,1991,1993,2065,},{1992,1993,1539,1541,1542,2095,},{1562,1563,1544,1548,1549,2081,},{2072,1547,1546,1549,2064,2065,},{1547,1548,1549,2069,2072,2081,},{1552,1550,1553,1566,1554,1557,},{1551,1552,1553,1559,1563,1566,},{1567,1566,1554,1558,1557,2102,},{1555,1556,1557,2023,2024,2095,},{1558,1555,1557,2025,2024,2102,},{1568,1566,1565,1559,1563,2103,},{1560,1561,1562,1569,1573,1579,},{1575,1569,1560,1564,1561,1581,},{1579,1580,1561,1562,1563,2081,},{1564,1561,1563,1581,1580,2101,},{1565,1564,1563,2112,2103,2101,},{1568,1567,1566,2124,2103,2102,},{1586,1577,1582,1570,1569,1576,},{1599,1571,1575,1569,1578,1581,},{1569,1573,1576,1579,1582,2082,},{2077,1584,1586,1572,1570,1576,},{2076,2077,1572,1574,1576,2093,},{2093,1574,1573,1576,2080,2082,},{1583,1577,1582,1587,1586,2151,},{1601,1599,2114,1578,1583,1581,},{1579,1582,1580,2082,2081,2104,},{2113,1581,1582,1580,2101,2104,},{2114,2113,1583,1581,1582,2151,},{2087,1585,1584,1586,2075,2077,},{1588,1585,1586,2088,2087,2152,},{2158,1588,1587,1586,2152,2151,},{1589,1595,1592,1598,1596,1940,},{1598,1597,1589,1595,1593,2013,},{1815,1818,1833,1590,1591,1592,},{1822,1818,1590,1595,1592,1940,},{1819,1822,1590,1594,1595,2019,},{1594,1595,1593,2019,2010,2013,},{1598,1596,1597,1940,1939,2013,},{2147,1600,1601,1599,2111,2114,},{2148,2147,2160,1600,1604,1601,},{1601,1602,1603,2158,2159,2163,},{1604,1601,1603,2160,2159,2168,},{1612,1617,1605,1608,1611,2037,},{1615,1617,2199,1605,1610,1611,},{1607,1609,1606,2032,1842,1843,},{1845,1843,1606,1610,1609,2179,},{2032,2027,1607,1609,1608,2036,},{1609,1608,1611,2180,2036,2037,},{1610,1609,1611,2199,2179,2180,},{2035,2037,2120,1612,1613,1617,},{1616,1613,1614,2119,2117,2134,},{1613,1614,1617,2117,2120,2136,},{2204,1616,1614,1617,2134,2136,},{2200,2199,1615,1618,1617,2220,},{1619,1616,1617,2205,2204,2221,},{1619,1618,1617,2228,2221,2220,},{1620,1621,1623,1634,1637,1641,},{1620,1625,1622,1638,1636,1687,},{1620,1623,1625,1637,1638,1692,},{1699,1624,1625,1622,1683,1687,},{1699,1624,1623,1625,1689,1692,},{1646,1635,1638,1627,1626,1633,},{1638,1636,1626,1633,1630,1687,},{1657,1644,1646,1628,1627,1633,},{1653,1655,1628,1629,1632,1659,},{1655,1657,1628,1632,1633,1738,},{1631,1629,1633,1734,1658,1661,},{1629,1632,1633,1659,1661,1738,},{1631,1633,1630,1734,1684,1687,},{1635,1634,1638,1646,1639,1642,},{1634,1637,1638,1641,1642,1692,},{1639,1640,1642,1643,1646,1652,},{1640,1641,1642,1650,1652,1692,},{1655,1644,1645,1643,1647,1651,},{1645,1643,1646,1738,1651,1652,},{1644,1645,1646,1655,1657,1738,},{1655,1654,1663,1647,1651,1648,},{1674,1649,1648,1652,1662,1664,},{1738,1663,1664,1651,1648,1652,},{1649,1650,1652,1672,1674,1692,},{1656,1653,1655,1660,1659,1737,},{1730,1728,1658,1660,1659,1737,},{1658,1659,1661,1728,1734,1738,},{1673,1674,1662,1663,1664,1738,},{1671,1669,1668,1665,1667,1693,},{1666,1668,1667,1675,1672,1693,},{1708,1670,1671,1669,1691,1693,},{1675,1672,1674,1693,1692,2245,},{1673,1676,1674,1739,1738,2247,},{2252,1676,1675,1674,2247,2245,},{1678,1677,1682,1751,1741,1745,},{1677,1680,1682,1744,1745,2056,},{1984,1748,1751,1679,1678,1682,},{2066,1983,1984,1681,1679,1682,},{2066,1681,1680,1682,2053,2056,},{1700,1698,2062,1683,1688,1686,},{1700,1699,2248,1688,1683,1687,},{1733,1732,2052,1686,1684,1685,},{1735,1733,2062,1688,1684,1686,},{1735,1734,2248,1684,1688,1687,},{1695,1700,1705,1689,1690,1694,},{1700,1699,1694,1689,1692,2248,},{1707,1701,1704,1691,1690,1692,},{1705,1704,1690,1694,1692,2248,},{1708,1707,1693,1691,1692,2245,},{1717,1696,1695,1700,1702,1705,},{1712,1717,1724,1696,1697,1700,},{1724,1723,1697,1700,1698,2062,},{1701,1703,1705,1706,1710,1727,},{1701,1705,1704,1710,1707,2248,},{1703,1702,1705,1727,1713,1717,},{1726,1727,1706,1709,1710,2254,},{1708,1709,1707,2251,2245,2246,},{1709,1710,1707,2254,2246,2248,},{1711,1712,1715,1718,1719,1723,},{1722,1719,1711,1717,1715,2062,},{1716,1711,1717,2089,1721,1722,},{1712,1717,1715,1724,1723,2062,},{1725,1727,1774,1713,1714,1717,},{2089,1716,1714,1717,1772,1774,},{2078,1720,1722,1719,2060,2062,},{2089,2075,2078,1721,1720,1722,},{1773,1774,2254,1725,1726,1727,},{1730,1728,1736,1757,1737,1740,},{1740,1738,1728,1736,1734,2249,},{1743,1746,1768,1729,1731,1736,},{1744,1746,1729,1732,1736,2058,},{1768,1755,1757,1731,1730,1736,},{1735,1733,1732,2062,2057,2052,},{1735,1732,1736,2290,2057,2058,},{1735,1736,1734,2290,2248,2249,},{1756,1757,2258,1737,1739,1740,},{2258,1739,1740,1738,2247,2249,},{1741,1742,1746,1747,1753,1762,},{1741,1746,1745,1753,1751,2264,},{1759,1762,1768,1742,1743,1746,},{2058,2056,1744,1746,1745,2264,},{2270,1761,1762,1752,1747,1753,},{1980,1984,1998,1748,1749,1751,},{1749,1750,1751,1996,1998,2004,},{1752,1750,1751,2005,2004,2262,},{1752,1753,1751,2270,2262,2264,},{1763,1767,1754,1755,1757,1768,},{1754,1756,1757,1765,1767,2258,},{1758,1759,1762,1763,1767,1768,},{1771,1764,1767,1760,1758,1762,},{2270,1769,1771,1761,1760,1762,},{1764,1766,1767,1770,1771,2284,},{1766,1765,1767,2284,2257,2258,},{1769,1770,1771,2269,2270,2284,},{1775,1772,1774,2090,2089,2291,},{2254,2255,1773,1774,1776,2292,},{2303,1775,1776,1774,2291,2292,},{2213,1779,1778,1777,2174,2172,},{2307,1780,1779,1777,2175,2174,},{2315,2307,2308,1780,1779,1781,},{1783,1782,1786,1871,1798,1802,},{1802,1801,1782,1786,1785,1920,},{1784,1783,1786,1875,1868,1871,},{1784,1786,1785,1875,1873,1920,},{1809,1788,1787,1795,1803,1807,},{1787,1795,1791,1807,1806,1920,},{1809,1808,1788,1795,1789,1895,},{1790,1795,1789,1901,1891,1895,},{1899,1898,1948,1790,1794,1793,},{1899,1901,1956,1790,1794,1795,},{1946,1794,1792,1791,1919,1918,},{1956,1794,1795,1791,1919,1920,},{1804,1807,1796,1797,1802,1813,},{1807,1806,1796,1802,1801,1920,},{1812,1813,1797,1800,1802,1911,},{1798,1799,1802,1870,1871,1887,},{1911,1800,1799,1802,1886,1887,},{1803,1807,1805,1809,1808,1895,},{1813,1810,1804,1807,1805,1895,},{1906,1811,1813,1810,1892,1895,},{1905,1906,1811,1812,1813,1911,},{1835,1815,1814,1823,1824,1831,},{1841,1825,1831,1816,1814,1823,},{1832,1833,1815,1817,1818,1932,},{1815,1817,1823,1832,1835,1937,},{1838,1839,1816,1820,1821,2048,},{1839,1841,1816,1821,1823,2181,},{1936,1932,1817,1822,1818,1940,},{1817,1822,1823,1936,1937,2184,},{2048,1820,1819,1821,2017,2018,},{2019,2018,1819,1822,1821,2177,},{1822,1821,1823,2184,2177,2181,},{1834,1835,1824,1829,1831,1958,},{1830,1831,1825,2191,1840,1841,},{1847,1849,1855,1826,1827,1828,},{1826,1828,1831,1849,1852,1943,},{2191,1830,1831,1826,1850,1852,},{1828,1829,1831,1942,1943,1958,},{1935,1937,1832,1834,1835,1958,},{2032,1837,1839,1836,1842,1843,},{1843,1846,1836,1839,1841,2181,},{1836,1840,1841,1844,1846,2191,},{1837,1839,1838,2032,2030,2048,},{2189,1844,1845,1843,2178,2179,},{2191,1844,1843,1846,2178,2181,},{1859,1853,1848,1847,1856,1854,},{1853,1847,1849,1856,1855,1944,},{1857,1858,1848,1850,1851,2188,},{1859,1858,1848,1853,1851,2195,},{1853,1849,1852,1944,1943,2336,},{1850,1851,1852,2188,2191,2194,},{1853,1851,1852,2195,2194,2336,},{2341,1859,1860,1858,2195,2196,},{1868,1872,1877,1861,1862,1867,},{1861,1867,1864,1872,1869,1884,},{1877,1876,1862,1867,1866,2342,},{1879,1878,1865,1863,1864,1882,},{1879,1880,1889,1863,1865,1867,},{1889,1865,1867,1864,1882,1884,},{1868,1872,1871,1877,1875,2329,},{1869,1870,1871,1881,1883,1887,},{1872,1869,1871,1884,1883,2329,},{1876,1874,1873,1944,1921,1917,},{1876,1875,1873,2328,1921,1920,},{1877,1876,1875,2342,2329,2328,},{1888,1887,1885,1881,1883,2330,},{2349,1889,1890,1884,1882,1885,},{1884,1885,1883,2349,2329,2330,},{1912,1911,1886,1888,1887,2330,},{1897,1903,1909,1891,1893,1896,},{1903,1901,2332,1891,1896,1895,},{1910,1904,1907,1894,1892,1896,},{1907,1906,2332,1896,1892,1895,},{1909,1908,1910,1896,1893,1894,},{1956,1899,1898,1901,1948,1952,},{1953,1951,1898,1902,1900,2281,},{1953,1952,1902,1898,1901,2331,},{1903,1902,1901,2356,2332,2331,},{1905,1907,1906,1914,1911,2332,},{1915,1912,1911,2354,2333,2330,},{2356,1913,1914,1911,2331,2332,},{2357,1915,1913,1911,2333,2331,},{2356,2357,2364,1913,1914,1915,},{1933,1938,1945,1916,1917,1922,},{1947,1934,1938,1918,1916,1922,},{1944,1945,2343,1917,1921,1922,},{1957,1946,1947,1919,1918,1922,},{2334,1956,1957,1920,1919,1922,},{2343,2328,2334,1921,1920,1922,},{1932,1938,1923,1924,1931,1941,},{1934,1938,1947,1923,1925,1931,},{1930,1924,1929,1940,1939,2013,},{1930,1924,1931,2185,1940,1941,},{1957,1926,1925,1931,1946,1947,},{1955,1957,1977,1926,1928,1931,},{1928,1927,1931,1977,1961,1965,},{1964,1962,1927,1930,1929,2013,},{1927,1930,1931,1964,1965,2185,},{2185,1936,1932,1938,1940,1941,},{1959,1942,1945,1935,1933,1938,},{1935,1938,1937,1959,1958,2337,},{2185,2184,1936,1938,1937,2337,},{1959,1958,1942,1945,1943,2337,},{1944,1945,1943,2343,2336,2337,},{1955,1957,1948,1949,1954,1977,},{1948,1952,1954,1956,1957,2334,},{1976,1977,1949,1950,1954,2276,},{2282,2275,2276,1951,1950,1954,},{2358,2281,2282,1953,1951,1954,},{2358,1953,1952,1954,2331,2334,},{1967,1971,1975,1960,1961,1963,},{1978,1975,2098,1961,1966,1963,},{1978,1977,1961,1966,1965,2368,},{2096,1963,1964,1962,2012,2013,},{1963,1964,1965,2096,2097,2185,},{2098,2097,1966,1963,1965,2368,},{1973,1975,2002,1967,1970,1971,},{1990,1969,1968,1972,1979,1985,},{1981,1985,1968,1970,1972,2003,},{1990,1988,1969,1972,1971,2098,},{1970,1972,1971,2003,2002,2098,},{2001,2003,1973,1974,1978,2009,},{2003,2002,1973,1978,1975,2098,},{1976,1974,1978,2277,2008,2009,},{1976,1978,1977,2277,2276,2368,},{2066,1987,1989,1983,1979,1984,},{1979,1985,1984,1990,1989,2265,},{1980,1982,1981,1997,1995,2001,},{1997,2000,1980,1982,1985,2009,},{2000,1998,1980,1985,1984,2265,},{2009,1982,1981,1985,2001,2003,},{2067,1991,1994,1987,1986,1990,},{1994,1992,1986,1990,1988,2098,},{1987,1990,1989,2067,2066,2265,},{2067,2065,1991,1994,1993,2105,},{1994,1992,1993,2098,2095,2105,},{2007,2004,1996,2000,1998,2265,},{1999,1996,2000,2277,2006,2007,},{1997,1999,2000,2008,2009,2277,},{2271,2005,2007,2004,2262,2265,},{2268,2271,2005,2006,2007,2277,},{2015,2020,2026,2010,2011,2014,},{2020,2019,2186,2010,2014,2013,},{2026,2023,2099,2014,2011,2012,},{2099,2096,2186,2014,2012,2013,},{2021,2026,2047,2015,2016,2020,},{2016,2017,2020,2045,2047,2049,},{2049,2048,2017,2020,2018,2182,},{2020,2019,2018,2186,2182,2177,},{2046,2047,2021,2022,2026,2051,},{2125,2050,2051,2025,2022,2026,},{2026,2023,2024,2099,2095,2106,},{2025,2026,2024,2125,2102,2106,},{2044,2034,2038,2028,2027,2033,},{2036,2038,2182,2027,2032,2033,},{2039,2044,2028,2031,2033,2051,},{2029,2033,2030,2047,2045,2049,},{2047,2046,2029,2033,2031,2051,},{2030,2033,2032,2049,2048,2182,},{2120,2035,2034,2037,2040,2043,},{2044,2043,2034,2038,2037,2222,},{2038,2036,2037,2182,2180,2222,},{2125,2041,2039,2044,2050,2051,},{2130,2116,2121,2042,2040,2044,},{2121,2120,2040,2044,2043,2222,},{2123,2125,2130,2041,2042,2044,},{2086,2061,2063,2055,2052,2059,},{2062,2063,2294,2052,2057,2059,},{2064,2068,2073,2053,2054,2059,},{2068,2066,2059,2053,2056,2266,},{2070,2073,2086,2054,2055,2059,},{2290,2057,2058,2056,2263,2264,},{2294,2057,2059,2056,2263,2266,},{2074,2079,2086,2060,2061,2063,},{2294,2078,2079,2062,2060,2063,},{2073,2072,2064,2068,2065,2107,},{2067,2068,2065,2378,2105,2107,},{2378,2067,2068,2066,2265,2266,},{2071,2069,2072,2092,2080,2081,},{2094,2071,2070,2073,2084,2086,},{2094,2092,2071,2073,2072,2107,},{2076,2074,2077,2093,2084,2085,},{2074,2079,2077,2086,2085,2155,},{2091,2087,2075,2079,2077,2155,},{2089,2091,2075,2078,2079,2294,},{2080,2083,2081,2094,2092,2107,},{2094,2093,2080,2083,2082,2155,},{2083,2082,2081,2155,2107,2104,},{2084,2086,2085,2094,2093,2155,},{2166,2088,2091,2087,2152,2155,},{2304,2090,2091,2088,2165,2166,},{2090,2091,2089,2304,2291,2294,},{2379,2098,2100,2095,2105,2108,},{2099,2100,2095,2383,2106,2108,},{2099,2096,2097,2186,2185,2369,},{2377,2098,2099,2097,2368,2369,},{2383,2377,2379,2099,2098,2100,},{2150,2112,2115,2103,2101,2108,},{2115,2113,2156,2108,2101,2104,},{2124,2126,2150,2102,2103,2108,},{2383,2125,2126,2106,2102,2108,},{2386,2155,2156,2107,2108,2104,},{2379,2378,2386,2105,2108,2107,},{2110,2109,2115,2141,2127,2131,},{2109,2112,2115,2128,2131,2150,},{2149,2139,2141,2111,2110,2115,},{2161,2147,2149,2114,2111,2115,},{2114,2115,2113,2161,2151,2156,},{2116,2118,2122,2127,2131,2141,},{2130,2129,2116,2121,2120,2222,},{2116,2122,2120,2131,2129,2223,},{2141,2132,2137,2118,2117,2122,},{2137,2136,2117,2122,2120,2223,},{2124,2123,2126,2150,2128,2131,},{2123,2125,2126,2130,2131,2383,},{2130,2131,2129,2383,2222,2223,},{2140,2138,2145,2135,2132,2133,},{2138,2141,2146,2132,2133,2137,},{2145,2146,2217,2133,2135,2137,},{2216,2203,2204,2135,2134,2136,},{2217,2216,2135,2137,2136,2223,},{2149,2142,2146,2139,2138,2141,},{2148,2147,2160,2144,2142,2143,},{2147,2149,2161,2142,2143,2146,},{2160,2161,2209,2143,2144,2146,},{2217,2145,2144,2146,2208,2209,},{2158,2159,2163,2151,2152,2153,},{2171,2159,2162,2153,2151,2157,},{2160,2161,2209,2151,2154,2156,},{2160,2162,2210,2151,2154,2157,},{2163,2167,2171,2152,2153,2157,},{2387,2166,2167,2155,2152,2157,},{2209,2210,2397,2154,2156,2157,},{2397,2386,2387,2156,2155,2157,},{2210,2160,2159,2162,2168,2171,},{2212,2165,2164,2163,2170,2169,},{2165,2163,2167,2305,2170,2171,},{2304,2305,2165,2166,2167,2387,},{2207,2210,2214,2168,2169,2171,},{2305,2212,2214,2170,2169,2171,},{2212,2214,2305,2172,2173,2176,},{2309,2213,2214,2174,2172,2176,},{2316,2175,2173,2176,2302,2305,},{2316,2307,2309,2175,2174,2176,},{2187,2184,2177,2183,2181,2339,},{2384,2187,2186,2183,2182,2177,},{2189,2192,2202,2178,2179,2183,},{2192,2191,2183,2178,2181,2339,},{2202,2199,2179,2183,2180,2224,},{2384,2183,2182,2180,2224,2222,},{2187,2185,2184,2371,2339,2337,},{2384,2186,2187,2185,2369,2371,},{2234,2190,2192,2188,2193,2198,},{2198,2194,2188,2192,2191,2339,},{2190,2192,2189,2234,2201,2202,},{2233,2234,2390,2193,2197,2198,},{2344,2197,2195,2194,2338,2336,},{2390,2197,2198,2194,2338,2339,},{2341,2344,2346,2195,2196,2197,},{2200,2202,2199,2230,2220,2224,},{2234,2201,2200,2202,2227,2230,},{2218,2216,2203,2206,2204,2225,},{2238,2206,2205,2204,2225,2221,},{2214,2215,2207,2210,2211,2405,},{2211,2208,2209,2219,2217,2400,},{2211,2209,2210,2400,2397,2405,},{2215,2213,2214,2310,2309,2405,},{2218,2217,2216,2399,2225,2223,},{2417,2218,2219,2217,2399,2400,},{2228,2231,2239,2220,2221,2226,},{2411,2230,2231,2224,2220,2226,},{2238,2239,2418,2221,2225,2226,},{2384,2383,2398,2222,2224,2223,},{2398,2401,2411,2223,2224,2226,},{2418,2399,2401,2225,2223,2226,},{2229,2227,2231,2241,2232,2235,},{2227,2230,2231,2234,2235,2411,},{2237,2239,2241,2228,2229,2231,},{2242,2241,2232,2236,2235,2424,},{2236,2233,2234,2392,2390,2412,},{2236,2234,2235,2412,2411,2424,},{2243,2241,2240,2237,2239,2425,},{2240,2238,2239,2419,2418,2425,},{2432,2244,2242,2241,2426,2424,},{2244,2243,2241,2437,2426,2425,},{2256,2253,2251,2250,2246,2245,},{2252,2253,2260,2245,2247,2250,},{2256,2254,2295,2246,2250,2248,},{2260,2258,2299,2250,2247,2249,},{2295,2290,2299,2248,2250,2249,},{2321,2255,2256,2254,2292,2295,},{2284,2285,2257,2258,2259,2298,},{2261,2257,2259,2286,2285,2453,},{2260,2258,2259,2299,2298,2452,},{2460,2261,2260,2259,2453,2452,},{2270,2274,2300,2262,2264,2267,},{2380,2271,2274,2265,2262,2267,},{2293,2290,2297,2265,2263,2264,},{2293,2294,2378,2263,2265,2266,},{2297,2300,2380,2264,2265,2267,},{2277,2279,2268,2271,2274,2380,},{2268,2273,2274,2278,2279,2474,},{2269,2270,2272,2284,2285,2298,},{2288,2285,2269,2273,2272,2455,},{2270,2274,2272,2300,2298,2456,},{2474,2273,2274,2272,2455,2456,},{2280,2275,2276,2283,2282,2373,},{2277,2276,2279,2380,2368,2372,},{2280,2276,2279,2373,2372,2479,},{2475,2474,2280,2278,2279,2479,},{2281,2283,2282,2359,2358,2373,},{2287,2286,2285,2464,2454,2453,},{2468,2289,2287,2285,2457,2454,},{2476,2288,2289,2285,2455,2457,},{2381,2293,2296,2290,2297,2301,},{2295,2296,2290,2461,2299,2301,},{2322,2303,2306,2292,2291,2296,},{2291,2294,2296,2304,2306,2388,},{2461,2321,2322,2295,2292,2296,},{2378,2381,2293,2294,2296,2388,},{2381,2380,2301,2297,2300,2481,},{2461,2299,2301,2298,2452,2458,},{2301,2300,2298,2481,2458,2456,},{2303,2302,2305,2320,2314,2316,},{2322,2320,2303,2306,2305,2408,},{2304,2306,2305,2388,2387,2408,},{2307,2308,2309,2315,2316,2324,},{2326,2324,2308,2313,2309,2409,},{2422,2310,2311,2309,2405,2406,},{2441,2311,2312,2309,2406,2407,},{2470,2312,2313,2309,2407,2409,},{2314,2317,2316,2322,2320,2408,},{2314,2319,2317,2323,2322,2497,},{2326,2324,2315,2318,2316,2409,},{2315,2318,2317,2326,2325,2496,},{2319,2315,2317,2327,2325,2497,},{2318,2317,2316,2496,2409,2408,},{2462,2461,2321,2323,2322,2497,},{2503,2327,2326,2325,2497,2496,},{2345,2342,2351,2328,2335,2329,},{2345,2343,2328,2335,2334,2374,},{2353,2330,2331,2329,2349,2350,},{2351,2350,2360,2329,2335,2331,},{2353,2354,2357,2330,2331,2333,},{2360,2358,2335,2331,2334,2374,},{2345,2343,2374,2336,2340,2337,},{2345,2344,2393,2340,2336,2338,},{2413,2374,2371,2340,2339,2337,},{2393,2390,2413,2340,2338,2339,},{2345,2341,2344,2347,2346,2393,},{2513,2347,2348,2346,2393,2394,},{2355,2353,2362,2349,2352,2350,},{2515,2351,2350,2352,2360,2362,},{2355,2353,2354,2362,2357,2366,},{2356,2363,2357,2365,2364,2367,},{2363,2357,2362,2367,2366,2534,},{2361,2359,2358,2489,2375,2373,},{2514,2360,2361,2358,2374,2375,},{2527,2514,2515,2361,2360,2362,},{2528,2527,2361,2363,2362,2534,},{2383,2377,2379,2369,2368,2370,},{2382,2379,2403,2368,2376,2370,},{2382,2380,2368,2376,2372,2484,},{2385,2383,2403,2376,2369,2370,},{2414,2384,2385,2371,2369,2376,},{2516,2413,2414,2374,2371,2376,},{2490,2376,2373,2372,2484,2479,},{2489,2490,2529,2373,2375,2376,},{2529,2514,2516,2375,2374,2376,},{2382,2379,2378,2403,2389,2386,},{2382,2378,2381,2389,2388,2498,},{2382,2381,2380,2498,2484,2481,},{2384,2385,2383,2414,2398,2403,},{2386,2388,2387,2402,2397,2408,},{2403,2402,2386,2389,2388,2498,},{2392,2390,2391,2412,2411,2424,},{2396,2390,2391,2415,2411,2429,},{2393,2390,2395,2516,2413,2414,},{2396,2390,2395,2415,2414,2540,},{2392,2396,2391,2434,2424,2429,},{2518,2513,2516,2394,2393,2395,},{2396,2394,2395,2519,2518,2540,},{2400,2404,2397,2423,2405,2410,},{2404,2402,2397,2499,2410,2408,},{2398,2404,2401,2416,2411,2430,},{2414,2416,2541,2398,2403,2404,},{2423,2417,2421,2400,2399,2404,},{2421,2418,2399,2404,2401,2430,},{2541,2403,2404,2402,2498,2499,},{2422,2423,2442,2405,2406,2410,},{2441,2442,2471,2406,2407,2410,},{2470,2471,2504,2407,2409,2410,},{2504,2499,2496,2410,2409,2408,},{2415,2414,2411,2540,2429,2428,},{2414,2416,2411,2541,2428,2430,},{2442,2420,2417,2421,2422,2423,},{2438,2419,2421,2418,2425,2430,},{2442,2436,2438,2420,2419,2421,},{2433,2432,2444,2427,2424,2426,},{2448,2433,2434,2427,2429,2424,},{2437,2439,2445,2425,2426,2431,},{2555,2438,2439,2430,2425,2431,},{2444,2445,2449,2426,2427,2431,},{2448,2449,2548,2427,2429,2431,},{2540,2541,2547,2428,2429,2430,},{2547,2548,2555,2429,2430,2431,},{2549,2448,2450,2434,2435,2433,},{2436,2440,2438,2443,2442,2556,},{2446,2445,2437,2440,2439,2564,},{2440,2438,2439,2556,2555,2564,},{2443,2441,2442,2472,2471,2556,},{2451,2449,2444,2447,2445,2565,},{2446,2447,2445,2573,2564,2565,},{2549,2548,2450,2448,2449,2563,},{2451,2450,2449,2569,2565,2563,},{2460,2461,2465,2452,2453,2458,},{2467,2464,2469,2459,2453,2454,},{2467,2465,2500,2453,2459,2458,},{2493,2468,2469,2457,2459,2454,},{2476,2474,2480,2457,2455,2456,},{2493,2485,2480,2459,2457,2456,},{2500,2481,2485,2458,2459,2456,},{2460,2462,2461,2466,2465,2497,},{2467,2466,2460,2463,2462,2509,},{2467,2466,2465,2509,2500,2497,},{2505,2504,2470,2473,2471,2557,},{2574,2472,2473,2471,2556,2557,},{2476,2475,2474,2487,2480,2479,},{2476,2475,2477,2492,2487,2488,},{2494,2492,2476,2478,2477,2524,},{2492,2487,2488,2480,2479,2483,},{2525,2488,2491,2483,2479,2486,},{2490,2491,2542,2479,2484,2486,},{2492,2495,2525,2480,2483,2486,},{2579,2493,2495,2485,2480,2486,},{2509,2500,2497,2485,2482,2481,},{2511,2497,2501,2482,2486,2481,},{2542,2501,2498,2486,2484,2481,},{2509,2511,2579,2482,2485,2486,},{2489,2488,2490,2529,2522,2523,},{2523,2525,2488,2490,2491,2542,},{2587,2494,2492,2495,2524,2525,},{2494,2493,2495,2587,2577,2579,},{2512,2503,2508,2497,2496,2502,},{2504,2508,2559,2496,2499,2502,},{2609,2511,2512,2501,2497,2502,},{2559,2541,2543,2499,2498,2502,},{2542,2543,2609,2498,2501,2502,},{2593,2506,2503,2508,2510,2512,},{2505,2504,2508,2583,2557,2559,},{2605,2582,2583,2507,2505,2508,},{2591,2593,2605,2506,2507,2508,},{2592,2510,2509,2511,2578,2579,},{2592,2593,2510,2511,2512,2609,},{2517,2513,2516,2521,2518,2544,},{2527,2529,2514,2515,2516,2535,},{2536,2535,2515,2517,2516,2544,},{2521,2519,2518,2550,2544,2540,},{2553,2520,2521,2519,2546,2550,},{2529,2530,2522,2523,2525,2542,},{2526,2522,2525,2532,2530,2611,},{2588,2587,2524,2526,2525,2611,},{2539,2528,2527,2533,2534,2537,},{2531,2527,2529,2536,2535,2544,},{2531,2527,2533,2624,2536,2537,},{2539,2538,2528,2533,2532,2627,},{2531,2529,2530,2544,2542,2610,},{2531,2533,2530,2624,2610,2612,},{2533,2532,2530,2627,2612,2611,},{2550,2547,2540,2544,2541,2560,},{2609,2542,2541,2543,2558,2559,},{2545,2542,2541,2613,2561,2558,},{2625,2544,2545,2541,2560,2561,},{2625,2545,2544,2542,2613,2610,},{2553,2552,2546,2550,2549,2570,},{2551,2547,2548,2561,2555,2567,},{2625,2551,2550,2547,2561,2560,},{2551,2549,2548,2571,2567,2563,},{2625,2550,2551,2549,2570,2571,},{2625,2553,2554,2552,2570,2571,},{2574,2557,2556,2555,2566,2564,},{2584,2562,2557,2555,2568,2566,},{2631,2561,2562,2555,2567,2568,},{2584,2583,2557,2562,2559,2619,},{2613,2609,2561,2558,2559,2618,},{2631,2562,2561,2559,2619,2618,},{2572,2569,2576,2568,2563,2565,},{2631,2572,2571,2568,2567,2563,},{2576,2575,2573,2568,2565,2564,},{2575,2574,2584,2568,2564,2566,},{2580,2577,2579,2589,2587,2614,},{2594,2592,2580,2578,2579,2614,},{2605,2598,2599,2582,2581,2583,},{2585,2581,2583,2600,2599,2620,},{2586,2585,2581,2638,2603,2600,},{2585,2584,2583,2636,2620,2619,},{2590,2588,2587,2628,2615,2611,},{2642,2590,2589,2587,2615,2614,},{2608,2605,2591,2597,2593,2622,},{2595,2591,2597,2648,2606,2608,},{2594,2592,2593,2614,2609,2621,},{2594,2597,2593,2643,2621,2622,},{2641,2643,2652,2594,2596,2597,},{2652,2645,2648,2596,2595,2597,},{2598,2604,2599,2608,2605,2622,},{2647,2606,2607,2601,2602,2598,},{2606,2608,2648,2598,2601,2604,},{2639,2600,2604,2599,2620,2622,},{2665,2638,2639,2603,2600,2604,},{2647,2648,2661,2601,2602,2604,},{2665,2603,2602,2604,2660,2661,},{2634,2613,2617,2609,2618,2623,},{2643,2614,2616,2609,2621,2622,},{2617,2616,2609,2679,2623,2622,},{2626,2624,2630,2610,2617,2612,},{2626,2625,2634,2617,2610,2613,},{2629,2627,2630,2617,2611,2612,},{2671,2628,2629,2615,2611,2617,},{2670,2642,2643,2615,2614,2616,},{2671,2670,2617,2615,2616,2679,},{2631,2632,2636,2618,2619,2620,},{2632,2633,2639,2618,2620,2622,},{2634,2633,2679,2623,2618,2622,},{2631,2635,2632,2637,2636,2640,},{2635,2632,2633,2640,2639,2682,},{2635,2634,2633,2687,2682,2679,},{2640,2638,2639,2667,2665,2682,},{2644,2641,2643,2653,2652,2683,},{2672,2670,2642,2644,2643,2683,},{2645,2646,2648,2650,2652,2656,},{2646,2649,2648,2658,2656,2684,},{2663,2661,2684,2647,2649,2648,},{2651,2650,2654,2675,2655,2659,},{2659,2656,2650,2654,2652,2685,},{2653,2654,2652,2711,2683,2685,},{2675,2674,2655,2659,2657,2694,},{2657,2658,2656,2693,2680,2684,},{2659,2657,2656,2694,2685,2680,},{2662,2660,2661,2666,2665,2681,},{2663,2661,2662,2684,2681,2702,},{2715,2663,2664,2662,2702,2703,},{2667,2666,2665,2701,2682,2681,},{2708,2668,2667,2666,2705,2701,},{2732,2709,2708,2669,2668,2667,},{2671,2672,2670,2688,2679,2683,},{2671,2673,2672,2690,2688,2712,},{2678,2674,2675,2699,2694,2718,},{2725,2676,2677,2674,2696,2698,},{2678,2674,2677,2699,2698,2739,},{2687,2692,2710,2679,2682,2686,},{2714,2688,2692,2683,2679,2686,},{2717,2693,2700,2684,2680,2686,},{2694,2700,2719,2680,2685,2686,},{2710,2701,2707,2682,2681,2686,},{2702,2707,2717,2681,2684,2686,},{2719,2711,2714,2685,2683,2686,},{2687,2689,2692,2709,2710,2736,},{2691,2690,2688,2745,2713,2712,},{2691,2688,2692,2752,2713,2714,},{2689,2691,2692,2735,2736,2752,},{2720,2695,2696,2693,2715,2716,},{2695,2693,2700,2723,2715,2717,},{2718,2719,2748,2694,2699,2700,},{2724,2720,2721,2696,2695,2697,},{2695,2700,2697,2723,2721,2730,},{2724,2726,2730,2696,2697,2700,},{2742,2725,2726,2698,2696,2700,},{2748,2739,2742,2699,2698,2700,},{2732,2708,2709,2705,2706,2701,},{2736,2709,2710,2706,2701,2707,},{2715,2717,2723,2702,2703,2707,},{2722,2721,2727,2705,2703,2704,},{2721,2723,2730,2703,2704,2707,},{2727,2730,2733,2704,2705,2707,},{2732,2733,2736,2705,2706,2707,},{2718,2719,2711,2712,2714,2748,},{2752,2745,2748,2713,2712,2714,},{2742,2728,2730,2725,2724,2726,},{2734,2733,2727,2731,2730,2769,},{2762,2743,2740,2731,2729,2728,},{2743,2742,2728,2731,2730,2769,},{2737,2736,2734,2732,2733,2769,},{2753,2752,2738,2735,2736,2770,},{2738,2737,2736,2774,2770,2769,},{2744,2739,2741,2749,2747,2767,},{2744,2739,2742,2749,2748,2771,},{2740,2744,2741,2764,2761,2767,},{2762,2764,2778,2740,2743,2744,},{2778,2743,2744,2742,2769,2771,},{2758,2754,2751,2750,2746,2745,},{2754,2752,2745,2750,2748,2772,},{2757,2756,2749,2746,2747,2767,},{2758,2757,2799,2746,2750,2749,},{2799,2750,2749,2748,2772,2771,},{2759,2758,2805,2751,2755,2754,},{2781,2772,2770,2754,2753,2752,},{2805,2755,2754,2753,2783,2781,},{2833,2759,2760,2758,2805,2807,},{2802,2764,2766,2761,2767,2768,},{2762,2764,2763,2778,2776,2792,},{2800,2764,2763,2765,2792,2794,},{2764,2766,2765,2802,2800,2847,},{2774,2779,2784,2769,2770,2773,},{2803,2778,2779,2771,2769,2773,},{2781,2784,2808,2770,2772,2773,},{2808,2799,2803,2772,2771,2773,},{2775,2774,2779,2790,2780,2784,},{2777,2775,2776,2786,2785,2791,},{2785,2790,2775,2776,2779,2795,},{2778,2776,2779,2803,2792,2795,},{2780,2782,2784,2788,2790,2825,},{2834,2805,2808,2783,2781,2784,},{2823,2825,2834,2782,2783,2784,},{2798,2786,2785,2790,2791,2795,},{2797,2798,2819,2786,2787,2790,},{2818,2819,2828,2787,2789,2790,},{2789,2788,2790,2828,2822,2825,},{2793,2791,2795,2815,2796,2798,},{2792,2794,2795,2800,2803,2849,},{2849,2812,2815,2794,2793,2795,},{2811,2815,2819,2796,2797,2798,},{2809,2808,2799,2804,2803,2864,},{2802,2800,2801,2847,2846,2851,},{2846,2849,2800,2801,2803,2853,},{2854,2853,2804,2801,2803,2864,},{2833,2831,2805,2807,2806,2837,},{2805,2806,2808,2831,2834,2838,},{2839,2838,2806,2810,2808,2865,},{2810,2809,2808,2874,2865,2864,},{2820,2819,2811,2816,2815,2863,},{2821,2820,2817,2811,2816,2870,},{2848,2846,2812,2814,2813,2852,},{2812,2813,2815,2846,2849,2853,},{2857,2814,2813,2815,2852,2853,},{2817,2814,2815,2859,2857,2866,},{2817,2816,2815,2870,2866,2863,},{2820,2818,2819,2829,2828,2863,},{2822,2826,2825,2829,2828,2863,},{2827,2822,2826,2830,2829,2871,},{2824,2823,2825,2841,2832,2834,},{2826,2824,2825,2842,2841,2863,},{2827,2826,2824,2871,2843,2842,},{2832,2831,2834,2841,2836,2838,},{2835,2831,2832,2840,2836,2844,},{2835,2831,2833,2840,2837,2845,},{2844,2841,2836,2840,2838,2868,},{2878,2840,2839,2838,2868,2865,},{2871,2842,2843,2841,2863,2867,},{2887,2843,2844,2841,2867,2868,},{2856,2847,2850,2846,2851,2855,},{2860,2850,2848,2846,2855,2852,},{2858,2857,2854,2852,2853,2864,},{2860,2858,2876,2852,2855,2854,},{2859,2858,2857,2875,2866,2864,},{2881,2875,2876,2859,2860,2858,},{2881,2882,2900,2859,2860,2861,},{2883,2882,2862,2859,2861,2905,},{2885,2870,2873,2866,2869,2863,},{2887,2872,2871,2868,2867,2863,},{2893,2873,2872,2869,2868,2863,},{2874,2877,2879,2864,2865,2869,},{2885,2877,2875,2869,2866,2864,},{2893,2878,2879,2868,2869,2865,},{2885,2880,2889,2870,2873,2871,},{2889,2887,2893,2871,2873,2872,},{2903,2881,2885,2876,2875,2877,},{2926,2885,2880,2886,2889,2890,},{2902,2900,2881,2884,2882,2907,},{2903,2902,2881,2885,2884,2916,},{2883,2884,2882,2911,2905,2907,},{2883,2886,2884,2912,2911,2917,},{2926,2885,2886,2884,2916,2917,},{2887,2890,2888,2894,2891,2897,},{2926,2889,2887,2890,2893,2894,},{2899,2892,2895,2891,2896,2898,},{2895,2894,2891,2930,2898,2897,},{2927,2926,2895,2893,2894,2930,},{2914,2901,2904,2900,2906,2908,},{2904,2902,2900,2918,2908,2907,},{2904,2903,2902,2928,2918,2916,},{2910,2913,2915,2905,2906,2909,},{2913,2911,2919,2905,2909,2907,},{2915,2914,2942,2909,2906,2908,},{2942,2919,2918,2909,2908,2907,},{2928,2926,2931,2918,2916,2917,},{2943,2932,2931,2920,2918,2917,},{2946,2943,2942,2920,2919,2918,},{2935,2925,2922,2921,2932,2930,},{2938,2934,2935,2923,2925,2922,},{2940,2937,2938,2924,2923,2925,},{2936,2927,2929,2926,2930,2933,},{2944,2929,2928,2926,2933,2931,},{2948,2935,2936,2932,2930,2933,},{2948,2944,2943,2933,2932,2931,},{2948,2938,2939,2935,2934,2936,},{2941,2940,2937,2939,2938,2948,},{2949,2947,2946,2945,2943,2942,},{2951,2948,2949,2944,2943,2945,},{2948,2949,2950,2951,2952,2953,},};
+int color_order_data[1770] = {9,24,27,38,68,78,103,121,147,155,174,179,204,226,228,246,268,293,326,327,343,369,375,384,393,400,405,430,434,441,468,508,536,558,568,578,671,687,704,731,738,761,779,803,816,829,838,865,873,886,927,965,988,1011,1051,1069,1072,1105,1198,1258,1305,1315,1329,1342,1376,1423,1431,1494,1517,1536,1548,1565,1590,1619,1639,1676,1678,1702,1714,1737,1749,1765,0,10,41,62,79,81,101,128,148,154,167,168,189,201,215,233,265,308,319,361,373,377,391,396,402,461,490,509,530,559,581,629,656,672,700,706,722,734,741,762,802,804,817,828,850,866,939,979,1014,1070,1074,1079,1102,1117,1125,1222,1240,1252,1287,1306,1341,1375,1429,1432,1463,1499,1549,1560,1576,1584,1613,1617,1667,1674,1721,1734,1745,1751,1756,1,17,22,31,35,73,97,105,136,182,196,224,230,244,267,275,292,325,334,371,383,399,401,414,439,463,464,515,525,551,582,587,604,617,628,673,711,721,725,733,737,771,784,800,806,811,841,870,900,907,926,974,996,1055,1068,1095,1118,1134,1184,1246,1300,1319,1385,1421,1422,1434,1474,1491,1555,1607,1628,1642,1658,1675,1712,1715,1723,1742,1767,2,28,63,95,112,127,158,169,191,203,238,253,263,286,306,388,404,426,445,465,477,499,510,514,529,560,595,633,674,683,690,716,736,743,767,796,812,825,867,877,910,941,955,972,1076,1094,1124,1146,1167,1242,1266,1318,1332,1365,1372,1394,1420,1445,1476,1535,1583,1594,1611,1618,1663,1673,1736,1743,1757,5,36,56,69,84,98,100,102,118,132,144,152,178,229,236,262,291,297,321,324,333,390,411,429,447,469,475,528,548,554,584,596,661,670,715,726,740,768,777,814,827,862,876,895,918,953,991,1012,1016,1100,1137,1153,1159,1162,1267,1302,1340,1366,1419,1489,1518,1533,1546,1603,1620,1631,1650,1692,1709,1739,1764,11,32,42,61,82,94,123,129,140,146,186,194,227,234,256,260,348,368,374,408,420,458,532,546,569,606,618,644,669,701,728,732,778,786,791,815,824,853,864,942,963,975,995,1077,1099,1126,1243,1263,1393,1424,1435,1450,1462,1479,1500,1538,1593,1614,1634,1664,1728,1746,1748,1766,6,15,23,80,86,96,104,111,134,153,181,212,223,247,285,294,314,349,424,438,449,457,476,517,533,541,571,577,579,663,682,720,757,769,785,795,826,845,868,904,908,940,1045,1078,1097,1119,1129,1196,1230,1265,1293,1307,1374,1430,1440,1447,1509,1515,1558,1606,1621,1655,1665,1720,1730,1741,1768,3,43,66,83,89,109,114,133,145,159,184,239,251,264,284,323,338,385,389,428,531,550,575,580,588,610,631,650,696,707,713,735,739,808,823,863,872,905,933,973,1008,1041,1101,1116,1158,1264,1298,1328,1333,1390,1425,1471,1490,1541,1550,1616,1622,1670,1696,1732,1754,1758,4,14,44,54,65,74,88,113,135,156,166,190,242,250,278,288,350,357,379,392,425,519,538,625,630,651,692,709,724,759,764,770,813,821,861,874,883,948,954,962,971,1005,1082,1128,1273,1301,1322,1360,1363,1417,1426,1472,1508,1519,1545,1623,1660,1680,1701,1750,1763,20,39,51,59,85,90,116,137,149,183,225,252,257,290,302,347,394,446,460,543,547,553,563,576,590,600,697,719,729,749,869,901,915,936,956,968,983,1056,1084,1096,1215,1238,1324,1384,1433,1454,1473,1529,1582,1624,1668,1695,1726,1735,1759,12,45,52,60,64,92,117,139,150,161,197,235,249,255,259,296,322,330,376,395,452,516,539,556,567,570,593,602,632,694,712,775,792,807,951,985,1009,1013,1089,1127,1186,1251,1297,1320,1327,1364,1380,1401,1459,1470,1557,1564,1586,1625,1689,1725,1744,1752,1769,29,37,55,87,93,110,124,131,162,171,187,200,274,299,320,356,370,386,406,454,507,524,549,585,620,688,705,727,730,750,799,854,898,919,938,958,977,1081,1088,1115,1123,1185,1353,1368,1382,1396,1443,1484,1505,1556,1626,1694,1727,1755,1760,7,19,46,53,76,91,125,130,142,151,157,188,258,269,277,303,358,387,398,403,467,479,518,526,552,583,597,679,708,745,780,798,820,836,851,943,1018,1049,1206,1232,1321,1346,1410,1444,1477,1487,1501,1542,1559,1572,1656,1733,1738,13,21,40,50,67,119,126,160,177,192,195,237,266,279,307,329,397,437,478,537,557,589,614,677,744,748,789,818,880,935,1006,1010,1039,1098,1111,1214,1249,1290,1313,1411,1441,1455,1483,1498,1589,1591,1659,1706,1762,8,25,34,58,72,99,106,120,122,164,198,213,261,272,295,355,360,419,480,534,542,555,564,591,611,649,714,751,797,822,847,860,923,934,964,987,1038,1109,1133,1219,1352,1369,1383,1398,1415,1456,1485,1507,1592,1627,1662,1705,1747,1753,16,33,48,70,115,165,170,185,199,270,287,305,336,359,372,481,535,540,565,609,641,723,753,783,879,966,1007,1017,1043,1114,1120,1141,1213,1272,1391,1436,1460,1469,1524,1596,1633,1671,1724,1761,26,77,107,163,172,175,221,240,309,313,318,353,378,466,485,521,545,566,586,612,622,787,810,849,916,937,952,961,994,1044,1053,1122,1180,1308,1343,1348,1442,1482,1513,1547,1569,1629,1693,1731,1740,18,30,57,143,173,176,248,282,304,351,382,435,486,523,544,592,619,642,693,710,801,837,855,947,970,1019,1054,1113,1143,1182,1223,1304,1386,1418,1475,1502,1521,1595,1630,1657,1682,47,75,141,180,211,254,273,283,298,301,352,381,436,487,522,527,605,627,643,717,742,781,871,875,884,945,949,959,1015,1106,1212,1247,1344,1359,1413,1437,1461,1516,1615,1638,1672,1729,49,71,138,193,202,231,354,380,409,421,482,520,607,648,684,773,830,858,878,944,957,976,1029,1090,1110,1172,1271,1370,1388,1404,1465,1578,1585,1661,1669,1677,108,232,271,281,422,443,488,561,594,608,621,646,763,790,834,899,967,1002,1071,1121,1245,1269,1316,1334,1349,1378,1392,1543,1571,1608,1647,1699,214,241,289,331,423,484,562,616,675,758,809,819,848,914,932,950,1024,1046,1073,1112,1183,1237,1280,1453,1464,1492,1531,1575,1646,1719,216,300,412,442,472,489,599,680,718,754,776,832,833,924,1093,1135,1181,1235,1248,1317,1358,1373,1395,1439,1458,1504,1522,1612,1632,1683,220,315,417,456,624,647,659,681,765,788,887,928,946,1047,1092,1147,1195,1218,1239,1303,1330,1355,1387,1503,1520,1609,1651,1697,206,407,433,459,511,603,645,676,766,793,831,882,960,984,1075,1205,1241,1286,1309,1326,1362,1389,1416,1467,1544,1566,1610,1654,1698,219,328,410,427,470,513,678,760,794,840,857,1028,1040,1080,1108,1190,1225,1256,1323,1345,1407,1438,1523,1554,1599,1666,1679,245,316,339,416,462,491,626,658,698,746,859,911,981,1052,1104,1148,1156,1191,1231,1255,1354,1402,1449,1457,1562,1563,1597,1637,1716,207,312,363,415,598,613,635,689,772,835,839,969,986,1064,1107,1140,1176,1193,1229,1262,1268,1399,1446,1514,1540,1561,1570,1640,1690,276,310,418,440,483,574,623,662,756,856,888,989,1001,1022,1042,1103,1151,1155,1216,1253,1270,1310,1347,1367,1486,1537,1553,1598,1641,1704,205,311,345,413,495,573,652,685,774,917,978,1035,1048,1142,1168,1203,1217,1250,1278,1311,1412,1448,1506,1552,1573,1587,1649,1717,218,317,346,431,601,615,638,653,686,755,844,906,929,980,1020,1063,1132,1154,1204,1244,1285,1351,1400,1488,1530,1551,1579,1635,1718,243,432,444,473,640,695,782,842,846,881,930,982,1021,1058,1138,1144,1174,1221,1254,1336,1350,1371,1408,1480,1511,1605,1652,1722,209,367,448,493,657,702,752,843,889,909,997,1030,1050,1136,1157,1210,1234,1261,1299,1325,1337,1493,1496,1527,1539,1574,1636,1703,210,335,451,494,691,747,805,852,912,1036,1061,1083,1187,1197,1236,1259,1312,1331,1338,1357,1403,1428,1452,1497,1581,1588,1643,1710,217,342,450,506,660,885,922,990,999,1032,1062,1152,1163,1202,1224,1257,1281,1405,1466,1512,1526,1601,1644,1681,280,332,471,512,654,703,891,931,1003,1057,1130,1188,1220,1260,1283,1314,1361,1409,1427,1451,1468,1568,1577,1653,1713,208,362,453,496,655,699,893,913,1059,1065,1131,1161,1189,1227,1291,1356,1397,1478,1495,1510,1567,1580,1648,1700,222,364,498,572,667,892,920,993,1000,1060,1067,1145,1169,1200,1233,1277,1406,1481,1525,1532,1602,1645,1711,344,455,634,668,902,925,1004,1023,1171,1207,1226,1295,1414,1534,1604,1688,337,340,341,365,366,474,492,497,500,501,502,503,504,505,636,637,639,664,665,666,890,894,896,897,903,921,992,998,1025,1026,1027,1031,1033,1034,1037,1066,1085,1086,1087,1091,1139,1149,1150,1160,1164,1165,1166,1170,1173,1175,1177,1178,1179,1192,1194,1199,1201,1208,1209,1211,1228,1274,1275,1276,1279,1282,1284,1288,1289,1292,1294,1296,1335,1339,1377,1379,1381,1528,1600,1684,1685,1686,1687,1691,1707,1708,};
+int color_offsets_data[40] = {0,82,161,240,309,380,444,511,573,634,689,748,803,856,905,959,1003,1048,1089,1131,1167,1199,1229,1259,1287,1316,1343,1372,1401,1431,1459,1488,1516,1544,1572,1596,1621,1645,1668,1684,};
@@ -2,6 +2,7 @@ import argparse
 import os
 import pathlib
 import shutil
+import time
 
 import numpy as np
 import taichi as ti
@@ -9,6 +10,39 @@ import taichi as ti
 parser = argparse.ArgumentParser()
 parser.add_argument('--dim', type=int, default=3)
 parser.add_argument('--aot', default=False, action='store_true')
+parser.add_argument('--reorder',
+                    choices=['none', 'rcm', 'morton'],
+                    default='rcm',
+                    help='vertex order of the mesh, which cells and edges '
+                    'follow; --aot writes it to mesh_data.h')
+parser.add_argument('--min-color-cells',
+                    type=int,
+                    default=16,
+                    help='smallest tet color that gets an atomic-free '
+                    'get_force dispatch of its own')
+parser.add_argument('--max-bodies',
+                    type=int,
+                    default=1,
+                    help='most copies of the mesh (FemApp --bodies) the '
+                    'module\'s fields are sized for; each one adds a body\'s '
+                    'worth to its root buffer')
+parser.add_argument('--bsr-matvec',
+                    default=False,
+                    action='store_true',
+                    help='multiply by the 3x3 block-sparse matrix '
+                    '(matmul_bsr) instead of scattering the per-edge '
+                    'Hessian (matmul_edge)')
+parser.add_argument('--colored-forces',
+                    default=False,
+                    action='store_true',
+                    help='scatter forces one tet color at a time, with the '
+                    'cells in color order, instead of by get_force with '
+                    'atomics')
+parser.add_argument('--reorder-report',
+                    default=False,
+                    action='store_true',
+                    help='compare access strides and kernel times of the '
+                    'tetrahedralizer order and --reorder, then exit')
 args = parser.parse_args()
 
 # TODO: asserts cuda or vulkan backend
@@ -21,16 +55,204 @@ def get_rel_path(*segs):
     return os.path.join(SCRIPT_PATH, *segs)
 
 
+def bsr_pattern(edges, n):
+    """Block-sparse row pattern of the system matrix of a mesh with `n`
+    vertices: row u holds its diagonal block followed by one block per edge
+    at u, ordered by column. FemApp builds the same pattern for its packed
+    bodies (build_bsr_pattern in fem_app.h)."""
+    neighbours = [[u] for u in range(n)]
+    for u, v in edges:
+        neighbours[u].append(v)
+        neighbours[v].append(u)
+    row_ptr = np.zeros(n + 1, dtype=np.int32)
+    row_ptr[1:] = np.cumsum([len(cols) for cols in neighbours])
+    cols = np.array(
+        [c for row in neighbours for c in [row[0]] + sorted(row[1:])],
+        dtype=np.int32)
+    return row_ptr, cols
+
+
+def rcm_order(edges, n):
+    """Reverse Cuthill-McKee order of `n` vertices joined by `edges`: a
+    breadth-first walk from a lowest-degree vertex, visiting neighbours by
+    increasing degree, reversed. Neighbours end up close in the order, which
+    keeps the bandwidth of the system matrix small."""
+    neighbours = [[] for _ in range(n)]
+    for u, v in edges:
+        neighbours[u].append(v)
+        neighbours[v].append(u)
+    degree = [len(nb) for nb in neighbours]
+    for nb in neighbours:
+        nb.sort(key=lambda w: degree[w])
+    order = []
+    visited = [False] * n
+    # One walk per connected component.
+    for start in sorted(range(n), key=lambda u: degree[u]):
+        if visited[start]:
+            continue
+        visited[start] = True
+        order.append(start)
+        head = len(order) - 1
+        while head < len(order):
+            for w in neighbours[order[head]]:
+                if not visited[w]:
+                    visited[w] = True
+                    order.append(w)
+            head += 1
+    return order[::-1]
+
+
+def morton_order(ox, bits=10):
+    """Vertices sorted along a Z-order curve through the mesh's bounding box,
+    each axis quantized to `bits` bits."""
+    lo = [min(p[d] for p in ox) for d in range(3)]
+    hi = [max(p[d] for p in ox) for d in range(3)]
+    scale = [((1 << bits) - 1) / max(hi[d] - lo[d], 1e-12) for d in range(3)]
+
+    def code(p):
+        q = [int((p[d] - lo[d]) * scale[d]) for d in range(3)]
+        c = 0
+        for bit in range(bits):
+            for d in range(3):
+                c |= ((q[d] >> bit) & 1) << (3 * bit + d)
+        return c
+
+    return sorted(range(len(ox)), key=lambda u: code(ox[u]))
+
+
+def build_c2e(cells, edges):
+    """The six edge ids of each cell, in the order get_matrix visits the
+    cell's vertex pairs (u, v) with u < v."""
+    edge_id = {(u, v): e for e, (u, v) in enumerate(edges)}
+    return [[edge_id[(u, v)] for u in cell for v in cell if u < v]
+            for cell in cells]
+
+
+def permute_mesh(order, ox, cells, faces, edges):
+    """Renumbers a mesh so that vertex i is old vertex order[i]. Cells are
+    then sorted by their vertices and edges by their end points, so that
+    neighbouring threads of get_force and matmul_edge touch neighbouring
+    vertices, and c2e is rebuilt to match. The vertex order within a cell
+    is kept, and with it the cell's orientation."""
+    new_id = [0] * len(order)
+    for new, old in enumerate(order):
+        new_id[old] = new
+    ox = [ox[old] for old in order]
+    cells = sorted(([new_id[u] for u in cell] for cell in cells), key=sorted)
+    faces = [[new_id[u] for u in face] for face in faces]
+    edges = sorted(sorted([new_id[u], new_id[v]]) for u, v in edges)
+    return ox, cells, faces, edges, build_c2e(cells, edges)
+
+
+def reorder_mesh(method, ox, cells, faces, edges, c2e):
+    if method == 'none':
+        return ox, cells, faces, edges, c2e
+    if method == 'rcm':
+        order = rcm_order(edges.tolist(), ox.shape[0])
+    else:
+        order = morton_order(ox.tolist())
+    permuted = permute_mesh(order, ox.tolist(), cells.tolist(),
+                            faces.tolist(), edges.tolist())
+    return tuple(
+        np.array(new, dtype=old.dtype)
+        for new, old in zip(permuted, (ox, cells, faces, edges, c2e)))
+
+
+def color_cells(cells, n, min_cells):
+    """Colors the cells of a mesh with `n` vertices so that no two cells of a
+    color share a vertex, and get_force_color can scatter a color's forces
+    without atomics. Cells with the most neighbours are colored first, which
+    needs no more colors than the most cells at any one vertex. Colors of
+    fewer than `min_cells` cells are not worth a dispatch of their own and
+    are left to get_force_rest. Returns the cell order the colored kernels
+    need, color by color and the rest last, each sorted by the cells'
+    vertices so that a color's threads gather from nearby vertices whatever
+    the vertex order, and the first position of each color followed by the
+    first of the rest."""
+    incident = [[] for _ in range(n)]
+    for i, cell in enumerate(cells):
+        for u in cell:
+            incident[u].append(i)
+    neighbours = [{j
+                   for u in cell for j in incident[u]} - {i}
+                  for i, cell in enumerate(cells)]
+    color = [-1] * len(cells)
+    for i in sorted(range(len(cells)), key=lambda i: -len(neighbours[i])):
+        taken = {color[j] for j in neighbours[i]}
+        c = 0
+        while c in taken:
+            c += 1
+        color[i] = c
+    sizes = [color.count(c) for c in range(max(color) + 1)]
+    kept = [c for c in range(len(sizes)) if sizes[c] >= min_cells]
+    rank = {c: r for r, c in enumerate(kept)}
+    order = sorted(range(len(cells)),
+                   key=lambda i: (rank.get(color[i], len(kept)),
+                                  sorted(cells[i])))
+    offsets = [0]
+    for c in kept:
+        offsets.append(offsets[-1] + sizes[c])
+    return order, offsets
+
+
+def access_stats(threads, warp=32, line_bytes=64, elem_bytes=12):
+    """Cache-miss proxies for a kernel whose threads, in launch order, read
+    x (or write f) at the vertex ids in `threads`: a histogram of the
+    distance between consecutive accesses, bucketed by powers of two, and
+    the mean number of distinct cache lines each warp touches."""
+    hist = {}
+    prev = None
+    for ids in threads:
+        for u in ids:
+            if prev is not None:
+                bucket = abs(u - prev).bit_length()
+                hist[bucket] = hist.get(bucket, 0) + 1
+            prev = u
+    lines = 0
+    for w in range(0, len(threads), warp):
+        lines += len({
+            u * elem_bytes // line_bytes
+            for ids in threads[w:w + warp] for u in ids
+        })
+    num_warps = (len(threads) + warp - 1) // warp
+    return hist, lines / num_warps
+
+
+def format_access_stats(name, threads):
+    hist, lines = access_stats(threads)
+    total = sum(hist.values())
+    buckets = []
+    for bucket in range(max(hist) + 1):
+        label = str(bucket) if bucket < 2 else '{}-{}'.format(
+            1 << (bucket - 1), (1 << bucket) - 1)
+        buckets.append('{}:{:.0f}%'.format(label,
+                                          100 * hist.get(bucket, 0) / total))
+    return '  {:<12} {:5.1f} lines/warp  stride {}'.format(
+        name, lines, ' '.join(buckets))
+
+
 c2e_np = np.load(get_rel_path('c2e.npy'))
 vertices_np = np.load(get_rel_path('vertices_np.npy'))
 indices_np = np.load(get_rel_path('indices_np.npy'))
 edges_np = np.load(get_rel_path('edges_np.npy'))
 ox_np = np.load(get_rel_path('ox_np.npy'))
+# The tetrahedralizer's own order, kept for --reorder-report.
+tetgen_mesh_np = (ox_np, vertices_np, indices_np, edges_np, c2e_np)
+ox_np, vertices_np, indices_np, edges_np, c2e_np = reorder_mesh(
+    args.reorder, *tetgen_mesh_np)
+# The cells stay in vertex order, which keeps get_force's atomics local.
+# Only --colored-forces (FemOptions::colored_forces in fem_app.h) puts them in
+# color_order, the order get_force_color needs.
+color_order, color_offsets = color_cells(vertices_np.tolist(),
+                                         ox_np.shape[0], args.min_color_cells)
+n_colors = len(color_offsets) - 1
 
 n_edges = edges_np.shape[0]
 n_verts = ox_np.shape[0]
 n_cells = c2e_np.shape[0]
 n_faces = indices_np.shape[0]
+bsr_row_ptr_np, bsr_cols_np = bsr_pattern(edges_np, n_verts)
+n_blocks = bsr_cols_np.shape[0]
 
 E, nu = 5e5, 0.0
 mu, la = E / (2 * (1 + nu)), E * nu / ((1 + nu) * (1 - 2 * nu))  # lambda = 0
@@ -39,15 +261,23 @@ epsilon = 1e-5
 dt = 7.5e-3
 num_substeps = int(2e-2 / dt + 0.5)
 aspect_ratio = 2.0
+# FemApp packs copies of the mesh into one set of ndarrays, vertex, cell and
+# edge ids offset per copy. The kernels only ever see the packed arrays, but
+# the fields below are indexed by those ids and so are sized for the largest
+# packing the module is generated for.
+MAX_BODIES = args.max_bodies
 
 x = ti.Vector.ndarray(args.dim, dtype=ti.f32, shape=n_verts)
 v = ti.Vector.ndarray(args.dim, dtype=ti.f32, shape=n_verts)
 f = ti.Vector.ndarray(args.dim, dtype=ti.f32, shape=n_verts)
 mul_ans = ti.Vector.ndarray(args.dim, dtype=ti.f32, shape=n_verts)
-m = ti.field(dtype=ti.f32, shape=n_verts)
+m = ti.field(dtype=ti.f32, shape=n_verts * MAX_BODIES)
 
-B = ti.Matrix.field(args.dim, args.dim, dtype=ti.f32, shape=n_cells)
-W = ti.field(dtype=ti.f32, shape=n_cells)
+B = ti.Matrix.field(args.dim,
+                    args.dim,
+                    dtype=ti.f32,
+                    shape=n_cells * MAX_BODIES)
+W = ti.field(dtype=ti.f32, shape=n_cells * MAX_BODIES)
 
 gravity = [0, -9.8, 0]
 
@@ -57,8 +287,15 @@ indices = ti.field(ti.i32, shape=n_faces * 3)
 edges = ti.Vector.ndarray(2, dtype=ti.i32, shape=n_edges)
 c2e = ti.Vector.ndarray(6, dtype=ti.i32, shape=n_cells)
 
-hes_edge = ti.field(dtype=ti.f32, shape=edges.shape)
-hes_vert = ti.field(dtype=ti.f32, shape=ox.shape)
+hes_edge = ti.field(dtype=ti.f32, shape=n_edges * MAX_BODIES)
+hes_vert = ti.field(dtype=ti.f32, shape=n_verts * MAX_BODIES)
+
+# A = M + dt^2 K as 3x3 blocks, assembled once by get_matrix_bsr. Unlike
+# hes_edge/hes_vert, which keep one scalar per block, the blocks are full,
+# so anisotropic materials need no change to the solver.
+bsr_row_ptr = ti.ndarray(ti.i32, shape=n_verts + 1)
+bsr_cols = ti.ndarray(ti.i32, shape=n_blocks)
+bsr_values = ti.Matrix.ndarray(3, 3, dtype=ti.f32, shape=n_blocks)
 
 b = ti.Vector.ndarray(3, dtype=ti.f32, shape=n_verts)
 r0 = ti.Vector.ndarray(3, dtype=ti.f32, shape=n_verts)
@@ -70,11 +307,17 @@ dot_ans = ti.field(ti.f32, shape=())
 r_2_scalar = ti.field(ti.f32, shape=())
 
 ox.from_numpy(ox_np)
-vertices.from_numpy(vertices_np)
+if args.colored_forces:
+    vertices.from_numpy(vertices_np[color_order])
+    c2e.from_numpy(c2e_np[color_order])
+else:
+    vertices.from_numpy(vertices_np)
+    c2e.from_numpy(c2e_np)
 indices.from_numpy(indices_np.reshape(-1))
 
 edges.from_numpy(np.array(list(edges_np)))
-c2e.from_numpy(c2e_np)
+bsr_row_ptr.from_numpy(bsr_row_ptr_np)
+bsr_cols.from_numpy(bsr_cols_np)
 
 
 @ti.kernel
@@ -106,12 +349,17 @@ def ssvd(F):
 
 
 @ti.func
-def get_force_func(c, verts, x: ti.template(), f: ti.template()):
+def cell_force(c, verts, x: ti.template()):
     F = Ds(verts, x) @ B[c]
     P = ti.Matrix.zero(ti.f32, 3, 3)
     U, sig, V = ssvd(F)
     P = 2 * mu * (F - U @ V.transpose())
-    H = -W[c] * P @ B[c].transpose()
+    return -W[c] * P @ B[c].transpose()
+
+
+@ti.func
+def get_force_func(c, verts, x: ti.template(), f: ti.template()):
+    H = cell_force(c, verts, x)
     for i in ti.static(range(3)):
         force = ti.Vector([H[j, i] for j in range(3)])
         f[verts[i]] += force
@@ -129,29 +377,71 @@ def get_force(
         f[u] += g * m[u]
 
 
+# Cells [begin, end) are one color, so no two threads touch the same vertex
+# and plain stores replace get_force's atomic adds.
+@ti.kernel
+def get_force_color(x: ti.types.ndarray(), f: ti.types.ndarray(),
+                    vertices: ti.types.ndarray(), begin: ti.i32,
+                    end: ti.i32):
+    for c in range(begin, end):
+        verts = vertices[c]
+        H = cell_force(c, verts, x)
+        total = ti.Vector.zero(ti.f32, 3)
+        for i in ti.static(range(3)):
+            force = ti.Vector([H[j, i] for j in range(3)])
+            f[verts[i]] = f[verts[i]] + force
+            total += force
+        f[verts[3]] = f[verts[3]] - total
+
+
+# The cells from `begin` on, those in colors too small for a dispatch of
+# their own, with atomics as in get_force, and gravity.
+@ti.kernel
+def get_force_rest(x: ti.types.ndarray(), f: ti.types.ndarray(),
+                   vertices: ti.types.ndarray(), begin: ti.i32, g_x: ti.f32,
+                   g_y: ti.f32, g_z: ti.f32):
+    for c in range(begin, vertices.shape[0]):
+        get_force_func(c, vertices[c], x, f)
+    for u in f:
+        g = ti.Vector([g_x, g_y, g_z])
+        f[u] += g * m[u]
+
+
+def get_force_colored(x, f, vertices, g_x, g_y, g_z):
+    get_force_rest(x, f, vertices, color_offsets[-1], g_x, g_y, g_z)
+    for color in range(n_colors):
+        get_force_color(x, f, vertices, color_offsets[color],
+                        color_offsets[color + 1])
+
+
+@ti.func
+def cell_hessian(c):
+    W_c = W[c]
+    B_c = B[c]
+    hes = ti.Matrix.zero(ti.f32, 12, 12)
+    for u in ti.static(range(4)):
+        for d in ti.static(range(3)):
+            dD = ti.Matrix.zero(ti.f32, 3, 3)
+            if ti.static(u == 3):
+                for j in ti.static(range(3)):
+                    dD[d, j] = -1
+            else:
+                dD[d, u] = 1
+            dF = dD @ B_c
+            dP = 2.0 * mu * dF
+            dH = -W_c * dP @ B_c.transpose()
+            for i in ti.static(range(3)):
+                for j in ti.static(range(3)):
+                    hes[i * 3 + j, u * 3 + d] = -dt**2 * dH[j, i]
+                    hes[3 * 3 + j, u * 3 + d] += dt**2 * dH[j, i]
+    return hes
+
+
 @ti.kernel
 def get_matrix(c2e: ti.types.ndarray(), vertices: ti.types.ndarray()):
     for c in vertices:
         verts = vertices[c]
-        W_c = W[c]
-        B_c = B[c]
-        hes = ti.Matrix.zero(ti.f32, 12, 12)
-        for u in ti.static(range(4)):
-            for d in ti.static(range(3)):
-                dD = ti.Matrix.zero(ti.f32, 3, 3)
-                if ti.static(u == 3):
-                    for j in ti.static(range(3)):
-                        dD[d, j] = -1
-                else:
-                    dD[d, u] = 1
-                dF = dD @ B_c
-                dP = 2.0 * mu * dF
-                dH = -W_c * dP @ B_c.transpose()
-                for i in ti.static(range(3)):
-                    for j in ti.static(range(3)):
-                        hes[i * 3 + j, u * 3 + d] = -dt**2 * dH[j, i]
-                        hes[3 * 3 + j, u * 3 + d] += dt**2 * dH[j, i]
-
+        hes = cell_hessian(c)
         z = 0
         for u_i in ti.static(range(4)):
             u = verts[u_i]
@@ -176,6 +466,44 @@ def matmul_edge(ret: ti.types.ndarray(), vel: ti.types.ndarray(),
         ret[v] += hes_edge[e] * vel[u]
 
 
+@ti.func
+def bsr_block(row_ptr, cols, u, v):
+    # Rows hold a vertex and its neighbours, so a scan finds v quickly.
+    k = row_ptr[u]
+    while cols[k] != v:
+        k += 1
+    return k
+
+
+@ti.kernel
+def get_matrix_bsr(vertices: ti.types.ndarray(), row_ptr: ti.types.ndarray(),
+                   cols: ti.types.ndarray(), values: ti.types.ndarray()):
+    for k in values:
+        values[k] = ti.Matrix.zero(ti.f32, 3, 3)
+    for c in vertices:
+        verts = vertices[c]
+        hes = cell_hessian(c)
+        for u_i in ti.static(range(4)):
+            for v_i in ti.static(range(4)):
+                k = bsr_block(row_ptr, cols, verts[u_i], verts[v_i])
+                for i in ti.static(range(3)):
+                    for j in ti.static(range(3)):
+                        values[k][i, j] += hes[u_i * 3 + i, v_i * 3 + j]
+
+
+# ret = A @ vel with one thread per row gathering its blocks, so unlike
+# matmul_edge there are no atomics.
+@ti.kernel
+def matmul_bsr(ret: ti.types.ndarray(), vel: ti.types.ndarray(),
+               row_ptr: ti.types.ndarray(), cols: ti.types.ndarray(),
+               values: ti.types.ndarray()):
+    for u in ret:
+        acc = m[u] * vel[u]
+        for k in range(row_ptr[u], row_ptr[u + 1]):
+            acc += values[k] @ vel[cols[k]]
+        ret[u] = acc
+
+
 @ti.kernel
 def add(ans: ti.types.ndarray(), a: ti.types.ndarray(), k: ti.f32,
         b: ti.types.ndarray()):
@@ -232,11 +560,20 @@ def update_beta_r_2(beta_scalar: ti.types.ndarray()):
     r_2_scalar[None] = dot_ans[None]
 
 
+def matmul(ret, vel):
+    if args.bsr_matvec:
+        matmul_bsr(ret, vel, bsr_row_ptr, bsr_cols, bsr_values)
+    else:
+        matmul_edge(ret, vel, edges)
+
+
 def cg(it):
-    get_force(x, f, vertices, gravity[0], gravity[1], gravity[2])
+    if args.colored_forces:
+        get_force_colored(x, f, vertices, gravity[0], gravity[1], gravity[2])
+    else:
+        get_force(x, f, vertices, gravity[0], gravity[1], gravity[2])
     get_b(v, b, f)
-    matmul_edge(mul_ans, v, edges)
-    matmul_edge(mul_ans, v, edges)
+    matmul(mul_ans, v)
     add(r0, b, -1, mul_ans)
 
     ndarray_to_ndarray(p0, r0)
@@ -244,7 +581,7 @@ def cg(it):
     init_r_2()
     CG_ITERS = 10
     for _ in range(CG_ITERS):
-        matmul_edge(mul_ans, p0, edges)
+        matmul(mul_ans, p0)
         dot2scalar(p0, mul_ans)
         update_alpha(alpha_scalar)
         add_scalar_ndarray(v, v, 1, alpha_scalar, p0)
@@ -317,6 +654,18 @@ def run_aot():
                        'f': f,
                        'vertices': vertices
                    })
+    mod.add_kernel(get_force_color,
+                   template_args={
+                       'x': x,
+                       'f': f,
+                       'vertices': vertices
+                   })
+    mod.add_kernel(get_force_rest,
+                   template_args={
+                       'x': x,
+                       'f': f,
+                       'vertices': vertices
+                   })
     mod.add_kernel(init,
                    template_args={
                        'x': x,
@@ -337,6 +686,21 @@ def run_aot():
                        'vel': x,
                        'edges': edges
                    })
+    mod.add_kernel(get_matrix_bsr,
+                   template_args={
+                       'vertices': vertices,
+                       'row_ptr': bsr_row_ptr,
+                       'cols': bsr_cols,
+                       'values': bsr_values
+                   })
+    mod.add_kernel(matmul_bsr,
+                   template_args={
+                       'ret': mul_ans,
+                       'vel': x,
+                       'row_ptr': bsr_row_ptr,
+                       'cols': bsr_cols,
+                       'values': bsr_values
+                   })
     mod.add_kernel(add, template_args={'ans': x, 'a': x, 'b': v})
     mod.add_kernel(add_scalar_ndarray,
                    template_args={
@@ -369,6 +733,51 @@ def run_aot():
     print('AOT done')
 
 
+def report_reordering():
+    """Prints the access patterns of get_force, matmul_edge and matmul_bsr
+    and their times on the tetrahedralizer's order and on --reorder."""
+    meshes = [('tetgen', tetgen_mesh_np),
+              (args.reorder,
+               (ox_np, vertices_np, indices_np, edges_np, c2e_np))]
+    for name, (ox_m, cells_m, _, edges_m, c2e_m) in meshes:
+        row_ptr_m, cols_m = bsr_pattern(edges_m, n_verts)
+        rows = [
+            cols_m[row_ptr_m[u]:row_ptr_m[u + 1]].tolist()
+            for u in range(n_verts)
+        ]
+        print(f'{name}:')
+        print(format_access_stats('get_force', cells_m.tolist()))
+        print(format_access_stats('matmul_edge', edges_m.tolist()))
+        print(format_access_stats('matmul_bsr', rows))
+
+        ox.from_numpy(ox_m)
+        vertices.from_numpy(cells_m)
+        edges.from_numpy(edges_m)
+        c2e.from_numpy(c2e_m)
+        bsr_row_ptr.from_numpy(row_ptr_m)
+        bsr_cols.from_numpy(cols_m)
+        clear_field()
+        init(x, v, f, ox, vertices)
+        get_matrix(c2e, vertices)
+        get_matrix_bsr(vertices, bsr_row_ptr, bsr_cols, bsr_values)
+
+        def time_ms(launch, runs=200):
+            launch()
+            ti.sync()
+            begin = time.perf_counter()
+            for _ in range(runs):
+                launch()
+            ti.sync()
+            return (time.perf_counter() - begin) * 1000 / runs
+
+        print('  get_force {:.3f} ms, matmul_edge {:.3f} ms, '
+              'matmul_bsr {:.3f} ms'.format(
+                  time_ms(lambda: get_force(x, f, vertices, *gravity)),
+                  time_ms(lambda: matmul_edge(mul_ans, v, edges)),
+                  time_ms(lambda: matmul_bsr(mul_ans, v, bsr_row_ptr,
+                                             bsr_cols, bsr_values))))
+
+
 @ti.kernel
 def convert_to_field(x: ti.types.ndarray(), y: ti.template()):
     for I in ti.grouped(x):
@@ -463,20 +872,27 @@ def generate_data_header_file_for_aot():
         f.write('constexpr int N_CELLS = {};\n'.format(n_cells))
         f.write('constexpr int N_FACES = {};\n'.format(n_faces))
         f.write('constexpr int N_EDGES = {};\n'.format(n_edges))
+        f.write('constexpr int N_COLORS = {};\n'.format(n_colors))
         write_array(ox_np, float, 'ox_data', f)
         write_array(vertices_np, int, 'vertices_data', f)
         write_array(indices_np.reshape(-1), int, 'indices_data', f)
         write_array(edges_np, int, 'edges_data', f)
         write_array(c2e_np, int, 'c2e_data', f)
+        write_array(np.array(color_order), int, 'color_order_data', f)
+        write_array(np.array(color_offsets), int, 'color_offsets_data', f)
 
 
 if __name__ == '__main__':
     print(f'dt={dt} num_substeps={num_substeps}')
-    if args.aot:
+    if args.reorder_report:
+        report_reordering()
+    elif args.aot:
         run_aot()
         generate_data_header_file_for_aot()
     else:
         clear_field()
         init(x, v, f, ox, vertices)
         get_matrix(c2e, vertices)
+        if args.bsr_matvec:
+            get_matrix_bsr(vertices, bsr_row_ptr, bsr_cols, bsr_values)
         run_ggui()
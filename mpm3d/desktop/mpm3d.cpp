@@ -0,0 +1,206 @@
+#include <chrono>
+#include <iostream>
+
+#include "mpm3d.hpp"
+#include <taichi/aot/graph_data.h>
+#include <taichi/rhi/vulkan/vulkan_common.h>
+#include <taichi/rhi/vulkan/vulkan_loader.h>
+#include <taichi/runtime/gfx/aot_module_loader_impl.h>
+#include <taichi/runtime/program_impls/vulkan/vulkan_program.h>
+
+#include "async_loader.hpp"
+#include "benchmark_sweep.hpp"
+#include "circles_window.hpp"
+#include "graph_args.hpp"
+#include "graph_runtime.hpp"
+#include "ndarray_and_mem.hpp"
+#include "startup_profiler.hpp"
+
+namespace demo {
+
+// 3D MLS-MPM with the same structure as MPM88DemoImpl. The grid is a flat
+// ndarray in blocked Morton order (see mpm3d.py), so grid_v and grid_m take
+// exactly n_grid^3 nodes and a particle's 27-node stencil stays within a few
+// neighbouring blocks.
+class MPM3DDemoImpl {
+public:
+  MPM3DDemoImpl(taichi::lang::vulkan::VulkanDevice *device,
+                const MPM3DOptions &options)
+      : rt_(device) {
+    Init(options);
+  }
+
+  // Headless variant for benchmarks: owns its Vulkan device and never
+  // touches a window or swap chain.
+  explicit MPM3DDemoImpl(const MPM3DOptions &options) { Init(options); }
+
+  void Reset() {
+    // update may still be compiling on the loader's worker.
+    g_init_.get();
+    auto lock = rt_.loader()->Lock();
+    args_.Run(*g_init_.get());
+    rt_.runtime()->synchronize();
+  }
+
+  void Step() {
+    args_.Run(*g_update_.get());
+    rt_.runtime()->synchronize();
+  }
+
+  const taichi::lang::DeviceAllocation &pos() { return pos_->devalloc(); }
+
+  uint64_t grid_bytes() const { return grid_v_->size() + grid_m_->size(); }
+
+private:
+  void Init(const MPM3DOptions &options) {
+    const int n_grid = options.n_grid;
+    if (n_grid < 4 || (n_grid & (n_grid - 1)) != 0) {
+      TI_ERROR("Grid size must be a power of two of at least 4, got {}",
+               n_grid);
+    }
+    ProfileScope init_phase("MPM3DDemoImpl");
+    rt_.LoadModule("../shaders/", "python3 mpm3d.py");
+    g_init_ = rt_.LoadGraph("init");
+    g_update_ = rt_.LoadGraph("update");
+
+    ProfileScope alloc_phase("allocate ndarrays");
+    const auto alloc_begin = std::chrono::steady_clock::now();
+    // The device is no more thread safe than the module, so allocations wait
+    // for the pipeline the loader's worker is creating.
+    auto device_lock = rt_.loader()->Lock();
+    arena_ = std::make_unique<DeviceArena>(rt_.device());
+    auto *arena = arena_.get();
+    const std::vector<int> vec3_shape = {3};
+    const std::vector<int> mat3_shape = {3, 3};
+    const int n = options.num_particles;
+
+    x_ = NdarrayAndMem::Make(arena, taichi::lang::PrimitiveType::f32, {n},
+                             vec3_shape);
+    v_ = NdarrayAndMem::Make(arena, taichi::lang::PrimitiveType::f32, {n},
+                             vec3_shape);
+    pos_ = NdarrayAndMem::Make(arena, taichi::lang::PrimitiveType::f32, {n},
+                               vec3_shape);
+    C_ = NdarrayAndMem::Make(arena, taichi::lang::PrimitiveType::f32, {n},
+                             mat3_shape);
+    J_ = NdarrayAndMem::Make(arena, taichi::lang::PrimitiveType::f32, {n});
+
+    const int n_nodes = n_grid * n_grid * n_grid;
+    grid_v_ = NdarrayAndMem::Make(arena, taichi::lang::PrimitiveType::f32,
+                                  {n_nodes}, vec3_shape);
+    grid_m_ = NdarrayAndMem::Make(arena, taichi::lang::PrimitiveType::f32,
+                                  {n_nodes});
+    alloc_phase.End();
+
+    using taichi::lang::aot::IValue;
+    args_.Bind("x", IValue::create(x_->ndarray()));
+    args_.Bind("v", IValue::create(v_->ndarray()));
+    args_.Bind("J", IValue::create(J_->ndarray()));
+    args_.Bind("C", IValue::create(C_->ndarray()));
+    args_.Bind("grid_v", IValue::create(grid_v_->ndarray()));
+    args_.Bind("grid_m", IValue::create(grid_m_->ndarray()));
+    args_.Bind("pos", IValue::create(pos_->ndarray()));
+    args_.Bind("n_grid", IValue::create<int32_t>(n_grid));
+    arena_->Report("mpm3d", MillisecondsSince(alloc_begin));
+    device_lock.unlock();
+
+    {
+      ProfileScope reset_phase("init graph", [this] {
+        rt_.runtime()->synchronize();
+      });
+      Reset();
+    }
+    rt_.FinishLoad("mpm3d");
+  }
+
+  // Outlives everything below, which lives on its device and module.
+  GraphRuntime rt_;
+  // Owns the memory of every ndarray below.
+  std::unique_ptr<DeviceArena> arena_{nullptr};
+  std::unique_ptr<NdarrayAndMem> x_{nullptr};
+  std::unique_ptr<NdarrayAndMem> v_{nullptr};
+  std::unique_ptr<NdarrayAndMem> J_{nullptr};
+  std::unique_ptr<NdarrayAndMem> C_{nullptr};
+  std::unique_ptr<NdarrayAndMem> grid_v_{nullptr};
+  std::unique_ptr<NdarrayAndMem> grid_m_{nullptr};
+  std::unique_ptr<NdarrayAndMem> pos_{nullptr};
+  Lazy<std::unique_ptr<taichi::lang::aot::CompiledGraph>> g_init_;
+  Lazy<std::unique_ptr<taichi::lang::aot::CompiledGraph>> g_update_;
+
+  GraphArgs args_;
+};
+
+// Runs `num_steps` frames with 8k, 16k, ... and `max_particles` particles
+// on a fixed grid, and prints the step time and particle throughput of each.
+void RunParticleSweep(int max_particles, int n_grid, int num_steps) {
+  std::cout << "particles, ms/step, particle-substeps/sec" << std::endl;
+  for (int n : SweepSizes(8192, max_particles)) {
+    MPM3DOptions options;
+    options.num_particles = n;
+    options.n_grid = n_grid;
+    MPM3DDemoImpl impl(options);
+    if (n == 8192) {
+      std::cout << "# grid " << n_grid << "^3, "
+                << impl.grid_bytes() / (1024.0 * 1024.0) << " MiB"
+                << std::endl;
+    }
+    const double ms = MillisecondsPerRun(num_steps, [&] { impl.Step(); });
+    // 25 substeps per step, as in mpm3d.py.
+    std::cout << n << ", " << ms << ", " << double(n) * 25 * 1000.0 / ms
+              << std::endl;
+  }
+}
+
+MPM3DDemo::MPM3DDemo(const OffscreenOptions &offscreen,
+                     const MPM3DOptions &options)
+    : window_(std::make_unique<CirclesWindow>("MPM3D", offscreen)) {
+  impl_ = std::make_unique<MPM3DDemoImpl>(window_->device(), options);
+  // pos holds the particles projected into the view by g2p.
+  window_->SetParticles(impl_->pos(), options.num_particles, 0.003f);
+}
+
+void MPM3DDemo::Step() {
+  window_->Run([this] { impl_->Step(); });
+}
+
+MPM3DDemo::~MPM3DDemo() {
+  // The window owns the device the simulation runs on.
+  impl_.reset();
+  window_.reset();
+}
+
+} // namespace demo
+
+int main(int argc, char **argv) {
+  demo::MillisecondsSinceStartup();
+  demo::StartupProfiler::Get().ParseArgs(argc, argv);
+  demo::AsyncModuleLoader::DefaultMode() =
+      demo::ParsePipelineLoadMode(argc, argv);
+  // `--particles <n>` and `--grid <n>` size the simulation;
+  // `--particle-sweep <max n> [--steps <n>]` benchmarks particle count
+  // against step time headless.
+  demo::MPM3DOptions options;
+  int particle_sweep = 0;
+  int steps = 100;
+  for (int i = 1; i + 1 < argc; i++) {
+    const std::string arg = argv[i];
+    if (arg == "--particles") {
+      options.num_particles = std::stoi(argv[++i]);
+    } else if (arg == "--grid") {
+      options.n_grid = std::stoi(argv[++i]);
+    } else if (arg == "--particle-sweep") {
+      particle_sweep = std::stoi(argv[++i]);
+    } else if (arg == "--steps") {
+      steps = std::stoi(argv[++i]);
+    }
+  }
+  if (particle_sweep > 0) {
+    demo::RunParticleSweep(particle_sweep, options.n_grid, steps);
+    return 0;
+  }
+
+  auto offscreen = demo::OffscreenOptions::Parse(argc, argv);
+  auto mpm3d_demo = std::make_unique<demo::MPM3DDemo>(offscreen, options);
+  mpm3d_demo->Step();
+
+  return 0;
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <memory>
+#include <taichi/gui/gui.h>
+#include <taichi/ui/backends/vulkan/renderer.h>
+#include <vector>
+
+#include "offscreen.hpp"
+
+namespace demo {
+
+struct MPM3DOptions {
+  int num_particles{8192 * 4};
+  // Grid nodes per side; a power of two, at least 4.
+  int n_grid{64};
+};
+
+class CirclesWindow;
+class MPM3DDemoImpl;
+class MPM3DDemo {
+public:
+  explicit MPM3DDemo(const OffscreenOptions &offscreen = {},
+                     const MPM3DOptions &options = {});
+  ~MPM3DDemo();
+
+  void Step();
+
+private:
+  std::unique_ptr<CirclesWindow> window_{nullptr};
+  std::unique_ptr<MPM3DDemoImpl> impl_{nullptr};
+};
+} // namespace demo
@@ -0,0 +1,227 @@
+import taichi as ti
+import tempfile
+
+ti.init(ti.vulkan)
+dt = 2e-4
+
+p_rho = 1
+gravity = 9.8
+bound = 3
+E = 400
+
+# The grid is stored as a flat ndarray in blocked Morton order: GRID_BLOCK^3
+# cells are contiguous, and blocks follow a Z-order curve. The 27 nodes a
+# particle touches then span at most 8 blocks that sit close together in
+# memory instead of 9 rows that are n_grid^2 cells apart. n_grid must be a
+# power of two multiple of GRID_BLOCK.
+GRID_BLOCK = 4
+
+
+@ti.func
+def spread_bits(v):
+    # Inserts two zero bits between each of the low 10 bits of v.
+    v = (v | (v << 16)) & 0x030000FF
+    v = (v | (v << 8)) & 0x0300F00F
+    v = (v | (v << 4)) & 0x030C30C3
+    v = (v | (v << 2)) & 0x09249249
+    return v
+
+
+@ti.func
+def compact_bits(v):
+    v &= 0x09249249
+    v = (v | (v >> 2)) & 0x030C30C3
+    v = (v | (v >> 4)) & 0x0300F00F
+    v = (v | (v >> 8)) & 0x030000FF
+    v = (v | (v >> 16)) & 0x000003FF
+    return v
+
+
+@ti.func
+def grid_index(I):
+    b = I // GRID_BLOCK
+    c = I % GRID_BLOCK
+    morton = spread_bits(b.x) | (spread_bits(b.y) << 1) | (
+        spread_bits(b.z) << 2)
+    return morton * GRID_BLOCK**3 + (c.x * GRID_BLOCK + c.y) * GRID_BLOCK + c.z
+
+
+@ti.func
+def grid_coord(g):
+    morton = g // GRID_BLOCK**3
+    c = g % GRID_BLOCK**3
+    b = ti.Vector([
+        compact_bits(morton),
+        compact_bits(morton >> 1),
+        compact_bits(morton >> 2)
+    ])
+    return b * GRID_BLOCK + ti.Vector(
+        [c // GRID_BLOCK**2, c // GRID_BLOCK % GRID_BLOCK, c % GRID_BLOCK])
+
+
+@ti.func
+def project(x):
+    # Oblique projection of the unit cube into the 2D view drawn by circles.
+    return ti.Vector(
+        [0.1 + 0.6 * x.x + 0.25 * x.z, 0.1 + 0.6 * x.y + 0.25 * x.z, 0])
+
+
+@ti.kernel
+def substep_reset_grid(grid_v: ti.any_arr(field_dim=1),
+                       grid_m: ti.any_arr(field_dim=1)):
+    for g in grid_m:
+        grid_v[g] = [0, 0, 0]
+        grid_m[g] = 0
+
+
+@ti.kernel
+def substep_p2g(x: ti.any_arr(field_dim=1), v: ti.any_arr(field_dim=1),
+                C: ti.any_arr(field_dim=1), J: ti.any_arr(field_dim=1),
+                grid_v: ti.any_arr(field_dim=1),
+                grid_m: ti.any_arr(field_dim=1), n_grid: ti.i32):
+    for p in x:
+        dx = 1 / n_grid
+        p_vol = (dx * 0.5)**3
+        p_mass = p_vol * p_rho
+        Xp = x[p] / dx
+        base = int(Xp - 0.5)
+        fx = Xp - base
+        w = [0.5 * (1.5 - fx)**2, 0.75 - (fx - 1)**2, 0.5 * (fx - 0.5)**2]
+        stress = -dt * 4 * E * p_vol * (J[p] - 1) / dx**2
+        affine = ti.Matrix.identity(float, 3) * stress + p_mass * C[p]
+        for offset in ti.static(ti.grouped(ti.ndrange(3, 3, 3))):
+            dpos = (offset - fx) * dx
+            weight = 1.0
+            for d in ti.static(range(3)):
+                weight *= w[offset[d]][d]
+            g = grid_index(base + offset)
+            grid_v[g] += weight * (p_mass * v[p] + affine @ dpos)
+            grid_m[g] += weight * p_mass
+
+
+@ti.kernel
+def substep_update_grid_v(grid_v: ti.any_arr(field_dim=1),
+                          grid_m: ti.any_arr(field_dim=1), n_grid: ti.i32):
+    # Walks the grid in storage order so that consecutive threads touch
+    # consecutive memory.
+    for g in grid_m:
+        I = grid_coord(g)
+        if grid_m[g] > 0:
+            grid_v[g] /= grid_m[g]
+        grid_v[g].y -= dt * gravity
+        for d in ti.static(range(3)):
+            if I[d] < bound and grid_v[g][d] < 0:
+                grid_v[g][d] = 0
+            if I[d] > n_grid - bound and grid_v[g][d] > 0:
+                grid_v[g][d] = 0
+
+
+@ti.kernel
+def substep_g2p(x: ti.any_arr(field_dim=1), v: ti.any_arr(field_dim=1),
+                C: ti.any_arr(field_dim=1), J: ti.any_arr(field_dim=1),
+                grid_v: ti.any_arr(field_dim=1), pos: ti.any_arr(field_dim=1),
+                n_grid: ti.i32):
+    for p in x:
+        dx = 1 / n_grid
+        Xp = x[p] / dx
+        base = int(Xp - 0.5)
+        fx = Xp - base
+        w = [0.5 * (1.5 - fx)**2, 0.75 - (fx - 1)**2, 0.5 * (fx - 0.5)**2]
+        new_v = ti.Vector.zero(float, 3)
+        new_C = ti.Matrix.zero(float, 3, 3)
+        for offset in ti.static(ti.grouped(ti.ndrange(3, 3, 3))):
+            dpos = (offset - fx) * dx
+            weight = 1.0
+            for d in ti.static(range(3)):
+                weight *= w[offset[d]][d]
+            g_v = grid_v[grid_index(base + offset)]
+            new_v += weight * g_v
+            new_C += 4 * weight * g_v.outer_product(dpos) / dx**2
+        v[p] = new_v
+        x[p] += dt * v[p]
+        pos[p] = project(x[p])
+        J[p] *= 1 + dt * new_C.trace()
+        C[p] = new_C
+
+
+@ti.kernel
+def init_particles(x: ti.any_arr(field_dim=1), v: ti.any_arr(field_dim=1),
+                   C: ti.any_arr(field_dim=1), J: ti.any_arr(field_dim=1),
+                   pos: ti.any_arr(field_dim=1)):
+    for i in range(x.shape[0]):
+        x[i] = [
+            ti.random() * 0.4 + 0.3,
+            ti.random() * 0.4 + 0.4,
+            ti.random() * 0.4 + 0.3
+        ]
+        v[i] = [0, -1, 0]
+        C[i] = ti.Matrix.zero(float, 3, 3)
+        J[i] = 1
+        pos[i] = project(x[i])
+
+
+N_ITER = 25
+
+sym_x = ti.graph.Arg(ti.graph.ArgKind.NDARRAY,
+                     'x',
+                     ti.f32,
+                     field_dim=1,
+                     element_shape=(3, ))
+sym_v = ti.graph.Arg(ti.graph.ArgKind.NDARRAY,
+                     'v',
+                     ti.f32,
+                     field_dim=1,
+                     element_shape=(3, ))
+sym_C = ti.graph.Arg(ti.graph.ArgKind.NDARRAY,
+                     'C',
+                     ti.f32,
+                     field_dim=1,
+                     element_shape=(3, 3))
+sym_J = ti.graph.Arg(ti.graph.ArgKind.NDARRAY,
+                     'J',
+                     ti.f32,
+                     field_dim=1,
+                     element_shape=())
+sym_grid_v = ti.graph.Arg(ti.graph.ArgKind.NDARRAY,
+                          'grid_v',
+                          ti.f32,
+                          field_dim=1,
+                          element_shape=(3, ))
+sym_grid_m = ti.graph.Arg(ti.graph.ArgKind.NDARRAY,
+                          'grid_m',
+                          ti.f32,
+                          field_dim=1,
+                          element_shape=())
+sym_pos = ti.graph.Arg(ti.graph.ArgKind.NDARRAY,
+                       'pos',
+                       ti.f32,
+                       field_dim=1,
+                       element_shape=(3, ))
+sym_n_grid = ti.graph.Arg(ti.graph.ArgKind.SCALAR, 'n_grid', ti.i32)
+
+g_init_builder = ti.graph.GraphBuilder()
+g_init_builder.dispatch(init_particles, sym_x, sym_v, sym_C, sym_J, sym_pos)
+
+g_update_builder = ti.graph.GraphBuilder()
+substep = g_update_builder.create_sequential()
+
+substep.dispatch(substep_reset_grid, sym_grid_v, sym_grid_m)
+substep.dispatch(substep_p2g, sym_x, sym_v, sym_C, sym_J, sym_grid_v,
+                 sym_grid_m, sym_n_grid)
+substep.dispatch(substep_update_grid_v, sym_grid_v, sym_grid_m, sym_n_grid)
+substep.dispatch(substep_g2p, sym_x, sym_v, sym_C, sym_J, sym_grid_v, sym_pos,
+                 sym_n_grid)
+
+for i in range(N_ITER):
+    g_update_builder.append(substep)
+
+g_init = g_init_builder.compile()
+g_update = g_update_builder.compile()
+
+# Serialize!
+with tempfile.TemporaryDirectory() as tmpdir:
+    tmpdir = 'shaders'
+    mod = ti.aot.Module(ti.vulkan)
+    mod.add_graph('init', g_init)
+    mod.add_graph('update', g_update)
+    mod.save(tmpdir, '')
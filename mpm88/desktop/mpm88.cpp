@@ -1,4 +1,5 @@
 #include <chrono>
+#include <cmath>
 #include <iostream>
 #include <signal.h>
 
@@ -11,10 +12,36 @@
 #include <taichi/runtime/program_impls/vulkan/vulkan_program.h>
 #include <unistd.h>
 
+#include "async_loader.hpp"
+#include "benchmark_sweep.hpp"
+#include "circles_window.hpp"
+#include "graph_args.hpp"
+#include "graph_runtime.hpp"
+#include "ndarray_and_mem.hpp"
+#include "queue_fence.hpp"
+#include "sdf_volume.hpp"
+#include "startup_profiler.hpp"
+
 namespace demo {
 namespace {
 constexpr int kNrParticles = 8192 * 2;
-constexpr int kNGrid = 128;
+// Edge length of a grid block in the sparse and tiled variants, as in
+// mpm88.py.
+constexpr int kGridBlock = 8;
+// Particles per tiled P2G work item and tiles per scan workgroup, P2G_CHUNK
+// and SCAN_THREADS in mpm88.py.
+constexpr int kP2GChunk = 256;
+constexpr int kScanThreads = 256;
+// Substeps per update graph run, N_ITER in mpm88.py.
+constexpr int kSubsteps = 50;
+// Simulated time per frame, and substeps per update_adaptive run, as in
+// mpm88.py.
+constexpr float kFrameDt = kSubsteps * 2e-4f;
+constexpr int kSubstepChunk = 10;
+// Frames of sim_state readback in flight before StepAdaptive() waits.
+constexpr int kSimStateReadbacks = 3;
+// Resolution of the boundary SDF, SDF_RES in mpm88.py.
+constexpr int kSdfRes = 256;
 
 template <typename T>
 std::vector<T> ReadDataToHost(taichi::lang::DeviceAllocation &alloc,
@@ -41,62 +68,50 @@ std::vector<T> ReadDataToHost(taichi::lang::DeviceAllocation &alloc,
 }
 } // namespace
 
+// Physical parameters of one scene in a batched run.
+struct SceneParams {
+  float E{400};
+  float gravity{9.8};
+  int num_particles{kNrParticles};
+};
+
 class MPM88DemoImpl {
 public:
-  MPM88DemoImpl(taichi::lang::vulkan::VulkanDevice *device) : device_(device) {
-    InitTaichiRuntime(device_);
+  // Simulates a single scene, or `scenes.size()` independent scenes in one
+  // dispatch per kernel when `scenes` is non-empty. Batched ndarrays have a
+  // leading scene dimension; scene 0 comes first in memory so pos() can be
+  // rendered as is.
+  MPM88DemoImpl(taichi::lang::vulkan::VulkanDevice *device,
+                const std::vector<SceneParams> &scenes = {},
+                const MPM88Options &options = {})
+      : rt_(device) {
+    Init(scenes, options);
+  }
 
-    taichi::lang::gfx::AotModuleParams mod_params;
-    mod_params.module_path = "../shaders/";
-    mod_params.runtime = vulkan_runtime.get();
-    module = taichi::lang::aot::Module::load(taichi::Arch::vulkan, mod_params);
+  // Headless variant for parameter sweeps: owns its Vulkan device and never
+  // touches a window or swap chain.
+  explicit MPM88DemoImpl(const std::vector<SceneParams> &scenes,
+                         const MPM88Options &options = {}) {
+    Init(scenes, options);
+  }
 
-    auto root_size = module->get_root_size();
-    vulkan_runtime->add_root_buffer(root_size);
+  int num_scenes() const { return num_scenes_; }
 
-    g_init_ = module->get_graph("init");
-    g_update_ = module->get_graph("update");
+  bool f16_state() const { return options_.f16_state; }
 
-    // Prepare Ndarray for model
-    const std::vector<int> vec2_shape = {2};
-    const std::vector<int> vec3_shape = {3};
-    const std::vector<int> mat2_shape = {2, 2};
-
-    x_ = NdarrayAndMem::Make(device_, taichi::lang::PrimitiveType::f32,
-                             {kNrParticles}, vec2_shape,
-                             /*host_read=*/true, /*host_write=*/true);
-    v_ = NdarrayAndMem::Make(device_, taichi::lang::PrimitiveType::f32,
-                             {kNrParticles}, vec2_shape);
-    pos_ = NdarrayAndMem::Make(device_, taichi::lang::PrimitiveType::f32,
-                               {kNrParticles}, vec3_shape);
-    C_ = NdarrayAndMem::Make(device_, taichi::lang::PrimitiveType::f32,
-                             {kNrParticles}, mat2_shape);
-    J_ = NdarrayAndMem::Make(device_, taichi::lang::PrimitiveType::f32,
-                             {kNrParticles});
-
-    grid_v_ = NdarrayAndMem::Make(device_, taichi::lang::PrimitiveType::f32,
-                                  {kNGrid, kNGrid}, vec2_shape);
-    grid_m_ = NdarrayAndMem::Make(device_, taichi::lang::PrimitiveType::f32,
-                                  {kNGrid, kNGrid});
-
-    args_.insert({"x", taichi::lang::aot::IValue::create(x_->ndarray())});
-    args_.insert({"v", taichi::lang::aot::IValue::create(v_->ndarray())});
-    args_.insert({"J", taichi::lang::aot::IValue::create(J_->ndarray())});
-    args_.insert({"C", taichi::lang::aot::IValue::create(C_->ndarray())});
-    args_.insert(
-        {"grid_v", taichi::lang::aot::IValue::create(grid_v_->ndarray())});
-    args_.insert(
-        {"grid_m", taichi::lang::aot::IValue::create(grid_m_->ndarray())});
-    args_.insert({"pos", taichi::lang::aot::IValue::create(pos_->ndarray())});
-
-    Reset();
+  // Bytes of per-particle state the substeps read and write.
+  uint64_t particle_state_bytes() const {
+    return x_->size() + v_->size() + C_->size() + J_->size() + pos_->size();
   }
 
   ~MPM88DemoImpl() {}
 
   void Reset() {
-    g_init_->run(args_);
-    vulkan_runtime->synchronize();
+    // update may still be compiling on the loader's worker.
+    g_init_.get();
+    auto lock = rt_.loader()->Lock();
+    args_.Run(*g_init_.get());
+    rt_.runtime()->synchronize();
 
     // For debugging
     //auto arr = ReadDataToHost<float>(x_->devalloc(), x_->ndarray().get_nelement() * x_->ndarray().get_element_size());
@@ -106,85 +121,412 @@ public:
   }
 
   void Step() {
-    g_update_->run(args_);
-    vulkan_runtime->synchronize();
+    if (options_.adaptive_dt) {
+      StepAdaptive();
+      return;
+    }
+    args_.Run(*g_update_.get());
+    rt_.runtime()->synchronize();
+  }
+
+  // Prints how the adaptive time step behaved over the run so far.
+  void ReportTimeStepping() {
+    if (!options_.adaptive_dt) {
+      return;
+    }
+    RetireSimStateReadbacks(/*wait=*/true);
+    const auto &s = dt_stats_;
+    if (s.frames == 0) {
+      return;
+    }
+    const double substeps_per_frame = double(s.substeps) / s.frames;
+    std::printf("[adaptive dt] mpm88: %.1f substeps per frame against %d "
+                "at the fixed dt (%+.0f%%), dt %.3g .. %.3g, peak signal "
+                "speed %.3g, %d of %d frames ended short and carried over, "
+                "%.1f idle substeps per frame, %s\n",
+                substeps_per_frame, kSubsteps,
+                100.0 * (substeps_per_frame - kSubsteps) / kSubsteps,
+                s.min_dt, s.max_dt, s.peak_speed, s.short_frames, s.frames,
+                double(s.dispatched - s.substeps) / s.frames,
+                s.unstable_frame < 0 ? "stable" : "UNSTABLE");
+    if (s.unstable_frame >= 0) {
+      std::printf("[adaptive dt] mpm88: non-finite state first seen in frame "
+                  "%d\n",
+                  s.unstable_frame);
+    }
+  }
+
+  // Average time of one P2G pass in ms, from `num_runs` runs of the
+  // bench_p2g graph matching this variant (the tiled one includes its sort).
+  double TimeP2G(int num_runs) {
+    auto graph =
+        rt_.LoadGraph(options_.tiled_p2g ? "bench_p2g_tiled" : "bench_p2g");
+    // Each graph run is kSubsteps P2G passes.
+    return MillisecondsPerRun(
+               num_runs, [&] { args_.Run(*graph.get()); },
+               [&] { rt_.runtime()->synchronize(); }) /
+           kSubsteps;
   }
 
   const taichi::lang::DeviceAllocation &pos() { return pos_->devalloc(); }
 
 private:
-  class NdarrayAndMem {
-  public:
-    NdarrayAndMem() = default;
-    ~NdarrayAndMem() { device_->dealloc_memory(devalloc_); }
-
-    const taichi::lang::Ndarray &ndarray() const { return *ndarray_; }
-
-    taichi::lang::DeviceAllocation &devalloc() { return devalloc_; }
-
-    static std::unique_ptr<NdarrayAndMem>
-    Make(taichi::lang::Device *device, taichi::lang::DataType dtype,
-         const std::vector<int> &arr_shape,
-         const std::vector<int> &element_shape = {}, bool host_read = false,
-         bool host_write = false) {
-      // TODO: Cannot use data_type_size() until
-      // https://github.com/taichi-dev/taichi/pull/5220.
-      // uint64_t alloc_size = taichi::lang::data_type_size(dtype);
-      uint64_t alloc_size = 1;
-      if (auto *prim = dtype->as<taichi::lang::PrimitiveType>()) {
-        using PT = taichi::lang::PrimitiveType;
-        if (prim == PT::f32 || prim == PT::i32 || prim == PT::u32) {
-          alloc_size = 4;
-        } else {
-          TI_ERROR("Unsupported bit width!");
-          return nullptr;
-        }
-      } else {
-        TI_ERROR("Non primitive type!");
-        return nullptr;
+  // Mirrors sim_state in mpm88.py.
+  struct SimState {
+    float dt;
+    float t;
+    float max_speed;
+    float substeps;
+  };
+
+  // One frame's copy of sim_state, readable once `fence` has signaled.
+  struct SimStateReadback {
+    taichi::lang::DeviceAllocation buffer;
+    std::unique_ptr<QueueFence> fence;
+    // Substeps the host queued for the frame.
+    int dispatched{0};
+  };
+
+  // Copies sim_state into the next readback slot behind the frame's
+  // substeps. Only if that slot's copy from kSimStateReadbacks frames ago is
+  // still in flight does the host wait, and then only for that copy.
+  void QueueSimStateReadback(int dispatched) {
+    auto &slot =
+        sim_state_readbacks_[sim_state_frame_++ % sim_state_readbacks_.size()];
+    if (slot.fence->pending()) {
+      slot.fence->Wait();
+      RetireSimStateReadback(slot);
+    }
+    rt_.runtime()->flush();
+    auto *stream = rt_.device()->get_compute_stream();
+    auto cmd_list = stream->new_command_list();
+    cmd_list->buffer_barrier(sim_state_->devalloc());
+    cmd_list->buffer_copy(slot.buffer.get_ptr(0),
+                          sim_state_->devalloc().get_ptr(0), sizeof(SimState));
+    stream->submit(cmd_list.get());
+    slot.fence->Signal(rt_.device()->compute_queue());
+    slot.dispatched = dispatched;
+  }
+
+  // Folds every readback that has arrived into next_dt_ and the stats.
+  // Slots are retired oldest first, so a slot still in flight stops the
+  // scan unless `wait`.
+  void RetireSimStateReadbacks(bool wait) {
+    const size_t n = sim_state_readbacks_.size();
+    for (size_t i = std::min(sim_state_frame_, n); i > 0; i--) {
+      auto &slot = sim_state_readbacks_[(sim_state_frame_ - i) % n];
+      if (!slot.fence->pending()) {
+        continue;
       }
-      for (int s : arr_shape) {
-        alloc_size *= s;
+      if (wait) {
+        slot.fence->Wait();
+      } else if (!slot.fence->Ready()) {
+        return;
       }
-      for (int s : element_shape) {
-        alloc_size *= s;
+      RetireSimStateReadback(slot);
+    }
+  }
+
+  void RetireSimStateReadback(SimStateReadback &slot) {
+    SimState state;
+    void *mapped = rt_.device()->map(slot.buffer);
+    std::memcpy(&state, mapped, sizeof(state));
+    rt_.device()->unmap(slot.buffer);
+
+    auto &s = dt_stats_;
+    if (!std::isfinite(state.dt) || !std::isfinite(state.max_speed) ||
+        !std::isfinite(state.t)) {
+      if (s.unstable_frame < 0) {
+        s.unstable_frame = s.frames;
       }
-      taichi::lang::Device::AllocParams alloc_params;
-      alloc_params.host_read = host_read;
-      alloc_params.host_write = host_write;
-      alloc_params.size = alloc_size;
-      alloc_params.usage = taichi::lang::AllocUsage::Storage;
-      auto res = std::make_unique<NdarrayAndMem>();
-      res->device_ = device;
-      res->devalloc_ = device->allocate_memory(alloc_params);
-      res->ndarray_ = std::make_unique<taichi::lang::Ndarray>(
-          res->devalloc_, dtype, arr_shape, element_shape);
-      return res;
+    } else {
+      next_dt_ = state.dt;
+      // What the next frames inherit on top of their own kFrameDt.
+      carried_time_ = std::max(0.0f, kFrameDt - state.t);
+      s.min_dt = std::min(s.min_dt, state.dt);
+      s.max_dt = std::max(s.max_dt, state.dt);
+      s.peak_speed = std::max(s.peak_speed, state.max_speed);
+      s.short_frames += carried_time_ > 1e-7f ? 1 : 0;
     }
+    s.frames++;
+    s.substeps += int64_t(state.substeps);
+    s.dispatched += slot.dispatched;
+  }
 
-  private:
-    taichi::lang::Device *device_{nullptr};
-    std::unique_ptr<taichi::lang::Ndarray> ndarray_{nullptr};
-    taichi::lang::DeviceAllocation devalloc_;
-  };
+  // The f16 graphs only load and store f16 through storage buffers, so they
+  // need storageBuffer16BitAccess rather than f16 arithmetic
+  // (spirv_has_float16 reflects shaderFloat16).
+  bool HasStorageBuffer16BitAccess() const {
+    VkPhysicalDevice16BitStorageFeatures storage_16bit{};
+    storage_16bit.sType =
+        VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_16BIT_STORAGE_FEATURES;
+    VkPhysicalDeviceFeatures2 features{};
+    features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+    features.pNext = &storage_16bit;
+    vkGetPhysicalDeviceFeatures2(rt_.device()->vk_physical_device(), &features);
+    return storage_16bit.storageBuffer16BitAccess == VK_TRUE;
+  }
 
-  void InitTaichiRuntime(taichi::lang::vulkan::VulkanDevice *device_) {
-    // Create Vulkan runtime
-    taichi::lang::gfx::GfxRuntime::Params params;
-    result_buffer_.resize(taichi_result_buffer_entries);
-    params.host_result_buffer = result_buffer_.data();
-    params.device = device_;
-    vulkan_runtime =
-        std::make_unique<taichi::lang::gfx::GfxRuntime>(std::move(params));
+  // Advances one frame of kFrameDt in as many substeps as the GPU-side CFL
+  // limit asks for, without waiting on the GPU. The number of
+  // update_adaptive runs is planned from the newest sim_state readback that
+  // has arrived, usually one or two frames old. Substeps queued past the end
+  // of the frame are no-ops; a frame planned too short carries the rest of
+  // its time into the next one on the GPU, and the readback that reports it
+  // makes the host plan for it.
+  //
+  // The substeps are flushed rather than synchronized: the renderer copies
+  // pos with memcpy_internal on the same compute stream, which orders the
+  // copy after them.
+  void StepAdaptive() {
+    RetireSimStateReadbacks(/*wait=*/false);
+    args_.Run(*g_begin_frame_.get());
+    const int chunks = std::max(
+        1, int(std::ceil((kFrameDt + carried_time_) / next_dt_ /
+                         kSubstepChunk)));
+    for (int i = 0; i < chunks; i++) {
+      args_.Run(*g_update_.get());
+    }
+    QueueSimStateReadback(chunks * kSubstepChunk);
   }
 
-  std::unique_ptr<taichi::lang::vulkan::VulkanDeviceCreator> embedded_device_{
-      nullptr};
-  taichi::lang::vulkan::VulkanDevice *device_{nullptr};
-  std::vector<uint64_t> result_buffer_;
-  std::unique_ptr<taichi::lang::gfx::GfxRuntime> vulkan_runtime{nullptr};
+  void Init(const std::vector<SceneParams> &scenes,
+            const MPM88Options &options) {
+    ProfileScope init_phase("MPM88DemoImpl");
+    rt_.LoadModule("../shaders/", "python3 mpm88.py");
+
+    // The graphs compile in the background while the ndarrays below are
+    // allocated; update is only needed after Reset() has run init.
+    const bool batched = !scenes.empty();
+    num_scenes_ = batched ? int(scenes.size()) : 1;
+    options_ = options;
+    if (batched && (options_.f16_state || options_.sparse_grid ||
+                    options_.tiled_p2g || options_.adaptive_dt ||
+                    options_.sdf_boundary)) {
+      TI_ERROR("Batched scenes only support the dense f32 variant");
+    }
+    if (int(options_.f16_state) + int(options_.sparse_grid) +
+            int(options_.tiled_p2g) + int(options_.adaptive_dt) +
+            int(options_.sdf_boundary) >
+        1) {
+      TI_ERROR("f16 particle state, the sparse grid, tiled P2G, the "
+               "adaptive time step and SDF boundaries cannot be combined");
+    }
+    if (options_.n_grid % kGridBlock != 0) {
+      TI_ERROR("Grid size must be a multiple of {}", kGridBlock);
+    }
+    if (options_.f16_state && !HasStorageBuffer16BitAccess()) {
+      std::cout << "[mpm88] device has no 16-bit storage buffer access, "
+                   "storing C in f32"
+                << std::endl;
+      options_.f16_state = false;
+    }
+    std::string init_name = "init";
+    std::string update_name = "update";
+    if (batched) {
+      init_name = "init_batched";
+      update_name = "update_batched";
+    } else if (options_.f16_state) {
+      init_name = "init_f16";
+      update_name = "update_f16";
+    } else if (options_.sparse_grid) {
+      init_name = "init_sparse";
+      update_name = "update_sparse";
+    } else if (options_.tiled_p2g) {
+      init_name = "init_tiled";
+      update_name = "update_tiled";
+    } else if (options_.adaptive_dt) {
+      init_name = "init_adaptive";
+      update_name = "update_adaptive";
+    } else if (options_.sdf_boundary) {
+      update_name = "update_sdf";
+    }
+    g_init_ = rt_.LoadGraph(init_name);
+    g_update_ = rt_.LoadGraph(update_name);
+    if (options_.adaptive_dt) {
+      g_begin_frame_ = rt_.LoadGraph("begin_frame_adaptive");
+    }
 
-  std::unique_ptr<taichi::lang::aot::Module> module{nullptr};
+    ProfileScope alloc_phase("allocate ndarrays");
+    const auto alloc_begin = std::chrono::steady_clock::now();
+    // The device is no more thread safe than the module, so allocations wait
+    // for the pipeline the loader's worker is creating.
+    auto device_lock = rt_.loader()->Lock();
+    arena_ = std::make_unique<DeviceArena>(rt_.device());
+    auto *arena = arena_.get();
+    // Batched ndarrays are indexed [scene, ...].
+    auto shape = [&](std::vector<int> arr_shape) {
+      if (batched) {
+        arr_shape.insert(arr_shape.begin(), num_scenes_);
+      }
+      return arr_shape;
+    };
+
+    // Prepare Ndarray for model
+    const std::vector<int> vec2_shape = {2};
+    const std::vector<int> vec3_shape = {3};
+    const std::vector<int> vec4_shape = {4};
+    const std::vector<int> mat2_shape = {2, 2};
+    const int n_particles = batched ? kNrParticles : options_.num_particles;
+
+    x_ = NdarrayAndMem::Make(arena, taichi::lang::PrimitiveType::f32,
+                           shape({n_particles}), vec2_shape,
+                           /*host_read=*/true, /*host_write=*/true);
+    v_ = NdarrayAndMem::Make(arena, taichi::lang::PrimitiveType::f32,
+                           shape({n_particles}), vec2_shape);
+    pos_ = NdarrayAndMem::Make(arena, taichi::lang::PrimitiveType::f32,
+                             shape({n_particles}), vec3_shape);
+    // C only feeds the affine term, which tolerates f16. J accumulates
+    // updates smaller than an f16 ulp, so it stays in f32.
+    const taichi::lang::DataType c_dtype =
+        options_.f16_state ? taichi::lang::PrimitiveType::f16
+                           : taichi::lang::PrimitiveType::f32;
+    C_ = NdarrayAndMem::Make(arena, c_dtype, shape({n_particles}), mat2_shape);
+    J_ = NdarrayAndMem::Make(arena, taichi::lang::PrimitiveType::f32,
+                             shape({n_particles}));
+
+    const int n_grid = options_.n_grid;
+    grid_v_ = NdarrayAndMem::Make(arena, taichi::lang::PrimitiveType::f32,
+                                shape({n_grid, n_grid}), vec2_shape);
+    grid_m_ = NdarrayAndMem::Make(arena, taichi::lang::PrimitiveType::f32,
+                                shape({n_grid, n_grid}));
+    if (options_.sparse_grid) {
+      const int n_blocks = n_grid / kGridBlock;
+      // A particle's 3x3 stencil touches at most 2x2 blocks, which bounds
+      // the active list. The grid passes launch a fixed number of threads
+      // that loop over however many blocks are active.
+      const int capacity = std::min(n_blocks * n_blocks, 4 * n_particles);
+      block_mask_ = NdarrayAndMem::Make(arena, taichi::lang::PrimitiveType::i32,
+                                        {n_blocks, n_blocks});
+      active_blocks_ = NdarrayAndMem::Make(
+          arena, taichi::lang::PrimitiveType::i32, {capacity});
+      block_count_ = NdarrayAndMem::Make(
+          arena, taichi::lang::PrimitiveType::i32, {1});
+    }
+    if (options_.tiled_p2g) {
+      const int n_tiles = (n_grid / kGridBlock) * (n_grid / kGridBlock);
+      // The second scan pass is a single workgroup over the block totals.
+      const int n_scan_blocks = (n_tiles + kScanThreads - 1) / kScanThreads;
+      if (n_scan_blocks > kScanThreads) {
+        TI_ERROR("Tiled P2G supports up to {} tiles (a {} grid), got {}",
+                 kScanThreads * kScanThreads,
+                 kGridBlock * kScanThreads, n_tiles);
+      }
+      tile_count_ = NdarrayAndMem::Make(arena, taichi::lang::PrimitiveType::i32,
+                                        {n_tiles});
+      tile_cursor_ = NdarrayAndMem::Make(
+          arena, taichi::lang::PrimitiveType::i32, {n_tiles});
+      // One past the last tile holds the total, so tile t's particles are
+      // always tile_offset[t] .. tile_offset[t + 1].
+      tile_offset_ = NdarrayAndMem::Make(
+          arena, taichi::lang::PrimitiveType::i32, {n_tiles + 1});
+      sorted_ids_ = NdarrayAndMem::Make(
+          arena, taichi::lang::PrimitiveType::i32, {n_particles});
+      // Per-tile work item offsets, with the item count at the end.
+      chunk_offset_ = NdarrayAndMem::Make(
+          arena, taichi::lang::PrimitiveType::i32, {n_tiles + 1});
+      // Particle and work item totals of each scan workgroup.
+      tile_block_sums_ = NdarrayAndMem::Make(
+          arena, taichi::lang::PrimitiveType::i32, {2 * n_scan_blocks});
+      // Every non-empty tile has a partial work item at most, so this bounds
+      // the item count and with it the P2G launch.
+      const int max_work_items = std::min(n_tiles, n_particles) +
+                                 (n_particles + kP2GChunk - 1) / kP2GChunk;
+      work_items_ = NdarrayAndMem::Make(
+          arena, taichi::lang::PrimitiveType::i32, {2 * max_work_items});
+    }
+    if (options_.adaptive_dt) {
+      // [dt, t, max_speed, substeps], copied out once per frame.
+      sim_state_ = NdarrayAndMem::Make(arena, taichi::lang::PrimitiveType::f32,
+                                       {4});
+      taichi::lang::Device::AllocParams readback_params;
+      readback_params.host_write = false;
+      readback_params.host_read = true;
+      readback_params.size = sizeof(SimState);
+      readback_params.usage = taichi::lang::AllocUsage::Storage;
+      sim_state_readbacks_.resize(kSimStateReadbacks);
+      for (auto &slot : sim_state_readbacks_) {
+        slot.buffer = arena->Allocate(readback_params);
+        slot.fence = std::make_unique<QueueFence>(rt_.device()->vk_device());
+      }
+    }
+    if (options_.sdf_boundary) {
+      sdf_ = SdfVolume::Load(rt_.runtime(),
+                             rt_.module_path() + "boundary.sdf");
+      if (sdf_->num_dimensions() != 2 || sdf_->res(0) != kSdfRes ||
+          sdf_->res(1) != kSdfRes) {
+        TI_ERROR("boundary.sdf must be {0}x{0}", kSdfRes);
+      }
+    }
+
+    alloc_phase.End();
+
+    // Bound once; Step() never touches the map again.
+    using taichi::lang::aot::IValue;
+    args_.Bind("x", IValue::create(x_->ndarray()));
+    args_.Bind("v", IValue::create(v_->ndarray()));
+    args_.Bind("J", IValue::create(J_->ndarray()));
+    args_.Bind("C", IValue::create(C_->ndarray()));
+    args_.Bind("grid_v", IValue::create(grid_v_->ndarray()));
+    args_.Bind("grid_m", IValue::create(grid_m_->ndarray()));
+    args_.Bind("pos", IValue::create(pos_->ndarray()));
+    if (options_.sparse_grid) {
+      args_.Bind("block_mask", IValue::create(block_mask_->ndarray()));
+      args_.Bind("active_blocks", IValue::create(active_blocks_->ndarray()));
+      args_.Bind("block_count", IValue::create(block_count_->ndarray()));
+    }
+    if (options_.tiled_p2g) {
+      args_.Bind("tile_count", IValue::create(tile_count_->ndarray()));
+      args_.Bind("tile_cursor", IValue::create(tile_cursor_->ndarray()));
+      args_.Bind("tile_offset", IValue::create(tile_offset_->ndarray()));
+      args_.Bind("sorted_ids", IValue::create(sorted_ids_->ndarray()));
+      args_.Bind("chunk_offset", IValue::create(chunk_offset_->ndarray()));
+      args_.Bind("tile_block_sums",
+                 IValue::create(tile_block_sums_->ndarray()));
+      args_.Bind("work_items", IValue::create(work_items_->ndarray()));
+    }
+    if (options_.adaptive_dt) {
+      args_.Bind("sim_state", IValue::create(sim_state_->ndarray()));
+    }
+    if (sdf_) {
+      args_.Bind("sdf", IValue::create(sdf_->texture()));
+    }
+
+    if (batched) {
+      ProfileScope params_phase("upload scene params");
+      // params[s] = [E, gravity, num_particles, 0]
+      params_ = NdarrayAndMem::Make(arena, taichi::lang::PrimitiveType::f32,
+                                  {num_scenes_}, vec4_shape,
+                                  /*host_read=*/false, /*host_write=*/true);
+      std::vector<float> params_data;
+      for (const auto &scene : scenes) {
+        params_data.insert(params_data.end(),
+                           {scene.E, scene.gravity,
+                            float(std::min(scene.num_particles, kNrParticles)),
+                            0.0f});
+      }
+      void *mapped = rt_.device()->map(params_->devalloc());
+      std::memcpy(mapped, params_data.data(),
+                  params_data.size() * sizeof(float));
+      rt_.device()->unmap(params_->devalloc());
+      args_.Bind("params", IValue::create(params_->ndarray()));
+    }
+    arena_->Report("mpm88", MillisecondsSince(alloc_begin));
+    device_lock.unlock();
+
+    {
+      ProfileScope reset_phase("init graph", [this] {
+        rt_.runtime()->synchronize();
+      });
+      Reset();
+    }
+    rt_.FinishLoad("mpm88");
+  }
+
+  // Outlives everything below, which lives on its device and module.
+  GraphRuntime rt_;
+  // Owns the memory of every ndarray below.
+  std::unique_ptr<DeviceArena> arena_{nullptr};
   std::unique_ptr<NdarrayAndMem> x_{nullptr};
   std::unique_ptr<NdarrayAndMem> v_{nullptr};
   std::unique_ptr<NdarrayAndMem> J_{nullptr};
@@ -192,91 +534,212 @@ private:
   std::unique_ptr<NdarrayAndMem> grid_v_{nullptr};
   std::unique_ptr<NdarrayAndMem> grid_m_{nullptr};
   std::unique_ptr<NdarrayAndMem> pos_{nullptr};
-  std::unique_ptr<taichi::lang::aot::CompiledGraph> g_init_{nullptr};
-  std::unique_ptr<taichi::lang::aot::CompiledGraph> g_update_{nullptr};
-
-  std::unordered_map<std::string, taichi::lang::aot::IValue> args_;
+  std::unique_ptr<NdarrayAndMem> params_{nullptr};
+  std::unique_ptr<NdarrayAndMem> block_mask_{nullptr};
+  std::unique_ptr<NdarrayAndMem> active_blocks_{nullptr};
+  std::unique_ptr<NdarrayAndMem> block_count_{nullptr};
+  std::unique_ptr<NdarrayAndMem> tile_count_{nullptr};
+  std::unique_ptr<NdarrayAndMem> tile_cursor_{nullptr};
+  std::unique_ptr<NdarrayAndMem> tile_offset_{nullptr};
+  std::unique_ptr<NdarrayAndMem> sorted_ids_{nullptr};
+  std::unique_ptr<NdarrayAndMem> chunk_offset_{nullptr};
+  std::unique_ptr<NdarrayAndMem> tile_block_sums_{nullptr};
+  std::unique_ptr<NdarrayAndMem> work_items_{nullptr};
+  std::unique_ptr<NdarrayAndMem> sim_state_{nullptr};
+  std::unique_ptr<SdfVolume> sdf_{nullptr};
+  int num_scenes_{1};
+  MPM88Options options_;
+  Lazy<std::unique_ptr<taichi::lang::aot::CompiledGraph>> g_init_;
+  Lazy<std::unique_ptr<taichi::lang::aot::CompiledGraph>> g_update_;
+  Lazy<std::unique_ptr<taichi::lang::aot::CompiledGraph>> g_begin_frame_;
+
+  std::vector<SimStateReadback> sim_state_readbacks_;
+  size_t sim_state_frame_{0};
+  // The dt and the shortfall of the newest frame read back, for planning
+  // the next one.
+  float next_dt_{2e-4f};
+  float carried_time_{0};
+  struct {
+    int frames{0};
+    int64_t substeps{0};
+    // Substeps queued, including the no-ops past the end of a frame.
+    int64_t dispatched{0};
+    int short_frames{0};
+    int unstable_frame{-1};
+    float min_dt{kFrameDt};
+    float max_dt{0};
+    float peak_speed{0};
+  } dt_stats_;
+
+  GraphArgs args_;
 };
 
-MPM88Demo::MPM88Demo() {
-  // Init gl window
-  glfwInit();
-  glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
-  window = glfwCreateWindow(512, 512, "Taichi show", NULL, NULL);
-  if (window == NULL) {
-    std::cout << "Failed to create GLFW window" << std::endl;
-    glfwTerminate();
+// Runs `num_steps` frames for 1, 2, 4, ... and `max_scenes` batched
+// scenes with varied stiffness, gravity and particle counts, and prints the
+// throughput in scene-steps/sec for each batch size.
+void RunBatchedSweep(int max_scenes, int num_steps) {
+  std::cout << "scenes, ms/step, scene-steps/sec" << std::endl;
+  for (int k : SweepSizes(1, max_scenes)) {
+    std::vector<SceneParams> scenes(k);
+    for (int s = 0; s < k; s++) {
+      const float t = k > 1 ? float(s) / (k - 1) : 0.0f;
+      scenes[s].E = 200 + 600 * t;
+      scenes[s].gravity = 4.9 + 9.8 * t;
+      scenes[s].num_particles = kNrParticles / 2 + (kNrParticles / 2) * s / k;
+    }
+    MPM88DemoImpl impl(scenes);
+    const double ms = MillisecondsPerRun(num_steps, [&] { impl.Step(); });
+    std::cout << k << ", " << ms << ", " << k * 1000.0 / ms << std::endl;
+  }
+}
+
+// Runs `num_steps` frames of the single-scene simulation with C stored in f32
+// and then in f16, and prints the particle state size and step time of
+// each.
+void RunPrecisionComparison(int num_steps) {
+  std::cout << "C dtype, particle state KiB, ms/step" << std::endl;
+  for (bool f16_state : {false, true}) {
+    MPM88Options options;
+    options.f16_state = f16_state;
+    MPM88DemoImpl impl({}, options);
+    if (f16_state && !impl.f16_state()) {
+      break;
+    }
+    std::cout << (f16_state ? "f16" : "f32") << ", "
+              << impl.particle_state_bytes() / 1024.0 << ", "
+              << MillisecondsPerRun(num_steps, [&] { impl.Step(); })
+              << std::endl;
   }
+}
 
-  // Create a GGUI configuration
-  taichi::ui::AppConfig app_config;
-  app_config.name = "MPM88";
-  app_config.width = 512;
-  app_config.height = 512;
-  app_config.vsync = true;
-  app_config.show_window = false;
-  app_config.package_path = "../"; // make it flexible later
-  app_config.ti_arch = taichi::Arch::vulkan;
-
-  // Create GUI & renderer
-  renderer = std::make_unique<taichi::ui::vulkan::Renderer>();
-  renderer->init(nullptr, window, app_config);
-
-  renderer->set_background_color({0.6, 0.6, 0.6});
-
-  gui_ = std::make_shared<taichi::ui::vulkan::Gui>(
-      &renderer->app_context(), &renderer->swap_chain(), window);
-
-  // Create Taichi Device for computation
-  taichi::lang::vulkan::VulkanDevice *device_ =
-      &(renderer->app_context().device());
-
-  impl_ = std::make_unique<MPM88DemoImpl>(device_);
-
-  // Describe information to render the circle with Vulkan
-  f_info.valid = true;
-  f_info.field_type = taichi::ui::FieldType::Scalar;
-  f_info.matrix_rows = 1;
-  f_info.matrix_cols = 1;
-  f_info.shape = {kNrParticles};
-  f_info.field_source = taichi::ui::FieldSource::TaichiVulkan;
-  f_info.dtype = taichi::lang::PrimitiveType::f32;
-  f_info.snode = nullptr;
-  f_info.dev_alloc = impl_->pos();
-
-  circles.renderable_info.has_per_vertex_color = false;
-  circles.renderable_info.vbo_attrs = taichi::ui::VertexAttributes::kPos;
-  circles.renderable_info.vbo = f_info;
-  circles.color = {0.8, 0.4, 0.1};
-  circles.radius = 0.005f; // 0.0015f looks unclear on desktop
+// Runs `num_steps` frames on dense and block-sparse grids of 128^2 up to
+// `max_grid`^2 nodes with the particle count fixed, and prints the step time
+// of each.
+void RunGridSweep(int max_grid, int num_steps) {
+  std::cout << "grid, dense ms/step, sparse ms/step" << std::endl;
+  // Grids are whole blocks, so a max_grid in between is rounded down.
+  for (int n_grid : SweepSizes(128, max_grid / kGridBlock * kGridBlock)) {
+    std::cout << n_grid;
+    for (bool sparse : {false, true}) {
+      MPM88Options options;
+      options.sparse_grid = sparse;
+      options.n_grid = n_grid;
+      MPM88DemoImpl impl({}, options);
+      std::cout << ", " << MillisecondsPerRun(num_steps, [&] { impl.Step(); });
+    }
+    std::cout << std::endl;
+  }
 }
 
-void MPM88Demo::Step() {
-  while (!glfwWindowShouldClose(window)) {
-    impl_->Step();
+// Times P2G with per-particle global atomics and with per-tile shared-memory
+// accumulation for 16k particles and 4x, 16x that many in the same volume,
+// and prints the time per pass of each.
+void RunP2GComparison(int num_runs) {
+  std::cout << "particles, atomic P2G ms, tiled P2G ms" << std::endl;
+  for (int num_particles : SweepSizes(kNrParticles, 16 * kNrParticles, 4)) {
+    std::cout << num_particles;
+    for (bool tiled : {false, true}) {
+      MPM88Options options;
+      options.tiled_p2g = tiled;
+      options.num_particles = num_particles;
+      MPM88DemoImpl impl({}, options);
+      // Let the particles settle into a realistic distribution.
+      impl.Step();
+      std::cout << ", " << impl.TimeP2G(num_runs);
+    }
+    std::cout << std::endl;
+  }
+}
 
-    // Render elements
-    renderer->circles(circles);
-    renderer->draw_frame(gui_.get());
-    renderer->swap_chain().surface().present_image();
-    renderer->prepare_for_next_frame();
+MPM88Demo::MPM88Demo(const OffscreenOptions &offscreen,
+                     const MPM88Options &options)
+    : window_(std::make_unique<CirclesWindow>("MPM88", offscreen)) {
+  impl_ = std::make_unique<MPM88DemoImpl>(
+      window_->device(), std::vector<SceneParams>{}, options);
+  // 0.0015f looks unclear on desktop
+  window_->SetParticles(impl_->pos(), options.num_particles, 0.005f);
+}
 
-    glfwSwapBuffers(window);
-    glfwPollEvents();
-  }
+void MPM88Demo::Step() {
+  window_->Run([this] { impl_->Step(); });
+  impl_->ReportTimeStepping();
 }
 
 MPM88Demo::~MPM88Demo() {
+  // The window owns the device the simulation runs on.
   impl_.reset();
-  gui_.reset();
-  // renderer owns the device so it must be destructed last.
-  renderer.reset();
+  window_.reset();
 }
 
 } // namespace demo
 
-int main() {
-  auto mpm88_demo = std::make_unique<demo::MPM88Demo>();
+int main(int argc, char **argv) {
+  demo::MillisecondsSinceStartup();
+  demo::StartupProfiler::Get().ParseArgs(argc, argv);
+  demo::AsyncModuleLoader::DefaultMode() =
+      demo::ParsePipelineLoadMode(argc, argv);
+  // `--batch <k> [--steps <n>]` benchmarks batched parameter sweeps headless.
+  // `--f16` stores C in f16; `--compare-precision [--steps <n>]`
+  // benchmarks that against f32 headless.
+  // `--sparse` and `--grid <n>` select the block-sparse grid and its size;
+  // `--grid-sweep <max n> [--steps <n>]` benchmarks dense against sparse.
+  // `--tiled-p2g` scatters through shared memory and `--particles <n>` sets
+  // the particle count; `--compare-p2g [--steps <n>]` times P2G both ways.
+  // `--adaptive-dt` picks each substep's dt from a CFL limit.
+  // `--sdf` collides with the SDF mpm88.py bakes instead of fixed walls.
+  int batch = 0;
+  int steps = 100;
+  int grid_sweep = 0;
+  bool compare_precision = false;
+  bool compare_p2g = false;
+  demo::MPM88Options options;
+  for (int i = 1; i < argc; i++) {
+    const std::string arg = argv[i];
+    if (arg == "--f16") {
+      options.f16_state = true;
+    } else if (arg == "--sparse") {
+      options.sparse_grid = true;
+    } else if (arg == "--tiled-p2g") {
+      options.tiled_p2g = true;
+    } else if (arg == "--adaptive-dt") {
+      options.adaptive_dt = true;
+    } else if (arg == "--sdf") {
+      options.sdf_boundary = true;
+    } else if (arg == "--compare-precision") {
+      compare_precision = true;
+    } else if (arg == "--compare-p2g") {
+      compare_p2g = true;
+    } else if (i + 1 < argc && arg == "--batch") {
+      batch = std::stoi(argv[++i]);
+    } else if (i + 1 < argc && arg == "--steps") {
+      steps = std::stoi(argv[++i]);
+    } else if (i + 1 < argc && arg == "--grid") {
+      options.n_grid = std::stoi(argv[++i]);
+    } else if (i + 1 < argc && arg == "--particles") {
+      options.num_particles = std::stoi(argv[++i]);
+    } else if (i + 1 < argc && arg == "--grid-sweep") {
+      grid_sweep = std::stoi(argv[++i]);
+    }
+  }
+  if (batch > 0) {
+    demo::RunBatchedSweep(batch, steps);
+    return 0;
+  }
+  if (compare_precision) {
+    demo::RunPrecisionComparison(steps);
+    return 0;
+  }
+  if (compare_p2g) {
+    demo::RunP2GComparison(steps);
+    return 0;
+  }
+  if (grid_sweep > 0) {
+    demo::RunGridSweep(grid_sweep, steps);
+    return 0;
+  }
+
+  auto offscreen = demo::OffscreenOptions::Parse(argc, argv);
+  auto mpm88_demo = std::make_unique<demo::MPM88Demo>(offscreen, options);
   mpm88_demo->Step();
 
   return 0;
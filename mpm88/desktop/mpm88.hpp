@@ -5,22 +5,41 @@
 #include <taichi/ui/backends/vulkan/renderer.h>
 #include <vector>
 
+#include "offscreen.hpp"
+
 namespace demo {
 
+// Variants of the simulation; batched runs only take n_grid. At most one of
+// f16_state, sparse_grid, tiled_p2g, adaptive_dt and sdf_boundary may be set.
+struct MPM88Options {
+  // Store C in f16; J stays in f32.
+  bool f16_state{false};
+  // Only visit the grid blocks that particles touch.
+  bool sparse_grid{false};
+  // Scatter particles to the grid through per-tile shared memory.
+  bool tiled_p2g{false};
+  // Pick each substep's dt from a CFL limit instead of a fixed 2e-4.
+  bool adaptive_dt{false};
+  // Collide with the SDF baked into shaders/boundary.sdf instead of the
+  // fixed walls.
+  bool sdf_boundary{false};
+  // Grid nodes per side.
+  int n_grid{128};
+  int num_particles{8192 * 2};
+};
+
+class CirclesWindow;
 class MPM88DemoImpl;
 class MPM88Demo {
 public:
-  MPM88Demo();
+  explicit MPM88Demo(const OffscreenOptions &offscreen = {},
+                     const MPM88Options &options = {});
   ~MPM88Demo();
 
   void Step();
 
 private:
+  std::unique_ptr<CirclesWindow> window_{nullptr};
   std::unique_ptr<MPM88DemoImpl> impl_{nullptr};
-  std::shared_ptr<taichi::ui::vulkan::Gui> gui_{nullptr};
-  std::unique_ptr<taichi::ui::vulkan::Renderer> renderer{nullptr};
-  GLFWwindow *window{nullptr};
-  taichi::ui::FieldInfo f_info;
-  taichi::ui::CirclesInfo circles;
 };
 } // namespace demo
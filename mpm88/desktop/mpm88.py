@@ -1,3 +1,4 @@
+import numpy as np
 import taichi as ti
 import tempfile
 
@@ -5,6 +6,8 @@ ti.init(ti.vulkan)
 n_particles = 8192 * 5
 n_grid = 128
 dt = 2e-4
+# Substeps per frame.
+N_ITER = 50
 
 p_rho = 1
 gravity = 9.8
@@ -18,70 +21,82 @@ def substep_reset_grid(grid_v: ti.any_arr(field_dim=2),
         grid_v[i, j] = [0, 0]
         grid_m[i, j] = 0
 
+@ti.func
+def p2g_particle(x, v, C, J, grid_v, grid_m, p, dt):
+    dx = 1 / grid_v.shape[0]
+    p_vol = (dx * 0.5)**2
+    p_mass = p_vol * p_rho
+    Xp = x[p] / dx
+    base = int(Xp - 0.5)
+    fx = Xp - base
+    w = [0.5 * (1.5 - fx)**2, 0.75 - (fx - 1)**2, 0.5 * (fx - 0.5)**2]
+    stress = -dt * 4 * E * p_vol * (J[p] - 1) / dx**2
+    affine = ti.Matrix([[stress, 0], [0, stress]]) + p_mass * C[p]
+    for i, j in ti.static(ti.ndrange(3, 3)):
+        offset = ti.Vector([i, j])
+        dpos = (offset - fx) * dx
+        weight = w[i].x * w[j].y
+        grid_v[base +
+               offset] += weight * (p_mass * v[p] + affine @ dpos)
+        grid_m[base + offset] += weight * p_mass
+
 @ti.kernel
 def substep_p2g(x: ti.any_arr(field_dim=1), v: ti.any_arr(field_dim=1),
                 C: ti.any_arr(field_dim=1), J: ti.any_arr(field_dim=1),
                 grid_v: ti.any_arr(field_dim=2),
                 grid_m: ti.any_arr(field_dim=2)):
     for p in x:
-        dx = 1 / grid_v.shape[0]
-        p_vol = (dx * 0.5)**2
-        p_mass = p_vol * p_rho
-        Xp = x[p] / dx
-        base = int(Xp - 0.5)
-        fx = Xp - base
-        w = [0.5 * (1.5 - fx)**2, 0.75 - (fx - 1)**2, 0.5 * (fx - 0.5)**2]
-        stress = -dt * 4 * E * p_vol * (J[p] - 1) / dx**2
-        affine = ti.Matrix([[stress, 0], [0, stress]]) + p_mass * C[p]
-        for i, j in ti.static(ti.ndrange(3, 3)):
-            offset = ti.Vector([i, j])
-            dpos = (offset - fx) * dx
-            weight = w[i].x * w[j].y
-            grid_v[base +
-                   offset] += weight * (p_mass * v[p] + affine @ dpos)
-            grid_m[base + offset] += weight * p_mass
+        p2g_particle(x, v, C, J, grid_v, grid_m, p, dt)
+
+@ti.func
+def update_grid_node(grid_v, grid_m, i, j, dt):
+    num_grid = grid_v.shape[0]
+    if grid_m[i, j] > 0:
+        grid_v[i, j] /= grid_m[i, j]
+    grid_v[i, j].y -= dt * gravity
+    if i < bound and grid_v[i, j].x < 0:
+        grid_v[i, j].x = 0
+    if i > num_grid - bound and grid_v[i, j].x > 0:
+        grid_v[i, j].x = 0
+    if j < bound and grid_v[i, j].y < 0:
+        grid_v[i, j].y = 0
+    if j > num_grid - bound and grid_v[i, j].y > 0:
+        grid_v[i, j].y = 0
 
 @ti.kernel
 def substep_update_grid_v(grid_v: ti.any_arr(field_dim=2),
                           grid_m: ti.any_arr(field_dim=2)):
     for i, j in grid_m:
-        num_grid = grid_v.shape[0]
-        if grid_m[i, j] > 0:
-            grid_v[i, j] /= grid_m[i, j]
-        grid_v[i, j].y -= dt * gravity
-        if i < bound and grid_v[i, j].x < 0:
-            grid_v[i, j].x = 0
-        if i > num_grid - bound and grid_v[i, j].x > 0:
-            grid_v[i, j].x = 0
-        if j < bound and grid_v[i, j].y < 0:
-            grid_v[i, j].y = 0
-        if j > num_grid - bound and grid_v[i, j].y > 0:
-            grid_v[i, j].y = 0
+        update_grid_node(grid_v, grid_m, i, j, dt)
+
+@ti.func
+def g2p_particle(x, v, C, J, grid_v, pos, p, dt):
+    dx = 1 / grid_v.shape[0]
+    Xp = x[p] / dx
+    base = int(Xp - 0.5)
+    fx = Xp - base
+    w = [0.5 * (1.5 - fx)**2, 0.75 - (fx - 1)**2, 0.5 * (fx - 0.5)**2]
+    new_v = ti.Vector.zero(float, 2)
+    new_C = ti.Matrix.zero(float, 2, 2)
+    for i, j in ti.static(ti.ndrange(3, 3)):
+        offset = ti.Vector([i, j])
+        dpos = (offset - fx) * dx
+        weight = w[i].x * w[j].y
+        g_v = grid_v[base + offset]
+        new_v += weight * g_v
+        new_C += 4 * weight * g_v.outer_product(dpos) / dx**2
+    v[p] = new_v
+    x[p] += dt * v[p]
+    pos[p] = [x[p][0], x[p][1], 0]
+    J[p] *= 1 + dt * new_C.trace()
+    C[p] = new_C
 
 @ti.kernel
 def substep_g2p(x: ti.any_arr(field_dim=1), v: ti.any_arr(field_dim=1),
                 C: ti.any_arr(field_dim=1), J: ti.any_arr(field_dim=1),
                 grid_v: ti.any_arr(field_dim=2), pos: ti.any_arr(field_dim=1)):
     for p in x:
-        dx = 1 / grid_v.shape[0]
-        Xp = x[p] / dx
-        base = int(Xp - 0.5)
-        fx = Xp - base
-        w = [0.5 * (1.5 - fx)**2, 0.75 - (fx - 1)**2, 0.5 * (fx - 0.5)**2]
-        new_v = ti.Vector.zero(float, 2)
-        new_C = ti.Matrix.zero(float, 2, 2)
-        for i, j in ti.static(ti.ndrange(3, 3)):
-            offset = ti.Vector([i, j])
-            dpos = (offset - fx) * dx
-            weight = w[i].x * w[j].y
-            g_v = grid_v[base + offset]
-            new_v += weight * g_v
-            new_C += 4 * weight * g_v.outer_product(dpos) / dx**2
-        v[p] = new_v
-        x[p] += dt * v[p]
-        pos[p] = [x[p][0], x[p][1], 0]
-        J[p] *= 1 + dt * new_C.trace()
-        C[p] = new_C
+        g2p_particle(x, v, C, J, grid_v, pos, p, dt)
 
 @ti.kernel
 def init_particles(x: ti.any_arr(field_dim=1), v: ti.any_arr(field_dim=1),
@@ -91,7 +106,556 @@ def init_particles(x: ti.any_arr(field_dim=1), v: ti.any_arr(field_dim=1),
         v[i] = [0, -1]
         J[i] = 1
 
-N_ITER = 50
+# Signed distance field boundaries: the distance to the scene geometry,
+# positive in the fluid, is baked into an SDF_RES^2 texture over the unit
+# square and sampled with hardware bilinear filtering. Grid nodes closer than
+# `bound` cells to it lose the velocity component into it, which for the
+# walls is exactly the fixed `bound` handling above. That costs one texture
+# fetch per node, plus four for the normal near geometry, however complex
+# the geometry is. The default scene is the walls plus a ball on the floor,
+# right of where the particles start.
+SDF_RES = 256
+SDF_BALL_CENTER = np.array([0.75, 0.12])
+SDF_BALL_RADIUS = 0.1
+
+
+def write_sdf(path):
+    # Texel (i, j) holds the distance at ((i, j) + 0.5) / SDF_RES; x varies
+    # fastest in the file.
+    c = (np.arange(SDF_RES) + 0.5) / SDF_RES
+    y, x = np.meshgrid(c, c, indexing='ij')
+    p = np.stack([x, y], axis=-1)
+    walls = np.minimum(p, 1.0 - p).min(axis=-1)
+    ball = np.linalg.norm(p - SDF_BALL_CENTER, axis=-1) - SDF_BALL_RADIUS
+    d = np.minimum(walls, ball).astype(np.float32)
+    with open(path, 'wb') as f:
+        f.write(b'SDF1')
+        np.array([SDF_RES, SDF_RES, 1], dtype=np.int32).tofile(f)
+        d.tofile(f)
+
+@ti.func
+def sdf_at(sdf, p):
+    return sdf.sample_lod(p, 0.0).r
+
+@ti.kernel
+def substep_update_grid_v_sdf(grid_v: ti.any_arr(field_dim=2),
+                              grid_m: ti.any_arr(field_dim=2),
+                              sdf: ti.types.texture(num_dimensions=2)):
+    for i, j in grid_m:
+        dx = 1 / grid_v.shape[0]
+        if grid_m[i, j] > 0:
+            grid_v[i, j] /= grid_m[i, j]
+        grid_v[i, j].y -= dt * gravity
+        p = ti.Vector([i, j]) * dx
+        if sdf_at(sdf, p) < bound * dx:
+            # Central differences one texel apart.
+            e = 1.0 / SDF_RES
+            n = ti.Vector([
+                sdf_at(sdf, p + ti.Vector([e, 0.0])) -
+                sdf_at(sdf, p - ti.Vector([e, 0.0])),
+                sdf_at(sdf, p + ti.Vector([0.0, e])) -
+                sdf_at(sdf, p - ti.Vector([0.0, e]))
+            ])
+            n /= max(n.norm(), 1e-6)
+            vn = n.dot(grid_v[i, j])
+            if vn < 0:
+                grid_v[i, j] -= vn * n
+
+# Block-sparse variants: the grid is split into BLOCK x BLOCK blocks and the
+# grid passes only visit blocks that particles touch. Each substep marks the
+# blocks under every particle's 3x3 stencil, appending each newly marked
+# block to `active_blocks` (with the count in `block_count[0]`), and after
+# G2P clears exactly those blocks again, so the grid is all zero between
+# substeps without a dense reset. The grid passes run SPARSE_WORKERS
+# persistent threads that stride over the active nodes, so no launch grows
+# with the grid size and the work follows block_count, which the host never
+# reads back.
+BLOCK = 8
+SPARSE_WORKERS = 8192
+
+@ti.kernel
+def clear_grid(grid_v: ti.any_arr(field_dim=2),
+               grid_m: ti.any_arr(field_dim=2),
+               block_mask: ti.any_arr(field_dim=2)):
+    for i, j in grid_m:
+        grid_v[i, j] = [0, 0]
+        grid_m[i, j] = 0
+    for bi, bj in block_mask:
+        block_mask[bi, bj] = 0
+
+@ti.kernel
+def substep_reset_block_count(block_count: ti.any_arr(field_dim=1)):
+    block_count[0] = 0
+
+@ti.kernel
+def substep_mark_blocks(x: ti.any_arr(field_dim=1),
+                        grid_m: ti.any_arr(field_dim=2),
+                        block_mask: ti.any_arr(field_dim=2),
+                        active_blocks: ti.any_arr(field_dim=1),
+                        block_count: ti.any_arr(field_dim=1)):
+    for p in x:
+        dx = 1 / grid_m.shape[0]
+        base = int(x[p] / dx - 0.5)
+        # The stencil spans base .. base + 2, i.e. at most 2x2 blocks.
+        for i, j in ti.static(ti.ndrange(2, 2)):
+            b = (base + ti.Vector([i, j]) * 2) // BLOCK
+            # Only the thread that marks a block first appends it.
+            if ti.atomic_or(block_mask[b], 1) == 0:
+                k = ti.atomic_add(block_count[0], 1)
+                active_blocks[k] = b.x * block_mask.shape[1] + b.y
+
+@ti.func
+def active_block(block_mask, active_blocks, k):
+    b = active_blocks[k]
+    return ti.Vector([b // block_mask.shape[1], b % block_mask.shape[1]])
+
+@ti.kernel
+def substep_update_grid_v_sparse(grid_v: ti.any_arr(field_dim=2),
+                                 grid_m: ti.any_arr(field_dim=2),
+                                 block_mask: ti.any_arr(field_dim=2),
+                                 active_blocks: ti.any_arr(field_dim=1),
+                                 block_count: ti.any_arr(field_dim=1)):
+    for t in range(SPARSE_WORKERS):
+        n = block_count[0] * BLOCK * BLOCK
+        node = t
+        while node < n:
+            k = node // (BLOCK * BLOCK)
+            c = node % (BLOCK * BLOCK)
+            blk = active_block(block_mask, active_blocks, k)
+            update_grid_node(grid_v, grid_m, blk.x * BLOCK + c // BLOCK,
+                             blk.y * BLOCK + c % BLOCK, dt)
+            node += SPARSE_WORKERS
+
+@ti.kernel
+def substep_clear_active_blocks(grid_v: ti.any_arr(field_dim=2),
+                                grid_m: ti.any_arr(field_dim=2),
+                                block_mask: ti.any_arr(field_dim=2),
+                                active_blocks: ti.any_arr(field_dim=1),
+                                block_count: ti.any_arr(field_dim=1)):
+    for t in range(SPARSE_WORKERS):
+        n = block_count[0] * BLOCK * BLOCK
+        node = t
+        while node < n:
+            k = node // (BLOCK * BLOCK)
+            c = node % (BLOCK * BLOCK)
+            blk = active_block(block_mask, active_blocks, k)
+            i = blk.x * BLOCK + c // BLOCK
+            j = blk.y * BLOCK + c % BLOCK
+            grid_v[i, j] = [0, 0]
+            grid_m[i, j] = 0
+            if c == 0:
+                block_mask[blk] = 0
+            node += SPARSE_WORKERS
+
+# Tiled P2G: each substep buckets particles by the BLOCK x BLOCK tile that
+# holds their stencil base (a counting sort into `sorted_ids`, with tile t's
+# particles at tile_offset[t] .. tile_offset[t + 1]). Each tile's range is
+# then cut into work items of at most P2G_CHUNK particles, so a dense tile is
+# spread over several workgroups instead of serializing on one. A workgroup
+# takes one work item: its threads scatter the item's particles into a
+# (BLOCK + 2)^2 halo of the tile in shared memory and flush the halo to the
+# grid with one global atomic per touched node and channel, instead of 27
+# per particle. The offsets come from a three-pass parallel scan: per
+# SCAN_THREADS tiles in shared memory, over the per-block sums, then adding
+# those back. `tile_count` must be zero on entry; the scan leaves it zeroed
+# again.
+P2G_THREADS = 64
+P2G_CHUNK = 4 * P2G_THREADS
+HALO = BLOCK + 2
+SCAN_THREADS = 256
+SCAN_STEPS = 8  # log2(SCAN_THREADS)
+
+@ti.func
+def particle_tile(x, p, num_grid):
+    base = int(x[p] * num_grid - 0.5)
+    tile = base // BLOCK
+    return tile.x * (num_grid // BLOCK) + tile.y
+
+@ti.kernel
+def clear_tile_counts(tile_count: ti.any_arr(field_dim=1)):
+    for t in tile_count:
+        tile_count[t] = 0
+
+@ti.kernel
+def substep_count_tiles(x: ti.any_arr(field_dim=1),
+                        grid_m: ti.any_arr(field_dim=2),
+                        tile_count: ti.any_arr(field_dim=1)):
+    for p in x:
+        ti.atomic_add(tile_count[particle_tile(x, p, grid_m.shape[0])], 1)
+
+@ti.func
+def scan_block(s_particles: ti.template(), s_chunks: ti.template(), k):
+    # Inclusive Hillis-Steele scan of both channels in shared memory.
+    for step in ti.static(range(SCAN_STEPS)):
+        d = 1 << step
+        add_particles = 0
+        add_chunks = 0
+        if k >= d:
+            add_particles = s_particles[k - d]
+            add_chunks = s_chunks[k - d]
+        ti.simt.block.sync()
+        s_particles[k] = s_particles[k] + add_particles
+        s_chunks[k] = s_chunks[k] + add_chunks
+        ti.simt.block.sync()
+
+@ti.kernel
+def substep_scan_tiles_local(tile_count: ti.any_arr(field_dim=1),
+                             tile_offset: ti.any_arr(field_dim=1),
+                             chunk_offset: ti.any_arr(field_dim=1),
+                             tile_block_sums: ti.any_arr(field_dim=1)):
+    # One workgroup per SCAN_THREADS tiles; the last one is padded with
+    # empty tiles. Leaves block-local exclusive offsets and each block's
+    # totals.
+    ti.loop_config(block_dim=SCAN_THREADS)
+    for t in range(tile_block_sums.shape[0] // 2 * SCAN_THREADS):
+        s_particles = ti.simt.block.SharedArray((SCAN_THREADS, ), ti.i32)
+        s_chunks = ti.simt.block.SharedArray((SCAN_THREADS, ), ti.i32)
+        k = t % SCAN_THREADS
+        count = 0
+        if t < tile_count.shape[0]:
+            count = tile_count[t]
+        chunks = (count + P2G_CHUNK - 1) // P2G_CHUNK
+        s_particles[k] = count
+        s_chunks[k] = chunks
+        ti.simt.block.sync()
+        scan_block(s_particles, s_chunks, k)
+        if t < tile_count.shape[0]:
+            tile_offset[t] = s_particles[k] - count
+            chunk_offset[t] = s_chunks[k] - chunks
+        if k == SCAN_THREADS - 1:
+            b = t // SCAN_THREADS
+            tile_block_sums[2 * b] = s_particles[k]
+            tile_block_sums[2 * b + 1] = s_chunks[k]
+
+@ti.kernel
+def substep_scan_tile_blocks(tile_offset: ti.any_arr(field_dim=1),
+                             chunk_offset: ti.any_arr(field_dim=1),
+                             tile_block_sums: ti.any_arr(field_dim=1)):
+    # One workgroup turns the block totals into exclusive block offsets; the
+    # host keeps the number of blocks at or below SCAN_THREADS.
+    ti.loop_config(block_dim=SCAN_THREADS)
+    for k in range(SCAN_THREADS):
+        s_particles = ti.simt.block.SharedArray((SCAN_THREADS, ), ti.i32)
+        s_chunks = ti.simt.block.SharedArray((SCAN_THREADS, ), ti.i32)
+        n_blocks = tile_block_sums.shape[0] // 2
+        particles = 0
+        chunks = 0
+        if k < n_blocks:
+            particles = tile_block_sums[2 * k]
+            chunks = tile_block_sums[2 * k + 1]
+        s_particles[k] = particles
+        s_chunks[k] = chunks
+        ti.simt.block.sync()
+        scan_block(s_particles, s_chunks, k)
+        if k < n_blocks:
+            tile_block_sums[2 * k] = s_particles[k] - particles
+            tile_block_sums[2 * k + 1] = s_chunks[k] - chunks
+        if k == SCAN_THREADS - 1:
+            n_tiles = tile_offset.shape[0] - 1
+            tile_offset[n_tiles] = s_particles[k]
+            chunk_offset[n_tiles] = s_chunks[k]
+
+@ti.kernel
+def substep_emit_tile_work(tile_count: ti.any_arr(field_dim=1),
+                           tile_offset: ti.any_arr(field_dim=1),
+                           tile_cursor: ti.any_arr(field_dim=1),
+                           chunk_offset: ti.any_arr(field_dim=1),
+                           tile_block_sums: ti.any_arr(field_dim=1),
+                           work_items: ti.any_arr(field_dim=1)):
+    # Adds the block offsets, resets the counts for the next substep and
+    # writes each tile's work items as (tile, first sorted index) pairs.
+    for t in tile_count:
+        b = t // SCAN_THREADS
+        offset = tile_offset[t] + tile_block_sums[2 * b]
+        first_chunk = chunk_offset[t] + tile_block_sums[2 * b + 1]
+        count = tile_count[t]
+        tile_offset[t] = offset
+        tile_cursor[t] = offset
+        tile_count[t] = 0
+        for c in range((count + P2G_CHUNK - 1) // P2G_CHUNK):
+            work_items[2 * (first_chunk + c)] = t
+            work_items[2 * (first_chunk + c) + 1] = offset + c * P2G_CHUNK
+
+@ti.kernel
+def substep_scatter_tiles(x: ti.any_arr(field_dim=1),
+                          grid_m: ti.any_arr(field_dim=2),
+                          tile_cursor: ti.any_arr(field_dim=1),
+                          sorted_ids: ti.any_arr(field_dim=1)):
+    for p in x:
+        t = particle_tile(x, p, grid_m.shape[0])
+        sorted_ids[ti.atomic_add(tile_cursor[t], 1)] = p
+
+@ti.kernel
+def substep_p2g_tiled(x: ti.any_arr(field_dim=1), v: ti.any_arr(field_dim=1),
+                      C: ti.any_arr(field_dim=1), J: ti.any_arr(field_dim=1),
+                      grid_v: ti.any_arr(field_dim=2),
+                      grid_m: ti.any_arr(field_dim=2),
+                      tile_offset: ti.any_arr(field_dim=1),
+                      chunk_offset: ti.any_arr(field_dim=1),
+                      work_items: ti.any_arr(field_dim=1),
+                      sorted_ids: ti.any_arr(field_dim=1)):
+    # Launched over the host's bound on work items. Workgroups past this
+    # substep's count, chunk_offset[n_tiles], scatter nothing but still pass
+    # the barriers.
+    ti.loop_config(block_dim=P2G_THREADS)
+    for item, k in ti.ndrange(work_items.shape[0] // 2, P2G_THREADS):
+        halo_v = ti.simt.block.SharedArray((HALO, HALO, 2), ti.f32)
+        halo_m = ti.simt.block.SharedArray((HALO, HALO), ti.f32)
+        t = 0
+        first = 0
+        end = 0
+        if item < chunk_offset[chunk_offset.shape[0] - 1]:
+            t = work_items[2 * item]
+            first = work_items[2 * item + 1]
+            end = ti.min(first + P2G_CHUNK, tile_offset[t + 1])
+        tiles = grid_m.shape[0] // BLOCK
+        origin = ti.Vector([t // tiles, t % tiles]) * BLOCK
+        n = k
+        while n < HALO * HALO:
+            halo_v[n // HALO, n % HALO, 0] = 0.0
+            halo_v[n // HALO, n % HALO, 1] = 0.0
+            halo_m[n // HALO, n % HALO] = 0.0
+            n += P2G_THREADS
+        ti.simt.block.sync()
+
+        dx = 1 / grid_v.shape[0]
+        p_vol = (dx * 0.5)**2
+        p_mass = p_vol * p_rho
+        i = first + k
+        while i < end:
+            p = sorted_ids[i]
+            Xp = x[p] / dx
+            base = int(Xp - 0.5)
+            fx = Xp - base
+            w = [0.5 * (1.5 - fx)**2, 0.75 - (fx - 1)**2, 0.5 * (fx - 0.5)**2]
+            stress = -dt * 4 * E * p_vol * (J[p] - 1) / dx**2
+            affine = ti.Matrix([[stress, 0], [0, stress]]) + p_mass * C[p]
+            local = base - origin
+            for a, b in ti.static(ti.ndrange(3, 3)):
+                offset = ti.Vector([a, b])
+                dpos = (offset - fx) * dx
+                weight = w[a].x * w[b].y
+                dv = weight * (p_mass * v[p] + affine @ dpos)
+                ti.atomic_add(halo_v[local.x + a, local.y + b, 0], dv.x)
+                ti.atomic_add(halo_v[local.x + a, local.y + b, 1], dv.y)
+                ti.atomic_add(halo_m[local.x + a, local.y + b],
+                              weight * p_mass)
+            i += P2G_THREADS
+        ti.simt.block.sync()
+
+        n = k
+        while n < HALO * HALO:
+            g = origin + ti.Vector([n // HALO, n % HALO])
+            m = halo_m[n // HALO, n % HALO]
+            if m != 0 and g.x < grid_m.shape[0] and g.y < grid_m.shape[1]:
+                grid_v[g] += ti.Vector([halo_v[n // HALO, n % HALO, 0],
+                                        halo_v[n // HALO, n % HALO, 1]])
+                grid_m[g] += m
+            n += P2G_THREADS
+
+# CFL-adaptive variants: the frame time N_ITER * dt is fixed, but each substep
+# takes its dt from `sim_state = [dt, t, max_speed, substeps]` on the GPU.
+# G2P reduces the largest signal speed, particle speed plus the local wave
+# speed, into max_speed, and substep_advance turns it into the next dt
+# through the CFL condition. Once t reaches the frame time every kernel
+# returns immediately, so the host can queue more substeps than a frame
+# needs without changing the result. A frame that ends short (the host
+# planned too few substeps) is not extended on the host: begin_frame_adaptive
+# carries the missing time into the next frame.
+CFL = 0.6
+DT_MAX = 1e-3
+FRAME_DT = N_ITER * dt
+# Substeps per update_adaptive run.
+SUBSTEP_CHUNK = 10
+
+@ti.func
+def wave_speed(J):
+    # p2g_particle applies the Kirchhoff stress tau(J) = E * (J - 1), i.e. a
+    # pressure p = -tau / J at density p_rho / J, so the acoustic speed
+    # sqrt(dp / drho) is sqrt((J * tau'(J) - tau(J)) / p_rho). For this
+    # equation of state it comes out as sqrt(E / p_rho) at any J: the fluid
+    # is as stiff stretched as compressed.
+    tau = E * (J - 1)
+    tau_slope = E
+    return ti.sqrt(ti.max(J * tau_slope - tau, 0) / p_rho)
+
+@ti.func
+def frame_active(sim_state):
+    return sim_state[1] < FRAME_DT - 1e-7
+
+@ti.kernel
+def init_sim_state(sim_state: ti.any_arr(field_dim=1)):
+    for _ in range(1):
+        sim_state[0] = dt
+        sim_state[1] = FRAME_DT
+        sim_state[2] = 0
+        sim_state[3] = 0
+
+@ti.kernel
+def begin_frame_adaptive(sim_state: ti.any_arr(field_dim=1)):
+    for _ in range(1):
+        # Zero unless the previous frame ended short of FRAME_DT.
+        sim_state[1] -= FRAME_DT
+        sim_state[3] = 0
+
+@ti.kernel
+def substep_reset_grid_adaptive(grid_v: ti.any_arr(field_dim=2),
+                                grid_m: ti.any_arr(field_dim=2),
+                                sim_state: ti.any_arr(field_dim=1)):
+    for i, j in grid_m:
+        if frame_active(sim_state):
+            grid_v[i, j] = [0, 0]
+            grid_m[i, j] = 0
+            if i == 0 and j == 0:
+                sim_state[2] = 0
+
+@ti.kernel
+def substep_p2g_adaptive(x: ti.any_arr(field_dim=1),
+                         v: ti.any_arr(field_dim=1),
+                         C: ti.any_arr(field_dim=1),
+                         J: ti.any_arr(field_dim=1),
+                         grid_v: ti.any_arr(field_dim=2),
+                         grid_m: ti.any_arr(field_dim=2),
+                         sim_state: ti.any_arr(field_dim=1)):
+    for p in x:
+        if frame_active(sim_state):
+            p2g_particle(x, v, C, J, grid_v, grid_m, p, sim_state[0])
+
+@ti.kernel
+def substep_update_grid_v_adaptive(grid_v: ti.any_arr(field_dim=2),
+                                   grid_m: ti.any_arr(field_dim=2),
+                                   sim_state: ti.any_arr(field_dim=1)):
+    for i, j in grid_m:
+        if frame_active(sim_state):
+            update_grid_node(grid_v, grid_m, i, j, sim_state[0])
+
+@ti.kernel
+def substep_g2p_adaptive(x: ti.any_arr(field_dim=1),
+                         v: ti.any_arr(field_dim=1),
+                         C: ti.any_arr(field_dim=1),
+                         J: ti.any_arr(field_dim=1),
+                         grid_v: ti.any_arr(field_dim=2),
+                         pos: ti.any_arr(field_dim=1),
+                         sim_state: ti.any_arr(field_dim=1)):
+    for p in x:
+        if frame_active(sim_state):
+            g2p_particle(x, v, C, J, grid_v, pos, p, sim_state[0])
+            ti.atomic_max(sim_state[2], v[p].norm() + wave_speed(J[p]))
+
+@ti.kernel
+def substep_advance(grid_m: ti.any_arr(field_dim=2),
+                    sim_state: ti.any_arr(field_dim=1)):
+    for _ in range(1):
+        if frame_active(sim_state):
+            t = sim_state[1] + sim_state[0]
+            sim_state[1] = t
+            sim_state[3] += 1
+            dx = 1 / grid_m.shape[0]
+            new_dt = ti.min(CFL * dx / sim_state[2], DT_MAX)
+            # Land on the frame boundary rather than stepping past it.
+            remaining = FRAME_DT - t
+            if remaining > 1e-7 and new_dt > remaining:
+                new_dt = remaining
+            sim_state[0] = new_dt
+
+# Batched variants: every ndarray gains a leading scene dimension so that one
+# graph dispatch advances many independent scenes. Per-scene parameters live
+# in `params[s] = [E, gravity, n_particles, 0]`; particles past n_particles
+# are inactive padding.
+@ti.kernel
+def substep_reset_grid_batched(grid_v: ti.any_arr(field_dim=3),
+                               grid_m: ti.any_arr(field_dim=3)):
+    for s, i, j in grid_m:
+        grid_v[s, i, j] = [0, 0]
+        grid_m[s, i, j] = 0
+
+@ti.kernel
+def substep_p2g_batched(x: ti.any_arr(field_dim=2), v: ti.any_arr(field_dim=2),
+                        C: ti.any_arr(field_dim=2), J: ti.any_arr(field_dim=2),
+                        grid_v: ti.any_arr(field_dim=3),
+                        grid_m: ti.any_arr(field_dim=3),
+                        params: ti.any_arr(field_dim=1)):
+    for s, p in x:
+        if p < ti.cast(params[s][2], ti.i32):
+            dx = 1 / grid_v.shape[1]
+            p_vol = (dx * 0.5)**2
+            p_mass = p_vol * p_rho
+            Xp = x[s, p] / dx
+            base = int(Xp - 0.5)
+            fx = Xp - base
+            w = [0.5 * (1.5 - fx)**2, 0.75 - (fx - 1)**2, 0.5 * (fx - 0.5)**2]
+            stress = -dt * 4 * params[s][0] * p_vol * (J[s, p] - 1) / dx**2
+            affine = ti.Matrix([[stress, 0], [0, stress]]) + p_mass * C[s, p]
+            for i, j in ti.static(ti.ndrange(3, 3)):
+                offset = ti.Vector([i, j])
+                dpos = (offset - fx) * dx
+                weight = w[i].x * w[j].y
+                grid_v[s, base.x + i, base.y +
+                       j] += weight * (p_mass * v[s, p] + affine @ dpos)
+                grid_m[s, base.x + i, base.y + j] += weight * p_mass
+
+@ti.kernel
+def substep_update_grid_v_batched(grid_v: ti.any_arr(field_dim=3),
+                                  grid_m: ti.any_arr(field_dim=3),
+                                  params: ti.any_arr(field_dim=1)):
+    for s, i, j in grid_m:
+        num_grid = grid_v.shape[1]
+        if grid_m[s, i, j] > 0:
+            grid_v[s, i, j] /= grid_m[s, i, j]
+        grid_v[s, i, j].y -= dt * params[s][1]
+        if i < bound and grid_v[s, i, j].x < 0:
+            grid_v[s, i, j].x = 0
+        if i > num_grid - bound and grid_v[s, i, j].x > 0:
+            grid_v[s, i, j].x = 0
+        if j < bound and grid_v[s, i, j].y < 0:
+            grid_v[s, i, j].y = 0
+        if j > num_grid - bound and grid_v[s, i, j].y > 0:
+            grid_v[s, i, j].y = 0
+
+@ti.kernel
+def substep_g2p_batched(x: ti.any_arr(field_dim=2), v: ti.any_arr(field_dim=2),
+                        C: ti.any_arr(field_dim=2), J: ti.any_arr(field_dim=2),
+                        grid_v: ti.any_arr(field_dim=3),
+                        pos: ti.any_arr(field_dim=2),
+                        params: ti.any_arr(field_dim=1)):
+    for s, p in x:
+        if p < ti.cast(params[s][2], ti.i32):
+            dx = 1 / grid_v.shape[1]
+            Xp = x[s, p] / dx
+            base = int(Xp - 0.5)
+            fx = Xp - base
+            w = [0.5 * (1.5 - fx)**2, 0.75 - (fx - 1)**2, 0.5 * (fx - 0.5)**2]
+            new_v = ti.Vector.zero(float, 2)
+            new_C = ti.Matrix.zero(float, 2, 2)
+            for i, j in ti.static(ti.ndrange(3, 3)):
+                offset = ti.Vector([i, j])
+                dpos = (offset - fx) * dx
+                weight = w[i].x * w[j].y
+                g_v = grid_v[s, base.x + i, base.y + j]
+                new_v += weight * g_v
+                new_C += 4 * weight * g_v.outer_product(dpos) / dx**2
+            v[s, p] = new_v
+            x[s, p] += dt * v[s, p]
+            pos[s, p] = [x[s, p][0], x[s, p][1], 0]
+            J[s, p] *= 1 + dt * new_C.trace()
+            C[s, p] = new_C
+
+@ti.kernel
+def init_particles_batched(x: ti.any_arr(field_dim=2),
+                           v: ti.any_arr(field_dim=2),
+                           J: ti.any_arr(field_dim=2),
+                           pos: ti.any_arr(field_dim=2),
+                           params: ti.any_arr(field_dim=1)):
+    for s, i in x:
+        if i < ti.cast(params[s][2], ti.i32):
+            x[s, i] = [ti.random() * 0.4 + 0.2, ti.random() * 0.4 + 0.2]
+            pos[s, i] = [x[s, i][0], x[s, i][1], 0]
+        else:
+            # Park inactive padding outside the view.
+            x[s, i] = [-1, -1]
+            pos[s, i] = [-1, -1, 0]
+        v[s, i] = [0, -1]
+        J[s, i] = 1
 
 sym_x = ti.graph.Arg(ti.graph.ArgKind.NDARRAY,
                      'x',
@@ -147,6 +711,252 @@ for i in range(N_ITER):
 g_init = g_init_builder.compile()
 g_update = g_update_builder.compile()
 
+# SDF boundary variant, initialized by init.
+sym_sdf = ti.graph.Arg(ti.graph.ArgKind.TEXTURE,
+                       'sdf',
+                       channel_format=ti.f32,
+                       shape=(SDF_RES, SDF_RES),
+                       num_channels=1)
+
+g_update_sdf_builder = ti.graph.GraphBuilder()
+substep_sdf = g_update_sdf_builder.create_sequential()
+
+substep_sdf.dispatch(substep_reset_grid, sym_grid_v, sym_grid_m)
+substep_sdf.dispatch(substep_p2g, sym_x, sym_v, sym_C, sym_J, sym_grid_v,
+                     sym_grid_m)
+substep_sdf.dispatch(substep_update_grid_v_sdf, sym_grid_v, sym_grid_m,
+                     sym_sdf)
+substep_sdf.dispatch(substep_g2p, sym_x, sym_v, sym_C, sym_J, sym_grid_v,
+                     sym_pos)
+
+for i in range(N_ITER):
+    g_update_sdf_builder.append(substep_sdf)
+
+g_update_sdf = g_update_sdf_builder.compile()
+
+# Compact variants storing C in f16, which cuts the per-particle state the
+# substeps stream through from 48 to 40 bytes. Math stays in f32; only loads
+# and stores convert. J stays in f32: it changes by J * dt * trace(C) per
+# substep, and with dt = 2e-4 that is below half an f16 ulp near 1 (4.9e-4)
+# wherever |trace(C)| < 2.4, so an f16 J would round back to where it was
+# and stop moving. Requires a device with 16-bit storage buffers.
+sym_C_f16 = ti.graph.Arg(ti.graph.ArgKind.NDARRAY,
+                         'C',
+                         ti.f16,
+                         field_dim=1,
+                         element_shape=(2, 2))
+
+g_init_f16_builder = ti.graph.GraphBuilder()
+g_init_f16_builder.dispatch(init_particles, sym_x, sym_v, sym_J)
+
+g_update_f16_builder = ti.graph.GraphBuilder()
+substep_f16 = g_update_f16_builder.create_sequential()
+substep_f16.dispatch(substep_reset_grid, sym_grid_v, sym_grid_m)
+substep_f16.dispatch(substep_p2g, sym_x, sym_v, sym_C_f16, sym_J,
+                     sym_grid_v, sym_grid_m)
+substep_f16.dispatch(substep_update_grid_v, sym_grid_v, sym_grid_m)
+substep_f16.dispatch(substep_g2p, sym_x, sym_v, sym_C_f16, sym_J,
+                     sym_grid_v, sym_pos)
+for i in range(N_ITER):
+    g_update_f16_builder.append(substep_f16)
+
+g_init_f16 = g_init_f16_builder.compile()
+g_update_f16 = g_update_f16_builder.compile()
+
+sym_block_mask = ti.graph.Arg(ti.graph.ArgKind.NDARRAY,
+                              'block_mask',
+                              ti.i32,
+                              field_dim=2,
+                              element_shape=())
+sym_active_blocks = ti.graph.Arg(ti.graph.ArgKind.NDARRAY,
+                                 'active_blocks',
+                                 ti.i32,
+                                 field_dim=1,
+                                 element_shape=())
+sym_block_count = ti.graph.Arg(ti.graph.ArgKind.NDARRAY,
+                               'block_count',
+                               ti.i32,
+                               field_dim=1,
+                               element_shape=())
+
+g_init_sparse_builder = ti.graph.GraphBuilder()
+g_init_sparse_builder.dispatch(init_particles, sym_x, sym_v, sym_J)
+g_init_sparse_builder.dispatch(clear_grid, sym_grid_v, sym_grid_m,
+                               sym_block_mask)
+
+g_update_sparse_builder = ti.graph.GraphBuilder()
+substep_sparse = g_update_sparse_builder.create_sequential()
+substep_sparse.dispatch(substep_reset_block_count, sym_block_count)
+substep_sparse.dispatch(substep_mark_blocks, sym_x, sym_grid_m, sym_block_mask,
+                        sym_active_blocks, sym_block_count)
+substep_sparse.dispatch(substep_p2g, sym_x, sym_v, sym_C, sym_J, sym_grid_v,
+                        sym_grid_m)
+substep_sparse.dispatch(substep_update_grid_v_sparse, sym_grid_v, sym_grid_m,
+                        sym_block_mask, sym_active_blocks, sym_block_count)
+substep_sparse.dispatch(substep_g2p, sym_x, sym_v, sym_C, sym_J, sym_grid_v,
+                        sym_pos)
+substep_sparse.dispatch(substep_clear_active_blocks, sym_grid_v, sym_grid_m,
+                        sym_block_mask, sym_active_blocks, sym_block_count)
+for i in range(N_ITER):
+    g_update_sparse_builder.append(substep_sparse)
+
+g_init_sparse = g_init_sparse_builder.compile()
+g_update_sparse = g_update_sparse_builder.compile()
+
+sym_tile_count = ti.graph.Arg(ti.graph.ArgKind.NDARRAY,
+                              'tile_count',
+                              ti.i32,
+                              field_dim=1,
+                              element_shape=())
+sym_tile_offset = ti.graph.Arg(ti.graph.ArgKind.NDARRAY,
+                               'tile_offset',
+                               ti.i32,
+                               field_dim=1,
+                               element_shape=())
+sym_tile_cursor = ti.graph.Arg(ti.graph.ArgKind.NDARRAY,
+                               'tile_cursor',
+                               ti.i32,
+                               field_dim=1,
+                               element_shape=())
+sym_sorted_ids = ti.graph.Arg(ti.graph.ArgKind.NDARRAY,
+                              'sorted_ids',
+                              ti.i32,
+                              field_dim=1,
+                              element_shape=())
+sym_chunk_offset = ti.graph.Arg(ti.graph.ArgKind.NDARRAY,
+                                'chunk_offset',
+                                ti.i32,
+                                field_dim=1,
+                                element_shape=())
+sym_tile_block_sums = ti.graph.Arg(ti.graph.ArgKind.NDARRAY,
+                                   'tile_block_sums',
+                                   ti.i32,
+                                   field_dim=1,
+                                   element_shape=())
+sym_work_items = ti.graph.Arg(ti.graph.ArgKind.NDARRAY,
+                              'work_items',
+                              ti.i32,
+                              field_dim=1,
+                              element_shape=())
+
+def dispatch_p2g_tiled(seq):
+    seq.dispatch(substep_count_tiles, sym_x, sym_grid_m, sym_tile_count)
+    seq.dispatch(substep_scan_tiles_local, sym_tile_count, sym_tile_offset,
+                 sym_chunk_offset, sym_tile_block_sums)
+    seq.dispatch(substep_scan_tile_blocks, sym_tile_offset, sym_chunk_offset,
+                 sym_tile_block_sums)
+    seq.dispatch(substep_emit_tile_work, sym_tile_count, sym_tile_offset,
+                 sym_tile_cursor, sym_chunk_offset, sym_tile_block_sums,
+                 sym_work_items)
+    seq.dispatch(substep_scatter_tiles, sym_x, sym_grid_m, sym_tile_cursor,
+                 sym_sorted_ids)
+    seq.dispatch(substep_p2g_tiled, sym_x, sym_v, sym_C, sym_J, sym_grid_v,
+                 sym_grid_m, sym_tile_offset, sym_chunk_offset,
+                 sym_work_items, sym_sorted_ids)
+
+g_init_tiled_builder = ti.graph.GraphBuilder()
+g_init_tiled_builder.dispatch(init_particles, sym_x, sym_v, sym_J)
+g_init_tiled_builder.dispatch(clear_tile_counts, sym_tile_count)
+
+g_update_tiled_builder = ti.graph.GraphBuilder()
+substep_tiled = g_update_tiled_builder.create_sequential()
+substep_tiled.dispatch(substep_reset_grid, sym_grid_v, sym_grid_m)
+dispatch_p2g_tiled(substep_tiled)
+substep_tiled.dispatch(substep_update_grid_v, sym_grid_v, sym_grid_m)
+substep_tiled.dispatch(substep_g2p, sym_x, sym_v, sym_C, sym_J, sym_grid_v,
+                       sym_pos)
+for i in range(N_ITER):
+    g_update_tiled_builder.append(substep_tiled)
+
+g_init_tiled = g_init_tiled_builder.compile()
+g_update_tiled = g_update_tiled_builder.compile()
+
+# P2G alone, N_ITER times on unchanged particles, for timing the two
+# scatter strategies against each other. The tiled one includes its sort.
+g_bench_p2g_builder = ti.graph.GraphBuilder()
+bench_p2g = g_bench_p2g_builder.create_sequential()
+bench_p2g.dispatch(substep_reset_grid, sym_grid_v, sym_grid_m)
+bench_p2g.dispatch(substep_p2g, sym_x, sym_v, sym_C, sym_J, sym_grid_v,
+                   sym_grid_m)
+g_bench_p2g_tiled_builder = ti.graph.GraphBuilder()
+bench_p2g_tiled = g_bench_p2g_tiled_builder.create_sequential()
+bench_p2g_tiled.dispatch(substep_reset_grid, sym_grid_v, sym_grid_m)
+dispatch_p2g_tiled(bench_p2g_tiled)
+for i in range(N_ITER):
+    g_bench_p2g_builder.append(bench_p2g)
+    g_bench_p2g_tiled_builder.append(bench_p2g_tiled)
+
+g_bench_p2g = g_bench_p2g_builder.compile()
+g_bench_p2g_tiled = g_bench_p2g_tiled_builder.compile()
+
+sym_sim_state = ti.graph.Arg(ti.graph.ArgKind.NDARRAY,
+                             'sim_state',
+                             ti.f32,
+                             field_dim=1,
+                             element_shape=())
+
+g_init_adaptive_builder = ti.graph.GraphBuilder()
+g_init_adaptive_builder.dispatch(init_particles, sym_x, sym_v, sym_J)
+g_init_adaptive_builder.dispatch(init_sim_state, sym_sim_state)
+
+g_begin_frame_adaptive_builder = ti.graph.GraphBuilder()
+g_begin_frame_adaptive_builder.dispatch(begin_frame_adaptive, sym_sim_state)
+
+g_update_adaptive_builder = ti.graph.GraphBuilder()
+substep_adaptive = g_update_adaptive_builder.create_sequential()
+substep_adaptive.dispatch(substep_reset_grid_adaptive, sym_grid_v, sym_grid_m,
+                          sym_sim_state)
+substep_adaptive.dispatch(substep_p2g_adaptive, sym_x, sym_v, sym_C, sym_J,
+                          sym_grid_v, sym_grid_m, sym_sim_state)
+substep_adaptive.dispatch(substep_update_grid_v_adaptive, sym_grid_v,
+                          sym_grid_m, sym_sim_state)
+substep_adaptive.dispatch(substep_g2p_adaptive, sym_x, sym_v, sym_C, sym_J,
+                          sym_grid_v, sym_pos, sym_sim_state)
+substep_adaptive.dispatch(substep_advance, sym_grid_m, sym_sim_state)
+for i in range(SUBSTEP_CHUNK):
+    g_update_adaptive_builder.append(substep_adaptive)
+
+g_init_adaptive = g_init_adaptive_builder.compile()
+g_begin_frame_adaptive = g_begin_frame_adaptive_builder.compile()
+g_update_adaptive = g_update_adaptive_builder.compile()
+
+sym_x_b = ti.graph.Arg(ti.graph.ArgKind.NDARRAY, 'x', ti.f32, field_dim=2,
+                       element_shape=(2, ))
+sym_v_b = ti.graph.Arg(ti.graph.ArgKind.NDARRAY, 'v', ti.f32, field_dim=2,
+                       element_shape=(2, ))
+sym_C_b = ti.graph.Arg(ti.graph.ArgKind.NDARRAY, 'C', ti.f32, field_dim=2,
+                       element_shape=(2, 2))
+sym_J_b = ti.graph.Arg(ti.graph.ArgKind.NDARRAY, 'J', ti.f32, field_dim=2,
+                       element_shape=())
+sym_grid_v_b = ti.graph.Arg(ti.graph.ArgKind.NDARRAY, 'grid_v', ti.f32,
+                            field_dim=3, element_shape=(2, ))
+sym_grid_m_b = ti.graph.Arg(ti.graph.ArgKind.NDARRAY, 'grid_m', ti.f32,
+                            field_dim=3, element_shape=())
+sym_pos_b = ti.graph.Arg(ti.graph.ArgKind.NDARRAY, 'pos', ti.f32, field_dim=2,
+                         element_shape=(3, ))
+sym_params = ti.graph.Arg(ti.graph.ArgKind.NDARRAY, 'params', ti.f32,
+                          field_dim=1, element_shape=(4, ))
+
+g_init_batched_builder = ti.graph.GraphBuilder()
+g_init_batched_builder.dispatch(init_particles_batched, sym_x_b, sym_v_b,
+                                sym_J_b, sym_pos_b, sym_params)
+
+g_update_batched_builder = ti.graph.GraphBuilder()
+substep_batched = g_update_batched_builder.create_sequential()
+substep_batched.dispatch(substep_reset_grid_batched, sym_grid_v_b,
+                         sym_grid_m_b)
+substep_batched.dispatch(substep_p2g_batched, sym_x_b, sym_v_b, sym_C_b,
+                         sym_J_b, sym_grid_v_b, sym_grid_m_b, sym_params)
+substep_batched.dispatch(substep_update_grid_v_batched, sym_grid_v_b,
+                         sym_grid_m_b, sym_params)
+substep_batched.dispatch(substep_g2p_batched, sym_x_b, sym_v_b, sym_C_b,
+                         sym_J_b, sym_grid_v_b, sym_pos_b, sym_params)
+for i in range(N_ITER):
+    g_update_batched_builder.append(substep_batched)
+
+g_init_batched = g_init_batched_builder.compile()
+g_update_batched = g_update_batched_builder.compile()
+
 pos = ti.Vector.ndarray(3, ti.f32, n_particles)
 x = ti.Vector.ndarray(2, ti.f32, shape=(n_particles))
 v = ti.Vector.ndarray(2, ti.f32, shape=(n_particles))
@@ -162,7 +972,22 @@ with tempfile.TemporaryDirectory() as tmpdir:
     mod = ti.aot.Module(ti.vulkan)
     mod.add_graph('init', g_init)
     mod.add_graph('update', g_update)
+    mod.add_graph('init_batched', g_init_batched)
+    mod.add_graph('update_batched', g_update_batched)
+    mod.add_graph('init_f16', g_init_f16)
+    mod.add_graph('update_f16', g_update_f16)
+    mod.add_graph('init_sparse', g_init_sparse)
+    mod.add_graph('update_sparse', g_update_sparse)
+    mod.add_graph('init_tiled', g_init_tiled)
+    mod.add_graph('update_tiled', g_update_tiled)
+    mod.add_graph('bench_p2g', g_bench_p2g)
+    mod.add_graph('bench_p2g_tiled', g_bench_p2g_tiled)
+    mod.add_graph('init_adaptive', g_init_adaptive)
+    mod.add_graph('begin_frame_adaptive', g_begin_frame_adaptive)
+    mod.add_graph('update_adaptive', g_update_adaptive)
+    mod.add_graph('update_sdf', g_update_sdf)
     mod.save(tmpdir, '')
+    write_sdf(tmpdir + '/boundary.sdf')
 
 # Run!
 #g_init.run({'x': x, 'v': v, 'J': J})
@@ -0,0 +1,32 @@
+#version 460
+
+layout (set = 0, binding = 0) uniform Constants {
+    mat4 proj;
+    mat4 view;
+    float radius;
+};
+
+layout (location = 0) in vec2 corner;
+layout (location = 1) in vec3 center_view;
+
+layout (location = 0) out vec4 color;
+
+void main() {
+    float r2 = dot(corner, corner);
+    if (r2 > 1.0) {
+        discard;
+    }
+
+    // The sphere's surface point under this fragment, in view space, gives
+    // both the shading normal and the depth.
+    vec3 normal = vec3(corner, sqrt(1.0 - r2));
+    vec4 clip = proj * vec4(center_view + normal * radius, 1.0);
+    gl_FragDepth = (clip.w - clip.z) / clip.w;
+
+    const vec3 light = normalize(vec3(0.3, 0.8, 0.5));
+    float diffuse = max(dot(normal, light), 0.0);
+    vec3 c = vec3(0.4, 0.7, 1.0) * (0.25 + 0.75 * diffuse);
+    c = pow(c, vec3(1.0 / 2.2));
+
+    color = vec4(c, 1.0);
+}
@@ -0,0 +1,36 @@
+#version 460
+
+layout (set = 0, binding = 0) uniform Constants {
+    mat4 proj;
+    mat4 view;
+    float radius;
+};
+
+// Tightly packed vec3 positions, and the ids the culling pass kept.
+layout (set = 0, binding = 1) readonly buffer Positions {
+    float pos[];
+};
+layout (set = 0, binding = 2) readonly buffer Visible {
+    int visible[];
+};
+
+layout (location = 0) out vec2 corner;
+layout (location = 1) out vec3 center_view;
+
+const vec2 corners[6] = vec2[](
+    vec2(-1.0, -1.0), vec2(1.0, -1.0), vec2(1.0, 1.0),
+    vec2(-1.0, -1.0), vec2(1.0, 1.0), vec2(-1.0, 1.0));
+
+void main() {
+    int i = visible[gl_InstanceIndex];
+    vec3 center = vec3(pos[3 * i], pos[3 * i + 1], pos[3 * i + 2]);
+    corner = corners[gl_VertexIndex];
+    center_view = (view * vec4(center, 1.0)).xyz;
+
+    // A camera-facing quad around the sphere; the fragment shader carves the
+    // sphere out of it.
+    vec4 p = proj * vec4(center_view + vec3(corner * radius, 0.0), 1.0);
+    p.z = p.w - p.z;
+
+    gl_Position = p;
+}
@@ -1,6 +1,8 @@
 #include <signal.h>
 #include <iostream>
 #include <chrono>
+#include <random>
+#include <string>
 
 #include <taichi/runtime/program_impls/vulkan/vulkan_program.h>
 #include <taichi/rhi/vulkan/vulkan_common.h>
@@ -12,7 +14,44 @@
 #include <taichi/gui/gui.h>
 #include <taichi/ui/backends/vulkan/renderer.h>
 
+#include "async_loader.hpp"
+#include "device_arena.hpp"
+#include "graph_args.hpp"
+#include "offscreen.hpp"
+#include "particle_renderer.hpp"
+#include "pipeline_cache.hpp"
+#include "sdf_volume.hpp"
+
 #define NR_PARTICLES 8000
+// Neighbor-list capacity per particle and number of list-building cells,
+// max_neighbors and cell_res^3 in sph.py.
+#define NLIST_MAX_NEIGHBORS 128
+#define NLIST_CELLS (20 * 20 * 20)
+// Per-workgroup sums of the cell scan, n_cell_blocks in sph.py.
+#define NLIST_CELL_BLOCKS ((NLIST_CELLS + 255) / 256)
+// Simulated time per update graph run.
+#define FRAME_SECONDS 0.016
+// Resolution of the boundary SDF, sdf_res in sph.py.
+#define SDF_RES 64
+// Sphere impostor radius, particle_radius in sph.py.
+#define PARTICLE_RADIUS 0.01f
+// Particle counts timed by --render-bench.
+const int kBenchParticles[] = {100000, 1000000};
+
+// Solvers exported by sph.py.
+struct SphSolver {
+    const char *name;
+    const char *init_graph;
+    const char *update_graph;
+    int substeps;
+    bool neighbor_list;
+    bool pcisph;
+};
+const SphSolver kSolvers[] = {
+    {"all pairs", "init", "update", 5, false, false},
+    {"neighbor lists", "init_nlist", "update_nlist", 5, true, false},
+    {"pcisph", "init_nlist", "update_pcisph", 2, true, true},
+};
 void get_data(
     taichi::lang::gfx::GfxRuntime *vulkan_runtime,
     taichi::lang::DeviceAllocation &alloc,
@@ -36,15 +75,69 @@ void set_data(
   vulkan_runtime->get_ti_device()->unmap(alloc);
 }
 #include <unistd.h>
-int main() {
-    // Init gl window
-    glfwInit();
-    glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
-    GLFWwindow* window = glfwCreateWindow(512, 512, "Taichi show", NULL, NULL);
-    if (window == NULL) {
-        std::cout << "Failed to create GLFW window" << std::endl;
-        glfwTerminate();
-        return -1;
+int main(int argc, char **argv) {
+    demo::MillisecondsSinceStartup();
+    demo::AsyncModuleLoader::DefaultMode() =
+        demo::ParsePipelineLoadMode(argc, argv);
+    auto offscreen_options = demo::OffscreenOptions::Parse(argc, argv);
+    // `--neighbor-list` looks neighbors up in Verlet lists instead of
+    // testing every particle pair, and `--pcisph` solves for pressure on
+    // top of them. `--compare-solvers [--steps <n>]` times every solver
+    // without rendering and exits.
+    // `--impostors` draws the particles as frustum-culled 3D sphere
+    // impostors, and `--render-bench [--steps <n>]` times culling and
+    // drawing on large synthetic particle sets and exits.
+    // `--sdf` collides particles with the signed distance field sph.py bakes
+    // into shaders/boundary.sdf instead of the boundary box.
+    const SphSolver *solver = &kSolvers[0];
+    bool compare_solvers = false;
+    bool impostors = false;
+    bool render_bench = false;
+    bool sdf_boundary = false;
+    int steps = 100;
+    for (int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        if (arg == "--neighbor-list") {
+            solver = &kSolvers[1];
+        } else if (arg == "--pcisph") {
+            solver = &kSolvers[2];
+        } else if (arg == "--compare-solvers") {
+            compare_solvers = true;
+        } else if (arg == "--impostors") {
+            impostors = true;
+        } else if (arg == "--render-bench") {
+            render_bench = true;
+        } else if (arg == "--sdf") {
+            sdf_boundary = true;
+        } else if (i + 1 < argc && arg == "--steps") {
+            steps = std::stoi(argv[++i]);
+        }
+    }
+    std::vector<const SphSolver *> solvers = {solver};
+    if (compare_solvers) {
+        solvers.clear();
+        for (const auto &s : kSolvers) {
+            solvers.push_back(&s);
+        }
+    }
+    bool neighbor_list = false;
+    bool pcisph = false;
+    for (const auto *s : solvers) {
+        neighbor_list |= s->neighbor_list;
+        pcisph |= s->pcisph;
+    }
+
+    // Init gl window, unless rendering offscreen.
+    GLFWwindow* window = nullptr;
+    if (!offscreen_options.enabled) {
+        glfwInit();
+        glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
+        window = glfwCreateWindow(512, 512, "Taichi show", NULL, NULL);
+        if (window == NULL) {
+            std::cout << "Failed to create GLFW window" << std::endl;
+            glfwTerminate();
+            return -1;
+        }
     }
 
     // Create a GGUI configuration
@@ -77,20 +170,46 @@ int main() {
 
     // Retrieve kernels/fields/etc from AOT module so we can initialize our
     // runtime
+    const auto load_begin = std::chrono::steady_clock::now();
     taichi::lang::gfx::AotModuleParams mod_params;
     mod_params.module_path = "../shaders/";
     mod_params.runtime = vulkan_runtime.get();
+    // Kept alive for the whole run so the renderer's lazily created
+    // pipelines land in the cache too.
+    demo::PipelineCacheStore pipeline_cache(device_, mod_params.module_path);
+    pipeline_cache.Install();
     std::unique_ptr<taichi::lang::aot::Module> module = taichi::lang::aot::Module::load(taichi::Arch::vulkan, mod_params);
 
     auto root_size = module->get_root_size();
     printf("root buffer size=%ld\n", root_size);
     vulkan_runtime->add_root_buffer(root_size);
 
-    auto g_init = module->get_graph("init");
-    auto g_update = module->get_graph("update");
+    // Compile the graphs in the background while the ndarrays are set up.
+    demo::AsyncModuleLoader loader;
+    std::vector<demo::Lazy<std::unique_ptr<taichi::lang::aot::CompiledGraph>>>
+        g_inits, g_updates;
+    const std::string update_suffix = sdf_boundary ? "_sdf" : "";
+    for (const auto *s : solvers) {
+        g_inits.push_back(
+            loader.Load([&, s] { return module->get_graph(s->init_graph); }));
+        g_updates.push_back(loader.Load([&, s] {
+            return module->get_graph(s->update_graph + update_suffix);
+        }));
+    }
+    auto g_init = g_inits[0];
+    auto g_update = g_updates[0];
+    demo::Lazy<std::unique_ptr<taichi::lang::aot::CompiledGraph>> g_cull;
+    if (impostors || render_bench) {
+        g_cull = loader.Load([&] { return module->get_graph("cull"); });
+    }
 
 
-    // Prepare Ndarray for model
+    // Prepare Ndarray for model. The device is no more thread safe than the
+    // module, so everything created on it until the loader is done waits for
+    // the pipeline the loader's worker is creating.
+    auto device_lock = loader.Lock();
+    const auto alloc_begin = std::chrono::steady_clock::now();
+    demo::DeviceArena arena(device_);
     taichi::lang::Device::AllocParams alloc_params;
     alloc_params.host_write = false;
     alloc_params.host_read = false;
@@ -98,53 +217,120 @@ int main() {
     alloc_params.usage = taichi::lang::AllocUsage::Storage;
 
     alloc_params.size = NR_PARTICLES * sizeof(int);
-    alloc_params.host_write = alloc_params.host_read = true;
-    taichi::lang::DeviceAllocation devalloc_N = device_->allocate_memory(alloc_params);
+    taichi::lang::DeviceAllocation devalloc_N = arena.Allocate(alloc_params);
     auto N = taichi::lang::Ndarray(devalloc_N, taichi::lang::PrimitiveType::i32, {NR_PARTICLES});
-    alloc_params.host_write = alloc_params.host_read = false;
 
     alloc_params.size = NR_PARTICLES * sizeof(float);
-    taichi::lang::DeviceAllocation devalloc_den = device_->allocate_memory(alloc_params);
+    taichi::lang::DeviceAllocation devalloc_den = arena.Allocate(alloc_params);
     auto den = taichi::lang::Ndarray(devalloc_den, taichi::lang::PrimitiveType::f32, {NR_PARTICLES});
-    taichi::lang::DeviceAllocation devalloc_pre = device_->allocate_memory(alloc_params);
+    taichi::lang::DeviceAllocation devalloc_pre = arena.Allocate(alloc_params);
     auto pre = taichi::lang::Ndarray(devalloc_pre, taichi::lang::PrimitiveType::f32, {NR_PARTICLES});
 
     alloc_params.size = NR_PARTICLES * 3 * sizeof(float);
-    taichi::lang::DeviceAllocation devalloc_pos = device_->allocate_memory(alloc_params);
+    taichi::lang::DeviceAllocation devalloc_pos = arena.Allocate(alloc_params);
     auto pos = taichi::lang::Ndarray(devalloc_pos, taichi::lang::PrimitiveType::f32, {NR_PARTICLES}, {3});
-    taichi::lang::DeviceAllocation devalloc_vel = device_->allocate_memory(alloc_params);
+    taichi::lang::DeviceAllocation devalloc_vel = arena.Allocate(alloc_params);
     auto vel = taichi::lang::Ndarray(devalloc_vel, taichi::lang::PrimitiveType::f32, {NR_PARTICLES}, {3});
-    taichi::lang::DeviceAllocation devalloc_acc = device_->allocate_memory(alloc_params);
+    taichi::lang::DeviceAllocation devalloc_acc = arena.Allocate(alloc_params);
     auto acc = taichi::lang::Ndarray(devalloc_acc, taichi::lang::PrimitiveType::f32, {NR_PARTICLES}, {3});
-    alloc_params.host_write = alloc_params.host_read = true;
-    taichi::lang::DeviceAllocation devalloc_boundary_box = device_->allocate_memory(alloc_params);
+    taichi::lang::DeviceAllocation devalloc_boundary_box = arena.Allocate(alloc_params);
     auto boundary_box = taichi::lang::Ndarray(devalloc_boundary_box, taichi::lang::PrimitiveType::f32, {NR_PARTICLES}, {3});
-    taichi::lang::DeviceAllocation devalloc_spawn_box = device_->allocate_memory(alloc_params);
+    taichi::lang::DeviceAllocation devalloc_spawn_box = arena.Allocate(alloc_params);
     auto spawn_box = taichi::lang::Ndarray(devalloc_spawn_box, taichi::lang::PrimitiveType::f32, {NR_PARTICLES}, {3});
-    taichi::lang::DeviceAllocation devalloc_gravity = device_->allocate_memory(alloc_params);
+    taichi::lang::DeviceAllocation devalloc_gravity = arena.Allocate(alloc_params);
     auto gravity = taichi::lang::Ndarray(devalloc_gravity, taichi::lang::PrimitiveType::f32, {}, {3});
-    alloc_params.host_write = alloc_params.host_read = false;
+
+    // Ndarrays only some solvers use.
+    std::vector<std::pair<std::string, taichi::lang::Ndarray>> solver_arrays;
+    uint64_t nlist_bytes = 0;
+    auto add = [&](const char *name, taichi::lang::DataType dtype, int n,
+                   std::vector<int> element_shape = {},
+                   bool host_read = false) {
+        alloc_params.host_read = host_read;
+        alloc_params.size = uint64_t(n) * sizeof(float);
+        for (int dim : element_shape) {
+            alloc_params.size *= dim;
+        }
+        auto devalloc = arena.Allocate(alloc_params);
+        alloc_params.host_read = false;
+        solver_arrays.push_back(
+            {name, taichi::lang::Ndarray(devalloc, dtype, {n}, element_shape)});
+        return devalloc;
+    };
+    // Verlet lists, the cell grid they are built from, and
+    // nlist_state = [max squared displacement, builds, substeps, overflows].
+    taichi::lang::DeviceAllocation devalloc_nlist_state;
+    if (neighbor_list) {
+        const uint64_t bytes_before = arena.stats().buffer_bytes;
+        add("neighbors", taichi::lang::PrimitiveType::i32,
+            NR_PARTICLES * NLIST_MAX_NEIGHBORS);
+        add("neighbor_count", taichi::lang::PrimitiveType::i32, NR_PARTICLES);
+        add("pos_at_build", taichi::lang::PrimitiveType::f32, NR_PARTICLES, {3});
+        add("sorted_ids", taichi::lang::PrimitiveType::i32, NR_PARTICLES);
+        add("cell_count", taichi::lang::PrimitiveType::i32, NLIST_CELLS);
+        add("cell_cursor", taichi::lang::PrimitiveType::i32, NLIST_CELLS);
+        add("cell_offset", taichi::lang::PrimitiveType::i32, NLIST_CELLS + 1);
+        add("cell_block_sums", taichi::lang::PrimitiveType::i32,
+            NLIST_CELL_BLOCKS);
+        devalloc_nlist_state = add("nlist_state",
+                                   taichi::lang::PrimitiveType::f32, 4, {},
+                                   /*host_read=*/true);
+        nlist_bytes = arena.stats().buffer_bytes - bytes_before;
+    }
+    // PCISPH's pressure acceleration and predicted positions.
+    if (pcisph) {
+        add("acc_p", taichi::lang::PrimitiveType::f32, NR_PARTICLES, {3});
+        add("pos_pred", taichi::lang::PrimitiveType::f32, NR_PARTICLES, {3});
+    }
 
 
     // Initialize necessary data
     float* boundary_box_data = new float[6]{0.0, 0.0, 0.0, 1.0, 1.0, 1.0};
     float* spawn_box_data = new float[6]{0.3, 0.3, 0.3, 0.7, 0.7, 0.7};
     int* N_data = new int[3]{20, 20, 20};
-    set_data(vulkan_runtime.get(), devalloc_boundary_box, (void*)boundary_box_data, 6*sizeof(float));
-    set_data(vulkan_runtime.get(), devalloc_spawn_box, (void*)spawn_box_data, 6*sizeof(float));
-    set_data(vulkan_runtime.get(), devalloc_N, (void*)N_data, 3*sizeof(int));
+    // Staged through the arena, so every buffer above can live in
+    // device-local memory.
+    arena.Upload(devalloc_boundary_box, boundary_box_data, 6*sizeof(float));
+    arena.Upload(devalloc_spawn_box, spawn_box_data, 6*sizeof(float));
+    arena.Upload(devalloc_N, N_data, 3*sizeof(int));
+    arena.Flush();
+    arena.Report("sph", demo::MillisecondsSince(alloc_begin));
     delete[] boundary_box_data;
     delete[] spawn_box_data;
     delete[] N_data;
 
+    std::unique_ptr<demo::SdfVolume> sdf;
+    if (sdf_boundary) {
+        sdf = demo::SdfVolume::Load(vulkan_runtime.get(),
+                                    mod_params.module_path + "boundary.sdf");
+        if (sdf->num_dimensions() != 3 || sdf->res(0) != SDF_RES ||
+            sdf->res(1) != SDF_RES || sdf->res(2) != SDF_RES) {
+            TI_ERROR("boundary.sdf must be {0}x{0}x{0}", SDF_RES);
+        }
+    }
 
-    std::unordered_map<std::string, taichi::lang::aot::IValue> args;
-    args.insert({"pos", taichi::lang::aot::IValue::create(pos)});
-    args.insert({"spawn_box", taichi::lang::aot::IValue::create(spawn_box)});
-    args.insert({"N", taichi::lang::aot::IValue::create(N)});
-    args.insert({"gravity", taichi::lang::aot::IValue::create(gravity)});
 
-    g_init->run(args);
+    demo::GraphArgs args;
+    args.Bind("pos", taichi::lang::aot::IValue::create(pos));
+    args.Bind("spawn_box", taichi::lang::aot::IValue::create(spawn_box));
+    args.Bind("N", taichi::lang::aot::IValue::create(N));
+    args.Bind("gravity", taichi::lang::aot::IValue::create(gravity));
+    args.Bind("vel", taichi::lang::aot::IValue::create(vel));
+    for (const auto &[name, ndarray] : solver_arrays) {
+        args.Bind(name, taichi::lang::aot::IValue::create(ndarray));
+    }
+    if (sdf) {
+        args.Bind("sdf", taichi::lang::aot::IValue::create(sdf->texture()));
+    }
+
+    // Launching is not safe while the worker is still registering graphs.
+    device_lock.unlock();
+    loader.Wait();
+    pipeline_cache.Report(
+        "sph", demo::MillisecondsSince(load_begin),
+        loader.mode() == demo::PipelineLoadMode::kOnFirstUse);
+
+    args.Run(*g_init.get());
     vulkan_runtime->synchronize();
 
     // Create a GUI even though it's not used in our case (required to
@@ -172,39 +358,185 @@ int main() {
 
     renderer->set_background_color({0.6, 0.6, 0.6});
 
-    args.insert({"pos", taichi::lang::aot::IValue::create(pos)});
-    args.insert({"den", taichi::lang::aot::IValue::create(den)});
-    args.insert({"pre", taichi::lang::aot::IValue::create(pre)});
-    args.insert({"vel", taichi::lang::aot::IValue::create(vel)});
-    args.insert({"acc", taichi::lang::aot::IValue::create(acc)});
-    args.insert({"gravity", taichi::lang::aot::IValue::create(gravity)});
-    args.insert({"boundary_box", taichi::lang::aot::IValue::create(boundary_box)});
+    std::unique_ptr<demo::OffscreenCapture> offscreen;
+    if (offscreen_options.enabled) {
+        offscreen = std::make_unique<demo::OffscreenCapture>(
+            device_, app_config.width, app_config.height, offscreen_options);
+    }
+
+    args.Bind("den", taichi::lang::aot::IValue::create(den));
+    args.Bind("pre", taichi::lang::aot::IValue::create(pre));
+    args.Bind("acc", taichi::lang::aot::IValue::create(acc));
+    args.Bind("boundary_box", taichi::lang::aot::IValue::create(boundary_box));
+
+    // Looks at the tank from where the GGUI camera of sph.py does, or from
+    // `eye` if given.
+    auto set_impostor_camera = [&](demo::ParticleImpostorRenderer *r,
+                                   glm::vec3 eye = glm::vec3(0.5, 1.0, 2.0)) {
+        glm::mat4 proj = glm::perspective(
+            glm::radians(70.0f), float(app_config.width) / app_config.height,
+            0.1f, 10.0f);
+        proj[1][1] *= -1.0f;
+        r->SetCamera(glm::lookAt(eye, glm::vec3(0.5, 0.5, 0.5),
+                                 glm::vec3(0.0, 1.0, 0.0)),
+                     proj);
+    };
+    const glm::vec3 background(0.6, 0.6, 0.6);
+    std::unique_ptr<demo::ParticleImpostorRenderer> impostor_renderer;
+    if (impostors || render_bench) {
+        impostor_renderer = std::make_unique<demo::ParticleImpostorRenderer>(
+            device_, "../shaders/render", app_config.width, app_config.height,
+            render_bench ? kBenchParticles[1] : NR_PARTICLES, PARTICLE_RADIUS);
+        impostor_renderer->Bind(args);
+        set_impostor_camera(impostor_renderer.get());
+    }
+
+    if (compare_solvers) {
+        // Every solver starts from the same initial state and advances
+        // FRAME_SECONDS per update run.
+        printf("solver, substep ms, ms/frame, simulated s per wall s\n");
+        for (size_t i = 0; i < solvers.size(); i++) {
+            args.Run(*g_inits[i].get());
+            args.Run(*g_updates[i].get()); // warm up
+            vulkan_runtime->synchronize();
+            const auto begin = std::chrono::steady_clock::now();
+            for (int step = 0; step < steps; step++) {
+                args.Run(*g_updates[i].get());
+            }
+            vulkan_runtime->synchronize();
+            const double ms = demo::MillisecondsSince(begin) / steps;
+            printf("%s, %.2f, %.2f, %.3f\n", solvers[i]->name,
+                   FRAME_SECONDS * 1000.0 / solvers[i]->substeps, ms,
+                   FRAME_SECONDS * 1000.0 / ms);
+        }
+    }
+
+    if (render_bench) {
+        // Particles spread uniformly over a box four times the size of the
+        // tank, so that only part of them is in view, seen from the default
+        // camera and from one close to the tank.
+        const glm::vec3 eyes[] = {glm::vec3(0.5, 1.0, 2.0),
+                                  glm::vec3(0.5, 0.6, 0.9)};
+        const char *view_names[] = {"default", "close"};
+        printf("particles, view, visible, cull ms, draw ms\n");
+        std::mt19937 rng(0);
+        std::uniform_real_distribution<float> coord(-1.5f, 2.5f);
+        for (int n : kBenchParticles) {
+            auto bench_pos = demo::NdarrayAndMem::Make(
+                &arena, taichi::lang::PrimitiveType::f32, {n}, {3});
+            std::vector<float> data(3 * size_t(n));
+            for (auto &x : data) {
+                x = coord(rng);
+            }
+            arena.Upload(bench_pos->devalloc(), data.data(),
+                         data.size() * sizeof(float));
+            arena.Flush();
+            args.Bind("pos", taichi::lang::aot::IValue::create(
+                                 bench_pos->ndarray()));
+            auto target = renderer->swap_chain().surface().get_target_image();
+            for (int v = 0; v < 2; v++) {
+                set_impostor_camera(impostor_renderer.get(), eyes[v]);
+                args.Run(*g_cull.get()); // warm up
+                vulkan_runtime->synchronize();
+                impostor_renderer->Draw(target, bench_pos->devalloc(),
+                                        background);
+                device_->get_graphics_stream()->command_sync();
+
+                auto begin = std::chrono::steady_clock::now();
+                for (int step = 0; step < steps; step++) {
+                    args.Run(*g_cull.get());
+                }
+                vulkan_runtime->synchronize();
+                const double cull_ms = demo::MillisecondsSince(begin) / steps;
+
+                begin = std::chrono::steady_clock::now();
+                for (int step = 0; step < steps; step++) {
+                    impostor_renderer->Draw(target, bench_pos->devalloc(),
+                                            background);
+                }
+                device_->get_graphics_stream()->command_sync();
+                const double draw_ms = demo::MillisecondsSince(begin) / steps;
+                printf("%d, %s, %d, %.3f, %.3f\n", n, view_names[v],
+                       impostor_renderer->visible_count(), cull_ms, draw_ms);
+            }
+        }
+        args.Bind("pos", taichi::lang::aot::IValue::create(pos));
+        set_impostor_camera(impostor_renderer.get());
+    }
 
     // sleep(10);
     int count = 0;
-    while (!glfwWindowShouldClose(window)) {
-        g_update->run(args);
+    double step_ms = 0;
+    for (int frame = 0;
+         !compare_solvers && !render_bench &&
+         (offscreen ? frame < offscreen_options.num_frames
+                    : !glfwWindowShouldClose(window));
+         frame++) {
+        const auto step_begin = std::chrono::steady_clock::now();
+        args.Run(*g_update.get());
         vulkan_runtime->synchronize();
+        step_ms += demo::MillisecondsSince(step_begin);
+        count++;
 
-        // Render elements
-        renderer->circles(circles);
-        renderer->draw_frame(gui.get());
-        renderer->swap_chain().surface().present_image();
+        // Render elements. The culling graph is only flushed: the draw is
+        // ordered after it on the GPU, and presenting waits for the draw.
+        taichi::lang::StreamSemaphore rendered{nullptr};
+        if (impostor_renderer) {
+            args.Run(*g_cull.get());
+            vulkan_runtime->flush();
+            rendered = impostor_renderer->Draw(
+                renderer->swap_chain().surface().get_target_image(),
+                devalloc_pos, background);
+        } else {
+            renderer->circles(circles);
+            renderer->draw_frame(gui.get());
+        }
+        if (offscreen) {
+            offscreen->Capture(renderer->swap_chain().surface());
+        }
+        if (rendered) {
+            renderer->swap_chain().surface().present_image({rendered});
+        } else {
+            renderer->swap_chain().surface().present_image();
+        }
         renderer->prepare_for_next_frame();
+        if (frame == 0) {
+            printf("[startup] first frame after %.1f ms (pipelines: %s)\n",
+                   demo::MillisecondsSinceStartup(),
+                   demo::PipelineLoadModeName(loader.mode()));
+        }
 
-        glfwSwapBuffers(window);
-        glfwPollEvents();
+        if (!offscreen) {
+            glfwSwapBuffers(window);
+            glfwPollEvents();
+        }
+    }
+    offscreen.reset();
+    impostor_renderer.reset();
+
+    // pos, vel, acc, den and pre.
+    const uint64_t particle_bytes = uint64_t(NR_PARTICLES) * 11 * sizeof(float);
+    if (count > 0) {
+        printf("[sph] %s: %.2f ms/step over %d steps (%.3f simulated s per "
+               "wall s); particle state %.1f KiB, neighbor structures %.1f "
+               "KiB (%.0f bytes per particle)\n",
+               solver->name, step_ms / count, count,
+               FRAME_SECONDS * 1000.0 * count / step_ms,
+               particle_bytes / 1024.0, nlist_bytes / 1024.0,
+               double(nlist_bytes) / NR_PARTICLES);
+    }
+    if (count > 0 && neighbor_list) {
+        float nlist_state[4];
+        get_data(vulkan_runtime.get(), devalloc_nlist_state, nlist_state,
+                 sizeof(nlist_state));
+        printf("[sph] neighbor lists: built in %d of %d substeps, %d "
+               "particles overflowed %d entries\n",
+               int(nlist_state[1]), int(nlist_state[2]), int(nlist_state[3]),
+               NLIST_MAX_NEIGHBORS);
     }
 
-    device_->dealloc_memory(devalloc_N);
-    device_->dealloc_memory(devalloc_den);
-    device_->dealloc_memory(devalloc_pre);
-    device_->dealloc_memory(devalloc_pos);
-    device_->dealloc_memory(devalloc_vel);
-    device_->dealloc_memory(devalloc_acc);
-    device_->dealloc_memory(devalloc_boundary_box);
-    device_->dealloc_memory(devalloc_spawn_box);
-    device_->dealloc_memory(devalloc_gravity);
+    sdf.reset();
+    arena.Release();
 
     vulkan_runtime.reset();
     renderer->cleanup();
@@ -67,7 +67,7 @@ W_gradient = W_spiky_gradient
 
 
 @ti.kernel
-def initialize_particle(pos: ti.any_arr(field_dim=1), spawn_box: ti.any_arr(field_dim=1), N: ti.any_arr(field_dim=1), gravity: ti.any_arr(field_dim=0)):
+def initialize_particle(pos: ti.any_arr(field_dim=1), vel: ti.any_arr(field_dim=1), spawn_box: ti.any_arr(field_dim=1), N: ti.any_arr(field_dim=1), gravity: ti.any_arr(field_dim=0)):
     gravity[None] = ti.Vector([0.0, -9.8, 0.0])
     for i in range(particle_num):
         pos[i] = (
@@ -77,6 +77,7 @@ def initialize_particle(pos: ti.any_arr(field_dim=1), spawn_box: ti.any_arr(fiel
             * particle_diameter
             + spawn_box[0]
         )
+        vel[i] = ti.Vector([0.0, 0.0, 0.0])
         # print(i, pos[i], spawn_box[0], N[0], N[1], N[2])
 
 
@@ -90,6 +91,46 @@ def update_density(pos: ti.any_arr(field_dim=1), den: ti.any_arr(field_dim=1), p
         pre[i] = pressure_scale * max(pow(den[i] / rest_density, gamma) - 1, 0)
 
 
+@ti.func
+def pair_acc(pos, vel, den, pre, i, j):
+    # Acceleration of particle i due to particle j.
+    R = pos[i] - pos[j]
+
+    res = (
+        -mass
+        * (pre[i] / (den[i] * den[i]) + pre[j] / (den[j] * den[j]))
+        * W_gradient(R, h)
+    )
+    return res + pair_acc_non_pressure(pos, vel, den, i, j)
+
+
+@ti.func
+def pair_acc_non_pressure(pos, vel, den, i, j):
+    # Viscosity and surface tension on particle i due to particle j.
+    R = pos[i] - pos[j]
+
+    res = (
+        viscosity_scale
+        * mass
+        * (vel[i] - vel[j]).dot(R)
+        / (R.norm() + 0.01 * h * h)
+        / den[j]
+        * W_gradient(R, h)
+    )
+
+    R2 = R.dot(R)
+    D2 = particle_diameter * particle_diameter
+    if R2 > D2:
+        res += -tension_scale * R * W(R, h)
+    else:
+        res += (
+            -tension_scale
+            * R
+            * W(ti.Vector([0.0, 1.0, 0.0]) * particle_diameter, h)
+        )
+    return res
+
+
 @ti.kernel
 def update_force(
     pos: ti.any_arr(field_dim=1), vel: ti.any_arr(field_dim=1), den: ti.any_arr(field_dim=1), pre: ti.any_arr(field_dim=1), acc: ti.any_arr(field_dim=1), gravity: ti.any_arr(field_dim=0)
@@ -97,33 +138,287 @@ def update_force(
     for i in range(particle_num):
         acc[i] = gravity[None]
         for j in range(particle_num):
-            R = pos[i] - pos[j]
+            acc[i] += pair_acc(pos, vel, den, pre, i, j)
+
+
+# Verlet neighbor lists: every particle keeps the ids of all particles within
+# h + skin, found through a uniform grid of (h + skin)-sized cells over the
+# unit boundary box. Each substep measures how far particles have moved
+# since the last build; the build kernels only run when some particle has
+# moved more than half the skin, since until then no pair can have come
+# within h without being on the list. Between builds the density and force
+# passes of every substep just walk the lists.
+skin = 0.25 * h
+list_radius = h + skin
+max_neighbors = 128
+# Cells per axis; rounding down keeps cells at least list_radius wide.
+cell_res = int(1.0 / list_radius)
+# The cell offsets come from a three-pass parallel scan, as in mpm88's tiled
+# P2G: per SCAN_THREADS cells in shared memory, over the per-block sums, then
+# adding those back. The block sums have to fit in one workgroup.
+SCAN_THREADS = 256
+SCAN_STEPS = 8  # log2(SCAN_THREADS)
+n_cell_blocks = (cell_res**3 + SCAN_THREADS - 1) // SCAN_THREADS
+assert n_cell_blocks <= SCAN_THREADS
 
-            acc[i] += (
-                -mass
-                * (pre[i] / (den[i] * den[i]) + pre[j] / (den[j] * den[j]))
-                * W_gradient(R, h)
-            )
 
-            acc[i] += (
-                viscosity_scale
-                * mass
-                * (vel[i] - vel[j]).dot(R)
-                / (R.norm() + 0.01 * h * h)
-                / den[j]
-                * W_gradient(R, h)
-            )
+@ti.func
+def cell_coord(p):
+    # Particles slightly outside the box share the cells at its faces.
+    return ti.max(ti.min(ti.cast(p / list_radius, ti.i32), cell_res - 1), 0)
+
+
+@ti.func
+def cell_id(c):
+    return (c.x * cell_res + c.y) * cell_res + c.z
+
+
+@ti.func
+def rebuild_needed(nlist_state):
+    return nlist_state[0] > (0.5 * skin) ** 2
+
+
+# nlist_state = [max squared displacement, builds, substeps, overflowed lists]
+@ti.kernel
+def init_neighbor_lists(pos_at_build: ti.any_arr(field_dim=1), cell_count: ti.any_arr(field_dim=1), nlist_state: ti.any_arr(field_dim=1)):
+    # Places every particle far from its last build to force the first one.
+    for i in pos_at_build:
+        pos_at_build[i] = ti.Vector([1e3, 1e3, 1e3])
+    for c in cell_count:
+        cell_count[c] = 0
+    for _ in range(1):
+        for k in ti.static(range(4)):
+            nlist_state[k] = 0.0
+
+
+@ti.kernel
+def begin_substep_nlist(nlist_state: ti.any_arr(field_dim=1)):
+    for _ in range(1):
+        nlist_state[0] = 0.0
+        nlist_state[2] += 1.0
 
-            R2 = R.dot(R)
-            D2 = particle_diameter * particle_diameter
-            if R2 > D2:
-                acc[i] += -tension_scale * R * W(R, h)
-            else:
-                acc[i] += (
-                    -tension_scale
-                    * R
-                    * W(ti.Vector([0.0, 1.0, 0.0]) * particle_diameter, h)
-                )
+
+@ti.kernel
+def measure_displacement(pos: ti.any_arr(field_dim=1), pos_at_build: ti.any_arr(field_dim=1), nlist_state: ti.any_arr(field_dim=1)):
+    for i in pos:
+        ti.atomic_max(nlist_state[0], (pos[i] - pos_at_build[i]).norm_sqr())
+
+
+@ti.kernel
+def count_cells(pos: ti.any_arr(field_dim=1), cell_count: ti.any_arr(field_dim=1), nlist_state: ti.any_arr(field_dim=1)):
+    for i in pos:
+        if rebuild_needed(nlist_state):
+            ti.atomic_add(cell_count[cell_id(cell_coord(pos[i]))], 1)
+
+
+@ti.func
+def scan_block(s: ti.template(), k):
+    # Inclusive Hillis-Steele scan in shared memory.
+    for step in ti.static(range(SCAN_STEPS)):
+        d = 1 << step
+        add = 0
+        if k >= d:
+            add = s[k - d]
+        ti.simt.block.sync()
+        s[k] = s[k] + add
+        ti.simt.block.sync()
+
+
+@ti.kernel
+def scan_cells_local(cell_count: ti.any_arr(field_dim=1), cell_offset: ti.any_arr(field_dim=1), cell_block_sums: ti.any_arr(field_dim=1), nlist_state: ti.any_arr(field_dim=1)):
+    # One workgroup per SCAN_THREADS cells; the last one is padded with empty
+    # cells. Leaves block-local exclusive offsets and each block's total. The
+    # rebuild test is uniform, but only gates memory accesses so every
+    # thread reaches the barriers.
+    ti.loop_config(block_dim=SCAN_THREADS)
+    for c in range(cell_block_sums.shape[0] * SCAN_THREADS):
+        s = ti.simt.block.SharedArray((SCAN_THREADS, ), ti.i32)
+        k = c % SCAN_THREADS
+        rebuild = rebuild_needed(nlist_state)
+        count = 0
+        if rebuild and c < cell_count.shape[0]:
+            count = cell_count[c]
+        s[k] = count
+        ti.simt.block.sync()
+        scan_block(s, k)
+        if rebuild:
+            if c < cell_count.shape[0]:
+                cell_offset[c] = s[k] - count
+            if k == SCAN_THREADS - 1:
+                cell_block_sums[c // SCAN_THREADS] = s[k]
+
+
+@ti.kernel
+def scan_cell_blocks(cell_offset: ti.any_arr(field_dim=1), cell_block_sums: ti.any_arr(field_dim=1), nlist_state: ti.any_arr(field_dim=1)):
+    # One workgroup turns the block totals into exclusive block offsets and
+    # writes the total after the last cell.
+    ti.loop_config(block_dim=SCAN_THREADS)
+    for k in range(SCAN_THREADS):
+        s = ti.simt.block.SharedArray((SCAN_THREADS, ), ti.i32)
+        rebuild = rebuild_needed(nlist_state)
+        total = 0
+        if rebuild and k < cell_block_sums.shape[0]:
+            total = cell_block_sums[k]
+        s[k] = total
+        ti.simt.block.sync()
+        scan_block(s, k)
+        if rebuild:
+            if k < cell_block_sums.shape[0]:
+                cell_block_sums[k] = s[k] - total
+            if k == SCAN_THREADS - 1:
+                cell_offset[cell_offset.shape[0] - 1] = s[k]
+                nlist_state[1] += 1.0
+
+
+@ti.kernel
+def finish_scan_cells(cell_count: ti.any_arr(field_dim=1), cell_offset: ti.any_arr(field_dim=1), cell_cursor: ti.any_arr(field_dim=1), cell_block_sums: ti.any_arr(field_dim=1), nlist_state: ti.any_arr(field_dim=1)):
+    # Adds the block offsets and resets the counts for the next build.
+    for c in cell_count:
+        if rebuild_needed(nlist_state):
+            offset = cell_offset[c] + cell_block_sums[c // SCAN_THREADS]
+            cell_offset[c] = offset
+            cell_cursor[c] = offset
+            cell_count[c] = 0
+
+
+def dispatch_scan_cells(seq, cell_count, cell_offset, cell_cursor, cell_block_sums, nlist_state):
+    seq.dispatch(scan_cells_local, cell_count, cell_offset, cell_block_sums, nlist_state)
+    seq.dispatch(scan_cell_blocks, cell_offset, cell_block_sums, nlist_state)
+    seq.dispatch(finish_scan_cells, cell_count, cell_offset, cell_cursor, cell_block_sums, nlist_state)
+
+
+@ti.kernel
+def scatter_cells(pos: ti.any_arr(field_dim=1), cell_cursor: ti.any_arr(field_dim=1), sorted_ids: ti.any_arr(field_dim=1), nlist_state: ti.any_arr(field_dim=1)):
+    for i in pos:
+        if rebuild_needed(nlist_state):
+            sorted_ids[ti.atomic_add(cell_cursor[cell_id(cell_coord(pos[i]))], 1)] = i
+
+
+@ti.kernel
+def build_neighbor_lists(
+    pos: ti.any_arr(field_dim=1), cell_offset: ti.any_arr(field_dim=1), sorted_ids: ti.any_arr(field_dim=1), neighbors: ti.any_arr(field_dim=1), neighbor_count: ti.any_arr(field_dim=1), pos_at_build: ti.any_arr(field_dim=1), nlist_state: ti.any_arr(field_dim=1)
+):
+    for i in pos:
+        if rebuild_needed(nlist_state):
+            n = 0
+            center = cell_coord(pos[i])
+            for offset in ti.static(ti.grouped(ti.ndrange((-1, 2), (-1, 2), (-1, 2)))):
+                c = center + offset
+                if 0 <= c.min() and c.max() < cell_res:
+                    cid = cell_id(c)
+                    for k in range(cell_offset[cid], cell_offset[cid + 1]):
+                        j = sorted_ids[k]
+                        if (pos[i] - pos[j]).norm_sqr() < list_radius * list_radius:
+                            if n < max_neighbors:
+                                neighbors[i * max_neighbors + n] = j
+                            n += 1
+            if n > max_neighbors:
+                ti.atomic_add(nlist_state[3], 1.0)
+                n = max_neighbors
+            neighbor_count[i] = n
+            pos_at_build[i] = pos[i]
+
+
+@ti.kernel
+def update_density_nlist(pos: ti.any_arr(field_dim=1), den: ti.any_arr(field_dim=1), pre: ti.any_arr(field_dim=1), neighbors: ti.any_arr(field_dim=1), neighbor_count: ti.any_arr(field_dim=1)):
+    for i in pos:
+        d = 0.0
+        for k in range(neighbor_count[i]):
+            j = neighbors[i * max_neighbors + k]
+            d += mass * W(pos[i] - pos[j], h)
+        den[i] = d
+        pre[i] = pressure_scale * max(pow(den[i] / rest_density, gamma) - 1, 0)
+
+
+@ti.kernel
+def update_force_nlist(
+    pos: ti.any_arr(field_dim=1), vel: ti.any_arr(field_dim=1), den: ti.any_arr(field_dim=1), pre: ti.any_arr(field_dim=1), acc: ti.any_arr(field_dim=1), gravity: ti.any_arr(field_dim=0), neighbors: ti.any_arr(field_dim=1), neighbor_count: ti.any_arr(field_dim=1)
+):
+    for i in pos:
+        a = gravity[None]
+        for k in range(neighbor_count[i]):
+            a += pair_acc(pos, vel, den, pre, i, neighbors[i * max_neighbors + k])
+        acc[i] = a
+
+
+# PCISPH: instead of the stiff equation of state, each substep predicts
+# positions under the current pressures, measures the resulting density
+# error and raises pressures to cancel it, for a fixed number of
+# iterations. Pressures are solved for rather than integrated explicitly, so
+# the substep can be several times longer than the EOS solver's. Neighbors
+# come from the Verlet lists above.
+pcisph_substeps = 2
+pcisph_dt = 0.016 / pcisph_substeps
+pcisph_iterations = 4
+
+
+def pcisph_delta():
+    # Pressure per unit density error, from a prototype particle with a
+    # full neighborhood on the spawn lattice (Solenthaler and Pajarola 2009).
+    n = int(math.ceil(h / particle_diameter))
+    grad_sum = np.zeros(3)
+    grad_dot_sum = 0.0
+    for offset in np.ndindex(2 * n + 1, 2 * n + 1, 2 * n + 1):
+        R = (np.array(offset) - n) * particle_diameter
+        r = np.linalg.norm(R)
+        if 0.0 < r <= h:
+            grad = -45.0 / (pi * h**6) * (h - r)**2 * (R / r)
+            grad_sum += grad
+            grad_dot_sum += grad.dot(grad)
+    beta = 2.0 * (pcisph_dt * mass / rest_density)**2
+    return 1.0 / (beta * (grad_sum.dot(grad_sum) + grad_dot_sum))
+
+
+pcisph_pressure_delta = pcisph_delta()
+
+
+@ti.kernel
+def pcisph_non_pressure(
+    pos: ti.any_arr(field_dim=1), vel: ti.any_arr(field_dim=1), den: ti.any_arr(field_dim=1), pre: ti.any_arr(field_dim=1), acc: ti.any_arr(field_dim=1), acc_p: ti.any_arr(field_dim=1), gravity: ti.any_arr(field_dim=0), neighbors: ti.any_arr(field_dim=1), neighbor_count: ti.any_arr(field_dim=1)
+):
+    for i in pos:
+        a = gravity[None]
+        for k in range(neighbor_count[i]):
+            a += pair_acc_non_pressure(pos, vel, den, i, neighbors[i * max_neighbors + k])
+        acc[i] = a
+        acc_p[i] = ti.Vector([0.0, 0.0, 0.0])
+        pre[i] = 0.0
+
+
+@ti.kernel
+def pcisph_predict(pos: ti.any_arr(field_dim=1), vel: ti.any_arr(field_dim=1), acc: ti.any_arr(field_dim=1), acc_p: ti.any_arr(field_dim=1), pos_pred: ti.any_arr(field_dim=1), boundary_box: ti.any_arr(field_dim=1)):
+    for i in pos:
+        v = vel[i] + (acc[i] + acc_p[i]) * pcisph_dt
+        pos_pred[i] = ti.max(ti.min(pos[i] + v * pcisph_dt, boundary_box[1]), boundary_box[0])
+
+
+@ti.kernel
+def pcisph_correct_pressure(pos_pred: ti.any_arr(field_dim=1), den: ti.any_arr(field_dim=1), pre: ti.any_arr(field_dim=1), neighbors: ti.any_arr(field_dim=1), neighbor_count: ti.any_arr(field_dim=1)):
+    for i in pos_pred:
+        d = 0.0
+        for k in range(neighbor_count[i]):
+            j = neighbors[i * max_neighbors + k]
+            d += mass * W(pos_pred[i] - pos_pred[j], h)
+        den[i] = d
+        # Only compression is corrected; free surfaces would otherwise clump.
+        pre[i] += pcisph_pressure_delta * max(d - rest_density, 0.0)
+
+
+@ti.kernel
+def pcisph_pressure_acc(pos_pred: ti.any_arr(field_dim=1), pre: ti.any_arr(field_dim=1), acc_p: ti.any_arr(field_dim=1), neighbors: ti.any_arr(field_dim=1), neighbor_count: ti.any_arr(field_dim=1)):
+    for i in pos_pred:
+        a = ti.Vector([0.0, 0.0, 0.0])
+        for k in range(neighbor_count[i]):
+            j = neighbors[i * max_neighbors + k]
+            a += -mass * (pre[i] + pre[j]) / (rest_density * rest_density) * W_gradient(pos_pred[i] - pos_pred[j], h)
+        acc_p[i] = a
+
+
+@ti.kernel
+def advance_pcisph(pos: ti.any_arr(field_dim=1), vel: ti.any_arr(field_dim=1), acc: ti.any_arr(field_dim=1), acc_p: ti.any_arr(field_dim=1)):
+    for i in pos:
+        vel[i] += (acc[i] + acc_p[i]) * pcisph_dt
+        pos[i] += vel[i] * pcisph_dt
 
 
 @ti.kernel
@@ -153,6 +448,108 @@ def boundary_handle(
             vel[i] -= (1.0 + damping) * collision_normal.dot(vel[i]) * collision_normal
 
 
+# Signed distance field boundaries: the distance to the scene geometry,
+# positive in the fluid, is baked into an sdf_res^3 texture over the unit box
+# and sampled with hardware trilinear filtering, so collisions cost a handful
+# of texture fetches per particle whatever the geometry. The default scene is
+# the box walls plus a ball on the floor, below the spawn box.
+sdf_res = 64
+sdf_ball_center = np.array([0.5, 0.12, 0.5])
+sdf_ball_radius = 0.12
+
+
+def write_sdf(path):
+    # Texel (i, j, k) holds the distance at ((i, j, k) + 0.5) / sdf_res; x
+    # varies fastest in the file.
+    c = (np.arange(sdf_res) + 0.5) / sdf_res
+    z, y, x = np.meshgrid(c, c, c, indexing='ij')
+    p = np.stack([x, y, z], axis=-1)
+    walls = np.minimum(p, 1.0 - p).min(axis=-1)
+    ball = np.linalg.norm(p - sdf_ball_center, axis=-1) - sdf_ball_radius
+    d = np.minimum(walls, ball).astype(np.float32)
+    with open(path, 'wb') as f:
+        f.write(b'SDF1')
+        np.array([sdf_res] * 3, dtype=np.int32).tofile(f)
+        d.tofile(f)
+
+
+@ti.func
+def sdf_at(sdf, p):
+    return sdf.sample_lod(p, 0.0).r
+
+
+@ti.func
+def sdf_normal(sdf, p):
+    # Central differences one texel apart.
+    n = ti.Vector([0.0, 0.0, 0.0])
+    for k in ti.static(range(3)):
+        e = ti.Vector([0.0, 0.0, 0.0])
+        e[k] = 1.0 / sdf_res
+        n[k] = sdf_at(sdf, p + e) - sdf_at(sdf, p - e)
+    return n / max(n.norm(), eps)
+
+
+@ti.func
+def sdf_project(sdf, p):
+    # Clamps p into the unit box and pushes it out along the SDF normal to
+    # particle_radius from the geometry. Returns the point and the normal
+    # it was pushed along, which is zero if p was already clear.
+    p = ti.max(ti.min(p, 1.0), 0.0)
+    n = ti.Vector([0.0, 0.0, 0.0])
+    d = sdf_at(sdf, p)
+    if d < particle_radius:
+        n = sdf_normal(sdf, p)
+        p += (particle_radius - d) * n
+    return p, n
+
+
+@ti.kernel
+def boundary_handle_sdf(pos: ti.any_arr(field_dim=1), vel: ti.any_arr(field_dim=1), sdf: ti.types.texture(num_dimensions=3)):
+    for i in range(particle_num):
+        p, n = sdf_project(sdf, pos[i])
+        pos[i] = p
+        vn = n.dot(vel[i])
+        if vn < 0:
+            vel[i] -= (1.0 + damping) * vn * n
+
+
+# pcisph_predict for the _sdf graphs: the predicted positions the pressure
+# is corrected for obey the same boundary as the final ones.
+@ti.kernel
+def pcisph_predict_sdf(pos: ti.any_arr(field_dim=1), vel: ti.any_arr(field_dim=1), acc: ti.any_arr(field_dim=1), acc_p: ti.any_arr(field_dim=1), pos_pred: ti.any_arr(field_dim=1), sdf: ti.types.texture(num_dimensions=3)):
+    for i in pos:
+        v = vel[i] + (acc[i] + acc_p[i]) * pcisph_dt
+        p, _ = sdf_project(sdf, pos[i] + v * pcisph_dt)
+        pos_pred[i] = p
+
+
+# Culling for the sphere impostor renderer: writes the ids of particles whose
+# bounding sphere touches the view frustum to `visible`, and their number to
+# the instance count of `draw_args`, which the renderer copies into its
+# indirect draw buffer. `frustum` holds the six planes as (normal, offset)
+# with unit normals pointing inwards.
+@ti.kernel
+def reset_draw_args(draw_args: ti.any_arr(field_dim=1)):
+    for _ in range(1):
+        # One quad per instance: 6 vertices, no vertex buffer.
+        draw_args[0] = 6
+        draw_args[1] = 0
+        draw_args[2] = 0
+        draw_args[3] = 0
+
+
+@ti.kernel
+def cull_particles(pos: ti.any_arr(field_dim=1), frustum: ti.any_arr(field_dim=1), draw_args: ti.any_arr(field_dim=1), visible: ti.any_arr(field_dim=1)):
+    for i in pos:
+        inside = True
+        for k in ti.static(range(6)):
+            plane = frustum[k]
+            if plane.x * pos[i].x + plane.y * pos[i].y + plane.z * pos[i].z + plane.w < -particle_radius:
+                inside = False
+        if inside:
+            visible[ti.atomic_add(draw_args[1], 1)] = i
+
+
 @ti.kernel
 def copy_data_from_ndarray_to_field(src: ti.template(), dst: ti.any_arr()):
     for I in ti.grouped(src):
@@ -212,22 +609,114 @@ if __name__ == "__main__":
 
 
         g_init_builder = ti.graph.GraphBuilder()
-        g_init_builder.dispatch(initialize_particle, sym_pos, sym_spawn_box, sym_N, sym_gravity)
+        g_init_builder.dispatch(initialize_particle, sym_pos, sym_vel, sym_spawn_box, sym_N, sym_gravity)
 
-        g_update_builder = ti.graph.GraphBuilder()
-        substep = g_update_builder.create_sequential()
+        # Every update graph also comes in an `_sdf` flavor that collides
+        # particles with the SDF texture instead of the boundary box.
+        sym_sdf = ti.graph.Arg(ti.graph.ArgKind.TEXTURE, 'sdf', channel_format=ti.f32, shape=(sdf_res, sdf_res, sdf_res), num_channels=1)
 
-        substep.dispatch(update_density, sym_pos, sym_den, sym_pre)
-        substep.dispatch(update_force, sym_pos, sym_vel, sym_den, sym_pre, sym_acc, sym_gravity)
-        substep.dispatch(advance, sym_pos, sym_vel, sym_acc)
-        substep.dispatch(boundary_handle, sym_pos, sym_vel, sym_boundary_box)
+        def dispatch_boundary(seq, sdf):
+            if sdf:
+                seq.dispatch(boundary_handle_sdf, sym_pos, sym_vel, sym_sdf)
+            else:
+                seq.dispatch(boundary_handle, sym_pos, sym_vel, sym_boundary_box)
+
+        def build_update(sdf):
+            g_update_builder = ti.graph.GraphBuilder()
+            substep = g_update_builder.create_sequential()
+
+            substep.dispatch(update_density, sym_pos, sym_den, sym_pre)
+            substep.dispatch(update_force, sym_pos, sym_vel, sym_den, sym_pre, sym_acc, sym_gravity)
+            substep.dispatch(advance, sym_pos, sym_vel, sym_acc)
+            dispatch_boundary(substep, sdf)
 
-        for i in range(substeps):
-            g_update_builder.append(substep)
+            for i in range(substeps):
+                g_update_builder.append(substep)
+            return g_update_builder
+
+        # Neighbor-list variant
+        sym_neighbors = ti.graph.Arg(ti.graph.ArgKind.NDARRAY, 'neighbors', ti.i32, field_dim=1, element_shape=())
+        sym_neighbor_count = ti.graph.Arg(ti.graph.ArgKind.NDARRAY, 'neighbor_count', ti.i32, field_dim=1, element_shape=())
+        sym_pos_at_build = ti.graph.Arg(ti.graph.ArgKind.NDARRAY, 'pos_at_build', ti.f32, field_dim=1, element_shape=(3, ))
+        sym_cell_count = ti.graph.Arg(ti.graph.ArgKind.NDARRAY, 'cell_count', ti.i32, field_dim=1, element_shape=())
+        sym_cell_offset = ti.graph.Arg(ti.graph.ArgKind.NDARRAY, 'cell_offset', ti.i32, field_dim=1, element_shape=())
+        sym_cell_cursor = ti.graph.Arg(ti.graph.ArgKind.NDARRAY, 'cell_cursor', ti.i32, field_dim=1, element_shape=())
+        sym_cell_block_sums = ti.graph.Arg(ti.graph.ArgKind.NDARRAY, 'cell_block_sums', ti.i32, field_dim=1, element_shape=())
+        sym_sorted_ids = ti.graph.Arg(ti.graph.ArgKind.NDARRAY, 'sorted_ids', ti.i32, field_dim=1, element_shape=())
+        sym_nlist_state = ti.graph.Arg(ti.graph.ArgKind.NDARRAY, 'nlist_state', ti.f32, field_dim=1, element_shape=())
+
+        g_init_nlist_builder = ti.graph.GraphBuilder()
+        g_init_nlist_builder.dispatch(initialize_particle, sym_pos, sym_vel, sym_spawn_box, sym_N, sym_gravity)
+        g_init_nlist_builder.dispatch(init_neighbor_lists, sym_pos_at_build, sym_cell_count, sym_nlist_state)
+
+        def build_update_nlist(sdf):
+            g_update_nlist_builder = ti.graph.GraphBuilder()
+            substep_nlist = g_update_nlist_builder.create_sequential()
+
+            substep_nlist.dispatch(begin_substep_nlist, sym_nlist_state)
+            substep_nlist.dispatch(measure_displacement, sym_pos, sym_pos_at_build, sym_nlist_state)
+            substep_nlist.dispatch(count_cells, sym_pos, sym_cell_count, sym_nlist_state)
+            dispatch_scan_cells(substep_nlist, sym_cell_count, sym_cell_offset, sym_cell_cursor, sym_cell_block_sums, sym_nlist_state)
+            substep_nlist.dispatch(scatter_cells, sym_pos, sym_cell_cursor, sym_sorted_ids, sym_nlist_state)
+            substep_nlist.dispatch(build_neighbor_lists, sym_pos, sym_cell_offset, sym_sorted_ids, sym_neighbors, sym_neighbor_count, sym_pos_at_build, sym_nlist_state)
+            substep_nlist.dispatch(update_density_nlist, sym_pos, sym_den, sym_pre, sym_neighbors, sym_neighbor_count)
+            substep_nlist.dispatch(update_force_nlist, sym_pos, sym_vel, sym_den, sym_pre, sym_acc, sym_gravity, sym_neighbors, sym_neighbor_count)
+            substep_nlist.dispatch(advance, sym_pos, sym_vel, sym_acc)
+            dispatch_boundary(substep_nlist, sdf)
+
+            for i in range(substeps):
+                g_update_nlist_builder.append(substep_nlist)
+            return g_update_nlist_builder
+
+        # PCISPH variant, initialized by init_nlist
+        sym_acc_p = ti.graph.Arg(ti.graph.ArgKind.NDARRAY, 'acc_p', ti.f32, field_dim=1, element_shape=(3, ))
+        sym_pos_pred = ti.graph.Arg(ti.graph.ArgKind.NDARRAY, 'pos_pred', ti.f32, field_dim=1, element_shape=(3, ))
+
+        def build_update_pcisph(sdf):
+            g_update_pcisph_builder = ti.graph.GraphBuilder()
+            substep_pcisph = g_update_pcisph_builder.create_sequential()
+
+            substep_pcisph.dispatch(begin_substep_nlist, sym_nlist_state)
+            substep_pcisph.dispatch(measure_displacement, sym_pos, sym_pos_at_build, sym_nlist_state)
+            substep_pcisph.dispatch(count_cells, sym_pos, sym_cell_count, sym_nlist_state)
+            dispatch_scan_cells(substep_pcisph, sym_cell_count, sym_cell_offset, sym_cell_cursor, sym_cell_block_sums, sym_nlist_state)
+            substep_pcisph.dispatch(scatter_cells, sym_pos, sym_cell_cursor, sym_sorted_ids, sym_nlist_state)
+            substep_pcisph.dispatch(build_neighbor_lists, sym_pos, sym_cell_offset, sym_sorted_ids, sym_neighbors, sym_neighbor_count, sym_pos_at_build, sym_nlist_state)
+            substep_pcisph.dispatch(update_density_nlist, sym_pos, sym_den, sym_pre, sym_neighbors, sym_neighbor_count)
+            substep_pcisph.dispatch(pcisph_non_pressure, sym_pos, sym_vel, sym_den, sym_pre, sym_acc, sym_acc_p, sym_gravity, sym_neighbors, sym_neighbor_count)
+            for i in range(pcisph_iterations):
+                if sdf:
+                    substep_pcisph.dispatch(pcisph_predict_sdf, sym_pos, sym_vel, sym_acc, sym_acc_p, sym_pos_pred, sym_sdf)
+                else:
+                    substep_pcisph.dispatch(pcisph_predict, sym_pos, sym_vel, sym_acc, sym_acc_p, sym_pos_pred, sym_boundary_box)
+                substep_pcisph.dispatch(pcisph_correct_pressure, sym_pos_pred, sym_den, sym_pre, sym_neighbors, sym_neighbor_count)
+                substep_pcisph.dispatch(pcisph_pressure_acc, sym_pos_pred, sym_pre, sym_acc_p, sym_neighbors, sym_neighbor_count)
+            substep_pcisph.dispatch(advance_pcisph, sym_pos, sym_vel, sym_acc, sym_acc_p)
+            dispatch_boundary(substep_pcisph, sdf)
+
+            for i in range(pcisph_substeps):
+                g_update_pcisph_builder.append(substep_pcisph)
+            return g_update_pcisph_builder
+
+        # Impostor culling
+        sym_frustum = ti.graph.Arg(ti.graph.ArgKind.NDARRAY, 'frustum', ti.f32, field_dim=1, element_shape=(4, ))
+        sym_draw_args = ti.graph.Arg(ti.graph.ArgKind.NDARRAY, 'draw_args', ti.i32, field_dim=1, element_shape=())
+        sym_visible = ti.graph.Arg(ti.graph.ArgKind.NDARRAY, 'visible', ti.i32, field_dim=1, element_shape=())
+
+        g_cull_builder = ti.graph.GraphBuilder()
+        g_cull_builder.dispatch(reset_draw_args, sym_draw_args)
+        g_cull_builder.dispatch(cull_particles, sym_pos, sym_frustum, sym_draw_args, sym_visible)
 
         # Compile
         g_init = g_init_builder.compile()
-        g_update = g_update_builder.compile()
+        g_update = build_update(False).compile()
+        g_update_sdf = build_update(True).compile()
+        g_init_nlist = g_init_nlist_builder.compile()
+        g_update_nlist = build_update_nlist(False).compile()
+        g_update_nlist_sdf = build_update_nlist(True).compile()
+        g_update_pcisph = build_update_pcisph(False).compile()
+        g_update_pcisph_sdf = build_update_pcisph(True).compile()
+        g_cull = g_cull_builder.compile()
 
         # Serialize!
         with tempfile.TemporaryDirectory() as tmpdir:
@@ -235,10 +724,18 @@ if __name__ == "__main__":
             mod = ti.aot.Module(ti.vulkan)
             mod.add_graph('init', g_init)
             mod.add_graph('update', g_update)
+            mod.add_graph('init_nlist', g_init_nlist)
+            mod.add_graph('update_nlist', g_update_nlist)
+            mod.add_graph('update_pcisph', g_update_pcisph)
+            mod.add_graph('update_sdf', g_update_sdf)
+            mod.add_graph('update_nlist_sdf', g_update_nlist_sdf)
+            mod.add_graph('update_pcisph_sdf', g_update_pcisph_sdf)
+            mod.add_graph('cull', g_cull)
             mod.save(tmpdir, '')
+            write_sdf(tmpdir + '/boundary.sdf')
 
         # Run
-        g_init.run({'pos': pos, 'spawn_box': spawn_box, 'N': N, 'gravity': gravity})
+        g_init.run({'pos': pos, 'vel': vel, 'spawn_box': spawn_box, 'N': N, 'gravity': gravity})
         while window.running:
 
             g_update.run({
@@ -264,7 +761,7 @@ if __name__ == "__main__":
 
     else:
 
-        initialize_particle(pos, spawn_box, N, gravity)
+        initialize_particle(pos, vel, spawn_box, N, gravity)
 
         while window.running:
 
@@ -1,6 +1,12 @@
 #include <signal.h>
 #include <iostream>
+#include <algorithm>
 #include <chrono>
+#include <cmath>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include <taichi/runtime/program_impls/vulkan/vulkan_program.h>
 #include <taichi/rhi/vulkan/vulkan_common.h>
@@ -12,8 +18,22 @@
 #include <taichi/gui/gui.h>
 #include <taichi/ui/backends/vulkan/renderer.h>
 
+#include "async_loader.hpp"
+#include "benchmark_sweep.hpp"
+#include "device_arena.hpp"
+#include "format_features.hpp"
+#include "graph_args.hpp"
+#include "ndarray_and_mem.hpp"
+#include "offscreen.hpp"
+#include "pipeline_cache.hpp"
+#include "resolution_controller.hpp"
+
+// Window size, and the default simulation grid.
 #define NX 512
 #define NY 1024
+// Impulse slots per frame, MAX_SPLATS in stable_fluid_graph.py; each is
+// [dir.x, dir.y, x, y, r, g, b, active].
+#define MAX_SPLATS 16
 void get_data(
     taichi::lang::gfx::GfxRuntime *vulkan_runtime,
     taichi::lang::DeviceAllocation &alloc,
@@ -41,16 +61,191 @@ float randn() {
   return static_cast<float>(rand()) / static_cast<float>(RAND_MAX);
 }
 
+// Average time in ms of one pressure projection (divergence, Jacobi solve
+// and gradient subtraction) by `graph` on an nx x ny grid, over `num_runs`
+// runs.
+double TimeProjection(taichi::lang::gfx::GfxRuntime *vulkan_runtime,
+                      taichi::lang::aot::CompiledGraph &graph, int nx, int ny,
+                      int num_runs) {
+    using demo::NdarrayAndMem;
+    using taichi::lang::PrimitiveType;
+    auto *device = vulkan_runtime->get_ti_device();
+    auto v = NdarrayAndMem::Make(device, PrimitiveType::f32, {nx, ny}, {2},
+                                 /*host_read=*/false, /*host_write=*/true);
+    auto v_div = NdarrayAndMem::Make(device, PrimitiveType::f32, {nx, ny});
+    auto pressure = NdarrayAndMem::Make(device, PrimitiveType::f32, {nx, ny}, {},
+                                        /*host_read=*/false, /*host_write=*/true);
+    auto new_pressure = NdarrayAndMem::Make(device, PrimitiveType::f32, {nx, ny});
+
+    // A smooth swirl, so the solve works on ordinary values.
+    std::vector<float> data(size_t(nx) * ny * 2);
+    for (int i = 0; i < nx; i++) {
+        for (int j = 0; j < ny; j++) {
+            data[2 * (size_t(i) * ny + j)] = std::sin(6.2831853f * j / ny);
+            data[2 * (size_t(i) * ny + j) + 1] = -std::sin(6.2831853f * i / nx);
+        }
+    }
+    set_data(vulkan_runtime, v->devalloc(), data.data(), v->size());
+    std::fill(data.begin(), data.end(), 0.0f);
+    set_data(vulkan_runtime, pressure->devalloc(), data.data(), pressure->size());
+
+    demo::GraphArgs args;
+    args.Bind("velocities_pair_cur", taichi::lang::aot::IValue::create(v->ndarray()));
+    args.Bind("velocity_divs", taichi::lang::aot::IValue::create(v_div->ndarray()));
+    args.Bind("pressures_pair_cur", taichi::lang::aot::IValue::create(pressure->ndarray()));
+    args.Bind("pressures_pair_nxt", taichi::lang::aot::IValue::create(new_pressure->ndarray()));
+    return demo::MillisecondsPerRun(
+        num_runs, [&] { args.Run(graph); },
+        [&] { vulkan_runtime->synchronize(); });
+}
+
+// Grid widths dynamic resolution picks from; grids are always twice as tall
+// as they are wide.
+const int kGridLevels[] = {128, 192, 256, 384, 512, 768, 1024};
+
+// The simulation state at one grid resolution. Every ndarray the step graphs
+// touch is sized by the grid, so a resize builds a whole new FluidGrid, with
+// its own arena, and resamples the latest state into it.
+class FluidGrid {
+public:
+    FluidGrid(taichi::lang::Device *device, int nx, int ny)
+        : nx_(nx), ny_(ny), arena_(device) {
+        using demo::NdarrayAndMem;
+        using taichi::lang::PrimitiveType;
+        v_ = NdarrayAndMem::Make(&arena_, PrimitiveType::f32, {nx, ny}, {2});
+        new_v_ = NdarrayAndMem::Make(&arena_, PrimitiveType::f32, {nx, ny}, {2});
+        v_div_ = NdarrayAndMem::Make(&arena_, PrimitiveType::f32, {nx, ny});
+        pressure_ = NdarrayAndMem::Make(&arena_, PrimitiveType::f32, {nx, ny});
+        new_pressure_ = NdarrayAndMem::Make(&arena_, PrimitiveType::f32, {nx, ny});
+        dye_ = NdarrayAndMem::Make(&arena_, PrimitiveType::f32, {nx, ny}, {3});
+        new_dye_ = NdarrayAndMem::Make(&arena_, PrimitiveType::f32, {nx, ny}, {3});
+        dye_image_ = NdarrayAndMem::Make(&arena_, PrimitiveType::f32, {nx, ny}, {4});
+    }
+
+    // Binds the grid arguments of the step graphs, replacing the previous
+    // grid's.
+    void Bind(demo::GraphArgs &args) const {
+        using taichi::lang::aot::IValue;
+        args.Bind("velocities_pair_cur", IValue::create(v_->ndarray()));
+        args.Bind("velocities_pair_nxt", IValue::create(new_v_->ndarray()));
+        args.Bind("dyes_pair_cur", IValue::create(dye_->ndarray()));
+        args.Bind("dyes_pair_nxt", IValue::create(new_dye_->ndarray()));
+        args.Bind("pressures_pair_cur", IValue::create(pressure_->ndarray()));
+        args.Bind("pressures_pair_nxt", IValue::create(new_pressure_->ndarray()));
+        args.Bind("velocity_divs", IValue::create(v_div_->ndarray()));
+        args.Bind("dye_image", IValue::create(dye_image_->ndarray()));
+    }
+
+    // Binds the latest state as the source of the resample graph. g1 leaves
+    // the velocities and dyes in the *_nxt arrays, g2 in the *_cur ones; the
+    // pressure always ends up in pressures_pair_cur.
+    void BindAsResampleSource(demo::GraphArgs &args, bool after_g1) const {
+        using taichi::lang::aot::IValue;
+        args.Bind("resample_velocities",
+                  IValue::create((after_g1 ? new_v_ : v_)->ndarray()));
+        args.Bind("resample_dyes",
+                  IValue::create((after_g1 ? new_dye_ : dye_)->ndarray()));
+        args.Bind("resample_pressures", IValue::create(pressure_->ndarray()));
+    }
+
+    int nx() const { return nx_; }
+    int ny() const { return ny_; }
+    demo::DeviceArena &arena() { return arena_; }
+    taichi::lang::DeviceAllocation &dye_image() { return dye_image_->devalloc(); }
+
+private:
+    int nx_;
+    int ny_;
+    demo::DeviceArena arena_;
+    std::unique_ptr<demo::NdarrayAndMem> v_;
+    std::unique_ptr<demo::NdarrayAndMem> new_v_;
+    std::unique_ptr<demo::NdarrayAndMem> v_div_;
+    std::unique_ptr<demo::NdarrayAndMem> pressure_;
+    std::unique_ptr<demo::NdarrayAndMem> new_pressure_;
+    std::unique_ptr<demo::NdarrayAndMem> dye_;
+    std::unique_ptr<demo::NdarrayAndMem> new_dye_;
+    std::unique_ptr<demo::NdarrayAndMem> dye_image_;
+};
+
 #include <unistd.h>
-int main() {
-    // Init gl window
-    glfwInit();
-    glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
-    GLFWwindow* window = glfwCreateWindow(NX, NY, "Taichi show", NULL, NULL);
-    if (window == NULL) {
-        std::cout << "Failed to create GLFW window" << std::endl;
-        glfwTerminate();
-        return -1;
+int main(int argc, char **argv) {
+    demo::MillisecondsSinceStartup();
+    demo::AsyncModuleLoader::DefaultMode() =
+        demo::ParsePipelineLoadMode(argc, argv);
+    auto offscreen_options = demo::OffscreenOptions::Parse(argc, argv);
+    // `--splats <k>` drives the fluid with k random emitters per frame
+    // instead of one, through the *_splats graphs. `--texture-advection` keeps velocity and dye in
+    // textures and advects them with hardware bilinear sampling;
+    // `--compare-advection [--steps <n>]` times both ways without
+    // rendering and exits. `--tiled-projection` runs the projection with the
+    // shared-memory stencil kernels; `--compare-projection [--steps <n>]`
+    // times both projections at 512x1024 and 2048x4096 and exits.
+    // `--grid <nx>` simulates on an nx x 2nx grid, whatever the window size.
+    // `--dynamic-resolution [--target-ms <t>]` resizes the grid to hold the
+    // simulation time per frame near t ms; `--trace-resolution <frames>`
+    // does so headless under a varying load and prints the frame times.
+    int num_splats = 1;
+    bool splats = false;
+    int grid_nx = NX;
+    bool dynamic_resolution = false;
+    double target_ms = 8.0;
+    int trace_frames = 0;
+    bool texture_advection = false;
+    bool compare_advection = false;
+    bool tiled_projection = false;
+    bool compare_projection = false;
+    int steps = 100;
+    for (int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        if (arg == "--texture-advection") {
+            texture_advection = true;
+        } else if (arg == "--compare-advection") {
+            compare_advection = true;
+        } else if (arg == "--tiled-projection") {
+            tiled_projection = true;
+        } else if (arg == "--compare-projection") {
+            compare_projection = true;
+        } else if (i + 1 < argc && arg == "--splats") {
+            num_splats = std::max(1, std::min(std::stoi(argv[++i]), MAX_SPLATS));
+            splats = true;
+        } else if (i + 1 < argc && arg == "--steps") {
+            steps = std::stoi(argv[++i]);
+        } else if (i + 1 < argc && arg == "--grid") {
+            grid_nx = std::stoi(argv[++i]);
+        } else if (arg == "--dynamic-resolution") {
+            dynamic_resolution = true;
+        } else if (i + 1 < argc && arg == "--target-ms") {
+            target_ms = std::stod(argv[++i]);
+        } else if (i + 1 < argc && arg == "--trace-resolution") {
+            trace_frames = std::stoi(argv[++i]);
+            dynamic_resolution = true;
+        }
+    }
+    if (grid_nx < 16) {
+        TI_ERROR("Grid width must be at least 16");
+    }
+    if (compare_advection) {
+        // g_tex applies the impulses as splats, so the ndarray side of the
+        // comparison has to as well.
+        splats = true;
+    }
+    if (dynamic_resolution && (texture_advection || compare_advection)) {
+        // The textures carry the state between frames and would need
+        // resampling too.
+        TI_ERROR("Dynamic resolution and texture advection cannot be combined");
+    }
+
+    // Init gl window, unless rendering offscreen.
+    GLFWwindow* window = nullptr;
+    if (!offscreen_options.enabled) {
+        glfwInit();
+        glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
+        window = glfwCreateWindow(NX, NY, "Taichi show", NULL, NULL);
+        if (window == NULL) {
+            std::cout << "Failed to create GLFW window" << std::endl;
+            glfwTerminate();
+            return -1;
+        }
     }
 
     // Create a GGUI configuration
@@ -73,6 +268,21 @@ int main() {
     result_buffer = (taichi::uint64 *)memory_pool->allocate(sizeof(taichi::uint64) * taichi_result_buffer_entries, 8);
     // Create Taichi Device for computation
     taichi::lang::vulkan::VulkanDevice *device_ = &(renderer->app_context().device());
+    // g_tex samples velocity and dye through a linear filter, which Vulkan
+    // does not require rg32f and rgba32f to support. The graphs are compiled
+    // for those formats, so there is no narrower texture to fall back to.
+    if ((texture_advection || compare_advection) &&
+        !(demo::HasLinearFilter(device_, VK_FORMAT_R32G32_SFLOAT) &&
+          demo::HasLinearFilter(device_, VK_FORMAT_R32G32B32A32_SFLOAT))) {
+        if (compare_advection) {
+            TI_ERROR("The device cannot linearly filter rg32f and rgba32f "
+                     "textures, so texture advection cannot run");
+        }
+        std::cout << "[stable_fluid] device cannot linearly filter rg32f and "
+                     "rgba32f textures, advecting the ndarrays instead"
+                  << std::endl;
+        texture_advection = false;
+    }
     // Create Vulkan runtime
     taichi::lang::gfx::GfxRuntime::Params params;
     params.host_result_buffer = result_buffer;
@@ -83,59 +293,108 @@ int main() {
 
     // Retrieve kernels/fields/etc from AOT module so we can initialize our
     // runtime
+    const auto load_begin = std::chrono::steady_clock::now();
     taichi::lang::gfx::AotModuleParams mod_params;
     mod_params.module_path = "../shaders/";
     mod_params.runtime = vulkan_runtime.get();
+    // Kept alive for the whole run so the renderer's lazily created
+    // pipelines land in the cache too.
+    demo::PipelineCacheStore pipeline_cache(device_, mod_params.module_path);
+    pipeline_cache.Install();
     std::unique_ptr<taichi::lang::aot::Module> module = taichi::lang::aot::Module::load(taichi::Arch::vulkan, mod_params);
 
     auto root_size = module->get_root_size();
     printf("root buffer size=%ld\n", root_size);
     vulkan_runtime->add_root_buffer(root_size);
 
-    auto g1= module->get_graph("g1");
-    auto g2 = module->get_graph("g2");
+    // Compile the graphs in the background while the ndarrays are set up.
+    // The checked-in module only has the plain g1 and g2; every other graph
+    // needs the module regenerated.
+    demo::AsyncModuleLoader loader;
+    auto load_graph = [&](std::string name) {
+        return loader.Load([&module, name] {
+            auto graph = module->get_graph(name);
+            if (!graph) {
+                TI_ERROR("Graph {} is not in the AOT module; regenerate it "
+                         "with `python3 stable_fluid_graph.py`", name);
+            }
+            return graph;
+        });
+    };
+    const std::string step_suffix = std::string(tiled_projection ? "_tiled" : "") +
+                                    (splats ? "_splats" : "");
+    auto g1 = load_graph("g1" + step_suffix);
+    auto g2 = load_graph("g2" + step_suffix);
+    demo::Lazy<std::unique_ptr<taichi::lang::aot::CompiledGraph>>
+        g_bench_projection, g_bench_projection_tiled;
+    if (compare_projection) {
+        g_bench_projection = load_graph("bench_projection");
+        g_bench_projection_tiled = load_graph("bench_projection_tiled");
+    }
+    demo::Lazy<std::unique_ptr<taichi::lang::aot::CompiledGraph>> g_init_tex, g_tex;
+    if (texture_advection || compare_advection) {
+        g_init_tex = load_graph("init_tex");
+        g_tex = load_graph("g_tex");
+    }
+    demo::Lazy<std::unique_ptr<taichi::lang::aot::CompiledGraph>> g_resample;
+    if (dynamic_resolution) {
+        g_resample = load_graph("resample");
+    }
 
 
-    // Prepare Ndarray for model
+    // Prepare Ndarray for model. With dynamic resolution the grid starts at
+    // the largest level that fits the requested width.
+    int level = 0;
+    while (level + 1 < int(std::size(kGridLevels)) &&
+           kGridLevels[level + 1] <= grid_nx) {
+        level++;
+    }
+    if (dynamic_resolution) {
+        grid_nx = kGridLevels[level];
+    }
+    // The device is no more thread safe than the module, so everything
+    // created on it from here to the render setup waits for the pipeline the
+    // loader's worker is creating.
+    auto device_lock = loader.Lock();
+    const auto alloc_begin = std::chrono::steady_clock::now();
+    auto grid = std::make_unique<FluidGrid>(device_, grid_nx, 2 * grid_nx);
+    grid->arena().Report("stable_fluid", demo::MillisecondsSince(alloc_begin));
+
+    // Written every frame through the arena's scratch space, so it can stay
+    // in device-local memory.
+    demo::DeviceArena arena(device_);
     taichi::lang::Device::AllocParams alloc_params;
     alloc_params.host_write = false;
     alloc_params.host_read = false;
     alloc_params.usage = taichi::lang::AllocUsage::Storage;
-    alloc_params.size = NX * NY * 2 * sizeof(float);
-
-    taichi::lang::DeviceAllocation devalloc_v = device_->allocate_memory(alloc_params);
-    auto v = taichi::lang::Ndarray(devalloc_v, taichi::lang::PrimitiveType::f32, {NX, NY}, {2});
-
-    taichi::lang::DeviceAllocation devalloc_new_v = device_->allocate_memory(alloc_params);
-    auto new_v = taichi::lang::Ndarray(devalloc_new_v, taichi::lang::PrimitiveType::f32, {NX, NY}, {2});
-
-    alloc_params.size = NX * NY * sizeof(float);
-    taichi::lang::DeviceAllocation devalloc_v_div = device_->allocate_memory(alloc_params);
-    auto v_div = taichi::lang::Ndarray(devalloc_v_div, taichi::lang::PrimitiveType::f32, {NX, NY});
-
-    alloc_params.size = NX * NY * sizeof(float);
-    taichi::lang::DeviceAllocation devalloc_pressure = device_->allocate_memory(alloc_params);
-    auto pressure = taichi::lang::Ndarray(devalloc_pressure, taichi::lang::PrimitiveType::f32, {NX, NY});
-
-    taichi::lang::DeviceAllocation devalloc_new_pressure = device_->allocate_memory(alloc_params);
-    auto new_pressure = taichi::lang::Ndarray(devalloc_new_pressure, taichi::lang::PrimitiveType::f32, {NX, NY});
-
-    alloc_params.size = NX * NY * 3 * sizeof(float);
-    taichi::lang::DeviceAllocation devalloc_dye = device_->allocate_memory(alloc_params);
-    auto dye = taichi::lang::Ndarray(devalloc_dye, taichi::lang::PrimitiveType::f32, {NX, NY}, {3});
-
-    taichi::lang::DeviceAllocation devalloc_new_dye = device_->allocate_memory(alloc_params);
-    auto new_dye = taichi::lang::Ndarray(devalloc_new_dye, taichi::lang::PrimitiveType::f32, {NX, NY}, {3});
-
-    alloc_params.host_write = true;
     alloc_params.size = 8 * sizeof(float);
-    taichi::lang::DeviceAllocation devalloc_mouse_data = device_->allocate_memory(alloc_params);
+    taichi::lang::DeviceAllocation devalloc_mouse_data = arena.Allocate(alloc_params);
     auto mouse_data = taichi::lang::Ndarray(devalloc_mouse_data, taichi::lang::PrimitiveType::f32, {8});
-
-    alloc_params.host_write = false;
-    alloc_params.size = NX * NY * 4 * sizeof(float);
-    taichi::lang::DeviceAllocation devalloc_dye_image = device_->allocate_memory(alloc_params);
-    auto dye_image = taichi::lang::Ndarray(devalloc_dye_image, taichi::lang::PrimitiveType::f32, {NX, NY}, {4});
+    alloc_params.size = MAX_SPLATS * 8 * sizeof(float);
+    taichi::lang::DeviceAllocation devalloc_impulses = arena.Allocate(alloc_params);
+    auto impulses = taichi::lang::Ndarray(devalloc_impulses, taichi::lang::PrimitiveType::f32, {MAX_SPLATS}, {8});
+
+    // Velocity (rg32f) and dye (rgba32f, as there are no 3-channel
+    // textures) for texture advection.
+    std::vector<taichi::lang::DeviceAllocation> tex_images;
+    std::unique_ptr<taichi::lang::Texture> velocity_tex, dye_tex;
+    if (texture_advection || compare_advection) {
+        auto make_texture = [&](taichi::lang::BufferFormat format, int num_channels) {
+            taichi::lang::ImageParams img_params;
+            img_params.dimension = taichi::lang::ImageDimension::d2D;
+            img_params.format = format;
+            img_params.x = grid->nx();
+            img_params.y = grid->ny();
+            img_params.z = 1;
+            img_params.initial_layout = taichi::lang::ImageLayout::undefined;
+            tex_images.push_back(device_->create_image(img_params));
+            return std::make_unique<taichi::lang::Texture>(
+                tex_images.back(), taichi::lang::PrimitiveType::f32,
+                num_channels, grid->nx(), grid->ny());
+        };
+        velocity_tex = make_texture(taichi::lang::BufferFormat::rg32f, 2);
+        dye_tex = make_texture(taichi::lang::BufferFormat::rgba32f, 4);
+    }
 
     // For debugging
     //float arr[NR_PARTICLES * 2];
@@ -150,75 +409,208 @@ int main() {
     f_info.field_type   = taichi::ui::FieldType::Scalar;
     f_info.matrix_rows  = 1;
     f_info.matrix_cols  = 1;
-    f_info.shape        = {NX, NY};
+    f_info.shape        = {grid->nx(), grid->ny()};
     f_info.field_source = taichi::ui::FieldSource::TaichiVulkan;
     f_info.dtype        = taichi::lang::PrimitiveType::f32;
     f_info.snode        = nullptr;
-    f_info.dev_alloc    = devalloc_dye_image;
+    f_info.dev_alloc    = grid->dye_image();
 
     taichi::ui::SetImageInfo set_image_info;
     set_image_info.img = f_info;
 
     renderer->set_background_color({0.6, 0.6, 0.6});
 
-    std::unordered_map<std::string, taichi::lang::aot::IValue> args;
-    args.insert({"mouse_data", taichi::lang::aot::IValue::create(mouse_data)});
-    args.insert({"velocities_pair_cur", taichi::lang::aot::IValue::create(v)});
-    args.insert({"velocities_pair_nxt", taichi::lang::aot::IValue::create(new_v)});
-    args.insert({"dyes_pair_cur", taichi::lang::aot::IValue::create(dye)});
-    args.insert({"dyes_pair_nxt", taichi::lang::aot::IValue::create(new_dye)});
-    args.insert({"pressures_pair_cur", taichi::lang::aot::IValue::create(pressure)});
-    args.insert({"pressures_pair_nxt", taichi::lang::aot::IValue::create(new_pressure)});
-    args.insert({"velocity_divs", taichi::lang::aot::IValue::create(v_div)});
-    args.insert({"dye_image", taichi::lang::aot::IValue::create(dye_image)});
+    std::unique_ptr<demo::OffscreenCapture> offscreen;
+    if (offscreen_options.enabled) {
+        offscreen = std::make_unique<demo::OffscreenCapture>(
+            device_, app_config.width, app_config.height, offscreen_options);
+    }
 
-    bool swap = true;
+    // Bound once for both graphs, and again only when the grid is resized;
+    // the frame loop just runs them.
+    demo::GraphArgs args;
+    args.Bind("mouse_data", taichi::lang::aot::IValue::create(mouse_data));
+    args.Bind("impulses", taichi::lang::aot::IValue::create(impulses));
+    // apply_splats launches over this many slots only.
+    args.Bind("num_splats",
+              taichi::lang::aot::IValue::create<int32_t>(num_splats));
+    grid->Bind(args);
+    if (velocity_tex) {
+        args.Bind("velocity_tex", taichi::lang::aot::IValue::create(*velocity_tex));
+        args.Bind("velocity_rw_tex", taichi::lang::aot::IValue::create(*velocity_tex));
+        args.Bind("dye_tex", taichi::lang::aot::IValue::create(*dye_tex));
+        args.Bind("dye_rw_tex", taichi::lang::aot::IValue::create(*dye_tex));
+    }
+
+    // Launching is not safe while the worker is still registering graphs.
+    device_lock.unlock();
+    loader.Wait();
+    pipeline_cache.Report(
+        "stable_fluid", demo::MillisecondsSince(load_begin),
+        loader.mode() == demo::PipelineLoadMode::kOnFirstUse);
 
-    while (!glfwWindowShouldClose(window)) {
+    bool swap = true;
+    // Uploads this frame's impulses and runs one simulation step, leaving the
+    // dye in dye_image.
+    auto step = [&](bool use_textures) {
         // Generate user inputs location randomly
         // Directions and colors are hardcoded here.
-        float x_pos = randn() * NX;
-        float y_pos = randn() * NY;
-        float direction_x = randn();
-        float direction_y = randn();
-        direction_x = direction_x / sqrt(direction_x * direction_x + direction_y * direction_y);
-        direction_y = direction_y / sqrt(direction_x * direction_x + direction_y * direction_y);
-        float r = randn();
-        float g = randn();
-        float b = randn();
-
-        float pos_data[8] = {direction_x, direction_y, x_pos, y_pos, r, g, b, 0.0};
-        set_data(vulkan_runtime.get(), devalloc_mouse_data, (void*)pos_data, 8*sizeof(float));
-
-        if (swap) {
-            g1->run(args);
+        float impulse_data[MAX_SPLATS * 8] = {};
+        for (int k = 0; k < num_splats; k++) {
+            float x_pos = randn() * grid->nx();
+            float y_pos = randn() * grid->ny();
+            float direction_x = randn();
+            float direction_y = randn();
+            direction_x = direction_x / sqrt(direction_x * direction_x + direction_y * direction_y);
+            direction_y = direction_y / sqrt(direction_x * direction_x + direction_y * direction_y);
+            float r = randn();
+            float g = randn();
+            float b = randn();
+
+            const float splat[8] = {direction_x, direction_y, x_pos, y_pos, r, g, b, 1.0};
+            std::memcpy(impulse_data + 8 * k, splat, sizeof(splat));
+        }
+        // The slots in use go up in one copy, submitted ahead of the graph
+        // on the compute stream; the scratch is recycled once the frame has
+        // synchronized. The plain graphs take only the first impulse.
+        if (use_textures || splats) {
+            arena.Upload(devalloc_impulses, impulse_data,
+                         num_splats * 8 * sizeof(float));
+        } else {
+            arena.Upload(devalloc_mouse_data, impulse_data, 8 * sizeof(float));
+        }
+        arena.Flush(/*wait=*/false);
+
+        if (use_textures) {
+            args.Run(*g_tex.get());
+        } else if (swap) {
+            args.Run(*g1.get());
             swap = false;
         } else {
-            g2->run(args);
+            args.Run(*g2.get());
             swap = true;
         }
 
         vulkan_runtime->synchronize();
+        arena.ResetScratch();
+    };
+
+    // Moves the simulation to an nx x 2nx grid, carrying the latest state
+    // over, and points the renderer at the new dye image.
+    auto resize = [&](int nx) {
+        const auto begin = std::chrono::steady_clock::now();
+        auto new_grid = std::make_unique<FluidGrid>(device_, nx, 2 * nx);
+        grid->BindAsResampleSource(args, /*after_g1=*/!swap);
+        new_grid->Bind(args);
+        args.Run(*g_resample.get());
+        vulkan_runtime->synchronize();
+        printf("[resolution] %dx%d -> %dx%d in %.1f ms\n", grid->nx(),
+               grid->ny(), new_grid->nx(), new_grid->ny(),
+               demo::MillisecondsSince(begin));
+        grid = std::move(new_grid);
+        // The resampled state is in the *_cur arrays, which g1 reads.
+        swap = true;
+        f_info.shape = {grid->nx(), grid->ny()};
+        f_info.dev_alloc = grid->dye_image();
+        set_image_info.img = f_info;
+    };
+    std::vector<double> level_costs;
+    for (int nx : kGridLevels) {
+        level_costs.push_back(double(nx) * 2 * nx);
+    }
+    demo::ResolutionController controller(level_costs, level, target_ms);
+
+    if (velocity_tex) {
+        args.Run(*g_init_tex.get());
+    }
+    if (compare_advection) {
+        printf("advection, ms/frame\n");
+        for (bool use_textures : {false, true}) {
+            printf("%s, %.3f\n", use_textures ? "texture" : "ndarray",
+                   demo::MillisecondsPerRun(steps,
+                                            [&] { step(use_textures); }));
+        }
+    }
+
+    if (compare_projection) {
+        printf("grid, projection ms, tiled projection ms\n");
+        for (auto [nx, ny] : {std::pair<int, int>{512, 1024}, {2048, 4096}}) {
+            printf("%dx%d, %.3f, %.3f\n", nx, ny,
+                   TimeProjection(vulkan_runtime.get(), *g_bench_projection.get(),
+                                  nx, ny, steps),
+                   TimeProjection(vulkan_runtime.get(),
+                                  *g_bench_projection_tiled.get(), nx, ny, steps));
+        }
+    }
+
+    if (trace_frames > 0) {
+        // Simulation steps per frame in each quarter of the trace, standing
+        // in for a device that gets busier and then recovers.
+        const int kLoad[] = {1, 2, 4, 1};
+        printf("frame, load, grid, frame ms, target ms\n");
+        int on_target = 0;
+        for (int frame = 0; frame < trace_frames; frame++) {
+            const int load = kLoad[4 * frame / trace_frames];
+            const auto begin = std::chrono::steady_clock::now();
+            for (int i = 0; i < load; i++) {
+                step(false);
+            }
+            const double frame_ms = demo::MillisecondsSince(begin);
+            printf("%d, %d, %dx%d, %.3f, %.3f\n", frame, load, grid->nx(),
+                   grid->ny(), frame_ms, target_ms);
+            if (std::abs(frame_ms - target_ms) <= 0.1 * target_ms) {
+                on_target++;
+            }
+            if (controller.Update(frame_ms)) {
+                resize(kGridLevels[controller.level()]);
+            }
+        }
+        printf("frames within 10%% of target: %.1f%%\n",
+               100.0 * on_target / trace_frames);
+    }
+
+    for (int frame = 0;
+         !compare_advection && !compare_projection && trace_frames == 0 &&
+         (offscreen ? frame < offscreen_options.num_frames
+                    : !glfwWindowShouldClose(window));
+         frame++) {
+        const auto step_begin = std::chrono::steady_clock::now();
+        step(texture_advection);
+        // Only the simulation counts; presenting is paced by vsync.
+        if (dynamic_resolution &&
+            controller.Update(demo::MillisecondsSince(step_begin))) {
+            resize(kGridLevels[controller.level()]);
+        }
 
         // Render elements
         renderer->set_image(set_image_info);
         renderer->draw_frame(gui.get());
+        if (offscreen) {
+            offscreen->Capture(renderer->swap_chain().surface());
+        }
         renderer->swap_chain().surface().present_image();
         renderer->prepare_for_next_frame();
+        if (frame == 0) {
+            printf("[startup] first frame after %.1f ms (pipelines: %s)\n",
+                   demo::MillisecondsSinceStartup(),
+                   demo::PipelineLoadModeName(loader.mode()));
+        }
 
-        glfwSwapBuffers(window);
-        glfwPollEvents();
+        if (!offscreen) {
+            glfwSwapBuffers(window);
+            glfwPollEvents();
+        }
     }
+    offscreen.reset();
+    args.Report("stable_fluid");
 
-    device_->dealloc_memory(devalloc_v);
-    device_->dealloc_memory(devalloc_new_v);
-    device_->dealloc_memory(devalloc_v_div);
-    device_->dealloc_memory(devalloc_pressure);
-    device_->dealloc_memory(devalloc_new_pressure);
-    device_->dealloc_memory(devalloc_dye);
-    device_->dealloc_memory(devalloc_new_dye);
-    device_->dealloc_memory(devalloc_mouse_data);
-    device_->dealloc_memory(devalloc_dye_image);
+    velocity_tex.reset();
+    dye_tex.reset();
+    for (auto &image : tex_images) {
+        device_->destroy_image(image);
+    }
+    grid.reset();
+    arena.Release();
 
     vulkan_runtime.reset();
     renderer->cleanup();
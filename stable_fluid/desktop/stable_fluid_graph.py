@@ -23,6 +23,9 @@ maxfps = 60
 dye_decay = 1 - 1 / (maxfps * time_c)
 gravity = True
 paused = False
+# Impulses per frame, each [dir.x, dir.y, x, y, r, g, b, active]. A splat
+# only touches the cells within splat_radius() of its center.
+MAX_SPLATS = 16
 
 
 class TexPair:
@@ -114,6 +117,54 @@ def apply_impulse(vf: ti.types.ndarray(field_dim=2),
         dyef[i, j] = dc
 
 
+@ti.kernel
+def advect_velocity(vf: ti.types.ndarray(field_dim=2),
+                    dyef: ti.types.ndarray(field_dim=2),
+                    new_vf: ti.types.ndarray(field_dim=2)):
+    # advect(vf, vf, new_vf) plus the dye buoyancy apply_impulse adds over
+    # the whole grid, taken from the advected dye at the same point, so the
+    # impulse pass only has to visit the splats.
+    g_dir = -ti.Vector([0, 9.8]) * 300
+    for i, j in vf:
+        p = ti.Vector([i, j]) + 0.5
+        p = backtrace(vf, p, dt)
+        a = (bilerp(dyef, p) * dye_decay).norm()
+        new_vf[i, j] = bilerp(vf, p) * dye_decay + g_dir * a / (1 + a) * dt
+
+
+@ti.func
+def splat_radius(nx):
+    # Where both of a splat's gaussians (see apply_impulse) have fallen below
+    # 1e-3 of their peak: 45 cells at NX = 512. The dye's width grows with
+    # the grid, the velocity's with its square root.
+    return int(ti.max(ti.sqrt(3.46 * nx), 1.32 * nx / 15)) + 1
+
+
+@ti.kernel
+def apply_splats(vf: ti.types.ndarray(field_dim=2),
+                 dyef: ti.types.ndarray(field_dim=2),
+                 impulses: ti.types.ndarray(field_dim=1), num_splats: ti.i32):
+    # One thread per splat and cell of its neighbourhood, for the first
+    # num_splats slots only, so the launch scales with the splats in use
+    # rather than MAX_SPLATS; slots marked inactive still return at once.
+    # Overlapping splats accumulate atomically.
+    NX = vf.shape[0]
+    NY = vf.shape[1]
+    r = splat_radius(NX)
+    for s, u, w in ti.ndrange(num_splats, 2 * r, 2 * r):
+        imp = impulses[s]
+        i = int(imp[2]) - r + u
+        j = int(imp[3]) - r + w
+        if imp[7] > 0 and i >= 0 and i < NX and j >= 0 and j < NY:
+            mdir = ti.Vector([imp[0], imp[1]])
+            dx, dy = (i + 0.5 - imp[2]), (j + 0.5 - imp[3])
+            d2 = dx * dx + dy * dy
+            vf[i, j] += mdir * f_strength * ti.exp(-d2 / NX * 2) * dt
+            if mdir.norm() > 0.5:
+                dyef[i, j] += ti.exp(-d2 * (4 / (NX / 15)**2)) * ti.Vector(
+                    [imp[4], imp[5], imp[6]])
+
+
 @ti.kernel
 def divergence(vf: ti.types.ndarray(field_dim=2),
                velocity_divs: ti.types.ndarray(field_dim=2)):
@@ -160,6 +211,136 @@ def subtract_gradient(vf: ti.types.ndarray(field_dim=2),
         vf[i, j] -= 0.5 * ti.Vector([pr - pl, pt - pb])
 
 
+# Tiled variants of the projection stencils. One TILE x TILE workgroup per
+# tile stages the tile and its halo in shared memory, clamped the way
+# `sample` clamps, so each global value is loaded once per tile instead of
+# once per neighbour. The thread for local cell (a, b) is k = a * TILE + b,
+# keeping j, the contiguous axis, fastest. Results are identical to the
+# untiled kernels.
+TILE = 16
+TILE_THREADS = TILE * TILE
+# Jacobi sweeps per pressure_jacobi_tiled launch. Each sweep consumes one
+# halo cell per side, so the tile loads a JACOBI_SWEEPS wide halo and
+# updates a shrinking region until only the tile itself is left.
+JACOBI_SWEEPS = 4
+JACOBI_HALO = TILE + 2 * JACOBI_SWEEPS
+
+
+@ti.kernel
+def divergence_tiled(vf: ti.types.ndarray(field_dim=2),
+                     velocity_divs: ti.types.ndarray(field_dim=2)):
+    NX = vf.shape[0]
+    NY = vf.shape[1]
+    tiles_y = (NY + TILE - 1) // TILE
+    n_tiles = (NX + TILE - 1) // TILE * tiles_y
+    ti.loop_config(block_dim=TILE_THREADS)
+    for t, k in ti.ndrange(n_tiles, TILE_THREADS):
+        halo = ti.simt.block.SharedArray((TILE + 2, TILE + 2, 2), ti.f32)
+        origin = ti.Vector([t // tiles_y, t % tiles_y]) * TILE - 1
+        n = k
+        while n < (TILE + 2)**2:
+            a, b = n // (TILE + 2), n % (TILE + 2)
+            v = sample(vf, origin.x + a, origin.y + b)
+            halo[a, b, 0] = v.x
+            halo[a, b, 1] = v.y
+            n += TILE_THREADS
+        ti.simt.block.sync()
+
+        a, b = k // TILE + 1, k % TILE + 1
+        i, j = origin.x + a, origin.y + b
+        if i < NX and j < NY:
+            vl = halo[a - 1, b, 0]
+            vr = halo[a + 1, b, 0]
+            vb = halo[a, b - 1, 1]
+            vt = halo[a, b + 1, 1]
+            if i == 0:
+                vl = -halo[a, b, 0]
+            if i == NX - 1:
+                vr = -halo[a, b, 0]
+            if j == 0:
+                vb = -halo[a, b, 1]
+            if j == NY - 1:
+                vt = -halo[a, b, 1]
+            velocity_divs[i, j] = (vr - vl + vt - vb) * 0.5
+
+
+@ti.kernel
+def pressure_jacobi_tiled(pf: ti.types.ndarray(field_dim=2),
+                          new_pf: ti.types.ndarray(field_dim=2),
+                          velocity_divs: ti.types.ndarray(field_dim=2)):
+    # JACOBI_SWEEPS iterations of pressure_jacobi, ping-ponging between the
+    # two layers of `p` in shared memory; only the last one is written back.
+    # Neighbours are clamped to the domain in global coordinates, like
+    # `sample`, so cells outside it are never read and need no values.
+    NX = pf.shape[0]
+    NY = pf.shape[1]
+    tiles_y = (NY + TILE - 1) // TILE
+    n_tiles = (NX + TILE - 1) // TILE * tiles_y
+    ti.loop_config(block_dim=TILE_THREADS)
+    for t, k in ti.ndrange(n_tiles, TILE_THREADS):
+        p = ti.simt.block.SharedArray((2, JACOBI_HALO, JACOBI_HALO), ti.f32)
+        div = ti.simt.block.SharedArray((JACOBI_HALO, JACOBI_HALO), ti.f32)
+        origin = ti.Vector([t // tiles_y, t % tiles_y]) * TILE - JACOBI_SWEEPS
+        n = k
+        while n < JACOBI_HALO**2:
+            a, b = n // JACOBI_HALO, n % JACOBI_HALO
+            i, j = origin.x + a, origin.y + b
+            if 0 <= i < NX and 0 <= j < NY:
+                p[0, a, b] = pf[i, j]
+                div[a, b] = velocity_divs[i, j]
+            n += TILE_THREADS
+        ti.simt.block.sync()
+
+        for s in ti.static(range(JACOBI_SWEEPS)):
+            # Sweep s is valid on [s + 1, JACOBI_HALO - s - 1) per axis,
+            # which only reads cells sweep s - 1 left valid.
+            width = JACOBI_HALO - 2 * (s + 1)
+            n = k
+            while n < width * width:
+                a, b = s + 1 + n // width, s + 1 + n % width
+                i, j = origin.x + a, origin.y + b
+                if 0 <= i < NX and 0 <= j < NY:
+                    al = ti.max(i - 1, 0) - origin.x
+                    ar = ti.min(i + 1, NX - 1) - origin.x
+                    bb = ti.max(j - 1, 0) - origin.y
+                    bt = ti.min(j + 1, NY - 1) - origin.y
+                    p[(s + 1) % 2, a, b] = (p[s % 2, al, b] + p[s % 2, ar, b] +
+                                            p[s % 2, a, bb] + p[s % 2, a, bt] -
+                                            div[a, b]) * 0.25
+                n += TILE_THREADS
+            ti.simt.block.sync()
+
+        a, b = k // TILE + JACOBI_SWEEPS, k % TILE + JACOBI_SWEEPS
+        i, j = origin.x + a, origin.y + b
+        if i < NX and j < NY:
+            new_pf[i, j] = p[JACOBI_SWEEPS % 2, a, b]
+
+
+@ti.kernel
+def subtract_gradient_tiled(vf: ti.types.ndarray(field_dim=2),
+                            pf: ti.types.ndarray(field_dim=2)):
+    NX = vf.shape[0]
+    NY = vf.shape[1]
+    tiles_y = (NY + TILE - 1) // TILE
+    n_tiles = (NX + TILE - 1) // TILE * tiles_y
+    ti.loop_config(block_dim=TILE_THREADS)
+    for t, k in ti.ndrange(n_tiles, TILE_THREADS):
+        halo = ti.simt.block.SharedArray((TILE + 2, TILE + 2), ti.f32)
+        origin = ti.Vector([t // tiles_y, t % tiles_y]) * TILE - 1
+        n = k
+        while n < (TILE + 2)**2:
+            a, b = n // (TILE + 2), n % (TILE + 2)
+            halo[a, b] = sample(pf, origin.x + a, origin.y + b)
+            n += TILE_THREADS
+        ti.simt.block.sync()
+
+        a, b = k // TILE + 1, k % TILE + 1
+        i, j = origin.x + a, origin.y + b
+        if i < NX and j < NY:
+            vf[i, j] -= 0.5 * ti.Vector([halo[a + 1, b] - halo[a - 1, b],
+                                         halo[a, b + 1] - halo[a, b - 1]])
+
+
 def solve_pressure_jacobi():
     for _ in range(p_jacobi_iters):
         pressure_jacobi(pressures_pair.cur, pressures_pair.nxt, _velocity_divs)
@@ -229,6 +410,121 @@ def dye_to_image(df: ti.types.ndarray(field_dim=2), di: ti.types.ndarray(field_d
         di[i, j] = ti.Vector([r, g, b, 1.0])
 
 
+# Texture advection: velocity and dye persist between frames in textures, and
+# the backtrace samples them with the hardware bilinear filter instead of
+# bilerp's four clamped loads per sample. Texel centers sit at (i + 0.5) / N
+# like bilerp's, and uv is kept half a texel inside the edge so every
+# sampler address mode clamps the way `sample` does. Advection writes the
+# usual ndarrays, which the rest of the step works on; subtract_gradient and
+# dye_to_image store the results back into the textures for the next frame.
+@ti.func
+def tex_sample(tf: ti.template(), p, res):
+    uv = ti.max(ti.min(p / res, 1.0 - 0.5 / res), 0.5 / res)
+    return tf.sample_lod(uv, 0.0)
+
+
+@ti.func
+def backtrace_tex(vt: ti.template(), p, res, dt: ti.template()):
+    v1 = tex_sample(vt, p, res).xy
+    p1 = p - 0.5 * dt * v1
+    v2 = tex_sample(vt, p1, res).xy
+    p2 = p - 0.75 * dt * v2
+    v3 = tex_sample(vt, p2, res).xy
+    p -= dt * ((2 / 9) * v1 + (1 / 3) * v2 + (4 / 9) * v3)
+    return p
+
+
+@ti.kernel
+def clear_textures(vf: ti.types.ndarray(field_dim=2),
+                   vt: ti.types.rw_texture(num_dimensions=2,
+                                          num_channels=2,
+                                          channel_format=ti.f32,
+                                          lod=0),
+                   dyet: ti.types.rw_texture(num_dimensions=2,
+                                             num_channels=4,
+                                             channel_format=ti.f32,
+                                             lod=0)):
+    # vf only provides the grid size.
+    for i, j in vf:
+        vt.store(ti.Vector([i, j]), ti.Vector([0.0, 0.0, 0.0, 0.0]))
+        dyet.store(ti.Vector([i, j]), ti.Vector([0.0, 0.0, 0.0, 0.0]))
+
+
+@ti.kernel
+def advect_velocity_tex(vt: ti.types.texture(num_dimensions=2),
+                        dyet: ti.types.texture(num_dimensions=2),
+                        new_vf: ti.types.ndarray(field_dim=2)):
+    # advect_velocity, sampling the textures.
+    g_dir = -ti.Vector([0, 9.8]) * 300
+    res = ti.Vector([new_vf.shape[0], new_vf.shape[1]])
+    for i, j in new_vf:
+        p = ti.Vector([i, j]) + 0.5
+        p = backtrace_tex(vt, p, res, dt)
+        a = (tex_sample(dyet, p, res).xyz * dye_decay).norm()
+        new_vf[i, j] = tex_sample(vt, p, res).xy * dye_decay + g_dir * a / (
+            1 + a) * dt
+
+
+@ti.kernel
+def advect_dye_tex(vt: ti.types.texture(num_dimensions=2),
+                   dyet: ti.types.texture(num_dimensions=2),
+                   new_dyef: ti.types.ndarray(field_dim=2)):
+    res = ti.Vector([new_dyef.shape[0], new_dyef.shape[1]])
+    for i, j in new_dyef:
+        p = ti.Vector([i, j]) + 0.5
+        p = backtrace_tex(vt, p, res, dt)
+        new_dyef[i, j] = tex_sample(dyet, p, res).xyz * dye_decay
+
+
+@ti.kernel
+def subtract_gradient_tex(vf: ti.types.ndarray(field_dim=2),
+                          pf: ti.types.ndarray(field_dim=2),
+                          vt: ti.types.rw_texture(num_dimensions=2,
+                                                  num_channels=2,
+                                                  channel_format=ti.f32,
+                                                  lod=0)):
+    for i, j in vf:
+        pl = sample(pf, i - 1, j)
+        pr = sample(pf, i + 1, j)
+        pb = sample(pf, i, j - 1)
+        pt = sample(pf, i, j + 1)
+        v = vf[i, j] - 0.5 * ti.Vector([pr - pl, pt - pb])
+        vt.store(ti.Vector([i, j]), ti.Vector([v.x, v.y, 0.0, 0.0]))
+
+
+@ti.kernel
+def dye_to_image_tex(df: ti.types.ndarray(field_dim=2),
+                     di: ti.types.ndarray(field_dim=2),
+                     dyet: ti.types.rw_texture(num_dimensions=2,
+                                               num_channels=4,
+                                               channel_format=ti.f32,
+                                               lod=0)):
+    for i, j in df:
+        c = ti.Vector([df[i, j][0], df[i, j][1], df[i, j][2], 1.0])
+        di[i, j] = c
+        dyet.store(ti.Vector([i, j]), c)
+
+
+@ti.kernel
+def resample_state(vf: ti.types.ndarray(field_dim=2),
+                   dyef: ti.types.ndarray(field_dim=2),
+                   pf: ti.types.ndarray(field_dim=2),
+                   new_vf: ti.types.ndarray(field_dim=2),
+                   new_dyef: ti.types.ndarray(field_dim=2),
+                   new_pf: ti.types.ndarray(field_dim=2)):
+    # Bilinearly resamples the state carried between frames onto a grid of
+    # another size. Velocities are in cells per unit time, so they scale
+    # with the grid; the pressure, which the next solve starts from, scales
+    # with the Laplacian, i.e. with the square of the grid.
+    scale = ti.Vector([new_vf.shape[0] / vf.shape[0],
+                       new_vf.shape[1] / vf.shape[1]])
+    for i, j in new_vf:
+        p = (ti.Vector([i, j]) + 0.5) / scale
+        new_vf[i, j] = bilerp(vf, p) * scale
+        new_dyef[i, j] = bilerp(dyef, p)
+        new_pf[i, j] = bilerp(pf, p) * scale.x * scale.y
+
+
 @ti.kernel
 def copy_image_ndarray_to_u8(src: ti.types.ndarray(field_dim=2),
                              dst: ti.template(),
@@ -299,49 +595,150 @@ if __name__ == "__main__":
                                      ti.f32, field_dim=2)
         mouse_data = ti.graph.Arg(ti.graph.ArgKind.NDARRAY, 'mouse_data',
                                   ti.f32, field_dim=1)
+        impulses = ti.graph.Arg(ti.graph.ArgKind.NDARRAY,
+                                'impulses',
+                                ti.f32,
+                                field_dim=1,
+                                element_shape=(8, ))
         dye_image = ti.graph.Arg(ti.graph.ArgKind.NDARRAY, 'dye_image', ti.f32, field_dim=2, element_shape=(4, ))
-
-        g1_builder = ti.graph.GraphBuilder()
-        g1_builder.dispatch(advect, velocities_pair_cur, velocities_pair_cur,
-                            velocities_pair_nxt)
-        g1_builder.dispatch(advect, velocities_pair_cur, dyes_pair_cur,
-                            dyes_pair_nxt)
-        g1_builder.dispatch(apply_impulse, velocities_pair_nxt, dyes_pair_nxt,
-                            mouse_data)
-        g1_builder.dispatch(divergence, velocities_pair_nxt, velocity_divs)
-        # swap is unrolled in the loop so we only need p_jacobi_iters // 2 iterations.
-        for _ in range(p_jacobi_iters // 2):
-            g1_builder.dispatch(pressure_jacobi, pressures_pair_cur,
-                                pressures_pair_nxt, velocity_divs)
-            g1_builder.dispatch(pressure_jacobi, pressures_pair_nxt,
-                                pressures_pair_cur, velocity_divs)
-        g1_builder.dispatch(subtract_gradient, velocities_pair_nxt,
-                            pressures_pair_cur)
-        g1_builder.dispatch(dye_to_image, dyes_pair_cur, dye_image)
-        g1 = g1_builder.compile()
-
-        g2_builder = ti.graph.GraphBuilder()
-        g2_builder.dispatch(advect, velocities_pair_nxt, velocities_pair_nxt,
-                            velocities_pair_cur)
-        g2_builder.dispatch(advect, velocities_pair_nxt, dyes_pair_nxt,
-                            dyes_pair_cur)
-        g2_builder.dispatch(apply_impulse, velocities_pair_cur, dyes_pair_cur,
-                            mouse_data)
-        g2_builder.dispatch(divergence, velocities_pair_cur, velocity_divs)
+        num_splats = ti.graph.Arg(ti.graph.ArgKind.SCALAR, 'num_splats',
+                                  ti.i32)
+
+        def dispatch_projection(builder, vf, tiled):
+            # Makes vf divergence free, leaving the pressure in
+            # pressures_pair_cur. The swap is unrolled, so each dispatch
+            # pair below is two sweeps (2 * JACOBI_SWEEPS tiled), and the
+            # untiled kernel makes up any remainder.
+            builder.dispatch(divergence_tiled if tiled else divergence, vf,
+                             velocity_divs)
+            pairs = p_jacobi_iters // 2
+            if tiled:
+                for _ in range(p_jacobi_iters // (2 * JACOBI_SWEEPS)):
+                    builder.dispatch(pressure_jacobi_tiled, pressures_pair_cur,
+                                     pressures_pair_nxt, velocity_divs)
+                    builder.dispatch(pressure_jacobi_tiled, pressures_pair_nxt,
+                                     pressures_pair_cur, velocity_divs)
+                pairs = p_jacobi_iters % (2 * JACOBI_SWEEPS) // 2
+            for _ in range(pairs):
+                builder.dispatch(pressure_jacobi, pressures_pair_cur,
+                                 pressures_pair_nxt, velocity_divs)
+                builder.dispatch(pressure_jacobi, pressures_pair_nxt,
+                                 pressures_pair_cur, velocity_divs)
+            builder.dispatch(subtract_gradient_tiled if tiled else
+                             subtract_gradient, vf, pressures_pair_cur)
+
+        def build_step(velocities, dyes, new_velocities, new_dyes, tiled,
+                       splats):
+            # One frame from (velocities, dyes) into (new_velocities,
+            # new_dyes); g2 is g1 with the pairs the other way round. Plain
+            # g1/g2 keep the single full-grid mouse_data impulse the
+            # checked-in module was built with; the *_splats graphs take the
+            # MAX_SPLATS impulse batch.
+            builder = ti.graph.GraphBuilder()
+            if splats:
+                builder.dispatch(advect_velocity, velocities, dyes,
+                                 new_velocities)
+            else:
+                builder.dispatch(advect, velocities, velocities,
+                                 new_velocities)
+            builder.dispatch(advect, velocities, dyes, new_dyes)
+            if splats:
+                builder.dispatch(apply_splats, new_velocities, new_dyes,
+                                 impulses, num_splats)
+            else:
+                builder.dispatch(apply_impulse, new_velocities, new_dyes,
+                                 mouse_data)
+            dispatch_projection(builder, new_velocities, tiled)
+            builder.dispatch(dye_to_image, dyes, dye_image)
+            return builder.compile()
+
+        step_graphs = {}
+        for tiled in (False, True):
+            for splats in (False, True):
+                suffix = ('_tiled' if tiled else '') + ('_splats'
+                                                        if splats else '')
+                step_graphs['g1' + suffix] = build_step(
+                    velocities_pair_cur, dyes_pair_cur, velocities_pair_nxt,
+                    dyes_pair_nxt, tiled, splats)
+                step_graphs['g2' + suffix] = build_step(
+                    velocities_pair_nxt, dyes_pair_nxt, velocities_pair_cur,
+                    dyes_pair_cur, tiled, splats)
+        g1 = step_graphs['g1']
+        g2 = step_graphs['g2']
+
+        # The projection alone, for timing the two stencil variants on
+        # grids of any size.
+        def build_bench_projection(tiled):
+            builder = ti.graph.GraphBuilder()
+            dispatch_projection(builder, velocities_pair_cur, tiled)
+            return builder.compile()
+
+        # Texture advection variant; one graph, since the state carried
+        # between frames lives in the textures.
+        def tex_arg(name, kind, num_channels):
+            return ti.graph.Arg(kind,
+                                name,
+                                channel_format=ti.f32,
+                                shape=(NX, NY),
+                                num_channels=num_channels)
+
+        velocity_tex = tex_arg('velocity_tex', ti.graph.ArgKind.TEXTURE, 2)
+        velocity_rw_tex = tex_arg('velocity_rw_tex',
+                                  ti.graph.ArgKind.RWTEXTURE, 2)
+        dye_tex = tex_arg('dye_tex', ti.graph.ArgKind.TEXTURE, 4)
+        dye_rw_tex = tex_arg('dye_rw_tex', ti.graph.ArgKind.RWTEXTURE, 4)
+
+        g_init_tex_builder = ti.graph.GraphBuilder()
+        g_init_tex_builder.dispatch(clear_textures, velocities_pair_cur,
+                                    velocity_rw_tex, dye_rw_tex)
+        g_init_tex = g_init_tex_builder.compile()
+
+        g_tex_builder = ti.graph.GraphBuilder()
+        g_tex_builder.dispatch(advect_velocity_tex, velocity_tex, dye_tex,
+                               velocities_pair_cur)
+        g_tex_builder.dispatch(advect_dye_tex, velocity_tex, dye_tex,
+                               dyes_pair_cur)
+        g_tex_builder.dispatch(apply_splats, velocities_pair_cur,
+                               dyes_pair_cur, impulses, num_splats)
+        g_tex_builder.dispatch(divergence, velocities_pair_cur, velocity_divs)
         for _ in range(p_jacobi_iters // 2):
-            g2_builder.dispatch(pressure_jacobi, pressures_pair_cur,
-                                pressures_pair_nxt, velocity_divs)
-            g2_builder.dispatch(pressure_jacobi, pressures_pair_nxt,
-                                pressures_pair_cur, velocity_divs)
-        g2_builder.dispatch(subtract_gradient, velocities_pair_cur,
-                            pressures_pair_cur)
-        g2_builder.dispatch(dye_to_image, dyes_pair_nxt, dye_image)
-        g2 = g2_builder.compile()
+            g_tex_builder.dispatch(pressure_jacobi, pressures_pair_cur,
+                                   pressures_pair_nxt, velocity_divs)
+            g_tex_builder.dispatch(pressure_jacobi, pressures_pair_nxt,
+                                   pressures_pair_cur, velocity_divs)
+        g_tex_builder.dispatch(subtract_gradient_tex, velocities_pair_cur,
+                               pressures_pair_cur, velocity_rw_tex)
+        g_tex_builder.dispatch(dye_to_image_tex, dyes_pair_cur, dye_image,
+                               dye_rw_tex)
+        g_tex = g_tex_builder.compile()
+
+        # Grid resizes: the resample_* arguments are the old grid's latest
+        # state, the *_pair_cur ones the new grid's.
+        def state_arg(name, element_shape):
+            return ti.graph.Arg(ti.graph.ArgKind.NDARRAY,
+                                name,
+                                ti.f32,
+                                field_dim=2,
+                                element_shape=element_shape)
+
+        g_resample_builder = ti.graph.GraphBuilder()
+        g_resample_builder.dispatch(resample_state,
+                                    state_arg('resample_velocities', (2, )),
+                                    state_arg('resample_dyes', (3, )),
+                                    state_arg('resample_pressures', ()),
+                                    velocities_pair_cur, dyes_pair_cur,
+                                    pressures_pair_cur)
+        g_resample = g_resample_builder.compile()
 
         tmpdir = 'shaders'
         mod = ti.aot.Module(ti.vulkan)
-        mod.add_graph('g1', g1)
-        mod.add_graph('g2', g2)
+        for name, graph in step_graphs.items():
+            mod.add_graph(name, graph)
+        mod.add_graph('bench_projection', build_bench_projection(False))
+        mod.add_graph('bench_projection_tiled', build_bench_projection(True))
+        mod.add_graph('init_tex', g_init_tex)
+        mod.add_graph('resample', g_resample)
+        mod.add_graph('g_tex', g_tex)
         mod.save(tmpdir, '')
         exit(0)
 
@@ -12,6 +12,12 @@
 #include <taichi/runtime/program_impls/vulkan/vulkan_program.h>
 #include <unistd.h>
 
+#include "async_loader.hpp"
+#include "graph_args.hpp"
+#include "ndarray_and_mem.hpp"
+#include "pipeline_cache.hpp"
+#include "startup_profiler.hpp"
+
 namespace demo {
 
 namespace{
@@ -48,23 +54,44 @@ std::vector<T> ReadDataToHost(taichi::lang::DeviceAllocation &alloc,
 class TextureDemoImpl {
 public:
   TextureDemoImpl(taichi::lang::vulkan::VulkanDevice *device) : device_(device) {
+    ProfileScope init_phase("TextureDemoImpl");
+    ProfileScope runtime_phase("runtime");
     InitTaichiRuntime(device_);
+    runtime_phase.End();
 
+    ProfileScope module_phase("module load");
+    const auto load_begin = std::chrono::steady_clock::now();
     taichi::lang::gfx::AotModuleParams mod_params;
     mod_params.module_path = "../shaders/";
     mod_params.runtime = vulkan_runtime.get();
+    pipeline_cache_ =
+        std::make_unique<PipelineCacheStore>(device_, mod_params.module_path);
+    pipeline_cache_->Install();
     module = taichi::lang::aot::Module::load(taichi::Arch::vulkan, mod_params);
 
     auto root_size = module->get_root_size();
     vulkan_runtime->add_root_buffer(root_size);
-
-    // load graph
-    g_update_ = module->get_graph("g");
-    g_init_ = module->get_graph("g_init");
+    module_phase.End();
+
+    // load graph, in the background while the texture is set up
+    loader_ = std::make_unique<AsyncModuleLoader>();
+    g_init_ = loader_->Load([this] {
+      ProfileScope phase("get_graph g_init");
+      return module->get_graph("g_init");
+    });
+    g_update_ = loader_->Load([this] {
+      ProfileScope phase("get_graph g");
+      return module->get_graph("g");
+    });
 
     const std::vector<int> vec4_shape = {4};
 
-    pixels_ = NdarrayAndMem::Make(device_, taichi::lang::PrimitiveType::f32, {kX, kY}, vec4_shape);
+    ProfileScope alloc_phase("allocate ndarray + texture");
+    // The device is no more thread safe than the module, so allocations wait
+    // for the pipeline the loader's worker is creating.
+    auto device_lock = loader_->Lock();
+    arena_ = std::make_unique<DeviceArena>(device_);
+    pixels_ = NdarrayAndMem::Make(arena_.get(), taichi::lang::PrimitiveType::f32, {kX, kY}, vec4_shape);
 
     taichi::lang::ImageParams img_params;
     img_params.dimension = taichi::lang::ImageDimension::d2D;
@@ -78,12 +105,25 @@ public:
     tex_ = std::make_unique<taichi::lang::Texture>(devalloc_tex,
         taichi::lang::PrimitiveType::f32, /*num_channels=*/1,
         kTextureWidth, kTextureHeight);
-
-    args_.insert({"pixels_arr", taichi::lang::aot::IValue::create(pixels_->ndarray())});
-    args_.insert({"tex", taichi::lang::aot::IValue::create(*tex_)});
-    args_.insert({"rw_tex", taichi::lang::aot::IValue::create(*tex_)});
-    args_.insert({"t", taichi::lang::aot::IValue::create<float>(t_)});
-    Reset();
+    device_lock.unlock();
+    alloc_phase.End();
+
+    args_.Bind("pixels_arr", taichi::lang::aot::IValue::create(pixels_->ndarray()));
+    args_.Bind("tex", taichi::lang::aot::IValue::create(*tex_));
+    args_.Bind("rw_tex", taichi::lang::aot::IValue::create(*tex_));
+    t_slot_ = args_.Bind("t", taichi::lang::aot::IValue::create<float>(t_));
+    {
+      ProfileScope reset_phase("init graph", [this] {
+        vulkan_runtime->synchronize();
+      });
+      Reset();
+    }
+    {
+      ProfileScope wait_phase("wait for pipelines");
+      loader_->Wait();
+    }
+    pipeline_cache_->Report("texture", MillisecondsSince(load_begin),
+                            loader_->mode() == PipelineLoadMode::kOnFirstUse);
   }
 
   ~TextureDemoImpl() {
@@ -100,76 +140,26 @@ public:
   }
 
   void Reset() {
-    g_init_->run(args_);
+    // g may still be compiling on the loader's worker.
+    g_init_.get();
+    auto lock = loader_->Lock();
+    args_.Run(*g_init_.get());
     vulkan_runtime->synchronize();
     // debugPixel();
   }
 
   void Step() {
     t_ += 0.03;
-    args_.at("t") = taichi::lang::aot::IValue::create<float>(t_);
-    g_update_->run(args_);
-    //vulkan_runtime->synchronize();
+    args_.SetScalar<float>(t_slot_, t_);
+    args_.Run(*g_update_.get());
+    // Hand the paint work to the queue without waiting for it; the frame
+    // pacer bounds how far ahead of the GPU this can run.
+    vulkan_runtime->flush();
     //debugPixel();
   }
 
   const taichi::lang::DeviceAllocation &pixels() { return pixels_->devalloc(); }
 private:
-  class NdarrayAndMem {
-  public:
-    NdarrayAndMem() = default;
-    ~NdarrayAndMem() { device_->dealloc_memory(devalloc_); }
-
-    const taichi::lang::Ndarray &ndarray() const { return *ndarray_; }
-
-    taichi::lang::DeviceAllocation &devalloc() { return devalloc_; }
-
-    static std::unique_ptr<NdarrayAndMem>
-    Make(taichi::lang::Device *device, taichi::lang::DataType dtype,
-         const std::vector<int> &arr_shape,
-         const std::vector<int> &element_shape = {}, bool host_read = false,
-         bool host_write = false) {
-      // TODO: Cannot use data_type_size() until
-      // https://github.com/taichi-dev/taichi/pull/5220.
-      // uint64_t alloc_size = taichi::lang::data_type_size(dtype);
-      uint64_t alloc_size = 1;
-      if (auto *prim = dtype->as<taichi::lang::PrimitiveType>()) {
-        using PT = taichi::lang::PrimitiveType;
-        if (prim == PT::f32 || prim == PT::i32 || prim == PT::u32) {
-          alloc_size = 4;
-        } else {
-          TI_ERROR("Unsupported bit width!");
-          return nullptr;
-        }
-      } else {
-        TI_ERROR("Non primitive type!");
-        return nullptr;
-      }
-      for (int s : arr_shape) {
-        alloc_size *= s;
-      }
-      for (int s : element_shape) {
-        alloc_size *= s;
-      }
-      taichi::lang::Device::AllocParams alloc_params;
-      alloc_params.host_read = host_read;
-      alloc_params.host_write = host_write;
-      alloc_params.size = alloc_size;
-      alloc_params.usage = taichi::lang::AllocUsage::Storage;
-      auto res = std::make_unique<NdarrayAndMem>();
-      res->device_ = device;
-      res->devalloc_ = device->allocate_memory(alloc_params);
-      res->ndarray_ = std::make_unique<taichi::lang::Ndarray>(
-          res->devalloc_, dtype, arr_shape, element_shape);
-      return res;
-    }
-
-  private:
-    taichi::lang::Device *device_{nullptr};
-    std::unique_ptr<taichi::lang::Ndarray> ndarray_{nullptr};
-    taichi::lang::DeviceAllocation devalloc_;
-  };
-
   void InitTaichiRuntime(taichi::lang::vulkan::VulkanDevice *device_) {
     // Create Vulkan runtime
     taichi::lang::gfx::GfxRuntime::Params params;
@@ -188,23 +178,31 @@ private:
 
   std::unique_ptr<taichi::lang::aot::Module> module{nullptr};
   float t_ = 0;
+  std::unique_ptr<DeviceArena> arena_{nullptr};
   std::unique_ptr<NdarrayAndMem> pixels_{nullptr};
   std::unique_ptr<taichi::lang::Texture> tex_{nullptr};
 
-  std::unique_ptr<taichi::lang::aot::CompiledGraph> g_init_{nullptr};
-  std::unique_ptr<taichi::lang::aot::CompiledGraph> g_update_{nullptr};
+  std::unique_ptr<PipelineCacheStore> pipeline_cache_{nullptr};
+  std::unique_ptr<AsyncModuleLoader> loader_{nullptr};
+  Lazy<std::unique_ptr<taichi::lang::aot::CompiledGraph>> g_init_;
+  Lazy<std::unique_ptr<taichi::lang::aot::CompiledGraph>> g_update_;
 
-  std::unordered_map<std::string, taichi::lang::aot::IValue> args_;
+  GraphArgs args_;
+  GraphArgs::Slot t_slot_{0};
 };
 
-TextureDemo::TextureDemo() {
-  // Init gl window
-  glfwInit();
-  glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
-  window = glfwCreateWindow(kX, kY, "Taichi show", NULL, NULL);
-  if (window == NULL) {
-    std::cout << "Failed to create GLFW window" << std::endl;
-    glfwTerminate();
+TextureDemo::TextureDemo(const OffscreenOptions &offscreen,
+                         int frames_in_flight)
+    : offscreen_options_(offscreen) {
+  // Init gl window, unless rendering offscreen.
+  if (!offscreen_options_.enabled) {
+    glfwInit();
+    glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
+    window = glfwCreateWindow(kX, kY, "Taichi show", NULL, NULL);
+    if (window == NULL) {
+      std::cout << "Failed to create GLFW window" << std::endl;
+      glfwTerminate();
+    }
   }
 
   // Create a GGUI configuration
@@ -218,8 +216,10 @@ TextureDemo::TextureDemo() {
   app_config.ti_arch = taichi::Arch::vulkan;
 
   // Create GUI & renderer
+  ProfileScope renderer_phase("renderer init");
   renderer = std::make_unique<taichi::ui::vulkan::Renderer>();
   renderer->init(nullptr, window, app_config);
+  renderer_phase.End();
 
   renderer->set_background_color({0.6, 0.6, 0.6});
 
@@ -231,6 +231,12 @@ TextureDemo::TextureDemo() {
       &(renderer->app_context().device());
 
   impl_ = std::make_unique<TextureDemoImpl>(device_);
+  pacer_ = std::make_unique<FramePacer>(device_, frames_in_flight);
+
+  if (offscreen_options_.enabled) {
+    offscreen_ = std::make_unique<OffscreenCapture>(device_, kX, kY,
+                                                    offscreen_options_);
+  }
 
   // Describe information to render the circle with Vulkan
   f_info.valid = true;
@@ -247,29 +253,57 @@ TextureDemo::TextureDemo() {
 }
 
 void TextureDemo::Step() {
-  while (!glfwWindowShouldClose(window)) {
+  for (int frame = 0;
+       offscreen_ ? frame < offscreen_options_.num_frames
+                  : !glfwWindowShouldClose(window);
+       frame++) {
+    pacer_->BeginFrame();
     impl_->Step();
 
     // Render elements
     renderer->set_image(set_image_info);
     renderer->draw_frame(gui_.get());
+    if (offscreen_) {
+      offscreen_->Capture(renderer->swap_chain().surface());
+    }
     renderer->swap_chain().surface().present_image();
     renderer->prepare_for_next_frame();
+    pacer_->EndFrame();
+    if (frame == 0) {
+      std::printf("[startup] first frame after %.1f ms (pipelines: %s)\n",
+                  MillisecondsSinceStartup(),
+                  PipelineLoadModeName(AsyncModuleLoader::DefaultMode()));
+      StartupProfiler::Get().Finish();
+    }
 
-    glfwSwapBuffers(window);
-    glfwPollEvents();
+    if (!offscreen_) {
+      glfwSwapBuffers(window);
+      glfwPollEvents();
+    }
+  }
+  if (offscreen_) {
+    offscreen_->Finish();
   }
+  pacer_->Report("texture");
 }
 
 TextureDemo::~TextureDemo() {
+    pacer_.reset();
+    offscreen_.reset();
     impl_.reset();
     gui_.reset();
     renderer.reset();
 }
 }
 
-int main() {
-  auto texture_demo = std::make_unique<demo::TextureDemo>();
+int main(int argc, char **argv) {
+  demo::MillisecondsSinceStartup();
+  demo::StartupProfiler::Get().ParseArgs(argc, argv);
+  demo::AsyncModuleLoader::DefaultMode() =
+      demo::ParsePipelineLoadMode(argc, argv);
+  auto offscreen = demo::OffscreenOptions::Parse(argc, argv);
+  auto texture_demo = std::make_unique<demo::TextureDemo>(
+      offscreen, demo::FramePacer::ParseArgs(argc, argv));
   texture_demo->Step();
 
   return 0;
@@ -5,11 +5,15 @@
 #include <taichi/ui/backends/vulkan/renderer.h>
 #include <vector>
 
+#include "frame_pacer.hpp"
+#include "offscreen.hpp"
+
 namespace demo {
 class TextureDemoImpl;
 class TextureDemo {
 public:
-  TextureDemo();
+  explicit TextureDemo(const OffscreenOptions &offscreen = {},
+                       int frames_in_flight = FramePacer::kDefaultFramesInFlight);
   ~TextureDemo();
 
   void Step();
@@ -18,6 +22,9 @@ private:
   std::shared_ptr<taichi::ui::vulkan::Gui> gui_{nullptr};
   std::unique_ptr<taichi::ui::vulkan::Renderer> renderer{nullptr};
   GLFWwindow *window{nullptr};
+  OffscreenOptions offscreen_options_;
+  std::unique_ptr<OffscreenCapture> offscreen_{nullptr};
+  std::unique_ptr<FramePacer> pacer_{nullptr};
   taichi::ui::FieldInfo f_info;
   taichi::ui::SetImageInfo set_image_info;
 };